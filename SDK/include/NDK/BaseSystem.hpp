@@ -84,7 +84,6 @@ namespace Ndk
 			static inline void Uninitialize();
 
 			Nz::Bitset<> m_excludedComponents;
-			mutable Nz::Bitset<> m_filterResult;
 			Nz::Bitset<> m_requiredAnyComponents;
 			Nz::Bitset<> m_requiredComponents;
 			EntityList m_entities;
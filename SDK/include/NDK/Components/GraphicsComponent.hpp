@@ -40,6 +40,8 @@ namespace Ndk
 			inline void Attach(Nz::InstancedRenderableRef renderable, int renderOrder = 0);
 			void Attach(Nz::InstancedRenderableRef renderable, const Nz::Matrix4f& localMatrix, int renderOrder = 0);
 
+			inline bool CanAddToRenderQueueConcurrently() const;
+
 			inline void Clear();
 
 			inline void Detach(const Nz::InstancedRenderable* renderable);
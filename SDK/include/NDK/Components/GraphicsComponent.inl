@@ -55,6 +55,23 @@ namespace Ndk
 		return Attach(std::move(renderable), Nz::Matrix4f::Identity(), renderOrder);
 	}
 
+	/*!
+	* \brief Checks whether this component can be added to a render queue while other components are added to other queues by other threads
+	* \return true if every attached renderable supports it
+	*
+	* \see Nz::InstancedRenderable::CanAddToRenderQueueConcurrently
+	*/
+	inline bool GraphicsComponent::CanAddToRenderQueueConcurrently() const
+	{
+		for (const Renderable& object : m_renderables)
+		{
+			if (!object.renderable->CanAddToRenderQueueConcurrently())
+				return false;
+		}
+
+		return true;
+	}
+
 	/*!
 	* \brief Clears every renderable elements
 	*/
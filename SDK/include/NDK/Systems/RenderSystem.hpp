@@ -9,12 +9,16 @@
 #define NDK_SYSTEMS_RENDERSYSTEM_HPP
 
 #include <Nazara/Graphics/AbstractBackground.hpp>
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
 #include <Nazara/Graphics/CullingList.hpp>
+#include <Nazara/Graphics/DepthRenderQueue.hpp>
 #include <Nazara/Graphics/DepthRenderTechnique.hpp>
 #include <Nazara/Renderer/RenderTexture.hpp>
 #include <NDK/EntityList.hpp>
 #include <NDK/System.hpp>
 #include <NDK/Components/GraphicsComponent.hpp>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace Ndk
@@ -31,6 +35,7 @@ namespace Ndk
 			inline Nz::AbstractRenderTechnique& ChangeRenderTechnique(std::unique_ptr<Nz::AbstractRenderTechnique>&& renderTechnique);
 
 			inline void EnableCulling(bool enable);
+			inline void EnableParallelQueueing(bool enable);
 
 			inline const Nz::BackgroundRef& GetDefaultBackground() const;
 			inline const Nz::Matrix4f& GetCoordinateSystemMatrix() const;
@@ -40,6 +45,7 @@ namespace Ndk
 			inline Nz::AbstractRenderTechnique& GetRenderTechnique() const;
 
 			inline bool IsCullingEnabled() const;
+			inline bool IsParallelQueueingEnabled() const;
 
 			inline void SetDefaultBackground(Nz::BackgroundRef background);
 			inline void SetGlobalForward(const Nz::Vector3f& direction);
@@ -49,6 +55,13 @@ namespace Ndk
 			static SystemIndex systemIndex;
 
 		private:
+			struct ShadowCasterCache;
+
+			void AddDrawablesToRenderQueue(const Nz::Frustumf& frustum, Nz::AbstractRenderQueue* renderQueue);
+			void AddRenderQueueSlices(const GraphicsComponentCullingList::ResultContainer& components, bool partiallyVisible);
+			void DrawShadowCasters(ShadowCasterCache& shadowCasters, const Nz::SceneData& sceneData);
+			void FillRenderQueueSlice(const Nz::Frustumf& frustum, std::size_t sliceIndex);
+
 			inline void InvalidateCoordinateSystem();
 
 			void OnEntityRemoved(Entity* entity) override;
@@ -58,10 +71,31 @@ namespace Ndk
 			void UpdateDynamicReflections();
 			void UpdateDirectionalShadowMaps(const Nz::AbstractViewer& viewer);
 			void UpdatePointSpotShadowMaps();
+			ShadowCasterCache& UpdateShadowCasters(const Entity* light, const Nz::Frustumf& lightVolume);
+
+			struct RenderQueueSlice
+			{
+				const GraphicsComponentCullingList::ResultContainer* components;
+				std::size_t firstComponent;
+				std::size_t lastComponent;
+				bool isConcurrent;
+				bool isPartiallyVisible;
+			};
+
+			struct ShadowCasterCache
+			{
+				GraphicsComponentCullingList casterCulling;
+				Nz::DepthRenderQueue renderQueue;
+				std::size_t visibilityHash = 0;
+				bool isRenderQueueValid = false;
+			};
 
 			std::unique_ptr<Nz::AbstractRenderTechnique> m_renderTechnique;
 			std::vector<GraphicsComponentCullingList::VolumeEntry> m_volumeEntries;
 			std::vector<EntityHandle> m_cameras;
+			std::vector<RenderQueueSlice> m_renderQueueSlices;
+			std::vector<std::unique_ptr<Nz::BasicRenderQueue>> m_sliceRenderQueues;
+			std::unordered_map<EntityId, ShadowCasterCache> m_shadowCasterCaches;
 			EntityList m_drawables;
 			EntityList m_directionalLights;
 			EntityList m_lights;
@@ -76,6 +110,7 @@ namespace Ndk
 			bool m_coordinateSystemInvalidated;
 			bool m_forceRenderQueueInvalidation;
 			bool m_isCullingEnabled;
+			bool m_isParallelQueueingEnabled;
 	};
 }
 
@@ -48,6 +48,21 @@ namespace Ndk
 		m_isCullingEnabled = enable;
 	}
 
+	/*!
+	* \brief Enables/disables parallel render queue construction
+	*
+	* When enabled, visible objects are split in slices added to separate render queues by the task scheduler workers, which are then appended in order to the render technique queue.
+	* This gives the same render queue as a serial construction, and is only used when the render technique queue is a BasicRenderQueue.
+	*
+	* \param enable Whether to enable or disable parallel queueing
+	*
+	* \see IsParallelQueueingEnabled
+	*/
+	inline void RenderSystem::EnableParallelQueueing(bool enable)
+	{
+		m_isParallelQueueingEnabled = enable;
+	}
+
 	/*!
 	* \brief Gets the background used for rendering
 	* \return A reference to the background
@@ -119,6 +134,17 @@ namespace Ndk
 		return m_isCullingEnabled;
 	}
 
+	/*!
+	* \brief Query if parallel render queue construction is enabled (enabled by default)
+	* \return True if parallel queueing is enabled, false otherwise
+	*
+	* \see EnableParallelQueueing
+	*/
+	inline bool RenderSystem::IsParallelQueueingEnabled() const
+	{
+		return m_isParallelQueueingEnabled;
+	}
+
 	/*!
 	* \brief Sets the background used for rendering
 	*
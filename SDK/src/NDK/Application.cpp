@@ -4,6 +4,7 @@
 
 #include <NDK/Application.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <regex>
 
 #ifndef NDK_SERVER
@@ -107,6 +108,8 @@ namespace Ndk
 		if (m_shouldQuit)
 			return false;
 
+		NazaraProfileFrame("Frame");
+
 		m_updateTime = m_updateClock.Restart() / 1'000'000.f;
 
 		for (World& world : m_worlds)
@@ -39,12 +39,10 @@ namespace Ndk
 
 		const Nz::Bitset<>& components = entity->GetComponentBits();
 
-		m_filterResult.PerformsAND(m_requiredComponents, components);
-		if (m_filterResult !=  m_requiredComponents)
+		if (!m_requiredComponents.IsSubsetOf(components))
 			return false; // At least one required component is not available
 
-		m_filterResult.PerformsAND(m_excludedComponents, components);
-		if (m_filterResult.TestAny())
+		if (m_excludedComponents.Intersects(components))
 			return false; // At least one excluded component is available
 
 		// If we have a list of needed components
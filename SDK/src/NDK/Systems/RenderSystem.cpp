@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <NDK/Systems/RenderSystem.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/ColorBackground.hpp>
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
 #include <Nazara/Graphics/SceneData.hpp>
@@ -15,9 +17,18 @@
 #include <NDK/Components/LightComponent.hpp>
 #include <NDK/Components/NodeComponent.hpp>
 #include <NDK/Components/ParticleGroupComponent.hpp>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
 
 namespace Ndk
 {
+	namespace
+	{
+		// Drawables per render queue slice, enough for a slice to outweigh the cost of its task and of its merge
+		constexpr std::size_t RenderQueueSliceSize = 256;
+	}
+
 	/*!
 	* \ingroup NDK
 	* \class Ndk::RenderSystem
@@ -36,7 +47,8 @@ namespace Ndk
 	m_coordinateSystemMatrix(Nz::Matrix4f::Identity()),
 	m_coordinateSystemInvalidated(true),
 	m_forceRenderQueueInvalidation(false),
-	m_isCullingEnabled(true)
+	m_isCullingEnabled(true),
+	m_isParallelQueueingEnabled(true)
 	{
 		ChangeRenderTechnique<Nz::ForwardRenderTechnique>();
 		SetDefaultBackground(Nz::ColorBackground::New());
@@ -44,6 +56,149 @@ namespace Ndk
 		SetMaximumUpdateRate(0.f);  //< We don't want any rate limit
 	}
 
+	/*!
+	* \brief Adds the drawables found visible by the culling list to a render queue
+	*
+	* \param frustum Frustum the culling list was culled with
+	* \param renderQueue Queue to fill
+	*
+	* If parallel queueing is enabled, visible drawables are split in slices of consecutive drawables, filled in separate queues by the task scheduler
+	* and appended in order to the render queue, which gives the same queue as adding drawables one by one.
+	*/
+	void RenderSystem::AddDrawablesToRenderQueue(const Nz::Frustumf& frustum, Nz::AbstractRenderQueue* renderQueue)
+	{
+		const GraphicsComponentCullingList::ResultContainer& fullyVisibleResults = m_drawableCulling.GetFullyVisibleResults();
+		const GraphicsComponentCullingList::ResultContainer& partiallyVisibleResults = m_drawableCulling.GetPartiallyVisibleResults();
+
+		// Slices can only be appended to a BasicRenderQueue, derived queues (like DepthRenderQueue) may filter what is added to them
+		bool parallelQueueing = m_isParallelQueueingEnabled &&
+		                        fullyVisibleResults.size() + partiallyVisibleResults.size() > RenderQueueSliceSize &&
+		                        typeid(*renderQueue) == typeid(Nz::BasicRenderQueue);
+
+		if (!parallelQueueing)
+		{
+			for (const GraphicsComponent* gfxComponent : fullyVisibleResults)
+				gfxComponent->AddToRenderQueue(renderQueue);
+
+			for (const GraphicsComponent* gfxComponent : partiallyVisibleResults)
+				gfxComponent->AddToRenderQueueByCulling(frustum, renderQueue);
+
+			return;
+		}
+
+		NazaraProfileZone("RenderSystem::AddDrawablesToRenderQueue");
+
+		m_renderQueueSlices.clear();
+		AddRenderQueueSlices(fullyVisibleResults, false);
+		AddRenderQueueSlices(partiallyVisibleResults, true);
+
+		std::size_t sliceCount = m_renderQueueSlices.size();
+		NazaraProfileCounter("RenderSystem::RenderQueueSlices", sliceCount);
+
+		while (m_sliceRenderQueues.size() < sliceCount)
+			m_sliceRenderQueues.emplace_back(std::make_unique<Nz::BasicRenderQueue>());
+
+		// Drawables which cannot be added concurrently (such as skeletal models) are added by this thread
+		for (std::size_t i = 0; i < sliceCount; ++i)
+		{
+			if (!m_renderQueueSlices[i].isConcurrent)
+				FillRenderQueueSlice(frustum, i);
+		}
+
+		Nz::ParallelFor(std::size_t(0), sliceCount, std::size_t(1), [&](std::size_t firstSlice, std::size_t lastSlice)
+		{
+			for (std::size_t i = firstSlice; i < lastSlice; ++i)
+			{
+				if (m_renderQueueSlices[i].isConcurrent)
+					FillRenderQueueSlice(frustum, i);
+			}
+		});
+
+		Nz::BasicRenderQueue* basicRenderQueue = static_cast<Nz::BasicRenderQueue*>(renderQueue);
+		for (std::size_t i = 0; i < sliceCount; ++i)
+			basicRenderQueue->Append(*m_sliceRenderQueues[i]);
+	}
+
+	/*!
+	* \brief Splits visible drawables in render queue slices
+	*
+	* \param components Visible drawables, in the order they have to be added to the render queue
+	* \param partiallyVisible Whether the drawables have to be culled per renderable
+	*/
+	void RenderSystem::AddRenderQueueSlices(const GraphicsComponentCullingList::ResultContainer& components, bool partiallyVisible)
+	{
+		std::size_t componentCount = components.size();
+		for (std::size_t i = 0; i < componentCount; ++i)
+		{
+			bool isConcurrent = components[i]->CanAddToRenderQueueConcurrently();
+
+			// Consecutive drawables share their slice until it's full, drawables which cannot be added concurrently share it whatever its size
+			if (!m_renderQueueSlices.empty())
+			{
+				RenderQueueSlice& lastSlice = m_renderQueueSlices.back();
+				if (lastSlice.components == &components && lastSlice.isConcurrent == isConcurrent && (!isConcurrent || lastSlice.lastComponent - lastSlice.firstComponent < RenderQueueSliceSize))
+				{
+					lastSlice.lastComponent++;
+					continue;
+				}
+			}
+
+			RenderQueueSlice slice;
+			slice.components = &components;
+			slice.firstComponent = i;
+			slice.lastComponent = i + 1;
+			slice.isConcurrent = isConcurrent;
+			slice.isPartiallyVisible = partiallyVisible;
+
+			m_renderQueueSlices.push_back(slice);
+		}
+	}
+
+	/*!
+	* \brief Draws the shadow casters of a light with the shadow technique
+	*
+	* \param shadowCasters Shadow caster cache of the light
+	* \param sceneData Data of the scene
+	*
+	* The render queue of the light is swapped with the one of the shadow technique while drawing, which allows the render queue of every light to be kept between frames.
+	*/
+	void RenderSystem::DrawShadowCasters(ShadowCasterCache& shadowCasters, const Nz::SceneData& sceneData)
+	{
+		Nz::DepthRenderQueue& techniqueQueue = static_cast<Nz::DepthRenderQueue&>(*m_shadowTechnique.GetRenderQueue());
+
+		std::swap(techniqueQueue, shadowCasters.renderQueue);
+
+		m_shadowTechnique.Clear(sceneData);
+		m_shadowTechnique.Draw(sceneData);
+
+		std::swap(techniqueQueue, shadowCasters.renderQueue);
+	}
+
+	/*!
+	* \brief Adds the drawables of a render queue slice to its own render queue
+	*
+	* \param frustum Frustum the culling list was culled with
+	* \param sliceIndex Index of the slice
+	*
+	* \remark Different slices may be filled concurrently, bounding volumes (and thus transform matrices) of every drawable being updated before culling
+	*/
+	void RenderSystem::FillRenderQueueSlice(const Nz::Frustumf& frustum, std::size_t sliceIndex)
+	{
+		const RenderQueueSlice& slice = m_renderQueueSlices[sliceIndex];
+
+		Nz::BasicRenderQueue& renderQueue = *m_sliceRenderQueues[sliceIndex];
+		renderQueue.Clear();
+
+		for (std::size_t i = slice.firstComponent; i < slice.lastComponent; ++i)
+		{
+			const GraphicsComponent* gfxComponent = (*slice.components)[i];
+			if (slice.isPartiallyVisible)
+				gfxComponent->AddToRenderQueueByCulling(frustum, &renderQueue);
+			else
+				gfxComponent->AddToRenderQueue(&renderQueue);
+		}
+	}
+
 	/*!
 	* \brief Operation to perform when an entity is removed
 	*
@@ -66,7 +221,12 @@ namespace Ndk
 		{
 			GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 			gfxComponent.RemoveFromCullingList(&m_drawableCulling);
+
+			for (auto& pair : m_shadowCasterCaches)
+				gfxComponent.RemoveFromCullingList(&pair.second.casterCulling);
 		}
+
+		m_shadowCasterCaches.erase(entity->GetId());
 	}
 
 	/*!
@@ -105,8 +265,13 @@ namespace Ndk
 
 			GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 			if (justAdded)
+			{
 				gfxComponent.AddToCullingList(&m_drawableCulling);
 
+				for (auto& pair : m_shadowCasterCaches)
+					gfxComponent.AddToCullingList(&pair.second.casterCulling);
+			}
+
 			if (gfxComponent.DoesRequireRealTimeReflections())
 				m_realtimeReflected.Insert(entity);
 			else
@@ -121,9 +286,15 @@ namespace Ndk
 			{
 				GraphicsComponent& gfxComponent = entity->GetComponent<GraphicsComponent>();
 				gfxComponent.RemoveFromCullingList(&m_drawableCulling);
+
+				for (auto& pair : m_shadowCasterCaches)
+					gfxComponent.RemoveFromCullingList(&pair.second.casterCulling);
 			}
 		}
 
+		// Shadow casters of a light are culled again from scratch whenever it changes (its type may be different)
+		m_shadowCasterCaches.erase(entity->GetId());
+
 		if (entity->HasComponent<LightComponent>() && entity->HasComponent<NodeComponent>())
 		{
 			m_forceRenderQueueInvalidation = true; //< Hackfix until lights and particles are handled by culling list
@@ -173,6 +344,9 @@ namespace Ndk
 
 	void RenderSystem::OnUpdate(float /*elapsedTime*/)
 	{
+		NazaraProfileZone("RenderSystem::OnUpdate");
+		NazaraProfileCounter("RenderSystem::Drawables", m_drawables.size());
+
 		// Invalidate every renderable if the coordinate system changed
 		if (m_coordinateSystemInvalidated)
 		{
@@ -187,6 +361,13 @@ namespace Ndk
 
 		Nz::SkinningManager::Skin();
 
+		// To make sure the bounding volumes used by the culling lists are updated
+		for (const Ndk::EntityHandle& drawable : m_drawables)
+		{
+			GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+			graphicsComponent.EnsureBoundingVolumesUpdate();
+		}
+
 		UpdateDynamicReflections();
 		UpdatePointSpotShadowMaps();
 
@@ -198,13 +379,6 @@ namespace Ndk
 
 			Nz::AbstractRenderQueue* renderQueue = m_renderTechnique->GetRenderQueue();
 
-			// To make sure the bounding volumes used by the culling list is updated
-			for (const Ndk::EntityHandle& drawable : m_drawables)
-			{
-				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
-				graphicsComponent.EnsureBoundingVolumesUpdate();
-			}
-
 			bool forceInvalidation = false;
 
 			const Nz::Frustumf& frustum = camComponent.GetFrustum();
@@ -222,11 +396,7 @@ namespace Ndk
 			if (camComponent.UpdateVisibility(visibilityHash) || m_forceRenderQueueInvalidation || forceInvalidation)
 			{
 				renderQueue->Clear();
-				for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetFullyVisibleResults())
-					gfxComponent->AddToRenderQueue(renderQueue);
-
-				for (const GraphicsComponent* gfxComponent : m_drawableCulling.GetPartiallyVisibleResults())
-					gfxComponent->AddToRenderQueueByCulling(frustum, renderQueue);
+				AddDrawablesToRenderQueue(frustum, renderQueue);
 
 				for (const Ndk::EntityHandle& light : m_lights)
 				{
@@ -298,7 +468,10 @@ namespace Ndk
 			NodeComponent& lightNode = light->GetComponent<NodeComponent>();
 
 			if (!lightComponent.IsShadowCastingEnabled())
+			{
+				m_shadowCasterCaches.erase(light->GetId());
 				continue;
+			}
 
 			Nz::Vector2ui shadowMapSize(lightComponent.GetShadowMap()->GetSize());
 
@@ -306,23 +479,17 @@ namespace Ndk
 			Nz::Renderer::SetTarget(&m_shadowRT);
 			Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
 
-			Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-			renderQueue->Clear();
-
-			///TODO: Culling
-			for (const Ndk::EntityHandle& drawable : m_drawables)
-			{
-				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+			///TODO: Cache the matrices in the light?
+			Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Ortho(0.f, 100.f, 100.f, 0.f, 1.f, 100.f);
+			Nz::Matrix4f viewMatrix = Nz::Matrix4f::ViewMatrix(lightNode.GetRotation() * Nz::Vector3f::Forward() * 100.f, lightNode.GetRotation());
 
-				graphicsComponent.AddToRenderQueue(renderQueue);
-			}
+			Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, projectionMatrix);
+			Nz::Renderer::SetMatrix(Nz::MatrixType_View, viewMatrix);
 
-			///TODO: Cache the matrices in the light?
-			Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Ortho(0.f, 100.f, 100.f, 0.f, 1.f, 100.f));
-			Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetRotation() * Nz::Vector3f::Forward() * 100.f, lightNode.GetRotation()));
+			Nz::Frustumf lightVolume;
+			lightVolume.Extract(viewMatrix, projectionMatrix);
 
-			m_shadowTechnique.Clear(dummySceneData);
-			m_shadowTechnique.Draw(dummySceneData);
+			DrawShadowCasters(UpdateShadowCasters(light, lightVolume), dummySceneData);
 		}
 	}
 
@@ -346,7 +513,10 @@ namespace Ndk
 			NodeComponent& lightNode = light->GetComponent<NodeComponent>();
 
 			if (!lightComponent.IsShadowCastingEnabled())
+			{
+				m_shadowCasterCaches.erase(light->GetId());
 				continue;
+			}
 
 			Nz::Vector2ui shadowMapSize(lightComponent.GetShadowMap()->GetSize());
 
@@ -368,6 +538,15 @@ namespace Ndk
 						Nz::Quaternionf::RotationBetween(Nz::Vector3f::Forward(),  Nz::Vector3f::UnitZ())  // CubemapFace_NegativeZ
 					};
 
+					// Faces share their shadow casters, which are culled once with the cube they cover
+					// Orthographic matrices map depth to [0, 1] while frustum extraction expects [-1, 1], a [0, radius] depth range thus covers [-radius, radius]
+					float radius = lightComponent.GetRadius();
+
+					Nz::Frustumf lightVolume;
+					lightVolume.Extract(Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), Nz::Quaternionf::Identity()), Nz::Matrix4f::Ortho(-radius, radius, -radius, radius, 0.f, radius));
+
+					ShadowCasterCache& shadowCasters = UpdateShadowCasters(light, lightVolume);
+
 					for (unsigned int face = 0; face < 6; ++face)
 					{
 						m_shadowRT.AttachTexture(Nz::AttachmentPoint_Depth, 0, lightComponent.GetShadowMap(), face);
@@ -375,22 +554,10 @@ namespace Ndk
 						Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
 
 						///TODO: Cache the matrices in the light?
-						Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Perspective(Nz::FromDegrees(90.f), 1.f, 0.1f, lightComponent.GetRadius()));
+						Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Perspective(Nz::FromDegrees(90.f), 1.f, 0.1f, radius));
 						Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), rotations[face]));
 
-						Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-						renderQueue->Clear();
-
-						///TODO: Culling
-						for (const Ndk::EntityHandle& drawable : m_drawables)
-						{
-							GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
-
-							graphicsComponent.AddToRenderQueue(renderQueue);
-						}
-
-						m_shadowTechnique.Clear(dummySceneData);
-						m_shadowTechnique.Draw(dummySceneData);
+						DrawShadowCasters(shadowCasters, dummySceneData);
 					}
 					break;
 				}
@@ -402,27 +569,78 @@ namespace Ndk
 					Nz::Renderer::SetViewport(Nz::Recti(0, 0, shadowMapSize.x, shadowMapSize.y));
 
 					///TODO: Cache the matrices in the light?
-					Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, Nz::Matrix4f::Perspective(lightComponent.GetOuterAngle()*2.f, 1.f, 0.1f, lightComponent.GetRadius()));
-					Nz::Renderer::SetMatrix(Nz::MatrixType_View, Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), lightNode.GetRotation()));
+					Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(lightComponent.GetOuterAngle()*2.f, 1.f, 0.1f, lightComponent.GetRadius());
+					Nz::Matrix4f viewMatrix = Nz::Matrix4f::ViewMatrix(lightNode.GetPosition(), lightNode.GetRotation());
 
-					Nz::AbstractRenderQueue* renderQueue = m_shadowTechnique.GetRenderQueue();
-					renderQueue->Clear();
+					Nz::Renderer::SetMatrix(Nz::MatrixType_Projection, projectionMatrix);
+					Nz::Renderer::SetMatrix(Nz::MatrixType_View, viewMatrix);
 
-					///TODO: Culling
-					for (const Ndk::EntityHandle& drawable : m_drawables)
-					{
-						GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+					Nz::Frustumf lightVolume;
+					lightVolume.Extract(viewMatrix, projectionMatrix);
 
-						graphicsComponent.AddToRenderQueue(renderQueue);
-					}
-
-					m_shadowTechnique.Clear(dummySceneData);
-					m_shadowTechnique.Draw(dummySceneData);
+					DrawShadowCasters(UpdateShadowCasters(light, lightVolume), dummySceneData);
 					break;
 				}
 			}
 		}
 	}
 
+	/*!
+	* \brief Culls the shadow casters of a light, filling its render queue again if they changed
+	* \return Shadow caster cache of the light, whose render queue contains the drawables inside of the light volume
+	*
+	* \param light Shadow casting light
+	* \param lightVolume Volume lit by the light
+	*
+	* Every shadow casting light has its own culling list, its render queue is only filled again when a drawable enters or leaves the light volume, or moves or changes inside of it
+	* (or every frame if one of its shadow casters cannot be added concurrently, as skeletal models).
+	* Static shadow casters are thus not added again to the render queue of a light every frame, and once for all the faces of a point light.
+	*/
+	RenderSystem::ShadowCasterCache& RenderSystem::UpdateShadowCasters(const Entity* light, const Nz::Frustumf& lightVolume)
+	{
+		auto it = m_shadowCasterCaches.find(light->GetId());
+		if (it == m_shadowCasterCaches.end())
+		{
+			it = m_shadowCasterCaches.emplace(std::piecewise_construct, std::forward_as_tuple(light->GetId()), std::forward_as_tuple()).first;
+
+			for (const Ndk::EntityHandle& drawable : m_drawables)
+			{
+				GraphicsComponent& graphicsComponent = drawable->GetComponent<GraphicsComponent>();
+				graphicsComponent.AddToCullingList(&it->second.casterCulling);
+				graphicsComponent.EnsureBoundingVolumesUpdate();
+			}
+		}
+
+		ShadowCasterCache& shadowCasters = it->second;
+
+		bool forceInvalidation = false;
+		std::size_t visibilityHash = shadowCasters.casterCulling.Cull(lightVolume, &forceInvalidation);
+
+		if (!shadowCasters.isRenderQueueValid || shadowCasters.visibilityHash != visibilityHash || forceInvalidation)
+		{
+			shadowCasters.renderQueue.Clear();
+
+			// Drawables which cannot be added concurrently (such as skeletal models) do more than copying their state to the render queue, and have to be added every frame
+			bool isCacheable = true;
+
+			for (const GraphicsComponent* gfxComponent : shadowCasters.casterCulling.GetFullyVisibleResults())
+			{
+				gfxComponent->AddToRenderQueue(&shadowCasters.renderQueue);
+				isCacheable = isCacheable && gfxComponent->CanAddToRenderQueueConcurrently();
+			}
+
+			for (const GraphicsComponent* gfxComponent : shadowCasters.casterCulling.GetPartiallyVisibleResults())
+			{
+				gfxComponent->AddToRenderQueueByCulling(lightVolume, &shadowCasters.renderQueue);
+				isCacheable = isCacheable && gfxComponent->CanAddToRenderQueueConcurrently();
+			}
+
+			shadowCasters.isRenderQueueValid = isCacheable;
+			shadowCasters.visibilityHash = visibilityHash;
+		}
+
+		return shadowCasters;
+	}
+
 	SystemIndex RenderSystem::systemIndex;
 }
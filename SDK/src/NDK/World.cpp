@@ -5,6 +5,7 @@
 #include <NDK/World.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <NDK/BaseComponent.hpp>
 #include <NDK/Systems/LifetimeSystem.hpp>
 #include <NDK/Systems/PhysicsSystem2D.hpp>
@@ -200,6 +201,8 @@ namespace Ndk
 	*/
 	void World::Refresh()
 	{
+		NazaraProfileZone("World::Refresh");
+
 		if (!m_orderedSystemsUpdated)
 			ReorderSystems();
 
@@ -221,7 +224,7 @@ namespace Ndk
 
 		// Handle killed entities before last call
 		std::swap(m_killedEntities.front, m_killedEntities.back);
-		for (std::size_t i = m_killedEntities.back.FindFirst(); i != m_killedEntities.back.npos; i = m_killedEntities.back.FindNext(i))
+		m_killedEntities.back.ForEachSetBit([&](std::size_t i)
 		{
 			NazaraAssert(i < m_entityBlocks.size(), "Entity index out of range");
 
@@ -232,12 +235,12 @@ namespace Ndk
 
 			// Send back the identifier of the entity to the free queue
 			m_freeEntityIds.UnboundedSet(i);
-		}
+		});
 		m_killedEntities.back.Clear();
 
 		// Handle of entities which need an update from the systems
 		std::swap(m_dirtyEntities.front, m_dirtyEntities.back);
-		for (std::size_t i = m_dirtyEntities.back.FindFirst(); i != m_dirtyEntities.back.npos; i = m_dirtyEntities.back.FindNext(i))
+		m_dirtyEntities.back.ForEachSetBit([&](std::size_t i)
 		{
 			NazaraAssert(i < m_entityBlocks.size(), "Entity index out of range");
 
@@ -245,7 +248,7 @@ namespace Ndk
 
 			// Check entity validity (as it could have been reported as dirty and killed during the same iteration)
 			if (!entity->IsValid())
-				continue;
+				return;
 
 			Nz::Bitset<>& removedComponents = entity->GetRemovedComponentBits();
 			for (std::size_t j = removedComponents.FindFirst(); j != m_dirtyEntities.back.npos; j = removedComponents.FindNext(j))
@@ -272,7 +275,7 @@ namespace Ndk
 						system->RemoveEntity(entity);
 				}
 			}
-		}
+		});
 		m_dirtyEntities.back.Clear();
 	}
 
@@ -285,6 +288,8 @@ namespace Ndk
 	*/
 	void World::Update(float elapsedTime)
 	{
+		NazaraProfileZone("World::Update");
+
 		if (m_isProfilerEnabled)
 		{
 			Nz::UInt64 t1 = Nz::GetElapsedMicroseconds();
@@ -311,6 +316,8 @@ namespace Ndk
 			for (auto& systemPtr : m_orderedSystems)
 				systemPtr->Update(elapsedTime);
 		}
+
+		NazaraProfileCounter("World::AliveEntities", m_aliveEntities.size());
 	}
 
 	void World::ReorderSystems()
@@ -0,0 +1,348 @@
+#include <Benchmark.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+
+namespace Bench
+{
+	namespace
+	{
+		struct Entry
+		{
+			std::string name;
+			Function function;
+		};
+
+		struct Result
+		{
+			std::string name;
+			std::size_t iterationCount;
+			double allocatedBytesPerIteration;
+			double allocationsPerIteration;
+			double bytesPerSecond;
+			double itemsPerSecond;
+			double max;
+			double mean;
+			double median;
+			double min;
+			double p90;
+			double p99;
+			double stddev;
+		};
+
+		std::atomic<Nz::UInt64> s_allocatedBytes(0);
+		std::atomic<Nz::UInt64> s_allocationCount(0);
+
+		std::vector<Entry>& GetRegistry()
+		{
+			static std::vector<Entry> registry;
+			return registry;
+		}
+
+		double Percentile(const std::vector<double>& sortedSamples, double percentile)
+		{
+			// Nearest-rank method
+			std::size_t rank = static_cast<std::size_t>(std::ceil(percentile * sortedSamples.size()));
+			return sortedSamples[std::max<std::size_t>(rank, 1) - 1];
+		}
+
+		Result ComputeResult(const std::string& name, const State& state)
+		{
+			std::vector<double> samples = state.GetSamples();
+			std::sort(samples.begin(), samples.end());
+
+			Result result;
+			result.name = name;
+			result.iterationCount = samples.size();
+			result.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+			result.median = Percentile(samples, 0.5);
+			result.min = samples.front();
+			result.max = samples.back();
+			result.p90 = Percentile(samples, 0.9);
+			result.p99 = Percentile(samples, 0.99);
+
+			double variance = 0.0;
+			for (double sample : samples)
+				variance += (sample - result.mean) * (sample - result.mean);
+
+			result.stddev = std::sqrt(variance / samples.size());
+
+			result.allocationsPerIteration = static_cast<double>(state.GetAllocationCount()) / samples.size();
+			result.allocatedBytesPerIteration = static_cast<double>(state.GetAllocatedBytes()) / samples.size();
+			result.bytesPerSecond = state.GetBytesPerIteration() / result.mean;
+			result.itemsPerSecond = state.GetItemsPerIteration() / result.mean;
+
+			return result;
+		}
+
+		void WriteJsonString(std::FILE* file, const std::string& str)
+		{
+			std::fputc('"', file);
+			for (char c : str)
+			{
+				if (c == '"' || c == '\\')
+					std::fputc('\\', file);
+
+				std::fputc(c, file);
+			}
+			std::fputc('"', file);
+		}
+
+		bool WriteJson(const std::string& filePath, const Options& options, const std::vector<Result>& results)
+		{
+			std::FILE* file = std::fopen(filePath.c_str(), "w");
+			if (!file)
+				return false;
+
+			std::fprintf(file, "{\n\t\"iterations\": %zu,\n\t\"warmup\": %zu,\n\t\"benchmarks\": [", options.iterationCount, options.warmupCount);
+
+			bool first = true;
+			for (const Result& result : results)
+			{
+				std::fprintf(file, (first) ? "\n\t\t{\n" : ",\n\t\t{\n");
+				first = false;
+
+				std::fprintf(file, "\t\t\t\"name\": ");
+				WriteJsonString(file, result.name);
+				std::fprintf(file, ",\n");
+
+				// Durations are written in seconds
+				std::fprintf(file, "\t\t\t\"iterations\": %zu,\n", result.iterationCount);
+				std::fprintf(file, "\t\t\t\"mean\": %.9g,\n", result.mean);
+				std::fprintf(file, "\t\t\t\"median\": %.9g,\n", result.median);
+				std::fprintf(file, "\t\t\t\"p90\": %.9g,\n", result.p90);
+				std::fprintf(file, "\t\t\t\"p99\": %.9g,\n", result.p99);
+				std::fprintf(file, "\t\t\t\"min\": %.9g,\n", result.min);
+				std::fprintf(file, "\t\t\t\"max\": %.9g,\n", result.max);
+				std::fprintf(file, "\t\t\t\"stddev\": %.9g,\n", result.stddev);
+				std::fprintf(file, "\t\t\t\"items_per_second\": %.9g,\n", result.itemsPerSecond);
+				std::fprintf(file, "\t\t\t\"bytes_per_second\": %.9g,\n", result.bytesPerSecond);
+				std::fprintf(file, "\t\t\t\"allocations_per_iteration\": %.9g,\n", result.allocationsPerIteration);
+				std::fprintf(file, "\t\t\t\"allocated_bytes_per_iteration\": %.9g\n", result.allocatedBytesPerIteration);
+				std::fprintf(file, "\t\t}");
+			}
+
+			std::fprintf(file, "\n\t]\n}\n");
+
+			return std::fclose(file) == 0;
+		}
+	}
+
+	State::State(std::size_t iterationCount, std::size_t warmupCount) :
+	m_iterationCount(iterationCount),
+	m_warmupCount(warmupCount),
+	m_warmupDone(0),
+	m_allocatedBytes(0),
+	m_allocationCount(0),
+	m_bytesPerIteration(0),
+	m_itemsPerIteration(0),
+	m_paused(false),
+	m_started(false)
+	{
+		m_samples.reserve(iterationCount);
+	}
+
+	/*!
+	* \brief Checks whether the benchmark should run one more iteration, and records the previous one
+	* \return true if another iteration has to be executed
+	*
+	* The first iterations are warmup iterations, which are executed but not recorded
+	*/
+	bool State::KeepRunning()
+	{
+		if (m_started)
+			StopIteration();
+		else
+			m_started = true;
+
+		if (m_samples.size() >= m_iterationCount)
+			return false;
+
+		StartIteration();
+		return true;
+	}
+
+	/*!
+	* \brief Stops measuring the current iteration, until ResumeTiming is called
+	*
+	* This allows an iteration to prepare its data without it being measured
+	*/
+	void State::PauseTiming()
+	{
+		auto now = std::chrono::steady_clock::now();
+
+		if (!m_paused)
+		{
+			m_iterationDuration += now - m_iterationStart;
+			m_iterationAllocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed) - m_iterationAllocatedBytes;
+			m_iterationAllocationCount = s_allocationCount.load(std::memory_order_relaxed) - m_iterationAllocationCount;
+			m_paused = true;
+		}
+	}
+
+	/*!
+	* \brief Resumes measuring the current iteration
+	*/
+	void State::ResumeTiming()
+	{
+		if (m_paused)
+		{
+			// While measuring, allocation counters hold the global counters minus what was allocated during the iteration
+			m_iterationAllocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed) - m_iterationAllocatedBytes;
+			m_iterationAllocationCount = s_allocationCount.load(std::memory_order_relaxed) - m_iterationAllocationCount;
+			m_paused = false;
+
+			m_iterationStart = std::chrono::steady_clock::now();
+		}
+	}
+
+	void State::StartIteration()
+	{
+		m_iterationAllocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed);
+		m_iterationAllocationCount = s_allocationCount.load(std::memory_order_relaxed);
+		m_iterationDuration = std::chrono::steady_clock::duration::zero();
+		m_paused = false;
+
+		m_iterationStart = std::chrono::steady_clock::now();
+	}
+
+	void State::StopIteration()
+	{
+		PauseTiming();
+
+		if (m_warmupDone < m_warmupCount)
+		{
+			m_warmupDone++;
+			return;
+		}
+
+		m_samples.push_back(std::chrono::duration<double>(m_iterationDuration).count());
+		m_allocatedBytes += m_iterationAllocatedBytes;
+		m_allocationCount += m_iterationAllocationCount;
+	}
+
+	bool Register(const char* name, Function function)
+	{
+		GetRegistry().push_back(Entry{name, function});
+		return true;
+	}
+
+	int RunAll(const Options& options)
+	{
+		std::vector<Entry> entries = GetRegistry();
+		std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.name < rhs.name; });
+
+		std::printf("%-56s %11s %11s %11s %11s %14s %8s %10s\n", "Benchmark", "Mean (ms)", "Median (ms)", "P99 (ms)", "Min (ms)", "Items/s", "GB/s", "Allocs/it");
+
+		std::vector<Result> results;
+		for (const Entry& entry : entries)
+		{
+			if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos)
+				continue;
+
+			State state(options.iterationCount, options.warmupCount);
+			entry.function(state);
+
+			if (state.GetSamples().empty())
+			{
+				std::printf("%-56s %11s\n", entry.name.c_str(), "(no iteration)");
+				continue;
+			}
+
+			Result result = ComputeResult(entry.name, state);
+
+			std::printf("%-56s %11.4f %11.4f %11.4f %11.4f", result.name.c_str(), result.mean * 1000.0, result.median * 1000.0, result.p99 * 1000.0, result.min * 1000.0);
+
+			if (result.itemsPerSecond > 0.0)
+				std::printf(" %14.0f", result.itemsPerSecond);
+			else
+				std::printf(" %14s", "");
+
+			if (result.bytesPerSecond > 0.0)
+				std::printf(" %8.2f", result.bytesPerSecond / 1e9);
+			else
+				std::printf(" %8s", "");
+
+			std::printf(" %10.1f\n", result.allocationsPerIteration);
+
+			results.push_back(std::move(result));
+		}
+
+		if (!options.jsonPath.empty() && !WriteJson(options.jsonPath, options, results))
+		{
+			std::fprintf(stderr, "Failed to write %s\n", options.jsonPath.c_str());
+			return EXIT_FAILURE;
+		}
+
+		return EXIT_SUCCESS;
+	}
+}
+
+// Counts the allocations made by benchmarks
+void* operator new(std::size_t size)
+{
+	Bench::s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	Bench::s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+	void* ptr = std::malloc((size > 0) ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return operator new(size);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return nullptr;
+	}
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
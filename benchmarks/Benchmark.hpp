@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_BENCHMARK_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+	struct Options
+	{
+		std::size_t iterationCount = 10;
+		std::size_t warmupCount = 2;
+		std::string filter;
+		std::string jsonPath;
+	};
+
+	class State
+	{
+		public:
+			State(std::size_t iterationCount, std::size_t warmupCount);
+			State(const State&) = delete;
+			State(State&&) = delete;
+			~State() = default;
+
+			inline Nz::UInt64 GetAllocatedBytes() const;
+			inline Nz::UInt64 GetAllocationCount() const;
+			inline Nz::UInt64 GetBytesPerIteration() const;
+			inline Nz::UInt64 GetItemsPerIteration() const;
+			inline std::size_t GetIterationCount() const;
+			inline const std::vector<double>& GetSamples() const;
+
+			bool KeepRunning();
+
+			void PauseTiming();
+			void ResumeTiming();
+
+			inline void SetBytesPerIteration(Nz::UInt64 byteCount);
+			inline void SetItemsPerIteration(Nz::UInt64 itemCount);
+
+			State& operator=(const State&) = delete;
+			State& operator=(State&&) = delete;
+
+		private:
+			void StartIteration();
+			void StopIteration();
+
+			std::chrono::steady_clock::duration m_iterationDuration;
+			std::chrono::steady_clock::time_point m_iterationStart;
+			std::size_t m_iterationCount;
+			std::size_t m_warmupCount;
+			std::size_t m_warmupDone;
+			std::vector<double> m_samples; //< Duration of each iteration, in seconds
+			Nz::UInt64 m_allocatedBytes;
+			Nz::UInt64 m_allocationCount;
+			Nz::UInt64 m_bytesPerIteration;
+			Nz::UInt64 m_iterationAllocatedBytes;
+			Nz::UInt64 m_iterationAllocationCount;
+			Nz::UInt64 m_itemsPerIteration;
+			bool m_paused;
+			bool m_started;
+	};
+
+	using Function = void(*)(State& state);
+
+	bool Register(const char* name, Function function);
+	int RunAll(const Options& options);
+
+	template<typename T> void DoNotOptimize(T&& value);
+}
+
+#define NAZARA_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define NAZARA_BENCHMARK_CONCAT(a, b) NAZARA_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_CASE_IMPL(name, function) \
+	static void function(Bench::State& state); \
+	static bool NAZARA_BENCHMARK_CONCAT(function, Registered) = Bench::Register(name, &function); \
+	static void function(Bench::State& state)
+
+// Declares a benchmark, the body has to loop on state.KeepRunning() and only the loop is measured
+#define BENCHMARK_CASE(name) BENCHMARK_CASE_IMPL(name, NAZARA_BENCHMARK_CONCAT(Benchmark, __LINE__))
+
+#include <Benchmark.inl>
+
+#endif // NAZARA_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,68 @@
+namespace Bench
+{
+	/*!
+	* \brief Gets the number of bytes allocated through operator new during the measured iterations
+	*/
+	inline Nz::UInt64 State::GetAllocatedBytes() const
+	{
+		return m_allocatedBytes;
+	}
+
+	/*!
+	* \brief Gets the number of calls to operator new during the measured iterations
+	*/
+	inline Nz::UInt64 State::GetAllocationCount() const
+	{
+		return m_allocationCount;
+	}
+
+	inline Nz::UInt64 State::GetBytesPerIteration() const
+	{
+		return m_bytesPerIteration;
+	}
+
+	inline Nz::UInt64 State::GetItemsPerIteration() const
+	{
+		return m_itemsPerIteration;
+	}
+
+	inline std::size_t State::GetIterationCount() const
+	{
+		return m_iterationCount;
+	}
+
+	inline const std::vector<double>& State::GetSamples() const
+	{
+		return m_samples;
+	}
+
+	/*!
+	* \brief Sets the number of bytes processed by one iteration, used to compute a bandwidth
+	*/
+	inline void State::SetBytesPerIteration(Nz::UInt64 byteCount)
+	{
+		m_bytesPerIteration = byteCount;
+	}
+
+	/*!
+	* \brief Sets the number of items (tasks, bytes, entities, ...) processed by one iteration, used to compute a throughput
+	*/
+	inline void State::SetItemsPerIteration(Nz::UInt64 itemCount)
+	{
+		m_itemsPerIteration = itemCount;
+	}
+
+	/*!
+	* \brief Prevents the compiler from optimizing away a computation whose result is unused
+	*/
+	template<typename T>
+	void DoNotOptimize(T&& value)
+	{
+		#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "g"(&value) : "memory");
+		#else
+		static volatile const void* sink;
+		sink = &value;
+		#endif
+	}
+}
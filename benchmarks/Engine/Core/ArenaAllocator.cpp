@@ -0,0 +1,40 @@
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <Benchmark.hpp>
+#include <unordered_map>
+
+namespace
+{
+	constexpr std::size_t MapSize = 10000;
+}
+
+BENCHMARK_CASE("Core/ArenaAllocator/UnorderedMap")
+{
+	using Allocator = Nz::ArenaStlAllocator<std::pair<const std::size_t, std::size_t>>;
+
+	Nz::ArenaAllocator arena;
+
+	state.SetItemsPerIteration(MapSize);
+	while (state.KeepRunning())
+	{
+		arena.Reset();
+
+		std::unordered_map<std::size_t, std::size_t, std::hash<std::size_t>, std::equal_to<std::size_t>, Allocator> map{Allocator(arena)};
+		for (std::size_t i = 0; i < MapSize; ++i)
+			map.emplace((i * 2654435761U) % MapSize, i);
+
+		Bench::DoNotOptimize(map);
+	}
+}
+
+BENCHMARK_CASE("Core/ArenaAllocator/NewDeleteReference/UnorderedMap")
+{
+	state.SetItemsPerIteration(MapSize);
+	while (state.KeepRunning())
+	{
+		std::unordered_map<std::size_t, std::size_t> map;
+		for (std::size_t i = 0; i < MapSize; ++i)
+			map.emplace((i * 2654435761U) % MapSize, i);
+
+		Bench::DoNotOptimize(map);
+	}
+}
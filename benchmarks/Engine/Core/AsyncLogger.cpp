@@ -0,0 +1,97 @@
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/FileLogger.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Benchmark.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t MessagesPerThread = 10000;
+
+	// Every producer thread writes its share of messages, the logger is flushed afterwards
+	template<typename F>
+	void RunProducers(unsigned int threadCount, F write)
+	{
+		std::vector<Nz::Thread> threads;
+		for (unsigned int i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&write]()
+			{
+				Nz::String message = "Failed to load resource: file not found";
+				for (std::size_t j = 0; j < MessagesPerThread; ++j)
+					write(message);
+			});
+		}
+
+		for (Nz::Thread& thread : threads)
+			thread.Join();
+	}
+
+	void BenchmarkAsyncLogger(Bench::State& state, unsigned int threadCount, Nz::LogOverflowPolicy policy)
+	{
+		Nz::AsyncLogger logger("AsyncLoggerBenchmark.log", 4096, policy);
+		logger.EnableStdReplication(false);
+
+		state.SetItemsPerIteration(threadCount * MessagesPerThread);
+		while (state.KeepRunning())
+		{
+			RunProducers(threadCount, [&logger](const Nz::String& message) { logger.WriteError(Nz::ErrorType_Normal, message, __LINE__, __FILE__, "BenchmarkAsyncLogger"); });
+			logger.Flush();
+		}
+	}
+
+	// Reference: the synchronous file logger, serialized by a mutex as it isn't thread-safe
+	void BenchmarkFileLogger(Bench::State& state, unsigned int threadCount)
+	{
+		Nz::FileLogger logger("FileLoggerBenchmark.log");
+		logger.EnableStdReplication(false);
+		Nz::Mutex mutex;
+
+		state.SetItemsPerIteration(threadCount * MessagesPerThread);
+		while (state.KeepRunning())
+		{
+			RunProducers(threadCount, [&logger, &mutex](const Nz::String& message)
+			{
+				Nz::LockGuard lock(mutex);
+				logger.Write("Error: " + message);
+			});
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/1Producer")
+{
+	BenchmarkAsyncLogger(state, 1, Nz::LogOverflowPolicy_Block);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/4Producers")
+{
+	BenchmarkAsyncLogger(state, 4, Nz::LogOverflowPolicy_Block);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/8Producers")
+{
+	BenchmarkAsyncLogger(state, 8, Nz::LogOverflowPolicy_Block);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/8Producers/Drop")
+{
+	BenchmarkAsyncLogger(state, 8, Nz::LogOverflowPolicy_Drop);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/FileLoggerReference/1Producer")
+{
+	BenchmarkFileLogger(state, 1);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/FileLoggerReference/4Producers")
+{
+	BenchmarkFileLogger(state, 4);
+}
+
+BENCHMARK_CASE("Core/AsyncLogger/FileLoggerReference/8Producers")
+{
+	BenchmarkFileLogger(state, 8);
+}
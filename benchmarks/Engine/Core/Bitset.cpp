@@ -0,0 +1,164 @@
+#include <Nazara/Core/Bitset.hpp>
+#include <Benchmark.hpp>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t BitCount = 1 << 20;
+
+	Nz::Bitset<Nz::UInt64> BuildBitset(unsigned int seed, double density)
+	{
+		std::mt19937 generator(seed);
+		std::bernoulli_distribution distribution(density);
+
+		Nz::Bitset<Nz::UInt64> bitset(BitCount, false);
+		for (std::size_t i = 0; i < BitCount; ++i)
+		{
+			if (distribution(generator))
+				bitset.Set(i);
+		}
+
+		return bitset;
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/Count")
+{
+	Nz::Bitset<Nz::UInt64> bitset = BuildBitset(1, 0.5);
+
+	state.SetBytesPerIteration(BitCount / 8);
+	while (state.KeepRunning())
+	{
+		std::size_t count = bitset.Count();
+		Bench::DoNotOptimize(count);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/FindNext/Sparse")
+{
+	Nz::Bitset<Nz::UInt64> bitset = BuildBitset(2, 0.01);
+
+	state.SetItemsPerIteration(BitCount);
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t i = bitset.FindFirst(); i != bitset.npos; i = bitset.FindNext(i))
+			sum += i;
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/FindNext/Dense")
+{
+	Nz::Bitset<Nz::UInt64> bitset = BuildBitset(3, 0.9);
+
+	state.SetItemsPerIteration(BitCount);
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		for (std::size_t i = bitset.FindFirst(); i != bitset.npos; i = bitset.FindNext(i))
+			sum += i;
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/ForEachSetBit/Sparse")
+{
+	Nz::Bitset<Nz::UInt64> bitset = BuildBitset(2, 0.01);
+
+	state.SetItemsPerIteration(BitCount);
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		bitset.ForEachSetBit([&](std::size_t i) { sum += i; });
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/ForEachSetBit/Dense")
+{
+	Nz::Bitset<Nz::UInt64> bitset = BuildBitset(3, 0.9);
+
+	state.SetItemsPerIteration(BitCount);
+	while (state.KeepRunning())
+	{
+		std::size_t sum = 0;
+		bitset.ForEachSetBit([&](std::size_t i) { sum += i; });
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/PerformsAND")
+{
+	Nz::Bitset<Nz::UInt64> a = BuildBitset(4, 0.5);
+	Nz::Bitset<Nz::UInt64> b = BuildBitset(5, 0.5);
+	Nz::Bitset<Nz::UInt64> result;
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+	while (state.KeepRunning())
+	{
+		result.PerformsAND(a, b);
+		Bench::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/PerformsANDNOT")
+{
+	Nz::Bitset<Nz::UInt64> a = BuildBitset(4, 0.5);
+	Nz::Bitset<Nz::UInt64> b = BuildBitset(5, 0.5);
+	Nz::Bitset<Nz::UInt64> result;
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+	while (state.KeepRunning())
+	{
+		result.PerformsANDNOT(a, b);
+		Bench::DoNotOptimize(result);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/Intersects")
+{
+	// Disjoint sets, so that every block has to be checked
+	Nz::Bitset<Nz::UInt64> a = BuildBitset(6, 0.5);
+	Nz::Bitset<Nz::UInt64> b = ~a;
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+	while (state.KeepRunning())
+	{
+		bool intersects = a.Intersects(b);
+		Bench::DoNotOptimize(intersects);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/IsSubsetOf")
+{
+	// A true subset, so that every block has to be checked
+	Nz::Bitset<Nz::UInt64> a = BuildBitset(7, 0.5);
+	Nz::Bitset<Nz::UInt64> b = a;
+	b |= BuildBitset(8, 0.5);
+
+	state.SetBytesPerIteration(BitCount / 8 * 2);
+	while (state.KeepRunning())
+	{
+		bool isSubset = a.IsSubsetOf(b);
+		Bench::DoNotOptimize(isSubset);
+	}
+}
+
+BENCHMARK_CASE("Core/Bitset/TestAny")
+{
+	// Only the last bit is set, so that every block has to be checked
+	Nz::Bitset<Nz::UInt64> bitset(BitCount, false);
+	bitset.Set(BitCount - 1);
+
+	state.SetBytesPerIteration(BitCount / 8);
+	while (state.KeepRunning())
+	{
+		bool any = bitset.TestAny();
+		Bench::DoNotOptimize(any);
+	}
+}
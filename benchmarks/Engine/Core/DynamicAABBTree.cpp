@@ -0,0 +1,123 @@
+#include <Nazara/Core/DynamicAABBTree.hpp>
+#include <Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BoxCount = 100000;
+	constexpr std::size_t QueryCount = 1000;
+
+	std::vector<Nz::Boxf> BuildBoxes()
+	{
+		std::mt19937 generator(1);
+		std::uniform_real_distribution<float> position(-5000.f, 5000.f);
+		std::uniform_real_distribution<float> altitude(-50.f, 50.f);
+		std::uniform_real_distribution<float> size(0.5f, 10.f);
+
+		std::vector<Nz::Boxf> boxes;
+		boxes.reserve(BoxCount);
+		for (std::size_t i = 0; i < BoxCount; ++i)
+			boxes.emplace_back(position(generator), altitude(generator), position(generator), size(generator), size(generator), size(generator));
+
+		return boxes;
+	}
+
+	Nz::DynamicAABBTree BuildTree(const std::vector<Nz::Boxf>& boxes, std::vector<std::size_t>* proxies = nullptr)
+	{
+		Nz::DynamicAABBTree tree;
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			std::size_t proxyId = tree.CreateProxy(boxes[i], i);
+			if (proxies)
+				proxies->push_back(proxyId);
+		}
+
+		return tree;
+	}
+}
+
+BENCHMARK_CASE("Core/DynamicAABBTree/CreateProxies")
+{
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+
+	state.SetItemsPerIteration(BoxCount);
+	while (state.KeepRunning())
+	{
+		Nz::DynamicAABBTree tree = BuildTree(boxes);
+		Bench::DoNotOptimize(tree);
+	}
+}
+
+BENCHMARK_CASE("Core/DynamicAABBTree/MoveProxies")
+{
+	// Small movements, most boxes staying in their fat AABB
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+	std::vector<std::size_t> proxies;
+	Nz::DynamicAABBTree tree = BuildTree(boxes, &proxies);
+
+	float offset = 0.f;
+
+	state.SetItemsPerIteration(BoxCount);
+	while (state.KeepRunning())
+	{
+		offset += 0.02f;
+		for (std::size_t i = 0; i < BoxCount; ++i)
+		{
+			Nz::Boxf box = boxes[i];
+			box.x += offset;
+
+			tree.MoveProxy(proxies[i], box, Nz::Vector3f(0.02f, 0.f, 0.f));
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/DynamicAABBTree/QueryBoxes")
+{
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+	Nz::DynamicAABBTree tree = BuildTree(boxes);
+
+	state.SetItemsPerIteration(QueryCount);
+	while (state.KeepRunning())
+	{
+		std::size_t hitCount = 0;
+		for (std::size_t i = 0; i < QueryCount; ++i)
+		{
+			const Nz::Boxf& box = boxes[i];
+			tree.Query(Nz::Boxf(box.x - 20.f, box.y - 20.f, box.z - 20.f, 40.f, 40.f, 40.f), [&](std::size_t /*proxyId*/)
+			{
+				hitCount++;
+				return true;
+			});
+		}
+
+		Bench::DoNotOptimize(hitCount);
+	}
+}
+
+BENCHMARK_CASE("Core/DynamicAABBTree/QueryRays")
+{
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+	Nz::DynamicAABBTree tree = BuildTree(boxes);
+
+	// Rays cast from boxes to others, as line of sight tests
+	std::vector<Nz::Rayf> rays;
+	for (std::size_t i = 0; i < QueryCount; ++i)
+		rays.emplace_back(boxes[i].GetCenter(), boxes[i + QueryCount].GetCenter() - boxes[i].GetCenter());
+
+	state.SetItemsPerIteration(QueryCount);
+	while (state.KeepRunning())
+	{
+		std::size_t hitCount = 0;
+		for (const Nz::Rayf& ray : rays)
+		{
+			tree.Query(ray, 1.f, [&](std::size_t /*proxyId*/, float /*distance*/)
+			{
+				hitCount++;
+				return true;
+			});
+		}
+
+		Bench::DoNotOptimize(hitCount);
+	}
+}
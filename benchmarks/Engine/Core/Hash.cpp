@@ -0,0 +1,93 @@
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Hash/CRC32.hpp>
+#include <Benchmark.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t DataSize = 16 * 1024 * 1024;
+
+	const std::vector<Nz::UInt8>& GetTestData()
+	{
+		static std::vector<Nz::UInt8> data = []()
+		{
+			std::mt19937 randomEngine(42);
+
+			std::vector<Nz::UInt8> randomData(DataSize);
+			for (Nz::UInt8& byte : randomData)
+				byte = static_cast<Nz::UInt8>(randomEngine());
+
+			return randomData;
+		}();
+
+		return data;
+	}
+
+	void RunHash(Bench::State& state, Nz::AbstractHash& hash)
+	{
+		const std::vector<Nz::UInt8>& data = GetTestData();
+
+		state.SetBytesPerIteration(data.size());
+		while (state.KeepRunning())
+		{
+			hash.Begin();
+			hash.Append(data.data(), data.size());
+			Bench::DoNotOptimize(hash.End());
+		}
+	}
+
+	void RunHash(Bench::State& state, Nz::HashType hashType)
+	{
+		std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(hashType);
+		RunHash(state, *hash);
+	}
+}
+
+BENCHMARK_CASE("Core/Hash/CRC32")
+{
+	RunHash(state, Nz::HashType_CRC32);
+}
+
+BENCHMARK_CASE("Core/Hash/CRC32C")
+{
+	Nz::HashCRC32 hash(0x1edc6f41);
+	RunHash(state, hash);
+}
+
+BENCHMARK_CASE("Core/Hash/CRC64")
+{
+	RunHash(state, Nz::HashType_CRC64);
+}
+
+BENCHMARK_CASE("Core/Hash/Fletcher16")
+{
+	RunHash(state, Nz::HashType_Fletcher16);
+}
+
+BENCHMARK_CASE("Core/Hash/MD5")
+{
+	RunHash(state, Nz::HashType_MD5);
+}
+
+BENCHMARK_CASE("Core/Hash/SHA1")
+{
+	RunHash(state, Nz::HashType_SHA1);
+}
+
+BENCHMARK_CASE("Core/Hash/SHA256")
+{
+	RunHash(state, Nz::HashType_SHA256);
+}
+
+BENCHMARK_CASE("Core/Hash/SHA512")
+{
+	RunHash(state, Nz::HashType_SHA512);
+}
+
+BENCHMARK_CASE("Core/Hash/Whirlpool")
+{
+	RunHash(state, Nz::HashType_Whirlpool);
+}
@@ -0,0 +1,58 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t LineCount = 50000;
+
+	const char* GetTestFile()
+	{
+		static const char* path = []()
+		{
+			const char* filePath = "MappedFileBenchmark.obj";
+
+			Nz::File file(filePath, Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			for (std::size_t i = 0; i < LineCount; ++i)
+				file.Write("v " + Nz::String::Number(i * 0.5f) + " " + Nz::String::Number(i * 0.25f) + " " + Nz::String::Number(i * 0.125f) + "\n");
+
+			return filePath;
+		}();
+
+		return path;
+	}
+
+	template<typename T>
+	void ReadLines(T& stream)
+	{
+		while (!stream.EndOfStream())
+			Bench::DoNotOptimize(stream.ReadLine());
+	}
+}
+
+BENCHMARK_CASE("Core/MappedFile/ReadLine")
+{
+	const char* filePath = GetTestFile();
+
+	state.SetItemsPerIteration(LineCount);
+	while (state.KeepRunning())
+	{
+		Nz::MappedFile file(filePath);
+		file.Advise(Nz::MemoryAccessHint_Sequential);
+
+		ReadLines(file);
+	}
+}
+
+BENCHMARK_CASE("Core/MappedFile/FileReference/ReadLine")
+{
+	const char* filePath = GetTestFile();
+
+	state.SetItemsPerIteration(LineCount);
+	while (state.KeepRunning())
+	{
+		Nz::File file(filePath, Nz::OpenMode_ReadOnly);
+
+		ReadLines(file);
+	}
+}
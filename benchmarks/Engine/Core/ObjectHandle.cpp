@@ -0,0 +1,99 @@
+#include <Nazara/Core/HandledObject.hpp>
+#include <Nazara/Core/ObjectHandle.hpp>
+#include <Benchmark.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t ObjectCount = 10000;
+
+	struct HandledValue : Nz::HandledObject<HandledValue>
+	{
+		HandledValue(int v) :
+		value(v)
+		{
+		}
+
+		int value;
+	};
+
+	void StartThread()
+	{
+		// Makes libstdc++ use atomic reference counting, as it does in any program running worker threads
+		std::thread([] {}).join();
+	}
+}
+
+BENCHMARK_CASE("Core/ObjectHandle/CopyAndRead")
+{
+	StartThread();
+
+	std::vector<HandledValue> objects;
+	objects.reserve(ObjectCount);
+	for (std::size_t i = 0; i < ObjectCount; ++i)
+		objects.emplace_back(static_cast<int>(i));
+
+	std::vector<Nz::ObjectHandle<HandledValue>> handles;
+	handles.reserve(ObjectCount);
+	for (HandledValue& object : objects)
+		handles.emplace_back(object.CreateHandle());
+
+	state.SetItemsPerIteration(ObjectCount);
+	while (state.KeepRunning())
+	{
+		long long sum = 0;
+		for (const Nz::ObjectHandle<HandledValue>& handle : handles)
+		{
+			Nz::ObjectHandle<HandledValue> copy = handle;
+			if (copy)
+				sum += copy->value;
+		}
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/ObjectHandle/Validate")
+{
+	std::vector<HandledValue> objects;
+	objects.reserve(ObjectCount);
+	for (std::size_t i = 0; i < ObjectCount; ++i)
+		objects.emplace_back(static_cast<int>(i));
+
+	std::vector<Nz::ObjectHandle<HandledValue>> handles;
+	handles.reserve(ObjectCount);
+	for (HandledValue& object : objects)
+		handles.emplace_back(object.CreateHandle());
+
+	state.SetItemsPerIteration(ObjectCount);
+	while (state.KeepRunning())
+	{
+		std::size_t validCount = 0;
+		for (const Nz::ObjectHandle<HandledValue>& handle : handles)
+			validCount += (handle.IsValid()) ? 1 : 0;
+
+		Bench::DoNotOptimize(validCount);
+	}
+}
+
+BENCHMARK_CASE("Core/ObjectHandle/CreateAndDestroy")
+{
+	StartThread();
+
+	state.SetItemsPerIteration(ObjectCount);
+	while (state.KeepRunning())
+	{
+		std::vector<std::unique_ptr<HandledValue>> objects;
+		objects.reserve(ObjectCount);
+
+		for (std::size_t i = 0; i < ObjectCount; ++i)
+		{
+			objects.emplace_back(std::make_unique<HandledValue>(static_cast<int>(i)));
+
+			Nz::ObjectHandle<HandledValue> handle = objects.back()->CreateHandle();
+			Bench::DoNotOptimize(handle);
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/PackFile.hpp>
+#include <Benchmark.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t FileCount = 1000;
+
+	const std::vector<Nz::String>& GetTestFiles()
+	{
+		static std::vector<Nz::String> paths = []()
+		{
+			Nz::Directory::Create("PackFileBenchmark");
+
+			std::vector<Nz::PackFile::BuildEntry> entries;
+			std::vector<Nz::String> filePaths;
+			for (std::size_t i = 0; i < FileCount; ++i)
+			{
+				Nz::String entryPath = "file" + Nz::String::Number(i) + ".txt";
+				Nz::String filePath = "PackFileBenchmark/" + entryPath;
+
+				Nz::File file(filePath, Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+				for (std::size_t j = 0; j < 32; ++j)
+					file.Write("resource " + Nz::String::Number(i) + " line " + Nz::String::Number(j) + "\n");
+
+				entries.push_back({entryPath, filePath});
+				filePaths.push_back(filePath);
+			}
+
+			Nz::PackFile::Build("PackFileBenchmark.pack", entries);
+
+			return filePaths;
+		}();
+
+		return paths;
+	}
+
+	void ReadAll(Nz::Stream& stream)
+	{
+		char buffer[4096];
+		while (std::size_t readSize = stream.Read(buffer, sizeof(buffer)))
+			Bench::DoNotOptimize(readSize);
+	}
+}
+
+BENCHMARK_CASE("Core/PackFile/OpenMountedFile")
+{
+	const std::vector<Nz::String>& filePaths = GetTestFiles();
+	Nz::PackFile::Mount("PackFileBenchmark.pack", "PackFileBenchmark");
+
+	state.SetItemsPerIteration(FileCount);
+	while (state.KeepRunning())
+	{
+		for (const Nz::String& filePath : filePaths)
+		{
+			std::unique_ptr<Nz::Stream> stream = Nz::PackFile::OpenMountedFile(filePath);
+			ReadAll(*stream);
+		}
+	}
+
+	Nz::PackFile::Unmount("PackFileBenchmark.pack");
+}
+
+BENCHMARK_CASE("Core/PackFile/FileReference/Open")
+{
+	const std::vector<Nz::String>& filePaths = GetTestFiles();
+
+	state.SetItemsPerIteration(FileCount);
+	while (state.KeepRunning())
+	{
+		for (const Nz::String& filePath : filePaths)
+		{
+			Nz::File file(filePath, Nz::OpenMode_ReadOnly);
+			ReadAll(file);
+		}
+	}
+}
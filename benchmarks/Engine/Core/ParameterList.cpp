@@ -0,0 +1,83 @@
+#include <Nazara/Core/ParameterList.hpp>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t LookupCount = 1000;
+
+	// Flags of the basic uber shader, as queried by UberShaderPreprocessor::Get
+	const char* shaderFlags[] = {
+		"ALPHA_MAPPING", "ALPHA_TEST", "COMPUTE_TBNMATRIX", "DIFFUSE_MAPPING", "EMISSIVE_MAPPING", "NORMAL_MAPPING",
+		"PARALLAX_MAPPING", "REFLECTION_MAPPING", "SHADOW_MAPPING", "SPECULAR_MAPPING", "TEXTURE_MAPPING", "TRANSFORM",
+		"FLAG_BILLBOARD", "FLAG_DEFERRED", "FLAG_INSTANCING", "FLAG_TEXTUREOVERLAY", "FLAG_VERTEXCOLOR"
+	};
+
+	constexpr std::size_t FlagCount = sizeof(shaderFlags) / sizeof(shaderFlags[0]);
+
+	Nz::ParameterList BuildShaderParameters()
+	{
+		Nz::ParameterList list;
+		for (std::size_t i = 0; i < FlagCount; ++i)
+			list.SetParameter(shaderFlags[i], (i % 3) == 0);
+
+		return list;
+	}
+}
+
+BENCHMARK_CASE("Core/ParameterList/ShaderFlags/Names")
+{
+	Nz::ParameterList list = BuildShaderParameters();
+
+	state.SetItemsPerIteration(LookupCount);
+	while (state.KeepRunning())
+	{
+		Nz::UInt32 flags = 0;
+		for (std::size_t i = 0; i < LookupCount; ++i)
+		{
+			for (std::size_t j = 0; j < FlagCount; ++j)
+			{
+				bool value;
+				if (list.HasParameter(shaderFlags[j]) && list.GetBooleanParameter(shaderFlags[j], &value) && value)
+					flags |= 1U << j;
+			}
+		}
+
+		Bench::DoNotOptimize(flags);
+	}
+}
+
+BENCHMARK_CASE("Core/ParameterList/ShaderFlags/Keys")
+{
+	Nz::ParameterList list = BuildShaderParameters();
+
+	Nz::ParameterKey keys[FlagCount];
+	for (std::size_t i = 0; i < FlagCount; ++i)
+		keys[i] = Nz::ParameterKey(shaderFlags[i]);
+
+	state.SetItemsPerIteration(LookupCount);
+	while (state.KeepRunning())
+	{
+		Nz::UInt32 flags = 0;
+		for (std::size_t i = 0; i < LookupCount; ++i)
+		{
+			for (std::size_t j = 0; j < FlagCount; ++j)
+			{
+				bool value;
+				if (list.HasParameter(keys[j]) && list.GetBooleanParameter(keys[j], &value) && value)
+					flags |= 1U << j;
+			}
+		}
+
+		Bench::DoNotOptimize(flags);
+	}
+}
+
+BENCHMARK_CASE("Core/ParameterList/Build")
+{
+	state.SetItemsPerIteration(FlagCount);
+	while (state.KeepRunning())
+	{
+		Nz::ParameterList list = BuildShaderParameters();
+		Bench::DoNotOptimize(list);
+	}
+}
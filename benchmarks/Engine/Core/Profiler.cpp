@@ -0,0 +1,44 @@
+#include <Nazara/Core/Profiler.hpp>
+#include <Benchmark.hpp>
+
+namespace
+{
+	constexpr std::size_t ZoneCount = 10000;
+}
+
+BENCHMARK_CASE("Core/Profiler/Zone/Disabled")
+{
+	Nz::Profiler::Disable();
+
+	state.SetItemsPerIteration(ZoneCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < ZoneCount; ++i)
+		{
+			NazaraProfileZone("Zone");
+			Bench::DoNotOptimize(i);
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/Profiler/Zone/Enabled")
+{
+	Nz::Profiler::Enable();
+
+	state.SetItemsPerIteration(ZoneCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < ZoneCount; ++i)
+		{
+			NazaraProfileZone("Zone");
+			Bench::DoNotOptimize(i);
+		}
+
+		state.PauseTiming();
+		Nz::Profiler::Clear();
+		state.ResumeTiming();
+	}
+
+	Nz::Profiler::Disable();
+	Nz::Profiler::Clear();
+}
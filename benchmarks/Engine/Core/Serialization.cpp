@@ -0,0 +1,227 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t ValueCount = 64 * 1024;
+
+	Nz::Endianness GetSwappedEndianness()
+	{
+		return (Nz::GetPlatformEndianness() == Nz::Endianness_BigEndian) ? Nz::Endianness_LittleEndian : Nz::Endianness_BigEndian;
+	}
+
+	std::vector<float> BuildFloats()
+	{
+		std::mt19937 generator(1);
+		std::uniform_real_distribution<float> distribution(-1000.f, 1000.f);
+
+		std::vector<float> values(ValueCount);
+		for (float& value : values)
+			value = distribution(generator);
+
+		return values;
+	}
+
+	// Mostly small values, as typical network data (ids, deltas, counts)
+	std::vector<Nz::Int32> BuildIntegers()
+	{
+		std::mt19937 generator(2);
+		std::geometric_distribution<Nz::Int32> distribution(0.01);
+		std::bernoulli_distribution signDistribution(0.5);
+
+		std::vector<Nz::Int32> values(ValueCount);
+		for (Nz::Int32& value : values)
+			value = (signDistribution(generator)) ? distribution(generator) : -distribution(generator);
+
+		return values;
+	}
+
+	void RunFloatWrite(Bench::State& state, Nz::Endianness endianness, bool bulk)
+	{
+		std::vector<float> values = BuildFloats();
+		std::vector<Nz::UInt8> buffer(ValueCount * sizeof(float));
+		Nz::MemoryView stream(buffer.data(), buffer.size());
+
+		Nz::SerializationContext context;
+		context.endianness = endianness;
+		context.stream = &stream;
+
+		state.SetBytesPerIteration(buffer.size());
+		while (state.KeepRunning())
+		{
+			stream.SetCursorPos(0);
+			if (bulk)
+				Nz::Serialize(context, values.data(), values.size());
+			else
+			{
+				for (float value : values)
+					Nz::Serialize(context, value);
+			}
+
+			Bench::DoNotOptimize(buffer.data());
+		}
+	}
+
+	void RunFloatRead(Bench::State& state, Nz::Endianness endianness, bool bulk)
+	{
+		std::vector<float> values = BuildFloats();
+		Nz::MemoryView stream(values.data(), values.size() * sizeof(float));
+
+		Nz::SerializationContext context;
+		context.endianness = endianness;
+		context.stream = &stream;
+
+		std::vector<float> readValues(ValueCount);
+
+		state.SetBytesPerIteration(values.size() * sizeof(float));
+		while (state.KeepRunning())
+		{
+			stream.SetCursorPos(0);
+			if (bulk)
+				Nz::Unserialize(context, readValues.data(), readValues.size());
+			else
+			{
+				for (float& value : readValues)
+					Nz::Unserialize(context, &value);
+			}
+
+			Bench::DoNotOptimize(readValues.data());
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/Serialization/WriteFloats/PerElement/Native")
+{
+	RunFloatWrite(state, Nz::GetPlatformEndianness(), false);
+}
+
+BENCHMARK_CASE("Core/Serialization/WriteFloats/PerElement/Swapped")
+{
+	RunFloatWrite(state, GetSwappedEndianness(), false);
+}
+
+BENCHMARK_CASE("Core/Serialization/WriteFloats/Bulk/Native")
+{
+	RunFloatWrite(state, Nz::GetPlatformEndianness(), true);
+}
+
+BENCHMARK_CASE("Core/Serialization/WriteFloats/Bulk/Swapped")
+{
+	RunFloatWrite(state, GetSwappedEndianness(), true);
+}
+
+BENCHMARK_CASE("Core/Serialization/ReadFloats/PerElement/Native")
+{
+	RunFloatRead(state, Nz::GetPlatformEndianness(), false);
+}
+
+BENCHMARK_CASE("Core/Serialization/ReadFloats/PerElement/Swapped")
+{
+	RunFloatRead(state, GetSwappedEndianness(), false);
+}
+
+BENCHMARK_CASE("Core/Serialization/ReadFloats/Bulk/Native")
+{
+	RunFloatRead(state, Nz::GetPlatformEndianness(), true);
+}
+
+BENCHMARK_CASE("Core/Serialization/ReadFloats/Bulk/Swapped")
+{
+	RunFloatRead(state, GetSwappedEndianness(), true);
+}
+
+BENCHMARK_CASE("Core/Serialization/VarInt/Write")
+{
+	std::vector<Nz::Int32> values = BuildIntegers();
+	std::vector<Nz::UInt8> buffer(ValueCount * 5);
+	Nz::MemoryView stream(buffer.data(), buffer.size());
+
+	Nz::SerializationContext context;
+	context.stream = &stream;
+
+	state.SetItemsPerIteration(ValueCount);
+	while (state.KeepRunning())
+	{
+		stream.SetCursorPos(0);
+		Nz::SerializeVarInt(context, values.data(), values.size());
+
+		Bench::DoNotOptimize(buffer.data());
+	}
+}
+
+BENCHMARK_CASE("Core/Serialization/VarInt/Read")
+{
+	std::vector<Nz::Int32> values = BuildIntegers();
+	std::vector<Nz::UInt8> buffer(ValueCount * 5);
+	Nz::MemoryView stream(buffer.data(), buffer.size());
+
+	Nz::SerializationContext context;
+	context.stream = &stream;
+	Nz::SerializeVarInt(context, values.data(), values.size());
+
+	std::vector<Nz::Int32> readValues(ValueCount);
+
+	state.SetItemsPerIteration(ValueCount);
+	while (state.KeepRunning())
+	{
+		stream.SetCursorPos(0);
+		Nz::UnserializeVarInt(context, readValues.data(), readValues.size());
+
+		Bench::DoNotOptimize(readValues.data());
+	}
+}
+
+BENCHMARK_CASE("Core/Serialization/Bits/Write")
+{
+	std::vector<Nz::UInt8> buffer(ValueCount * 2);
+	Nz::MemoryView stream(buffer.data(), buffer.size());
+
+	Nz::SerializationContext context;
+	context.stream = &stream;
+
+	state.SetItemsPerIteration(ValueCount);
+	while (state.KeepRunning())
+	{
+		stream.SetCursorPos(0);
+		for (std::size_t i = 0; i < ValueCount; ++i)
+			Nz::SerializeBits(context, i, 11);
+
+		context.FlushBits();
+		Bench::DoNotOptimize(buffer.data());
+	}
+}
+
+BENCHMARK_CASE("Core/Serialization/Bits/Read")
+{
+	std::vector<Nz::UInt8> buffer(ValueCount * 2);
+	Nz::MemoryView stream(buffer.data(), buffer.size());
+
+	Nz::SerializationContext context;
+	context.stream = &stream;
+
+	for (std::size_t i = 0; i < ValueCount; ++i)
+		Nz::SerializeBits(context, i, 11);
+
+	context.FlushBits();
+
+	state.SetItemsPerIteration(ValueCount);
+	while (state.KeepRunning())
+	{
+		stream.SetCursorPos(0);
+		context.ResetReadBitPosition();
+
+		Nz::UInt64 sum = 0;
+		for (std::size_t i = 0; i < ValueCount; ++i)
+		{
+			Nz::UInt64 value;
+			Nz::UnserializeBits(context, &value, 11);
+			sum += value;
+		}
+
+		Bench::DoNotOptimize(sum);
+	}
+}
@@ -0,0 +1,121 @@
+#include <Nazara/Core/Signal.hpp>
+#include <Benchmark.hpp>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t ListenerCount = 1000;
+
+	struct Listener
+	{
+		void OnInvalidation(const int* value)
+		{
+			sum += *value;
+		}
+
+		long long sum = 0;
+	};
+
+	void StartThread()
+	{
+		// Makes libstdc++ use atomic reference counting, as it does in any program running worker threads
+		std::thread([] {}).join();
+	}
+}
+
+BENCHMARK_CASE("Core/Signal/ConnectDisconnect")
+{
+	StartThread();
+
+	Nz::Signal<const int*> signal;
+	Listener listener;
+
+	std::vector<Nz::Signal<const int*>::Connection> connections(ListenerCount);
+
+	state.SetItemsPerIteration(ListenerCount);
+	while (state.KeepRunning())
+	{
+		for (auto& connection : connections)
+			connection = signal.Connect(listener, &Listener::OnInvalidation);
+
+		for (auto& connection : connections)
+			connection.Disconnect();
+	}
+}
+
+BENCHMARK_CASE("Core/Signal/Emit/OneListener")
+{
+	Nz::Signal<const int*> signal;
+	Listener listener;
+	signal.Connect(listener, &Listener::OnInvalidation);
+
+	int value = 1;
+
+	state.SetItemsPerIteration(ListenerCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < ListenerCount; ++i)
+			signal(&value);
+	}
+
+	Bench::DoNotOptimize(listener.sum);
+}
+
+BENCHMARK_CASE("Core/Signal/Emit/ManyListeners")
+{
+	Nz::Signal<const int*> signal;
+
+	std::vector<Listener> listeners(ListenerCount);
+	for (Listener& listener : listeners)
+		signal.Connect(listener, &Listener::OnInvalidation);
+
+	int value = 1;
+
+	state.SetItemsPerIteration(ListenerCount);
+	while (state.KeepRunning())
+		signal(&value);
+
+	Bench::DoNotOptimize(listeners.front().sum);
+}
+
+BENCHMARK_CASE("Core/Signal/Emit/NoListener")
+{
+	Nz::Signal<const int*> signal;
+
+	int value = 1;
+
+	state.SetItemsPerIteration(ListenerCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < ListenerCount; ++i)
+			signal(&value);
+	}
+}
+
+BENCHMARK_CASE("Core/Signal/ConnectionCopy")
+{
+	StartThread();
+
+	Nz::Signal<const int*> signal;
+	Listener listener;
+
+	std::vector<Nz::Signal<const int*>::Connection> connections;
+	connections.reserve(ListenerCount);
+	for (std::size_t i = 0; i < ListenerCount; ++i)
+		connections.emplace_back(signal.Connect(listener, &Listener::OnInvalidation));
+
+	state.SetItemsPerIteration(ListenerCount);
+	while (state.KeepRunning())
+	{
+		std::size_t connectedCount = 0;
+		for (const auto& connection : connections)
+		{
+			Nz::Signal<const int*>::Connection copy = connection;
+			if (copy.IsConnected())
+				connectedCount++;
+		}
+
+		Bench::DoNotOptimize(connectedCount);
+	}
+}
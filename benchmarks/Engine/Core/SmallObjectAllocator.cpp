@@ -0,0 +1,68 @@
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/SmallObjectAllocator.hpp>
+#include <Benchmark.hpp>
+#include <map>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t AllocationCount = 100000;
+	constexpr std::size_t AllocationSizes[] = { 16, 24, 48, 64, 96, 128, 200, 320 };
+	constexpr std::size_t MapSize = 100000;
+}
+
+BENCHMARK_CASE("Core/SmallObjectAllocator/AllocateFree")
+{
+	std::vector<void*> blocks(AllocationCount);
+
+	state.SetItemsPerIteration(AllocationCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < AllocationCount; ++i)
+			blocks[i] = Nz::SmallObjectAllocator::Allocate(AllocationSizes[i % Nz::CountOf(AllocationSizes)]);
+
+		for (std::size_t i = 0; i < AllocationCount; ++i)
+			Nz::SmallObjectAllocator::Free(blocks[i], AllocationSizes[i % Nz::CountOf(AllocationSizes)]);
+	}
+}
+
+BENCHMARK_CASE("Core/SmallObjectAllocator/NewDeleteReference/AllocateFree")
+{
+	std::vector<void*> blocks(AllocationCount);
+
+	state.SetItemsPerIteration(AllocationCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < AllocationCount; ++i)
+			blocks[i] = ::operator new(AllocationSizes[i % Nz::CountOf(AllocationSizes)]);
+
+		for (std::size_t i = 0; i < AllocationCount; ++i)
+			::operator delete(blocks[i]);
+	}
+}
+
+BENCHMARK_CASE("Core/SmallObjectAllocator/StdMap")
+{
+	state.SetItemsPerIteration(MapSize);
+	while (state.KeepRunning())
+	{
+		std::map<std::size_t, std::size_t, std::less<std::size_t>, Nz::SmallObjectStlAllocator<std::pair<const std::size_t, std::size_t>>> map;
+		for (std::size_t i = 0; i < MapSize; ++i)
+			map.emplace((i * 2654435761U) % MapSize, i);
+
+		Bench::DoNotOptimize(map);
+	}
+}
+
+BENCHMARK_CASE("Core/SmallObjectAllocator/NewDeleteReference/StdMap")
+{
+	state.SetItemsPerIteration(MapSize);
+	while (state.KeepRunning())
+	{
+		std::map<std::size_t, std::size_t> map;
+		for (std::size_t i = 0; i < MapSize; ++i)
+			map.emplace((i * 2654435761U) % MapSize, i);
+
+		Bench::DoNotOptimize(map);
+	}
+}
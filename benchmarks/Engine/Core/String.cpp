@@ -0,0 +1,207 @@
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/ParameterList.hpp>
+#include <Benchmark.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t StringCount = 10000;
+
+	const char* shortKeys[] = {
+		"Color", "Position", "Normal", "Tangent", "Texcoord", "Userdata0", "Size", "Rotation",
+		"SkipCache", "Level", "Flags", "Alpha", "Width", "Height", "Depth", "Format"
+	};
+
+	template<typename S>
+	std::vector<S> GenerateStrings(std::size_t length)
+	{
+		std::vector<S> strings;
+		strings.reserve(StringCount);
+		for (std::size_t i = 0; i < StringCount; ++i)
+		{
+			std::string str = "resources/" + std::to_string(i);
+			str.resize(length, 'x');
+
+			strings.emplace_back(str.c_str());
+		}
+
+		return strings;
+	}
+
+	template<typename S>
+	void BenchmarkCopy(Bench::State& state, std::size_t length)
+	{
+		std::vector<S> strings = GenerateStrings<S>(length);
+		std::vector<S> copies;
+		copies.reserve(StringCount);
+
+		state.SetItemsPerIteration(StringCount);
+		while (state.KeepRunning())
+		{
+			for (const S& str : strings)
+				copies.push_back(str);
+
+			Bench::DoNotOptimize(copies.data());
+			copies.clear();
+		}
+	}
+
+	template<typename S>
+	void BenchmarkConstruct(Bench::State& state)
+	{
+		state.SetItemsPerIteration(StringCount);
+		while (state.KeepRunning())
+		{
+			for (std::size_t i = 0; i < StringCount; ++i)
+			{
+				S str(shortKeys[i % 16]);
+				Bench::DoNotOptimize(str);
+			}
+		}
+	}
+
+	template<typename S>
+	void BenchmarkCompare(Bench::State& state, std::size_t length)
+	{
+		std::vector<S> first = GenerateStrings<S>(length);
+		std::vector<S> second = GenerateStrings<S>(length);
+
+		state.SetItemsPerIteration(StringCount);
+		while (state.KeepRunning())
+		{
+			std::size_t equalCount = 0;
+			for (std::size_t i = 0; i < StringCount; ++i)
+				equalCount += (first[i] == second[i]) ? 1 : 0;
+
+			Bench::DoNotOptimize(equalCount);
+		}
+	}
+
+	template<typename S>
+	void BenchmarkHash(Bench::State& state, std::size_t length)
+	{
+		std::vector<S> strings = GenerateStrings<S>(length);
+		std::hash<S> hasher;
+
+		state.SetItemsPerIteration(StringCount);
+		while (state.KeepRunning())
+		{
+			std::size_t hash = 0;
+			for (const S& str : strings)
+				hash ^= hasher(str);
+
+			Bench::DoNotOptimize(hash);
+		}
+	}
+
+	template<typename S>
+	void BenchmarkMapLookup(Bench::State& state)
+	{
+		std::unordered_map<S, int> map;
+		for (int i = 0; i < 16; ++i)
+			map[shortKeys[i]] = i;
+
+		state.SetItemsPerIteration(StringCount);
+		while (state.KeepRunning())
+		{
+			int sum = 0;
+			for (std::size_t i = 0; i < StringCount; ++i)
+				sum += map.find(shortKeys[i % 16])->second;
+
+			Bench::DoNotOptimize(sum);
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/String/Copy/Short")
+{
+	BenchmarkCopy<Nz::String>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/Copy/Long")
+{
+	BenchmarkCopy<Nz::String>(state, 64);
+}
+
+BENCHMARK_CASE("Core/String/Construct/Short")
+{
+	BenchmarkConstruct<Nz::String>(state);
+}
+
+BENCHMARK_CASE("Core/String/Compare/Short")
+{
+	BenchmarkCompare<Nz::String>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/Compare/Long")
+{
+	BenchmarkCompare<Nz::String>(state, 64);
+}
+
+BENCHMARK_CASE("Core/String/Hash/Short")
+{
+	BenchmarkHash<Nz::String>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/Hash/Long")
+{
+	BenchmarkHash<Nz::String>(state, 64);
+}
+
+BENCHMARK_CASE("Core/String/MapLookup")
+{
+	BenchmarkMapLookup<Nz::String>(state);
+}
+
+BENCHMARK_CASE("Core/String/ParameterListLookup")
+{
+	Nz::ParameterList parameters;
+	for (int i = 0; i < 16; ++i)
+		parameters.SetParameter(shortKeys[i], static_cast<long long>(i));
+
+	state.SetItemsPerIteration(StringCount);
+	while (state.KeepRunning())
+	{
+		long long sum = 0;
+		for (std::size_t i = 0; i < StringCount; ++i)
+		{
+			long long value;
+			if (parameters.GetIntegerParameter(shortKeys[i % 16], &value))
+				sum += value;
+		}
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/Copy/Short")
+{
+	BenchmarkCopy<std::string>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/Copy/Long")
+{
+	BenchmarkCopy<std::string>(state, 64);
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/Construct/Short")
+{
+	BenchmarkConstruct<std::string>(state);
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/Compare/Short")
+{
+	BenchmarkCompare<std::string>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/Hash/Short")
+{
+	BenchmarkHash<std::string>(state, 12);
+}
+
+BENCHMARK_CASE("Core/String/StdStringReference/MapLookup")
+{
+	BenchmarkMapLookup<std::string>(state);
+}
@@ -0,0 +1,224 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Benchmark.hpp>
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t EmptyTaskCount = 1000000;
+	constexpr std::size_t FlatTaskCount = 100000;
+	constexpr int NestedDepth = 16; // 2^17 - 1 tasks
+
+	// Reference implementation: the former scheduler design, one queue guarded by a single mutex and condition variable
+	class MutexQueueScheduler
+	{
+		public:
+			MutexQueueScheduler(unsigned int workerCount) :
+			m_activeTaskCount(0),
+			m_running(true)
+			{
+				for (unsigned int i = 0; i < workerCount; ++i)
+					m_workers.emplace_back(&MutexQueueScheduler::WorkerProc, this);
+			}
+
+			~MutexQueueScheduler()
+			{
+				{
+					Nz::LockGuard lock(m_mutex);
+					m_running = false;
+					m_notEmpty.SignalAll();
+				}
+
+				for (Nz::Thread& worker : m_workers)
+					worker.Join();
+			}
+
+			template<typename F>
+			void AddTask(F function)
+			{
+				Nz::LockGuard lock(m_mutex);
+				m_activeTaskCount++;
+				m_tasks.push(new Nz::FunctorWithoutArgs<F>(function));
+				m_notEmpty.Signal();
+			}
+
+			void Run(std::vector<Nz::Functor*>& tasks)
+			{
+				Nz::LockGuard lock(m_mutex);
+				m_activeTaskCount += tasks.size();
+				for (Nz::Functor* task : tasks)
+					m_tasks.push(task);
+
+				tasks.clear();
+				m_notEmpty.SignalAll();
+			}
+
+			void WaitForTasks()
+			{
+				Nz::LockGuard lock(m_mutex);
+				while (m_activeTaskCount > 0)
+					m_empty.Wait(&m_mutex);
+			}
+
+		private:
+			void WorkerProc()
+			{
+				Nz::LockGuard lock(m_mutex);
+				for (;;)
+				{
+					while (m_running && m_tasks.empty())
+						m_notEmpty.Wait(&m_mutex);
+
+					if (!m_running)
+						break;
+
+					std::unique_ptr<Nz::Functor> task(m_tasks.front());
+					m_tasks.pop();
+
+					lock.Unlock();
+					task->Run();
+					task.reset();
+					lock.Lock();
+
+					if (--m_activeTaskCount == 0)
+						m_empty.SignalAll();
+				}
+			}
+
+			std::queue<Nz::Functor*> m_tasks;
+			std::vector<Nz::Thread> m_workers;
+			Nz::ConditionVariable m_empty;
+			Nz::ConditionVariable m_notEmpty;
+			Nz::Mutex m_mutex;
+			std::size_t m_activeTaskCount;
+			bool m_running;
+	};
+
+	std::atomic_uint s_counter;
+
+	void SpawnNested(int depth)
+	{
+		s_counter++;
+
+		if (depth > 0)
+		{
+			Nz::TaskScheduler::AddTask([depth]() { SpawnNested(depth - 1); });
+			Nz::TaskScheduler::AddTask([depth]() { SpawnNested(depth - 1); });
+		}
+	}
+
+	void SpawnNestedReference(MutexQueueScheduler* scheduler, int depth)
+	{
+		s_counter++;
+
+		if (depth > 0)
+		{
+			scheduler->AddTask([scheduler, depth]() { SpawnNestedReference(scheduler, depth - 1); });
+			scheduler->AddTask([scheduler, depth]() { SpawnNestedReference(scheduler, depth - 1); });
+		}
+	}
+}
+
+BENCHMARK_CASE("Core/TaskScheduler/Flat")
+{
+	Nz::TaskScheduler::Initialize();
+
+	state.SetItemsPerIteration(FlatTaskCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < FlatTaskCount; ++i)
+			Nz::TaskScheduler::AddTask([]() { s_counter++; });
+
+		Nz::TaskScheduler::Run();
+		Nz::TaskScheduler::WaitForTasks();
+	}
+}
+
+BENCHMARK_CASE("Core/TaskScheduler/EmptyTasks")
+{
+	Nz::TaskScheduler::Initialize();
+
+	state.SetItemsPerIteration(EmptyTaskCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < EmptyTaskCount; ++i)
+			Nz::TaskScheduler::AddTask([]() {});
+
+		Nz::TaskScheduler::Run();
+		Nz::TaskScheduler::WaitForTasks();
+	}
+}
+
+// Same as EmptyTasks, with every task paying for a heap-allocated functor (as before task slots were pooled)
+BENCHMARK_CASE("Core/TaskScheduler/EmptyTasks/HeapFunctorReference")
+{
+	Nz::TaskScheduler::Initialize();
+
+	state.SetItemsPerIteration(EmptyTaskCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < EmptyTaskCount; ++i)
+		{
+			auto emptyTask = []() {};
+			Nz::Functor* functor = new Nz::FunctorWithoutArgs<decltype(emptyTask)>(emptyTask);
+			Nz::TaskScheduler::AddTask([functor]()
+			{
+				functor->Run();
+				delete functor;
+			});
+		}
+
+		Nz::TaskScheduler::Run();
+		Nz::TaskScheduler::WaitForTasks();
+	}
+}
+
+BENCHMARK_CASE("Core/TaskScheduler/Nested")
+{
+	Nz::TaskScheduler::Initialize();
+
+	state.SetItemsPerIteration((1 << (NestedDepth + 1)) - 1);
+	while (state.KeepRunning())
+	{
+		Nz::TaskScheduler::AddTask([]() { SpawnNested(NestedDepth); });
+
+		Nz::TaskScheduler::Run();
+		Nz::TaskScheduler::WaitForTasks();
+	}
+}
+
+BENCHMARK_CASE("Core/TaskScheduler/MutexQueueReference/Flat")
+{
+	MutexQueueScheduler scheduler(Nz::TaskScheduler::GetWorkerCount());
+	std::vector<Nz::Functor*> pendingTasks;
+
+	state.SetItemsPerIteration(FlatTaskCount);
+	while (state.KeepRunning())
+	{
+		auto task = []() { s_counter++; };
+		for (std::size_t i = 0; i < FlatTaskCount; ++i)
+			pendingTasks.push_back(new Nz::FunctorWithoutArgs<decltype(task)>(task));
+
+		scheduler.Run(pendingTasks);
+		scheduler.WaitForTasks();
+	}
+}
+
+BENCHMARK_CASE("Core/TaskScheduler/MutexQueueReference/Nested")
+{
+	MutexQueueScheduler scheduler(Nz::TaskScheduler::GetWorkerCount());
+	MutexQueueScheduler* schedulerPtr = &scheduler;
+
+	state.SetItemsPerIteration((1 << (NestedDepth + 1)) - 1);
+	while (state.KeepRunning())
+	{
+		scheduler.AddTask([schedulerPtr]() { SpawnNestedReference(schedulerPtr, NestedDepth); });
+		scheduler.WaitForTasks();
+	}
+}
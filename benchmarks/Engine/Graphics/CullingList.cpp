@@ -0,0 +1,398 @@
+#include <Nazara/Graphics/CullingList.hpp>
+#include <Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t RenderableCount = 10000;
+
+	struct Renderable
+	{
+		std::size_t id;
+	};
+
+	Nz::Frustumf BuildFrustum()
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(70.f, 16.f / 9.f, 1.f, 500.f, Nz::Vector3f::Zero(), Nz::Vector3f::Forward());
+
+		return frustum;
+	}
+
+	std::vector<Nz::Boxf> BuildBoxes(std::size_t count = RenderableCount)
+	{
+		// Renderables spread around the camera, about a fifth of them being visible
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-500.f, 500.f);
+		std::uniform_real_distribution<float> size(0.5f, 10.f);
+
+		std::vector<Nz::Boxf> boxes;
+		boxes.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float extent = size(generator);
+			boxes.emplace_back(position(generator), position(generator), position(generator), extent, extent, extent);
+		}
+
+		return boxes;
+	}
+
+	std::vector<Nz::Boxf> BuildOpenWorldBoxes(std::size_t count)
+	{
+		// Renderables spread over a large flat world, only a few of them being in view
+		std::mt19937 generator(43);
+		std::uniform_real_distribution<float> position(-5000.f, 5000.f);
+		std::uniform_real_distribution<float> altitude(-50.f, 50.f);
+		std::uniform_real_distribution<float> size(0.5f, 10.f);
+
+		std::vector<Nz::Boxf> boxes;
+		boxes.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float extent = size(generator);
+			boxes.emplace_back(position(generator), altitude(generator), position(generator), extent, extent, extent);
+		}
+
+		return boxes;
+	}
+
+	void RunCullBoxes(Bench::State& state, const std::vector<Nz::Boxf>& boxes, Nz::CullingBackend backend = Nz::CullingBackend_Linear)
+	{
+		Nz::CullingList<Renderable> cullingList;
+		cullingList.SetBackend(backend);
+
+		Nz::Frustumf frustum = BuildFrustum();
+		std::size_t count = boxes.size();
+
+		std::vector<Renderable> renderables(count);
+		std::vector<Nz::CullingList<Renderable>::BoxEntry> entries;
+		entries.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			renderables[i].id = i;
+
+			entries.emplace_back(cullingList.RegisterBoxTest(&renderables[i]));
+			entries.back().UpdateBox(boxes[i]);
+		}
+
+		state.SetItemsPerIteration(count);
+		while (state.KeepRunning())
+		{
+			std::size_t visibleHash = cullingList.Cull(frustum);
+			Bench::DoNotOptimize(visibleHash);
+		}
+	}
+
+	void RunCullSpheres(Bench::State& state, std::size_t count)
+	{
+		Nz::CullingList<Renderable> cullingList;
+		Nz::Frustumf frustum = BuildFrustum();
+		std::vector<Nz::Boxf> boxes = BuildBoxes(count);
+
+		std::vector<Renderable> renderables(count);
+		std::vector<Nz::CullingList<Renderable>::SphereEntry> entries;
+		entries.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			renderables[i].id = i;
+
+			entries.emplace_back(cullingList.RegisterSphereTest(&renderables[i]));
+			entries.back().UpdateSphere(Nz::Spheref(boxes[i].GetCenter(), boxes[i].GetRadius()));
+		}
+
+		state.SetItemsPerIteration(count);
+		while (state.KeepRunning())
+		{
+			std::size_t visibleHash = cullingList.Cull(frustum);
+			Bench::DoNotOptimize(visibleHash);
+		}
+	}
+
+	void RunUpdateBoxes(Bench::State& state, Nz::CullingBackend backend)
+	{
+		// Moving every renderable, as when the whole scene is animated
+		Nz::CullingList<Renderable> cullingList;
+		cullingList.SetBackend(backend);
+
+		std::vector<Nz::Boxf> boxes = BuildBoxes();
+
+		std::vector<Renderable> renderables(RenderableCount);
+		std::vector<Nz::CullingList<Renderable>::BoxEntry> entries;
+		entries.reserve(RenderableCount);
+		for (std::size_t i = 0; i < RenderableCount; ++i)
+			entries.emplace_back(cullingList.RegisterBoxTest(&renderables[i]));
+
+		float offset = 0.f;
+
+		state.SetItemsPerIteration(RenderableCount);
+		while (state.KeepRunning())
+		{
+			for (std::size_t i = 0; i < RenderableCount; ++i)
+			{
+				Nz::Boxf box = boxes[i];
+				box.x += offset;
+
+				entries[i].UpdateBox(box);
+			}
+
+			offset += 0.01f;
+		}
+	}
+
+	// Kernels alone, without building the result lists
+	void RunKernelBoxes(Bench::State& state, std::size_t count, Nz::CullingKernels::Implementation implementation)
+	{
+		Nz::Frustumf frustum = BuildFrustum();
+
+		Nz::CullingBoxArray boxArray;
+		for (const Nz::Boxf& box : BuildBoxes(count))
+			boxArray.Add(box);
+
+		std::vector<Nz::UInt8> results(count);
+
+		if (!Nz::CullingKernels::IsImplementationSupported(implementation))
+			return;
+
+		Nz::CullingKernels::Implementation previousImplementation = Nz::CullingKernels::GetImplementation();
+		Nz::CullingKernels::SetImplementation(implementation);
+
+		state.SetItemsPerIteration(count);
+		while (state.KeepRunning())
+		{
+			Nz::CullingKernels::CullBoxes(frustum, boxArray, results.data());
+			Bench::DoNotOptimize(results.data());
+		}
+
+		Nz::CullingKernels::SetImplementation(previousImplementation);
+	}
+
+	void RunKernelSpheres(Bench::State& state, std::size_t count, Nz::CullingKernels::Implementation implementation)
+	{
+		Nz::Frustumf frustum = BuildFrustum();
+
+		Nz::CullingSphereArray sphereArray;
+		for (const Nz::Boxf& box : BuildBoxes(count))
+			sphereArray.Add(Nz::Spheref(box.GetCenter(), box.GetRadius()));
+
+		std::vector<Nz::UInt8> results(count);
+
+		if (!Nz::CullingKernels::IsImplementationSupported(implementation))
+			return;
+
+		Nz::CullingKernels::Implementation previousImplementation = Nz::CullingKernels::GetImplementation();
+		Nz::CullingKernels::SetImplementation(implementation);
+
+		state.SetItemsPerIteration(count);
+		while (state.KeepRunning())
+		{
+			Nz::CullingKernels::CullSpheres(frustum, sphereArray, results.data());
+			Bench::DoNotOptimize(results.data());
+		}
+
+		Nz::CullingKernels::SetImplementation(previousImplementation);
+	}
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/10K")
+{
+	RunCullBoxes(state, BuildBoxes(10000));
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Spheres/10K")
+{
+	RunCullSpheres(state, 10000);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/100K")
+{
+	RunCullBoxes(state, BuildBoxes(100000));
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Spheres/100K")
+{
+	RunCullSpheres(state, 100000);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/1M")
+{
+	RunCullBoxes(state, BuildBoxes(1000000));
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Spheres/1M")
+{
+	RunCullSpheres(state, 1000000);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/Linear/10K")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(10000), Nz::CullingBackend_Linear);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/Linear/100K")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(100000), Nz::CullingBackend_Linear);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/Linear/1M")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(1000000), Nz::CullingBackend_Linear);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/DynamicTree/10K")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(10000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/DynamicTree/100K")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(100000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/OpenWorld/DynamicTree/1M")
+{
+	RunCullBoxes(state, BuildOpenWorldBoxes(1000000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/DynamicTree/10K")
+{
+	RunCullBoxes(state, BuildBoxes(10000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/DynamicTree/100K")
+{
+	RunCullBoxes(state, BuildBoxes(100000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Boxes/DynamicTree/1M")
+{
+	RunCullBoxes(state, BuildBoxes(1000000), Nz::CullingBackend_DynamicTree);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/Scalar/10K")
+{
+	RunKernelBoxes(state, 10000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/SSE2/10K")
+{
+	RunKernelBoxes(state, 10000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/AVX/10K")
+{
+	RunKernelBoxes(state, 10000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/Scalar/10K")
+{
+	RunKernelSpheres(state, 10000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/SSE2/10K")
+{
+	RunKernelSpheres(state, 10000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/AVX/10K")
+{
+	RunKernelSpheres(state, 10000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/Scalar/100K")
+{
+	RunKernelBoxes(state, 100000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/SSE2/100K")
+{
+	RunKernelBoxes(state, 100000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/AVX/100K")
+{
+	RunKernelBoxes(state, 100000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/Scalar/100K")
+{
+	RunKernelSpheres(state, 100000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/SSE2/100K")
+{
+	RunKernelSpheres(state, 100000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/AVX/100K")
+{
+	RunKernelSpheres(state, 100000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/Scalar/1M")
+{
+	RunKernelBoxes(state, 1000000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/SSE2/1M")
+{
+	RunKernelBoxes(state, 1000000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Boxes/AVX/1M")
+{
+	RunKernelBoxes(state, 1000000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/Scalar/1M")
+{
+	RunKernelSpheres(state, 1000000, Nz::CullingKernels::Implementation_Scalar);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/SSE2/1M")
+{
+	RunKernelSpheres(state, 1000000, Nz::CullingKernels::Implementation_SSE2);
+}
+
+BENCHMARK_CASE("Graphics/CullingKernels/Spheres/AVX/1M")
+{
+	RunKernelSpheres(state, 1000000, Nz::CullingKernels::Implementation_AVX);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/Cull/Volumes")
+{
+	Nz::CullingList<Renderable> cullingList;
+	Nz::Frustumf frustum = BuildFrustum();
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+
+	std::vector<Renderable> renderables(RenderableCount);
+	std::vector<Nz::CullingList<Renderable>::VolumeEntry> entries;
+	entries.reserve(RenderableCount);
+	for (std::size_t i = 0; i < RenderableCount; ++i)
+	{
+		renderables[i].id = i;
+
+		Nz::BoundingVolumef volume(boxes[i]);
+		volume.Update(Nz::Matrix4f::Identity());
+
+		entries.emplace_back(cullingList.RegisterVolumeTest(&renderables[i]));
+		entries.back().UpdateVolume(volume);
+	}
+
+	state.SetItemsPerIteration(RenderableCount);
+	while (state.KeepRunning())
+	{
+		std::size_t visibleHash = cullingList.Cull(frustum);
+		Bench::DoNotOptimize(visibleHash);
+	}
+}
+
+BENCHMARK_CASE("Graphics/CullingList/UpdateBoxes")
+{
+	RunUpdateBoxes(state, Nz::CullingBackend_Linear);
+}
+
+BENCHMARK_CASE("Graphics/CullingList/UpdateBoxes/DynamicTree")
+{
+	RunUpdateBoxes(state, Nz::CullingBackend_DynamicTree);
+}
@@ -0,0 +1,151 @@
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Benchmark.hpp>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	struct DrawItem
+	{
+		Nz::UInt64 key;
+	};
+
+	// Keys made the same way as the ones of BasicRenderQueue: a few layers and states shared by many draw items
+	std::vector<DrawItem> BuildStateKeys(std::size_t count)
+	{
+		std::mt19937 generator(24);
+		std::uniform_int_distribution<unsigned int> layer(0, 3);
+		std::uniform_int_distribution<unsigned int> state(0, 31);
+
+		std::vector<DrawItem> items(count);
+		for (DrawItem& item : items)
+		{
+			item.key = (Nz::UInt64(layer(generator)) << 48) |
+			           (Nz::UInt64(state(generator) % 4) << 40) |
+			           (Nz::UInt64(state(generator)) << 32) |
+			           (Nz::UInt64(state(generator) % 8) << 24) |
+			           (Nz::UInt64(state(generator)) << 16) |
+			           (Nz::UInt64(state(generator)) << 8);
+		}
+
+		return items;
+	}
+
+	// Back-to-front keys, each draw item having its own depth
+	std::vector<DrawItem> BuildDepthKeys(std::size_t count)
+	{
+		std::mt19937 generator(25);
+		std::uniform_int_distribution<unsigned int> layer(0, 1);
+		std::uniform_real_distribution<float> distance(1.f, 250000.f);
+
+		std::vector<DrawItem> items(count);
+		for (DrawItem& item : items)
+		{
+			float depth = distance(generator);
+
+			Nz::UInt32 depthBits;
+			std::memcpy(&depthBits, &depth, sizeof(float));
+
+			item.key = (Nz::UInt64(layer(generator)) << 48) | (Nz::UInt64(~depthBits) << 16);
+		}
+
+		return items;
+	}
+
+	void RunComparisonSort(Bench::State& state, const std::vector<DrawItem>& items)
+	{
+		// What RenderQueue::Sort used to do: build the (key, index) pairs and compare them
+		std::vector<std::pair<Nz::UInt64, std::size_t>> orderedQueue;
+
+		state.SetItemsPerIteration(items.size());
+		while (state.KeepRunning())
+		{
+			orderedQueue.clear();
+			orderedQueue.reserve(items.size());
+
+			std::size_t dataIndex = 0;
+			for (const DrawItem& item : items)
+				orderedQueue.emplace_back(item.key, dataIndex++);
+
+			std::sort(orderedQueue.begin(), orderedQueue.end());
+			Bench::DoNotOptimize(orderedQueue.data());
+		}
+	}
+
+	void RunRenderQueueSort(Bench::State& state, const std::vector<DrawItem>& items)
+	{
+		Nz::RenderQueue<DrawItem> queue;
+		for (DrawItem item : items)
+			queue.Insert(std::move(item));
+
+		state.SetItemsPerIteration(items.size());
+		while (state.KeepRunning())
+		{
+			queue.Sort([](const DrawItem& item) { return item.key; });
+			Bench::DoNotOptimize(queue);
+		}
+	}
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/StdSort/10K")
+{
+	RunComparisonSort(state, BuildStateKeys(10000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/RadixSort/10K")
+{
+	RunRenderQueueSort(state, BuildStateKeys(10000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/StdSort/100K")
+{
+	RunComparisonSort(state, BuildStateKeys(100000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/RadixSort/100K")
+{
+	RunRenderQueueSort(state, BuildStateKeys(100000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/StdSort/500K")
+{
+	RunComparisonSort(state, BuildStateKeys(500000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/States/RadixSort/500K")
+{
+	RunRenderQueueSort(state, BuildStateKeys(500000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/StdSort/10K")
+{
+	RunComparisonSort(state, BuildDepthKeys(10000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/RadixSort/10K")
+{
+	RunRenderQueueSort(state, BuildDepthKeys(10000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/StdSort/100K")
+{
+	RunComparisonSort(state, BuildDepthKeys(100000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/RadixSort/100K")
+{
+	RunRenderQueueSort(state, BuildDepthKeys(100000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/StdSort/500K")
+{
+	RunComparisonSort(state, BuildDepthKeys(500000));
+}
+
+BENCHMARK_CASE("Graphics/RenderQueue/Sort/Depth/RadixSort/500K")
+{
+	RunRenderQueueSort(state, BuildDepthKeys(500000));
+}
@@ -0,0 +1,107 @@
+#include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t VolumeCount = 10000;
+
+	Nz::Frustumf BuildFrustum()
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(70.f, 16.f / 9.f, 1.f, 500.f, Nz::Vector3f::Zero(), Nz::Vector3f::Forward());
+
+		return frustum;
+	}
+
+	std::vector<Nz::Boxf> BuildBoxes()
+	{
+		// Objects spread around the camera, about a fifth of them being visible
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-500.f, 500.f);
+		std::uniform_real_distribution<float> size(0.5f, 10.f);
+
+		std::vector<Nz::Boxf> boxes;
+		boxes.reserve(VolumeCount);
+		for (std::size_t i = 0; i < VolumeCount; ++i)
+		{
+			float extent = size(generator);
+			boxes.emplace_back(position(generator), position(generator), position(generator), extent, extent, extent);
+		}
+
+		return boxes;
+	}
+}
+
+BENCHMARK_CASE("Math/Frustum/ContainsBox")
+{
+	Nz::Frustumf frustum = BuildFrustum();
+	std::vector<Nz::Boxf> boxes = BuildBoxes();
+
+	state.SetItemsPerIteration(VolumeCount);
+	while (state.KeepRunning())
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Boxf& box : boxes)
+		{
+			if (frustum.Contains(box))
+				visibleCount++;
+		}
+
+		Bench::DoNotOptimize(visibleCount);
+	}
+}
+
+BENCHMARK_CASE("Math/Frustum/ContainsSphere")
+{
+	Nz::Frustumf frustum = BuildFrustum();
+
+	std::vector<Nz::Spheref> spheres;
+	spheres.reserve(VolumeCount);
+	for (const Nz::Boxf& box : BuildBoxes())
+		spheres.emplace_back(box.GetCenter(), box.GetRadius());
+
+	state.SetItemsPerIteration(VolumeCount);
+	while (state.KeepRunning())
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Spheref& sphere : spheres)
+		{
+			if (frustum.Contains(sphere))
+				visibleCount++;
+		}
+
+		Bench::DoNotOptimize(visibleCount);
+	}
+}
+
+BENCHMARK_CASE("Math/Frustum/IntersectVolume")
+{
+	Nz::Frustumf frustum = BuildFrustum();
+
+	std::vector<Nz::BoundingVolumef> volumes;
+	volumes.reserve(VolumeCount);
+	for (const Nz::Boxf& box : BuildBoxes())
+	{
+		Nz::BoundingVolumef volume(box);
+		volume.Update(Nz::Matrix4f::Identity());
+
+		volumes.push_back(volume);
+	}
+
+	state.SetItemsPerIteration(VolumeCount);
+	while (state.KeepRunning())
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::BoundingVolumef& volume : volumes)
+		{
+			if (frustum.Intersect(volume) != Nz::IntersectionSide_Outside)
+				visibleCount++;
+		}
+
+		Bench::DoNotOptimize(visibleCount);
+	}
+}
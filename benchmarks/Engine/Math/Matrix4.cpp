@@ -0,0 +1,104 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Benchmark.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t MatrixCount = 10000;
+
+	std::vector<Nz::Matrix4f> BuildTransforms()
+	{
+		std::vector<Nz::Matrix4f> matrices;
+		matrices.reserve(MatrixCount);
+
+		for (std::size_t i = 0; i < MatrixCount; ++i)
+		{
+			float f = static_cast<float>(i);
+			matrices.push_back(Nz::Matrix4f::Transform(Nz::Vector3f(f, -f, f * 0.5f), Nz::EulerAnglesf(f, f * 2.f, f * 3.f).ToQuaternion(), Nz::Vector3f(1.f + f * 0.001f)));
+		}
+
+		return matrices;
+	}
+}
+
+BENCHMARK_CASE("Math/Matrix4/Concatenate")
+{
+	std::vector<Nz::Matrix4f> matrices = BuildTransforms();
+	Nz::Matrix4f viewProj = Nz::Matrix4f::Perspective(70.f, 16.f / 9.f, 1.f, 1000.f) * Nz::Matrix4f::LookAt(Nz::Vector3f::Zero(), Nz::Vector3f::Forward());
+
+	state.SetItemsPerIteration(MatrixCount);
+	while (state.KeepRunning())
+	{
+		for (const Nz::Matrix4f& matrix : matrices)
+		{
+			Nz::Matrix4f result = Nz::Matrix4f::Concatenate(matrix, viewProj);
+			Bench::DoNotOptimize(result);
+		}
+	}
+}
+
+BENCHMARK_CASE("Math/Matrix4/ConcatenateAffine")
+{
+	std::vector<Nz::Matrix4f> matrices = BuildTransforms();
+	Nz::Matrix4f view = Nz::Matrix4f::LookAt(Nz::Vector3f::Zero(), Nz::Vector3f::Forward());
+
+	state.SetItemsPerIteration(MatrixCount);
+	while (state.KeepRunning())
+	{
+		for (const Nz::Matrix4f& matrix : matrices)
+		{
+			Nz::Matrix4f result = Nz::Matrix4f::ConcatenateAffine(matrix, view);
+			Bench::DoNotOptimize(result);
+		}
+	}
+}
+
+BENCHMARK_CASE("Math/Matrix4/Inverse")
+{
+	std::vector<Nz::Matrix4f> matrices = BuildTransforms();
+
+	state.SetItemsPerIteration(MatrixCount);
+	while (state.KeepRunning())
+	{
+		Nz::Matrix4f inverse;
+		for (const Nz::Matrix4f& matrix : matrices)
+		{
+			matrix.GetInverse(&inverse);
+			Bench::DoNotOptimize(inverse);
+		}
+	}
+}
+
+BENCHMARK_CASE("Math/Matrix4/InverseAffine")
+{
+	std::vector<Nz::Matrix4f> matrices = BuildTransforms();
+
+	state.SetItemsPerIteration(MatrixCount);
+	while (state.KeepRunning())
+	{
+		Nz::Matrix4f inverse;
+		for (const Nz::Matrix4f& matrix : matrices)
+		{
+			matrix.GetInverseAffine(&inverse);
+			Bench::DoNotOptimize(inverse);
+		}
+	}
+}
+
+BENCHMARK_CASE("Math/Matrix4/TransformPoint")
+{
+	std::vector<Nz::Matrix4f> matrices = BuildTransforms();
+
+	state.SetItemsPerIteration(MatrixCount);
+	while (state.KeepRunning())
+	{
+		Nz::Vector3f sum = Nz::Vector3f::Zero();
+		for (const Nz::Matrix4f& matrix : matrices)
+			sum += matrix.Transform(Nz::Vector3f::Unit());
+
+		Bench::DoNotOptimize(sum);
+	}
+}
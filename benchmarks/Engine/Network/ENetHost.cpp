@@ -0,0 +1,123 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <Benchmark.hpp>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t PacketCount = 100;
+	constexpr std::size_t PacketSize = 256;
+
+	struct LoopbackConnection
+	{
+		Nz::ENetHost client;
+		Nz::ENetHost server;
+		Nz::ENetPeer* clientPeer = nullptr;
+	};
+
+	bool Connect(LoopbackConnection& connection)
+	{
+		std::random_device randomDevice;
+		std::uniform_int_distribution<Nz::UInt16> portDistribution(1025, 65535);
+
+		// Hosts created with a loopback address are clients and are not bound
+		Nz::UInt16 port = portDistribution(randomDevice);
+		if (!connection.server.Create(Nz::IpAddress(Nz::IpAddress::AnyIpV4.ToIPv4(), port), 1, 1) || !connection.client.Create(Nz::IpAddress::LoopbackIpV4, 1, 1))
+			return false;
+
+		connection.clientPeer = connection.client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		if (!connection.clientPeer)
+			return false;
+
+		// Service both sides until the handshake is done
+		Nz::ENetEvent event;
+		for (unsigned int i = 0; i < 1000 && !connection.clientPeer->IsConnected(); ++i)
+		{
+			connection.server.Service(&event, 1);
+			connection.client.Service(&event, 1);
+		}
+
+		return connection.clientPeer->IsConnected();
+	}
+
+	// Services both hosts until the server received every packet
+	bool ReceivePackets(LoopbackConnection& connection, std::size_t packetCount)
+	{
+		std::size_t receivedCount = 0;
+		for (unsigned int i = 0; i < 100000 && receivedCount < packetCount; ++i)
+		{
+			Nz::ENetEvent event;
+			while (connection.server.Service(&event, 0) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+					receivedCount++;
+			}
+
+			while (connection.client.Service(&event, 0) > 0);
+		}
+
+		return receivedCount == packetCount;
+	}
+}
+
+BENCHMARK_CASE("Network/ENetHost/Loopback/Reliable")
+{
+	LoopbackConnection connection;
+	if (!Connect(connection))
+	{
+		std::fprintf(stderr, "Failed to connect ENet hosts on loopback\n");
+		return;
+	}
+
+	Nz::UInt8 payload[PacketSize] = {};
+
+	state.SetItemsPerIteration(PacketCount);
+	state.SetBytesPerIteration(PacketCount * PacketSize);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < PacketCount; ++i)
+			connection.clientPeer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload, PacketSize));
+
+		connection.client.Flush();
+
+		if (!ReceivePackets(connection, PacketCount))
+		{
+			std::fprintf(stderr, "Packets were lost on loopback\n");
+			return;
+		}
+	}
+}
+
+BENCHMARK_CASE("Network/UdpSocket/Loopback")
+{
+	Nz::UdpSocket server(Nz::NetProtocol_IPv4);
+	Nz::UdpSocket client(Nz::NetProtocol_IPv4);
+	if (server.Bind(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 0)) != Nz::SocketState_Bound ||
+	    client.Bind(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 0)) != Nz::SocketState_Bound)
+	{
+		std::fprintf(stderr, "Failed to bind UDP sockets on loopback\n");
+		return;
+	}
+
+	Nz::IpAddress serverAddress = server.GetBoundAddress();
+
+	Nz::UInt8 payload[PacketSize] = {};
+	Nz::NetPacket packet(1, payload, PacketSize);
+	Nz::NetPacket receivedPacket;
+
+	state.SetItemsPerIteration(PacketCount);
+	state.SetBytesPerIteration(PacketCount * PacketSize);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < PacketCount; ++i)
+		{
+			client.SendPacket(serverAddress, packet);
+
+			Nz::IpAddress from;
+			server.ReceivePacket(&receivedPacket, &from);
+		}
+	}
+}
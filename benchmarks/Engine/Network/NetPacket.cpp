@@ -0,0 +1,92 @@
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Benchmark.hpp>
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t PacketCount = 100000;
+	constexpr std::size_t PacketSize = 200;
+
+	void BuildPackets(std::size_t packetCount)
+	{
+		for (std::size_t i = 0; i < packetCount; ++i)
+		{
+			Nz::NetPacket packet(1, PacketSize);
+			packet << Nz::UInt32(i);
+
+			Bench::DoNotOptimize(packet.GetConstData());
+		}
+	}
+
+	void RunThreads(Bench::State& state, unsigned int threadCount)
+	{
+		state.SetItemsPerIteration(PacketCount);
+		while (state.KeepRunning())
+		{
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+				threads.emplace_back(BuildPackets, PacketCount / threadCount);
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+		}
+	}
+}
+
+BENCHMARK_CASE("Network/NetPacket/CreateDestroy/1Thread")
+{
+	RunThreads(state, 1);
+}
+
+BENCHMARK_CASE("Network/NetPacket/CreateDestroy/4Threads")
+{
+	RunThreads(state, 4);
+}
+
+BENCHMARK_CASE("Network/NetPacket/CreateDestroy/8Threads")
+{
+	RunThreads(state, 8);
+}
+
+BENCHMARK_CASE("Network/NetPacket/ProducerConsumer")
+{
+	// Packets are built by a thread and freed by another one, as when a server prepares packets for the network thread
+	constexpr std::size_t BatchCount = 100;
+	constexpr std::size_t PacketPerBatch = PacketCount / BatchCount;
+
+	state.SetItemsPerIteration(PacketCount);
+	while (state.KeepRunning())
+	{
+		std::array<std::vector<Nz::NetPacket>, BatchCount> batches;
+		std::atomic<std::size_t> readyBatches(0);
+
+		Nz::Thread producer([&]()
+		{
+			for (std::vector<Nz::NetPacket>& batch : batches)
+			{
+				batch.reserve(PacketPerBatch);
+				for (std::size_t i = 0; i < PacketPerBatch; ++i)
+					batch.emplace_back(1, PacketSize);
+
+				readyBatches.fetch_add(1, std::memory_order_release);
+			}
+		});
+
+		Nz::Thread consumer([&]()
+		{
+			for (std::size_t i = 0; i < BatchCount; ++i)
+			{
+				while (readyBatches.load(std::memory_order_acquire) <= i)
+					Nz::Thread::Sleep(0);
+
+				batches[i].clear();
+			}
+		});
+
+		producer.Join();
+		consumer.Join();
+	}
+}
@@ -0,0 +1,83 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Benchmark.hpp>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t ChildCount = 1000;
+	constexpr std::size_t Depth = 4;
+}
+
+BENCHMARK_CASE("Utility/Node/MoveRootAndUpdate")
+{
+	// A root with chains of nodes under it, as an entity hierarchy would be
+	Nz::Node root;
+
+	std::vector<std::unique_ptr<Nz::Node>> nodes;
+	std::vector<const Nz::Node*> leaves;
+	nodes.reserve(ChildCount * Depth);
+	leaves.reserve(ChildCount);
+
+	for (std::size_t i = 0; i < ChildCount; ++i)
+	{
+		const Nz::Node* parent = &root;
+		for (std::size_t j = 0; j < Depth; ++j)
+		{
+			nodes.emplace_back(std::make_unique<Nz::Node>());
+			nodes.back()->SetParent(parent);
+			nodes.back()->SetPosition(static_cast<float>(i), static_cast<float>(j), 0.f);
+
+			parent = nodes.back().get();
+		}
+
+		leaves.push_back(parent);
+	}
+
+	float offset = 0.f;
+
+	state.SetItemsPerIteration(ChildCount * Depth);
+	while (state.KeepRunning())
+	{
+		root.SetPosition(offset, 0.f, 0.f);
+		offset += 1.f;
+
+		Nz::Vector3f sum = Nz::Vector3f::Zero();
+		for (const Nz::Node* leaf : leaves)
+			sum += leaf->GetTransformMatrix().GetTranslation();
+
+		Bench::DoNotOptimize(sum);
+	}
+}
+
+BENCHMARK_CASE("Utility/Node/UpdateLeaves")
+{
+	Nz::Node root;
+
+	std::vector<std::unique_ptr<Nz::Node>> leaves;
+	leaves.reserve(ChildCount);
+	for (std::size_t i = 0; i < ChildCount; ++i)
+	{
+		leaves.emplace_back(std::make_unique<Nz::Node>());
+		leaves.back()->SetParent(root);
+	}
+
+	float angle = 0.f;
+
+	state.SetItemsPerIteration(ChildCount);
+	while (state.KeepRunning())
+	{
+		Nz::Quaternionf rotation = Nz::EulerAnglesf(0.f, angle, 0.f).ToQuaternion();
+		angle += 1.f;
+
+		Nz::Vector3f sum = Nz::Vector3f::Zero();
+		for (const auto& leaf : leaves)
+		{
+			leaf->SetRotation(rotation);
+			sum += leaf->GetForward();
+		}
+
+		Bench::DoNotOptimize(sum);
+	}
+}
@@ -0,0 +1,154 @@
+#include <NDK/Systems/RenderSystem.hpp>
+#include <NDK/World.hpp>
+#include <NDK/Components/CameraComponent.hpp>
+#include <NDK/Components/GraphicsComponent.hpp>
+#include <NDK/Components/LightComponent.hpp>
+#include <NDK/Components/NodeComponent.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Graphics/AbstractRenderTechnique.hpp>
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/Sprite.hpp>
+#include <Nazara/Renderer/RenderTarget.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Benchmark.hpp>
+#include <random>
+
+namespace
+{
+	constexpr std::size_t DrawableCount = 20000;
+
+	// Render queue construction only, nothing is drawn
+	class QueueOnlyRenderTechnique : public Nz::AbstractRenderTechnique
+	{
+		public:
+			void Clear(const Nz::SceneData& /*sceneData*/) const override
+			{
+			}
+
+			bool Draw(const Nz::SceneData& /*sceneData*/) const override
+			{
+				return true;
+			}
+
+			Nz::AbstractRenderQueue* GetRenderQueue() override
+			{
+				return &m_renderQueue;
+			}
+
+			Nz::RenderTechniqueType GetType() const override
+			{
+				return Nz::RenderTechniqueType_User;
+			}
+
+		private:
+			Nz::BasicRenderQueue m_renderQueue;
+	};
+
+	class NullRenderTarget : public Nz::RenderTarget
+	{
+		public:
+			Nz::RenderTargetParameters GetParameters() const override
+			{
+				return Nz::RenderTargetParameters();
+			}
+
+			Nz::Vector2ui GetSize() const override
+			{
+				return Nz::Vector2ui(1280U, 720U);
+			}
+
+			bool IsRenderable() const override
+			{
+				return true;
+			}
+
+			bool HasContext() const override
+			{
+				return true;
+			}
+
+		protected:
+			bool Activate() const override
+			{
+				return true;
+			}
+
+			void EnsureTargetUpdated() const override
+			{
+			}
+	};
+
+	// Half models and half sprites in front of the camera, with a light forcing the render queue to be rebuilt every update
+	void BuildScene(Ndk::World& world, const NullRenderTarget& target, bool parallelQueueing)
+	{
+		Ndk::RenderSystem& renderSystem = world.AddSystem<Ndk::RenderSystem>();
+		renderSystem.ChangeRenderTechnique<QueueOnlyRenderTechnique>();
+		renderSystem.EnableParallelQueueing(parallelQueueing);
+
+		const Ndk::EntityHandle& camera = world.CreateEntity();
+		camera->AddComponent<Ndk::NodeComponent>();
+		Ndk::CameraComponent& cameraComponent = camera->AddComponent<Ndk::CameraComponent>();
+		cameraComponent.SetTarget(&target);
+		cameraComponent.SetZFar(1000.f);
+
+		const Ndk::EntityHandle& light = world.CreateEntity();
+		light->AddComponent<Ndk::NodeComponent>();
+		light->AddComponent<Ndk::LightComponent>(Nz::LightType_Directional);
+
+		Nz::MeshParams meshParams;
+		meshParams.storage = Nz::DataStorage_Software;
+
+		Nz::MeshRef mesh = Nz::Mesh::New();
+		mesh->CreateStatic();
+		mesh->BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit()), meshParams);
+
+		Nz::ModelRef model = Nz::Model::New();
+		model->SetMesh(mesh);
+
+		Nz::SpriteRef sprite = Nz::Sprite::New();
+		sprite->SetSize(1.f, 1.f);
+
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<float> lateral(-100.f, 100.f);
+		std::uniform_real_distribution<float> depth(-900.f, -200.f);
+
+		for (std::size_t i = 0; i < DrawableCount; ++i)
+		{
+			const Ndk::EntityHandle& drawable = world.CreateEntity();
+
+			Ndk::NodeComponent& node = drawable->AddComponent<Ndk::NodeComponent>();
+			node.SetPosition(lateral(generator), lateral(generator), depth(generator));
+
+			Ndk::GraphicsComponent& graphics = drawable->AddComponent<Ndk::GraphicsComponent>();
+			if (i % 2 == 0)
+				graphics.Attach(model);
+			else
+				graphics.Attach(sprite, static_cast<int>(i % 3));
+		}
+
+		world.Update(0.f);
+	}
+
+	void RunRenderQueueConstruction(Bench::State& state, bool parallelQueueing)
+	{
+		NullRenderTarget target;
+
+		Ndk::World world(false);
+		BuildScene(world, target, parallelQueueing);
+
+		state.SetItemsPerIteration(DrawableCount);
+		while (state.KeepRunning())
+			world.Update(0.f);
+	}
+}
+
+BENCHMARK_CASE("NDK/RenderSystem/RenderQueue/Serial")
+{
+	RunRenderQueueConstruction(state, false);
+}
+
+BENCHMARK_CASE("NDK/RenderSystem/RenderQueue/Parallel")
+{
+	RunRenderQueueConstruction(state, true);
+}
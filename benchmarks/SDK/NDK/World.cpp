@@ -0,0 +1,161 @@
+#include <NDK/Algorithm.hpp>
+#include <NDK/Component.hpp>
+#include <NDK/System.hpp>
+#include <NDK/World.hpp>
+#include <Benchmark.hpp>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t EntityCount = 10000;
+
+	class PositionComponent : public Ndk::Component<PositionComponent>
+	{
+		public:
+			float x = 0.f;
+			float y = 0.f;
+
+			static Ndk::ComponentIndex componentIndex;
+	};
+
+	class VelocityComponent : public Ndk::Component<VelocityComponent>
+	{
+		public:
+			float x = 1.f;
+			float y = 1.f;
+
+			static Ndk::ComponentIndex componentIndex;
+	};
+
+	Ndk::ComponentIndex PositionComponent::componentIndex;
+	Ndk::ComponentIndex VelocityComponent::componentIndex;
+
+	class MovementSystem : public Ndk::System<MovementSystem>
+	{
+		public:
+			MovementSystem()
+			{
+				Requires<PositionComponent, VelocityComponent>();
+			}
+
+			static Ndk::SystemIndex systemIndex;
+
+		private:
+			void OnUpdate(float elapsedTime) override
+			{
+				for (const Ndk::EntityHandle& entity : GetEntities())
+				{
+					PositionComponent& position = entity->GetComponent<PositionComponent>();
+					const VelocityComponent& velocity = entity->GetComponent<VelocityComponent>();
+
+					position.x += velocity.x * elapsedTime;
+					position.y += velocity.y * elapsedTime;
+				}
+			}
+	};
+
+	Ndk::SystemIndex MovementSystem::systemIndex;
+
+	void InitializeTypes()
+	{
+		static bool initialized = false;
+		if (!initialized)
+		{
+			Ndk::InitializeComponent<PositionComponent>("BnchPos");
+			Ndk::InitializeComponent<VelocityComponent>("BnchVel");
+			Ndk::InitializeSystem<MovementSystem>();
+
+			initialized = true;
+		}
+	}
+}
+
+BENCHMARK_CASE("NDK/World/CreateRefreshKill")
+{
+	InitializeTypes();
+
+	Ndk::World world(false);
+	world.AddSystem<MovementSystem>();
+
+	std::vector<Ndk::EntityHandle> entities;
+	entities.reserve(EntityCount);
+
+	state.SetItemsPerIteration(EntityCount);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < EntityCount; ++i)
+		{
+			const Ndk::EntityHandle& entity = world.CreateEntity();
+			entity->AddComponent<PositionComponent>();
+			entity->AddComponent<VelocityComponent>();
+
+			entities.push_back(entity);
+		}
+
+		world.Refresh();
+
+		for (const Ndk::EntityHandle& entity : entities)
+			entity->Kill();
+
+		entities.clear();
+		world.Refresh();
+	}
+}
+
+BENCHMARK_CASE("NDK/World/RefreshComponentChanges")
+{
+	InitializeTypes();
+
+	Ndk::World world(false);
+	world.AddSystem<MovementSystem>();
+
+	std::vector<Ndk::EntityHandle> entities;
+	entities.reserve(EntityCount);
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		const Ndk::EntityHandle& entity = world.CreateEntity();
+		entity->AddComponent<PositionComponent>();
+		entity->AddComponent<VelocityComponent>();
+
+		entities.push_back(entity);
+	}
+	world.Refresh();
+
+	bool removed = false;
+
+	// Every other entity leaves then joins the system again
+	state.SetItemsPerIteration(EntityCount / 2);
+	while (state.KeepRunning())
+	{
+		for (std::size_t i = 0; i < EntityCount; i += 2)
+		{
+			if (removed)
+				entities[i]->AddComponent<VelocityComponent>();
+			else
+				entities[i]->RemoveComponent<VelocityComponent>();
+		}
+
+		removed = !removed;
+		world.Refresh();
+	}
+}
+
+BENCHMARK_CASE("NDK/World/Update")
+{
+	InitializeTypes();
+
+	Ndk::World world(false);
+	world.AddSystem<MovementSystem>();
+
+	for (std::size_t i = 0; i < EntityCount; ++i)
+	{
+		const Ndk::EntityHandle& entity = world.CreateEntity();
+		entity->AddComponent<PositionComponent>();
+		entity->AddComponent<VelocityComponent>();
+	}
+	world.Refresh();
+
+	state.SetItemsPerIteration(EntityCount);
+	while (state.KeepRunning())
+		world.Update(1.f / 60.f);
+}
@@ -0,0 +1,32 @@
+#include <Benchmark.hpp>
+#include <NDK/Application.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/Log.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char* argv[])
+{
+	Ndk::Application application(argc, argv);
+	Nz::Initializer<Nz::Network> modules;
+
+	Nz::Log::GetLogger()->EnableStdReplication(false);
+
+	// Usage: NazaraBenchmarks [filter] [--iterations N] [--warmup N] [--json file]
+	Bench::Options options;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+			options.iterationCount = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+			options.warmupCount = std::strtoul(argv[++i], nullptr, 10);
+		else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			options.jsonPath = argv[++i];
+		else
+			options.filter = argv[i];
+	}
+
+	return Bench::RunAll(options);
+}
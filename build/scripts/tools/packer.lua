@@ -0,0 +1,19 @@
+TOOL.Name = "Packer"
+
+TOOL.Directory = "../tools/Packer"
+TOOL.EnableConsole = true
+TOOL.Kind = "Application"
+TOOL.TargetDirectory = TOOL.Directory
+
+TOOL.Includes = {
+	"../include"
+}
+
+TOOL.Files = {
+	"../tools/Packer/**.hpp",
+	"../tools/Packer/**.cpp"
+}
+
+TOOL.Libraries = {
+	"NazaraCore"
+}
@@ -32,6 +32,8 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <Nazara/Core/AsyncLogger.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteStream.hpp>
@@ -43,6 +45,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Directory.hpp>
 #include <Nazara/Core/DynLib.hpp>
+#include <Nazara/Core/DynamicAABBTree.hpp>
 #include <Nazara/Core/EmptyStream.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Enums.hpp>
@@ -53,11 +56,13 @@
 #include <Nazara/Core/Flags.hpp>
 #include <Nazara/Core/Functor.hpp>
 #include <Nazara/Core/GuillotineBinPack.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Initializer.hpp>
 #include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
 #include <Nazara/Core/MemoryManager.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
@@ -69,10 +74,14 @@
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/PackFile.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Core/ParameterKey.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/PluginManager.hpp>
 #include <Nazara/Core/Primitive.hpp>
 #include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Resource.hpp>
 #include <Nazara/Core/ResourceLoader.hpp>
@@ -82,6 +91,7 @@
 #include <Nazara/Core/Semaphore.hpp>
 #include <Nazara/Core/SerializationContext.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/SmallObjectAllocator.hpp>
 #include <Nazara/Core/SparsePtr.hpp>
 #include <Nazara/Core/StackArray.hpp>
 #include <Nazara/Core/StackVector.hpp>
@@ -89,10 +99,14 @@
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/String.hpp>
 #include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/StringView.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/ThreadCachePool.hpp>
 #include <Nazara/Core/TypeTag.hpp>
 #include <Nazara/Core/Unicode.hpp>
 #include <Nazara/Core/Updatable.hpp>
+#include <Nazara/Core/X86Intrinsics.hpp>
 
 #endif // NAZARA_GLOBAL_CORE_HPP
@@ -46,6 +46,17 @@ namespace Nz
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Serialize(SerializationContext& context, T value, TypeTag<T>);
 
+	template<typename T>
+	std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool> Serialize(SerializationContext& context, const T* values, std::size_t count);
+
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount);
+
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, T value);
+
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, const T* values, std::size_t count);
+
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value);
 
@@ -54,6 +65,17 @@ namespace Nz
 
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Unserialize(SerializationContext& context, T* value, TypeTag<T>);
+
+	template<typename T>
+	std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool> Unserialize(SerializationContext& context, T* values, std::size_t count);
+
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount);
+
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* value);
+
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* values, std::size_t count);
 }
 
 #include <Nazara/Core/Algorithm.inl>
@@ -11,7 +11,9 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Stream.hpp>
+#include <algorithm>
 #include <climits>
+#include <cstring>
 #include <utility>
 #include <Nazara/Core/Debug.hpp>
 
@@ -33,6 +35,103 @@ namespace Nz
 		}
 
 		NAZARA_CORE_API extern const UInt8 BitReverseTable256[256];
+
+		template<typename T>
+		constexpr std::size_t MaxVarIntSize()
+		{
+			return (sizeof(T) * CHAR_BIT + 6) / 7;
+		}
+
+		// Zigzag encoding maps signed integers to unsigned ones so that small magnitudes stay small (0, -1, 1, -2 => 0, 1, 2, 3)
+		template<typename T>
+		std::make_unsigned_t<T> ZigZagEncode(T value, std::true_type /*isSigned*/)
+		{
+			using UnsignedType = std::make_unsigned_t<T>;
+
+			return static_cast<UnsignedType>(static_cast<UnsignedType>(static_cast<UnsignedType>(value) << 1) ^ static_cast<UnsignedType>(value >> (sizeof(T) * CHAR_BIT - 1)));
+		}
+
+		template<typename T>
+		T ZigZagEncode(T value, std::false_type /*isSigned*/)
+		{
+			return value;
+		}
+
+		template<typename T>
+		T ZigZagDecode(std::make_unsigned_t<T> value, std::true_type /*isSigned*/)
+		{
+			using UnsignedType = std::make_unsigned_t<T>;
+
+			return static_cast<T>(static_cast<UnsignedType>(value >> 1) ^ static_cast<UnsignedType>(-static_cast<UnsignedType>(value & 1)));
+		}
+
+		template<typename T>
+		T ZigZagDecode(T value, std::false_type /*isSigned*/)
+		{
+			return value;
+		}
+
+		template<typename T>
+		std::size_t EncodeVarInt(T value, UInt8* buffer)
+		{
+			auto encodedValue = ZigZagEncode(value, std::is_signed<T>());
+
+			std::size_t size = 0;
+			while (encodedValue >= 0x80)
+			{
+				buffer[size++] = static_cast<UInt8>(encodedValue | 0x80);
+				encodedValue >>= 7;
+			}
+			buffer[size++] = static_cast<UInt8>(encodedValue);
+
+			return size;
+		}
+
+		// Returns the number of bytes read, or zero if the buffer does not start with a complete and valid encoding of T
+		template<typename T>
+		std::size_t DecodeVarInt(const UInt8* buffer, std::size_t size, T* value)
+		{
+			using UnsignedType = std::make_unsigned_t<T>;
+			constexpr unsigned int BitCount = sizeof(T) * CHAR_BIT;
+			constexpr std::size_t MaxSize = MaxVarIntSize<T>();
+
+			UnsignedType decodedValue = 0;
+			std::size_t maxSize = std::min(size, MaxSize);
+			for (std::size_t i = 0; i < maxSize; ++i)
+			{
+				UInt8 byte = buffer[i];
+				unsigned int shift = static_cast<unsigned int>(i * 7);
+
+				// The last byte may only hold the remaining bits of the value, without continuation
+				if (i == MaxSize - 1 && (byte >> (BitCount - shift)) != 0)
+					return 0;
+
+				decodedValue |= static_cast<UnsignedType>(static_cast<UnsignedType>(byte & 0x7F) << shift);
+				if ((byte & 0x80) == 0)
+				{
+					*value = ZigZagDecode<T>(decodedValue, std::is_signed<T>());
+					return i + 1;
+				}
+			}
+
+			return 0;
+		}
+
+		template<typename T>
+		bool UnserializeVarIntFromStream(Stream& stream, T* value)
+		{
+			UInt8 buffer[MaxVarIntSize<T>()];
+			for (std::size_t i = 0; i < MaxVarIntSize<T>(); ++i)
+			{
+				if (stream.Read(&buffer[i], 1) != 1)
+					return false;
+
+				if ((buffer[i] & 0x80) == 0)
+					return DecodeVarInt(buffer, i + 1, value) != 0;
+			}
+
+			return false;
+		}
 	}
 
 	/*!
@@ -272,6 +371,165 @@ namespace Nz
 		return context.stream->Write(&value, sizeof(T)) == sizeof(T);
 	}
 
+	/*!
+	* \ingroup core
+	* \brief Serializes an array of arithmetic values
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param values Pointer to the first value to serialize
+	* \param count Number of values to serialize
+	*
+	* \remark The encoding is the same as serializing each value one at a time, but the values are written in one block if no byte swap is required, and swapped in bulk otherwise
+	* \remark Produce a NazaraAssert if pointer to values is invalid
+	*
+	* \see Serialize, Unserialize
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool> Serialize(SerializationContext& context, const T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		// Flush bits in case a writing is in progress
+		context.FlushBits();
+
+		if (context.endianness == Endianness_Unknown || context.endianness == GetPlatformEndianness())
+		{
+			std::size_t byteCount = count * sizeof(T);
+			return context.stream->Write(values, byteCount) == byteCount;
+		}
+
+		// Values can't be swapped in place, go through a buffer
+		constexpr std::size_t BufferCount = 4096 / sizeof(T);
+		T buffer[BufferCount];
+
+		while (count > 0)
+		{
+			std::size_t bufferCount = std::min(count, BufferCount);
+			std::memcpy(buffer, values, bufferCount * sizeof(T));
+			SwapBytesArray(buffer, bufferCount);
+
+			std::size_t byteCount = bufferCount * sizeof(T);
+			if (context.stream->Write(buffer, byteCount) != byteCount)
+				return false;
+
+			values += bufferCount;
+			count -= bufferCount;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes the lower bits of an integer
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Integer whose bits are serialized
+	* \param bitCount Number of bits to serialize, starting from the least significant one (up to 64)
+	*
+	* \remark Bits are packed the same way booleans are, both can be mixed; don't forget to flush bits once done
+	*
+	* \see SerializationContext::FlushBits, UnserializeBits
+	*/
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count must be less or equal to 64");
+
+		// Completed bytes are gathered to be written in one go
+		UInt8 buffer[9];
+		std::size_t bufferSize = 0;
+
+		while (bitCount > 0)
+		{
+			if (context.writeBitPos == 8)
+			{
+				context.writeBitPos = 0;
+				context.writeByte = 0;
+			}
+
+			unsigned int bits = std::min(8U - context.writeBitPos, bitCount);
+			context.writeByte |= static_cast<UInt8>((value & ((1U << bits) - 1)) << context.writeBitPos);
+			context.writeBitPos += bits;
+
+			value >>= bits;
+			bitCount -= bits;
+
+			if (context.writeBitPos == 8)
+				buffer[bufferSize++] = context.writeByte;
+		}
+
+		return bufferSize == 0 || context.stream->Write(buffer, bufferSize) == bufferSize;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes an integer using a variable-length encoding
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Integer to serialize
+	*
+	* Values are encoded seven bits per byte (LEB128), signed values being zigzag-encoded first, which makes small values (in magnitude) take a single byte
+	* This encoding doesn't depend on the context endianness
+	*
+	* \see UnserializeVarInt
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, T value)
+	{
+		// Flush bits in case a writing is in progress
+		context.FlushBits();
+
+		UInt8 buffer[Detail::MaxVarIntSize<T>()];
+		std::size_t size = Detail::EncodeVarInt(value, buffer);
+
+		return context.stream->Write(buffer, size) == size;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes an array of integers using a variable-length encoding
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param values Pointer to the first integer to serialize
+	* \param count Number of integers to serialize
+	*
+	* \remark The encoding is the same as serializing each value one at a time
+	* \remark Produce a NazaraAssert if pointer to values is invalid
+	*
+	* \see UnserializeVarInt
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, const T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		// Flush bits in case a writing is in progress
+		context.FlushBits();
+
+		constexpr std::size_t BufferSize = 1024;
+		UInt8 buffer[BufferSize];
+		std::size_t bufferSize = 0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (BufferSize - bufferSize < Detail::MaxVarIntSize<T>())
+			{
+				if (context.stream->Write(buffer, bufferSize) != bufferSize)
+					return false;
+
+				bufferSize = 0;
+			}
+
+			bufferSize += Detail::EncodeVarInt(values[i], &buffer[bufferSize]);
+		}
+
+		return bufferSize == 0 || context.stream->Write(buffer, bufferSize) == bufferSize;
+	}
+
 
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value)
@@ -353,6 +611,165 @@ namespace Nz
 		else
 			return false;
 	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an array of arithmetic values
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param values Pointer to the first value to unserialize
+	* \param count Number of values to unserialize
+	*
+	* \remark Values are read in one block, and swapped in place if required
+	* \remark Produce a NazaraAssert if pointer to values is invalid
+	*
+	* \see Serialize, Unserialize
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool> Unserialize(SerializationContext& context, T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		context.ResetReadBitPosition();
+
+		std::size_t byteCount = count * sizeof(T);
+		if (context.stream->Read(values, byteCount) != byteCount)
+			return false;
+
+		if (context.endianness != Endianness_Unknown && context.endianness != GetPlatformEndianness())
+			SwapBytesArray(values, count);
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes bits into an integer
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the integer receiving the bits (higher bits are cleared), can be null to skip them
+	* \param bitCount Number of bits to unserialize (up to 64)
+	*
+	* \see SerializeBits
+	*/
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count must be less or equal to 64");
+
+		// Read every byte we need at once
+		UInt8 buffer[9];
+		std::size_t bufferPos = 0;
+
+		unsigned int availableBits = 8U - context.readBitPos;
+		if (bitCount > availableBits)
+		{
+			std::size_t byteCount = (bitCount - availableBits + 7) / 8;
+			if (context.stream->Read(buffer, byteCount) != byteCount)
+				return false;
+		}
+
+		UInt64 result = 0;
+		unsigned int resultBits = 0;
+		while (resultBits < bitCount)
+		{
+			if (context.readBitPos == 8)
+			{
+				context.readByte = buffer[bufferPos++];
+				context.readBitPos = 0;
+			}
+
+			unsigned int bits = std::min(8U - context.readBitPos, bitCount - resultBits);
+			UInt64 chunk = (context.readByte >> context.readBitPos) & ((1U << bits) - 1);
+			result |= chunk << resultBits;
+
+			context.readBitPos += bits;
+			resultBits += bits;
+		}
+
+		if (value)
+			*value = result;
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an integer encoded with a variable-length encoding
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the integer to unserialize
+	*
+	* \remark Encodings too long or overflowing T are rejected
+	* \remark If the stream gives access to its memory (see Stream::GetMemoryView), bytes are decoded in place
+	* \remark Produce a NazaraAssert if pointer to value is invalid
+	*
+	* \see SerializeVarInt
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* value)
+	{
+		return UnserializeVarInt(context, value, 1);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an array of integers encoded with a variable-length encoding
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param values Pointer to the first integer to unserialize
+	* \param count Number of integers to unserialize
+	*
+	* \remark Encodings too long or overflowing T are rejected
+	* \remark If the stream gives access to its memory (see Stream::GetMemoryView), bytes are decoded in place
+	* \remark Produce a NazaraAssert if pointer to values is invalid
+	*
+	* \see SerializeVarInt
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		context.ResetReadBitPosition();
+
+		Stream& stream = *context.stream;
+		if (const UInt8* memory = stream.GetMemoryView())
+		{
+			UInt64 cursorPos = stream.GetCursorPos();
+			UInt64 streamSize = stream.GetSize();
+			if (cursorPos > streamSize)
+				return false;
+
+			const UInt8* data = memory + cursorPos;
+			std::size_t dataSize = static_cast<std::size_t>(streamSize - cursorPos);
+
+			std::size_t offset = 0;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				std::size_t size = Detail::DecodeVarInt(&data[offset], dataSize - offset, &values[i]);
+				if (size == 0)
+					return false;
+
+				offset += size;
+			}
+
+			return stream.SetCursorPos(cursorPos + offset);
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (!Detail::UnserializeVarIntFromStream(stream, &values[i]))
+					return false;
+			}
+
+			return true;
+		}
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,114 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ARENAALLOCATOR_HPP
+#define NAZARA_ARENAALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ArenaAllocator
+	{
+		public:
+			ArenaAllocator(std::size_t blockSize = 64 * 1024);
+			ArenaAllocator(const ArenaAllocator&) = delete;
+			ArenaAllocator(ArenaAllocator&&) noexcept = default;
+			~ArenaAllocator() = default;
+
+			inline void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+			template<typename T> T* AllocateArray(std::size_t count);
+
+			inline std::size_t GetAllocationCount() const;
+			inline std::size_t GetBlockSize() const;
+			inline std::size_t GetHeapAllocationCount() const;
+			inline std::size_t GetReservedMemory() const;
+			inline std::size_t GetUsedMemory() const;
+
+			template<typename T, typename... Args> T* New(Args&&... args);
+
+			void Reset();
+
+			ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+			ArenaAllocator& operator=(ArenaAllocator&&) noexcept = default;
+
+		private:
+			void* AllocateFromNextBlock(std::size_t size, std::size_t alignment);
+
+			struct Block
+			{
+				std::unique_ptr<UInt8[]> memory;
+				std::size_t size;
+			};
+
+			std::size_t m_allocationCount;
+			std::size_t m_blockSize;
+			std::size_t m_currentBlock;
+			std::size_t m_heapAllocationCount;
+			std::size_t m_offset;           //< Offset of the first free byte of the current block
+			std::size_t m_previousBlocksUsage;
+			std::vector<Block> m_blocks;
+	};
+
+	class NAZARA_CORE_API FrameAllocator
+	{
+		public:
+			FrameAllocator(std::size_t frameCount = 2, std::size_t blockSize = 64 * 1024);
+			FrameAllocator(const FrameAllocator&) = delete;
+			FrameAllocator(FrameAllocator&&) noexcept = default;
+			~FrameAllocator() = default;
+
+			inline ArenaAllocator& GetCurrentFrame();
+			inline const ArenaAllocator& GetCurrentFrame() const;
+			inline std::size_t GetFrameCount() const;
+			inline std::size_t GetLastFrameHeapAllocationCount() const;
+
+			void NextFrame();
+
+			FrameAllocator& operator=(const FrameAllocator&) = delete;
+			FrameAllocator& operator=(FrameAllocator&&) noexcept = default;
+
+		private:
+			std::size_t m_currentFrame;
+			std::size_t m_lastFrameHeapAllocationCount;
+			std::vector<ArenaAllocator> m_frames;
+	};
+
+	template<typename T>
+	class ArenaStlAllocator
+	{
+		template<typename U> friend class ArenaStlAllocator;
+
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = ArenaStlAllocator<U>;
+			};
+
+			inline ArenaStlAllocator(ArenaAllocator& arena);
+			template<typename U> ArenaStlAllocator(const ArenaStlAllocator<U>& allocator) noexcept;
+			~ArenaStlAllocator() = default;
+
+			T* allocate(std::size_t n);
+			void deallocate(T* ptr, std::size_t n);
+
+			template<typename U> bool operator==(const ArenaStlAllocator<U>& allocator) const;
+			template<typename U> bool operator!=(const ArenaStlAllocator<U>& allocator) const;
+
+		private:
+			ArenaAllocator* m_arena;
+	};
+}
+
+#include <Nazara/Core/ArenaAllocator.inl>
+
+#endif // NAZARA_ARENAALLOCATOR_HPP
@@ -0,0 +1,232 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Allocates memory from the arena
+	* \return Pointer to the allocated memory, valid until the next call to Reset
+	*
+	* \param size Size of the memory to allocate
+	* \param alignment Alignment of the memory, must be a power of two not greater than alignof(std::max_align_t)
+	*/
+	inline void* ArenaAllocator::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NazaraAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+		NazaraAssert(alignment <= alignof(std::max_align_t), "Over-aligned allocations are not supported");
+
+		m_allocationCount++;
+
+		if (m_currentBlock < m_blocks.size())
+		{
+			Block& block = m_blocks[m_currentBlock];
+
+			std::size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+			if (offset + size <= block.size)
+			{
+				m_offset = offset + size;
+				return &block.memory[offset];
+			}
+		}
+
+		return AllocateFromNextBlock(size, alignment);
+	}
+
+	/*!
+	* \brief Allocates an uninitialized array from the arena
+	* \return Pointer to the first element of the array, valid until the next call to Reset
+	*
+	* \param count Number of elements of the array
+	*/
+	template<typename T>
+	T* ArenaAllocator::AllocateArray(std::size_t count)
+	{
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/*!
+	* \brief Gets the number of allocations made since the last reset
+	* \return Number of allocations
+	*/
+	inline std::size_t ArenaAllocator::GetAllocationCount() const
+	{
+		return m_allocationCount;
+	}
+
+	/*!
+	* \brief Gets the default size of the blocks requested from the heap
+	* \return Size of a block
+	*/
+	inline std::size_t ArenaAllocator::GetBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	/*!
+	* \brief Gets the number of blocks requested from the heap since the last reset
+	* \return Number of heap allocations, which should be zero once the arena has been used a few times with the same pattern
+	*/
+	inline std::size_t ArenaAllocator::GetHeapAllocationCount() const
+	{
+		return m_heapAllocationCount;
+	}
+
+	/*!
+	* \brief Gets the memory owned by the arena
+	* \return Size of all blocks
+	*/
+	inline std::size_t ArenaAllocator::GetReservedMemory() const
+	{
+		std::size_t reservedMemory = 0;
+		for (const Block& block : m_blocks)
+			reservedMemory += block.size;
+
+		return reservedMemory;
+	}
+
+	/*!
+	* \brief Gets the memory used since the last reset
+	* \return Used memory, including alignment padding and the unused end of previous blocks
+	*/
+	inline std::size_t ArenaAllocator::GetUsedMemory() const
+	{
+		return m_previousBlocksUsage + m_offset;
+	}
+
+	/*!
+	* \brief Constructs an object in the arena
+	* \return Pointer to the object, valid until the next call to Reset
+	*
+	* \param args Arguments for the constructor of the object
+	*
+	* \remark Destructors are never called by the arena, objects have to be destroyed manually (if they need to) before resetting it
+	*/
+	template<typename T, typename... Args>
+	T* ArenaAllocator::New(Args&&... args)
+	{
+		return PlacementNew(static_cast<T*>(Allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Gets the arena of the current frame
+	* \return Arena which will be reset when it gets reused, after FrameCount frames
+	*/
+	inline ArenaAllocator& FrameAllocator::GetCurrentFrame()
+	{
+		return m_frames[m_currentFrame];
+	}
+
+	/*!
+	* \brief Gets the arena of the current frame
+	* \return Arena which will be reset when it gets reused, after FrameCount frames
+	*/
+	inline const ArenaAllocator& FrameAllocator::GetCurrentFrame() const
+	{
+		return m_frames[m_currentFrame];
+	}
+
+	/*!
+	* \brief Gets the number of frames memory stays valid
+	* \return Number of arenas used in turns
+	*/
+	inline std::size_t FrameAllocator::GetFrameCount() const
+	{
+		return m_frames.size();
+	}
+
+	/*!
+	* \brief Gets the number of heap allocations made by the frame before the current one
+	* \return Number of heap allocations, zero meaning the previous frame did not allocate any memory from the heap
+	*/
+	inline std::size_t FrameAllocator::GetLastFrameHeapAllocationCount() const
+	{
+		return m_lastFrameHeapAllocationCount;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ArenaStlAllocator
+	* \brief Core class that represents a standard allocator allocating from an ArenaAllocator
+	*
+	* Deallocation does nothing, memory is released at once when the arena is reset.
+	*
+	* \remark Containers using it must be destroyed or cleared before the arena is reset
+	*/
+
+	/*!
+	* \brief Constructs a ArenaStlAllocator object allocating from an arena
+	*
+	* \param arena Arena to allocate from
+	*/
+	template<typename T>
+	inline ArenaStlAllocator<T>::ArenaStlAllocator(ArenaAllocator& arena) :
+	m_arena(&arena)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ArenaStlAllocator object from another one (rebinding)
+	*
+	* \param allocator Allocator to copy the arena from
+	*/
+	template<typename T>
+	template<typename U>
+	ArenaStlAllocator<T>::ArenaStlAllocator(const ArenaStlAllocator<U>& allocator) noexcept :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	/*!
+	* \brief Allocates memory for n objects from the arena
+	* \return Pointer to the allocated (but not constructed) objects
+	*
+	* \param n Number of objects
+	*/
+	template<typename T>
+	T* ArenaStlAllocator<T>::allocate(std::size_t n)
+	{
+		return m_arena->AllocateArray<T>(n);
+	}
+
+	/*!
+	* \brief Does nothing, memory is released when the arena is reset
+	*/
+	template<typename T>
+	void ArenaStlAllocator<T>::deallocate(T* /*ptr*/, std::size_t /*n*/)
+	{
+	}
+
+	/*!
+	* \brief Compares two ArenaStlAllocator
+	* \return True if both allocators allocate from the same arena
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool ArenaStlAllocator<T>::operator==(const ArenaStlAllocator<U>& allocator) const
+	{
+		return m_arena == allocator.m_arena;
+	}
+
+	/*!
+	* \brief Compares two ArenaStlAllocator
+	* \return False if both allocators allocate from the same arena
+	*
+	* \param allocator Other allocator
+	*/
+	template<typename T>
+	template<typename U>
+	bool ArenaStlAllocator<T>::operator!=(const ArenaStlAllocator<U>& allocator) const
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
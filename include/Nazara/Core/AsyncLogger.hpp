@@ -0,0 +1,108 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ASYNCLOGGER_HPP
+#define NAZARA_ASYNCLOGGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/StdLogger.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <atomic>
+#include <ctime>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AsyncLogger : public AbstractLogger
+	{
+		public:
+			AsyncLogger(const String& logPath = "NazaraLog.log", std::size_t queueCapacity = 4096, LogOverflowPolicy overflowPolicy = LogOverflowPolicy_Block);
+			AsyncLogger(const AsyncLogger&) = delete;
+			AsyncLogger(AsyncLogger&&) = delete;
+			~AsyncLogger();
+
+			void EnableStdReplication(bool enable) override;
+			void EnableTimeLogging(bool enable);
+
+			void Flush();
+
+			inline UInt64 GetDroppedMessageCount() const;
+			inline LogOverflowPolicy GetOverflowPolicy() const;
+			inline std::size_t GetQueueCapacity() const;
+			inline std::size_t GetQueueDepth() const;
+			inline UInt64 GetWrittenMessageCount() const;
+
+			bool IsStdReplicationEnabled() const override;
+			bool IsTimeLoggingEnabled() const;
+
+			inline void SetOverflowPolicy(LogOverflowPolicy overflowPolicy);
+
+			void Write(const String& string) override;
+			void WriteError(ErrorType type, const String& error, unsigned int line = 0, const char* file = nullptr, const char* function = nullptr) override;
+
+			AsyncLogger& operator=(const AsyncLogger&) = delete;
+			AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+		private:
+			struct Message
+			{
+				String text;
+				const char* file;
+				const char* function;
+				std::time_t time;
+				unsigned int line;
+				ErrorType errorType;
+				bool isError;
+			};
+
+			struct Slot
+			{
+				std::atomic<std::size_t> sequence;
+				Message message;
+			};
+
+			bool Dequeue(Message* message);
+			void Enqueue(Message&& message);
+			void FormatMessage(const Message& message);
+			bool TryEnqueue(Message& message);
+			void WakeWorker();
+			void WorkerThread();
+			void WriteBatch(std::size_t messageCount);
+
+			std::unique_ptr<Slot[]> m_slots;
+			std::size_t m_queueMask;
+			std::atomic<std::size_t> m_enqueuePosition;
+			std::atomic<std::size_t> m_dequeuePosition;
+			std::atomic<UInt64> m_droppedMessageCount;
+			std::atomic<UInt64> m_writtenMessageCount;
+			std::atomic<LogOverflowPolicy> m_overflowPolicy;
+			std::atomic_bool m_running;
+			std::atomic_bool m_stdReplicationEnabled;
+			std::atomic_bool m_timeLoggingEnabled;
+			std::atomic_bool m_workerSleeping;
+			std::time_t m_lastTime;
+			std::size_t m_writtenPosition;
+			ConditionVariable m_flushCondition;
+			ConditionVariable m_wakeCondition;
+			File m_outputFile;
+			Mutex m_mutex;
+			StdLogger m_stdLogger;
+			String m_fileBuffer;
+			String m_stdBuffer;
+			String m_timePrefix;
+			Thread m_worker;
+			UInt64 m_reportedDroppedMessageCount;
+	};
+}
+
+#include <Nazara/Core/AsyncLogger.inl>
+
+#endif // NAZARA_ASYNCLOGGER_HPP
@@ -0,0 +1,70 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of messages discarded because the queue was full
+	* \return Dropped message count since the construction of the logger
+	*
+	* \see LogOverflowPolicy_Drop
+	*/
+	inline UInt64 AsyncLogger::GetDroppedMessageCount() const
+	{
+		return m_droppedMessageCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the behavior of the logger when its queue is full
+	* \return Overflow policy
+	*/
+	inline LogOverflowPolicy AsyncLogger::GetOverflowPolicy() const
+	{
+		return m_overflowPolicy.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the maximum number of messages waiting to be written
+	* \return Queue capacity (a power of two)
+	*/
+	inline std::size_t AsyncLogger::GetQueueCapacity() const
+	{
+		return m_queueMask + 1;
+	}
+
+	/*!
+	* \brief Gets the number of messages waiting to be written
+	* \return Queue depth, as seen by the calling thread
+	*/
+	inline std::size_t AsyncLogger::GetQueueDepth() const
+	{
+		std::size_t dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+		std::size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+
+		return (enqueuePosition > dequeuePosition) ? enqueuePosition - dequeuePosition : 0;
+	}
+
+	/*!
+	* \brief Gets the number of messages written by the logger
+	* \return Written message count since the construction of the logger
+	*/
+	inline UInt64 AsyncLogger::GetWrittenMessageCount() const
+	{
+		return m_writtenMessageCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Sets the behavior of the logger when its queue is full
+	*
+	* \param overflowPolicy Policy to apply from now on
+	*/
+	inline void AsyncLogger::SetOverflowPolicy(LogOverflowPolicy overflowPolicy)
+	{
+		m_overflowPolicy.store(overflowPolicy, std::memory_order_relaxed);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -5,6 +5,7 @@
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
 #include <cstdlib>
 #include <utility>
 #include <Nazara/Core/Debug.hpp>
@@ -272,11 +273,34 @@ namespace Nz
 
 		// If the block is not empty, it's good, else we must keep trying with the next block
 		if (block)
-			return IntegralLog2Pot(block & -block) + bit;
+			return FindFirstBit(block) + bit;
 		else
 			return FindFirstFrom(blockIndex + 1);
 	}
 
+	/*!
+	* \brief Calls a function for every bit set to one, in increasing order
+	*
+	* \param callback Function taking the index of each bit set as a std::size_t
+	*
+	* \remark This is faster than a loop on FindFirst/FindNext, as each block is only loaded once and bits are extracted without calling a function
+	* \remark Bits modified by the callback in the block being processed are not taken into account, but other blocks will be read after the modification
+	*/
+	template<typename Block, class Allocator>
+	template<typename F>
+	void Bitset<Block, Allocator>::ForEachSetBit(F&& callback) const
+	{
+		for (std::size_t i = 0; i < m_blocks.size(); ++i)
+		{
+			Block block = m_blocks[i];
+			while (block)
+			{
+				callback(i * bitsPerBlock + FindFirstBit(block));
+				block &= block - 1; // Clear the lowest bit set
+			}
+		}
+	}
+
 	/*!
 	* \brief Gets the ith block
 	* \return Block in the bitset
@@ -427,6 +451,36 @@ namespace Nz
 		ResetExtraBits();
 	}
 
+	/*!
+	* \brief Performs the "AND NOT" operation between two bitsets, without computing the negation of b
+	*
+	* \param a First bitset
+	* \param b Bitset whose bits are removed from a
+	*
+	* \remark The size of the result is the size of a, as bits of a beyond the size of b are kept (x & ~0 = x)
+	*/
+
+	template<typename Block, class Allocator>
+	void Bitset<Block, Allocator>::PerformsANDNOT(const Bitset& a, const Bitset& b)
+	{
+		std::size_t blockCount = a.GetBlockCount();
+		std::size_t sharedBlocks = std::min(blockCount, b.GetBlockCount());
+
+		m_blocks.resize(blockCount);
+		m_bitCount = a.GetSize();
+
+		// Either bitset may be this one, pointers are taken once the blocks have been resized
+		Block* result = m_blocks.data();
+		const Block* aBlocks = a.m_blocks.data();
+		const Block* bBlocks = b.m_blocks.data();
+
+		for (std::size_t i = 0; i < sharedBlocks; ++i)
+			result[i] = aBlocks[i] & ~bBlocks[i];
+
+		if (result != aBlocks)
+			std::copy(aBlocks + sharedBlocks, aBlocks + blockCount, result + sharedBlocks);
+	}
+
 	/*!
 	* \brief Performs the "NOT" operator of the bitset
 	*
@@ -512,17 +566,35 @@ namespace Nz
 	template<typename Block, class Allocator>
 	bool Bitset<Block, Allocator>::Intersects(const Bitset& bitset) const
 	{
+		const Block* a = m_blocks.data();
+		const Block* b = bitset.m_blocks.data();
+
 		// We only test the blocks in common
 		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
-		for (std::size_t i = 0; i < sharedBlocks; ++i)
-		{
-			Block a = GetBlock(i);
-			Block b = bitset.GetBlock(i);
-			if (a & b)
-				return true;
-		}
+		return AnyBlock(sharedBlocks, [=](std::size_t i) { return a[i] & b[i]; });
+	}
 
-		return false;
+	/*!
+	* \brief Checks if every bit set in this bitset is also set in another bitset
+	* \return true if this bitset is a subset of the other one
+	*
+	* \param bitset Bitset to test
+	*
+	* \remark This is equivalent to (*this & bitset) == *this, without building a temporary bitset
+	*/
+
+	template<typename Block, class Allocator>
+	bool Bitset<Block, Allocator>::IsSubsetOf(const Bitset& bitset) const
+	{
+		const Block* a = m_blocks.data();
+		const Block* b = bitset.m_blocks.data();
+
+		std::size_t sharedBlocks = std::min(GetBlockCount(), bitset.GetBlockCount());
+		if (AnyBlock(sharedBlocks, [=](std::size_t i) { return a[i] & ~b[i]; }))
+			return false;
+
+		// Bits beyond the other bitset cannot be set in it
+		return !AnyBlock(GetBlockCount() - sharedBlocks, [=](std::size_t i) { return a[sharedBlocks + i]; });
 	}
 
 	/*!
@@ -811,8 +883,10 @@ namespace Nz
 	template<typename Block, class Allocator>
 	bool Bitset<Block, Allocator>::TestAll() const
 	{
-		// Special case for the last block
+		// Special case for the last block (which is full if the size is a multiple of the block size)
 		Block lastBlockMask = GetLastBlockMask();
+		if (lastBlockMask == 0)
+			lastBlockMask = fullBitMask;
 
 		for (std::size_t i = 0; i < m_blocks.size(); ++i)
 		{
@@ -832,16 +906,8 @@ namespace Nz
 	template<typename Block, class Allocator>
 	bool Bitset<Block, Allocator>::TestAny() const
 	{
-		if (m_blocks.empty())
-			return false;
-
-		for (std::size_t i = 0; i < m_blocks.size(); ++i)
-		{
-			if (m_blocks[i])
-				return true;
-		}
-
-		return false;
+		const Block* blocks = m_blocks.data();
+		return AnyBlock(m_blocks.size(), [=](std::size_t i) { return blocks[i]; });
 	}
 
 	/*!
@@ -1197,7 +1263,7 @@ namespace Nz
 		Block block = m_blocks[i];
 
 		// Compute the position of LSB in the block (and adjustment of the position)
-		return IntegralLog2Pot(block & -block) + i*bitsPerBlock;
+		return FindFirstBit(block) + i*bitsPerBlock;
 	}
 
 	/*!
@@ -1223,6 +1289,40 @@ namespace Nz
 			m_blocks.back() &= mask;
 	}
 
+	/*!
+	* \brief Checks if a function returns a non-zero block for any index
+	* \return true if one of the blocks returned is not zero
+	*
+	* \param blockCount Number of blocks to test
+	* \param blockFunc Function computing the block at an index
+	*
+	* Blocks are combined by groups, which compilers can vectorize, while still exiting early
+	*/
+
+	template<typename Block, class Allocator>
+	template<typename F>
+	bool Bitset<Block, Allocator>::AnyBlock(std::size_t blockCount, F&& blockFunc)
+	{
+		constexpr std::size_t GroupSize = 8;
+
+		std::size_t i = 0;
+		for (; i + GroupSize <= blockCount; i += GroupSize)
+		{
+			Block group = 0;
+			for (std::size_t j = 0; j < GroupSize; ++j)
+				group |= blockFunc(i + j);
+
+			if (group)
+				return true;
+		}
+
+		Block remaining = 0;
+		for (; i < blockCount; ++i)
+			remaining |= blockFunc(i);
+
+		return remaining != 0;
+	}
+
 	/*!
 	* \brief Computes the block count with the index of the bit
 	* \return Number of the blocks to contain the bit
@@ -43,6 +43,9 @@
 // Checks the assertions
 #define NAZARA_CORE_ENABLE_ASSERTS 0
 
+// Compile the profiler zones of the engine (NazaraProfileZone, ...), they only cost a test when the profiler is disabled at runtime
+#define NAZARA_CORE_ENABLE_PROFILER 1
+
 // Call exit when an assertion is invalid
 #define NAZARA_CORE_EXIT_ON_ASSERT_FAILURE 1
 
@@ -0,0 +1,100 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_DYNAMICAABBTREE_HPP
+#define NAZARA_DYNAMICAABBTREE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Enums.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Ray.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API DynamicAABBTree
+	{
+		public:
+			DynamicAABBTree(float margin = 0.1f);
+			DynamicAABBTree(const DynamicAABBTree&) = default;
+			DynamicAABBTree(DynamicAABBTree&&) noexcept = default;
+			~DynamicAABBTree() = default;
+
+			void Clear();
+
+			std::size_t CreateProxy(const Boxf& aabb, std::size_t userData);
+			void DestroyProxy(std::size_t proxyId);
+
+			inline Boxf GetFatAABB(std::size_t proxyId) const;
+			inline unsigned int GetHeight() const;
+			inline float GetMargin() const;
+			inline std::size_t GetProxyCount() const;
+			inline std::size_t GetUserData(std::size_t proxyId) const;
+
+			bool MoveProxy(std::size_t proxyId, const Boxf& aabb, const Vector3f& displacement = Vector3f::Zero());
+
+			template<typename F> void Query(const Boxf& aabb, F&& callback) const;
+			template<typename F> void Query(const Frustumf& frustum, F&& callback) const;
+			template<typename F> void Query(const Rayf& ray, float maxDistance, F&& callback) const;
+
+			inline void SetMargin(float margin);
+			inline void SetUserData(std::size_t proxyId, std::size_t userData);
+
+			DynamicAABBTree& operator=(const DynamicAABBTree&) = default;
+			DynamicAABBTree& operator=(DynamicAABBTree&&) noexcept = default;
+
+			static constexpr std::size_t InvalidProxy = std::numeric_limits<std::size_t>::max();
+
+		private:
+			struct QueryPlane;
+			struct Node;
+
+			std::size_t AllocateNode();
+			std::size_t Balance(std::size_t nodeId);
+			void FreeNode(std::size_t nodeId);
+			void InsertLeaf(std::size_t leafId);
+			inline bool IsLeaf(const Node& node) const;
+			void RefitAncestors(std::size_t nodeId);
+			void RemoveLeaf(std::size_t leafId);
+
+			template<typename F> bool QueryBox(std::size_t nodeId, const Vector3f& minimum, const Vector3f& maximum, F& callback) const;
+			template<typename F> void QueryFrustum(std::size_t nodeId, const QueryPlane* planes, UInt8 planeMask, F& callback) const;
+			template<typename F> bool QueryRay(std::size_t nodeId, const Rayf& ray, const Vector3f& invDirection, float maxDistance, F& callback) const;
+			template<typename F> void ReportSubtree(std::size_t nodeId, F& callback) const;
+
+			static inline float ComputeArea(const Vector3f& minimum, const Vector3f& maximum);
+
+			struct QueryPlane
+			{
+				Vector3f normal;
+				float distance;
+			};
+
+			struct Node
+			{
+				Vector3f minimum;
+				Vector3f maximum;
+				std::size_t children[2];
+				std::size_t parent; //< Next free node for free nodes
+				std::size_t userData;
+				int height; //< 0 for leaves, -1 for free nodes
+			};
+
+			std::vector<Node> m_nodes;
+			std::size_t m_freeList;
+			std::size_t m_proxyCount;
+			std::size_t m_root;
+			float m_margin;
+	};
+}
+
+#include <Nazara/Core/DynamicAABBTree.inl>
+
+#endif // NAZARA_DYNAMICAABBTREE_HPP
@@ -0,0 +1,266 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/DynamicAABBTree.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the enlarged box stored in the tree for a proxy
+	* \return Fat AABB of the proxy, containing the last box given to CreateProxy or MoveProxy
+	*
+	* \param proxyId Identifier of the proxy
+	*/
+	inline Boxf DynamicAABBTree::GetFatAABB(std::size_t proxyId) const
+	{
+		NazaraAssert(proxyId < m_nodes.size() && IsLeaf(m_nodes[proxyId]), "Invalid proxy");
+
+		const Node& node = m_nodes[proxyId];
+		return Boxf(node.minimum, node.maximum);
+	}
+
+	/*!
+	* \brief Gets the height of the tree
+	* \return Number of levels below the root, zero for an empty tree or a single proxy
+	*/
+	inline unsigned int DynamicAABBTree::GetHeight() const
+	{
+		return (m_root != InvalidProxy) ? static_cast<unsigned int>(m_nodes[m_root].height) : 0U;
+	}
+
+	/*!
+	* \brief Gets the margin added around every proxy box
+	* \return Margin
+	*/
+	inline float DynamicAABBTree::GetMargin() const
+	{
+		return m_margin;
+	}
+
+	/*!
+	* \brief Gets the number of proxies in the tree
+	* \return Proxy count
+	*/
+	inline std::size_t DynamicAABBTree::GetProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	/*!
+	* \brief Gets the user data of a proxy
+	* \return User data given to CreateProxy or SetUserData
+	*
+	* \param proxyId Identifier of the proxy
+	*/
+	inline std::size_t DynamicAABBTree::GetUserData(std::size_t proxyId) const
+	{
+		NazaraAssert(proxyId < m_nodes.size() && IsLeaf(m_nodes[proxyId]), "Invalid proxy");
+
+		return m_nodes[proxyId].userData;
+	}
+
+	/*!
+	* \brief Calls a function for every proxy whose fat AABB overlaps a box
+	*
+	* \param aabb Box to test
+	* \param callback Function called with the proxy identifier, returning false to stop the query
+	*/
+	template<typename F>
+	void DynamicAABBTree::Query(const Boxf& aabb, F&& callback) const
+	{
+		if (m_root != InvalidProxy)
+			QueryBox(m_root, aabb.GetMinimum(), aabb.GetMaximum(), callback);
+	}
+
+	/*!
+	* \brief Calls a function for every proxy whose fat AABB is inside or intersects a frustum
+	*
+	* \param frustum Frustum to test
+	* \param callback Function called with the proxy identifier and its IntersectionSide (never IntersectionSide_Outside)
+	*
+	* \remark Subtrees fully outside a plane are skipped, and proxies of subtrees fully inside the frustum are reported without any further test
+	*/
+	template<typename F>
+	void DynamicAABBTree::Query(const Frustumf& frustum, F&& callback) const
+	{
+		if (m_root == InvalidProxy)
+			return;
+
+		QueryPlane planes[FrustumPlane_Max + 1];
+		for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+		{
+			const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+			planes[i].normal = plane.normal;
+			planes[i].distance = plane.distance;
+		}
+
+		QueryFrustum(m_root, planes, (1 << (FrustumPlane_Max + 1)) - 1, callback);
+	}
+
+	/*!
+	* \brief Calls a function for every proxy whose fat AABB is hit by a ray
+	*
+	* \param ray Ray to cast
+	* \param maxDistance Maximal distance along the ray, in units of the ray direction
+	* \param callback Function called with the proxy identifier and the distance at which the ray enters its fat AABB, returning false to stop the query
+	*
+	* \remark Proxies are not reported in distance order
+	*/
+	template<typename F>
+	void DynamicAABBTree::Query(const Rayf& ray, float maxDistance, F&& callback) const
+	{
+		if (m_root == InvalidProxy)
+			return;
+
+		Vector3f invDirection(1.f / ray.direction.x, 1.f / ray.direction.y, 1.f / ray.direction.z);
+		QueryRay(m_root, ray, invDirection, maxDistance, callback);
+	}
+
+	/*!
+	* \brief Sets the margin added around proxy boxes
+	*
+	* \param margin Margin, the bigger it is the less proxies have to be moved in the tree when their box change
+	*
+	* \remark Only applies to proxies created or moved afterwards
+	*/
+	inline void DynamicAABBTree::SetMargin(float margin)
+	{
+		NazaraAssert(margin >= 0.f, "Margin must be positive");
+
+		m_margin = margin;
+	}
+
+	/*!
+	* \brief Sets the user data of a proxy
+	*
+	* \param proxyId Identifier of the proxy
+	* \param userData New user data
+	*/
+	inline void DynamicAABBTree::SetUserData(std::size_t proxyId, std::size_t userData)
+	{
+		NazaraAssert(proxyId < m_nodes.size() && IsLeaf(m_nodes[proxyId]), "Invalid proxy");
+
+		m_nodes[proxyId].userData = userData;
+	}
+
+	inline bool DynamicAABBTree::IsLeaf(const Node& node) const
+	{
+		return node.height == 0;
+	}
+
+	template<typename F>
+	bool DynamicAABBTree::QueryBox(std::size_t nodeId, const Vector3f& minimum, const Vector3f& maximum, F& callback) const
+	{
+		const Node& node = m_nodes[nodeId];
+		if (node.maximum.x < minimum.x || node.minimum.x > maximum.x ||
+		    node.maximum.y < minimum.y || node.minimum.y > maximum.y ||
+		    node.maximum.z < minimum.z || node.minimum.z > maximum.z)
+			return true;
+
+		if (IsLeaf(node))
+			return callback(nodeId);
+
+		return QueryBox(node.children[0], minimum, maximum, callback) && QueryBox(node.children[1], minimum, maximum, callback);
+	}
+
+	template<typename F>
+	void DynamicAABBTree::QueryFrustum(std::size_t nodeId, const QueryPlane* planes, UInt8 planeMask, F& callback) const
+	{
+		const Node& node = m_nodes[nodeId];
+
+		// Same test as Frustum::Intersect(Box), planes the node is fully inside of are not tested for its children
+		for (unsigned int i = 0; i <= FrustumPlane_Max; ++i)
+		{
+			UInt8 planeBit = static_cast<UInt8>(1U << i);
+			if ((planeMask & planeBit) == 0)
+				continue;
+
+			const QueryPlane& plane = planes[i];
+
+			Vector3f positiveVertex((plane.normal.x > 0.f) ? node.maximum.x : node.minimum.x,
+			                        (plane.normal.y > 0.f) ? node.maximum.y : node.minimum.y,
+			                        (plane.normal.z > 0.f) ? node.maximum.z : node.minimum.z);
+
+			if (plane.normal.DotProduct(positiveVertex) - plane.distance < 0.f)
+				return;
+
+			Vector3f negativeVertex((plane.normal.x < 0.f) ? node.maximum.x : node.minimum.x,
+			                        (plane.normal.y < 0.f) ? node.maximum.y : node.minimum.y,
+			                        (plane.normal.z < 0.f) ? node.maximum.z : node.minimum.z);
+
+			if (plane.normal.DotProduct(negativeVertex) - plane.distance >= 0.f)
+				planeMask &= ~planeBit;
+		}
+
+		if (planeMask == 0)
+			ReportSubtree(nodeId, callback);
+		else if (IsLeaf(node))
+			callback(nodeId, IntersectionSide_Intersecting);
+		else
+		{
+			QueryFrustum(node.children[0], planes, planeMask, callback);
+			QueryFrustum(node.children[1], planes, planeMask, callback);
+		}
+	}
+
+	template<typename F>
+	bool DynamicAABBTree::QueryRay(std::size_t nodeId, const Rayf& ray, const Vector3f& invDirection, float maxDistance, F& callback) const
+	{
+		const Node& node = m_nodes[nodeId];
+
+		// Slab test
+		float entryDistance = 0.f;
+		float exitDistance = maxDistance;
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			if (ray.direction[i] == 0.f)
+			{
+				// Parallel to the slab, which has to contain the origin
+				if (ray.origin[i] < node.minimum[i] || ray.origin[i] > node.maximum[i])
+					return true;
+			}
+			else
+			{
+				float nearDistance = (node.minimum[i] - ray.origin[i]) * invDirection[i];
+				float farDistance = (node.maximum[i] - ray.origin[i]) * invDirection[i];
+				if (nearDistance > farDistance)
+					std::swap(nearDistance, farDistance);
+
+				entryDistance = std::max(entryDistance, nearDistance);
+				exitDistance = std::min(exitDistance, farDistance);
+				if (entryDistance > exitDistance)
+					return true;
+			}
+		}
+
+		if (IsLeaf(node))
+			return callback(nodeId, entryDistance);
+
+		return QueryRay(node.children[0], ray, invDirection, maxDistance, callback) && QueryRay(node.children[1], ray, invDirection, maxDistance, callback);
+	}
+
+	template<typename F>
+	void DynamicAABBTree::ReportSubtree(std::size_t nodeId, F& callback) const
+	{
+		const Node& node = m_nodes[nodeId];
+		if (IsLeaf(node))
+			callback(nodeId, IntersectionSide_Inside);
+		else
+		{
+			ReportSubtree(node.children[0], callback);
+			ReportSubtree(node.children[1], callback);
+		}
+	}
+
+	inline float DynamicAABBTree::ComputeArea(const Vector3f& minimum, const Vector3f& maximum)
+	{
+		Vector3f extent = maximum - minimum;
+		return 2.f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
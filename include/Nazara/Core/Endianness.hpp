@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/TypeTag.hpp>
 
 #if !defined(NAZARA_BIG_ENDIAN) && !defined(NAZARA_LITTLE_ENDIAN)
 	// Automatic detection following macros of compiler
@@ -30,6 +31,7 @@ namespace Nz
 	inline constexpr Endianness GetPlatformEndianness();
 	inline void SwapBytes(void* buffer, std::size_t size);
 	template<typename T> T SwapBytes(T value);
+	template<typename T> void SwapBytesArray(T* values, std::size_t count);
 }
 
 #include <Nazara/Core/Endianness.inl>
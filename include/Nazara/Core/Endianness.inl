@@ -3,10 +3,71 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <algorithm>
+#include <cstring>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Written with shifts so that compilers recognize them (as bswap instructions) and can vectorize loops using them
+		inline UInt16 ByteSwap(UInt16 value)
+		{
+			return static_cast<UInt16>((value >> 8) | (value << 8));
+		}
+
+		inline UInt32 ByteSwap(UInt32 value)
+		{
+			return (value >> 24) | ((value >> 8) & 0x0000FF00U) | ((value << 8) & 0x00FF0000U) | (value << 24);
+		}
+
+		inline UInt64 ByteSwap(UInt64 value)
+		{
+			return (UInt64(ByteSwap(UInt32(value))) << 32) | ByteSwap(UInt32(value >> 32));
+		}
+
+		template<typename UIntType>
+		void SwapBytesArray(void* values, std::size_t count, TypeTag<UIntType>)
+		{
+			UInt8* bytes = static_cast<UInt8*>(values);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				UIntType value;
+				std::memcpy(&value, &bytes[i * sizeof(UIntType)], sizeof(UIntType));
+				value = ByteSwap(value);
+				std::memcpy(&bytes[i * sizeof(UIntType)], &value, sizeof(UIntType));
+			}
+		}
+
+		template<std::size_t Size>
+		void SwapBytesArray(void* values, std::size_t count, std::integral_constant<std::size_t, Size>)
+		{
+			UInt8* bytes = static_cast<UInt8*>(values);
+			for (std::size_t i = 0; i < count; ++i)
+				SwapBytes(&bytes[i * Size], Size);
+		}
+
+		inline void SwapBytesArray(void* /*values*/, std::size_t /*count*/, std::integral_constant<std::size_t, 1>)
+		{
+		}
+
+		inline void SwapBytesArray(void* values, std::size_t count, std::integral_constant<std::size_t, 2>)
+		{
+			SwapBytesArray(values, count, TypeTag<UInt16>());
+		}
+
+		inline void SwapBytesArray(void* values, std::size_t count, std::integral_constant<std::size_t, 4>)
+		{
+			SwapBytesArray(values, count, TypeTag<UInt32>());
+		}
+
+		inline void SwapBytesArray(void* values, std::size_t count, std::integral_constant<std::size_t, 8>)
+		{
+			SwapBytesArray(values, count, TypeTag<UInt64>());
+		}
+	}
+
 	/*!
 	* \ingroup core
 	* \brief Gets the platform endianness
@@ -46,6 +107,23 @@ namespace Nz
 		SwapBytes(&value, sizeof(T));
 		return value;
 	}
+
+	/*!
+	* \ingroup core
+	* \brief Swaps the bytes of every element of an array, for endianness operations
+	*
+	* \param values Array of elements
+	* \param count Number of elements in the array
+	*
+	* \remark Elements of two, four and eight bytes are swapped as integers, which is much faster than calling SwapBytes on each of them
+	*/
+	template<typename T>
+	void SwapBytesArray(T* values, std::size_t count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+		Detail::SwapBytesArray(values, count, std::integral_constant<std::size_t, sizeof(T)>());
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
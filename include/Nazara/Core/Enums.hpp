@@ -76,6 +76,33 @@ namespace Nz
 		HashType_Max = HashType_Whirlpool
 	};
 
+	enum LogOverflowPolicy
+	{
+		LogOverflowPolicy_Block, // The writing thread waits until the queue has room for its message
+		LogOverflowPolicy_Drop,  // The message is discarded and counted as dropped
+
+		LogOverflowPolicy_Max = LogOverflowPolicy_Drop
+	};
+
+	enum MappedFileMode
+	{
+		MappedFileMode_CopyOnWrite, // Pages can be modified, changes are private and never written back to the file
+		MappedFileMode_ReadOnly,    // Pages can only be read
+
+		MappedFileMode_Max = MappedFileMode_ReadOnly
+	};
+
+	enum MemoryAccessHint
+	{
+		MemoryAccessHint_Normal,     // No particular access pattern
+		MemoryAccessHint_Random,     // Memory will be accessed in a random order, read-ahead is useless
+		MemoryAccessHint_Sequential, // Memory will be accessed in order, read-ahead aggressively
+		MemoryAccessHint_WillNeed,   // Memory will be accessed soon, start loading it
+		MemoryAccessHint_DontNeed,   // Memory won't be accessed soon, it can be released
+
+		MemoryAccessHint_Max = MemoryAccessHint_DontNeed
+	};
+
 	enum OpenMode
 	{
 		OpenMode_NotOpen,   // Use the current mod of opening
@@ -136,9 +163,12 @@ namespace Nz
 	{
 		ProcessorCap_x64,
 		ProcessorCap_AVX,
+		ProcessorCap_AVX2,
 		ProcessorCap_FMA3,
 		ProcessorCap_FMA4,
 		ProcessorCap_MMX,
+		ProcessorCap_PCLMULQDQ,
+		ProcessorCap_SHA,
 		ProcessorCap_XOP,
 		ProcessorCap_SSE,
 		ProcessorCap_SSE2,
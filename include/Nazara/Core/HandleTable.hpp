@@ -0,0 +1,51 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HANDLETABLE_HPP
+#define NAZARA_HANDLETABLE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+namespace Nz
+{
+	class NAZARA_CORE_API HandleTable
+	{
+		public:
+			HandleTable() = delete;
+			~HandleTable() = delete;
+
+			static UInt32 Allocate(void* object);
+
+			static void Free(UInt32 index);
+
+			static inline UInt32 GetGeneration(UInt32 index);
+			static inline void* GetObject(UInt32 index, UInt32 generation);
+			static std::size_t GetSlotCount();
+
+			static inline void SetObject(UInt32 index, void* object);
+
+			static constexpr UInt32 BlockShift = 12;
+			static constexpr UInt32 BlockSize = 1U << BlockShift;
+			static constexpr UInt32 MaxBlockCount = 4096;
+			static constexpr UInt32 NullIndex = 0;
+
+		private:
+			struct Slot
+			{
+				void* object;
+				UInt32 generation;
+			};
+
+			static inline Slot& GetSlot(UInt32 index);
+
+			static Slot* s_blocks[MaxBlockCount];
+			static Slot s_firstBlock[BlockSize];
+	};
+}
+
+#include <Nazara/Core/HandleTable.inl>
+
+#endif // NAZARA_HANDLETABLE_HPP
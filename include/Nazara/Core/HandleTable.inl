@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the current generation of a slot
+	* \return Generation, incremented every time the slot is freed
+	*
+	* \param index Index of an allocated slot
+	*/
+	inline UInt32 HandleTable::GetGeneration(UInt32 index)
+	{
+		return GetSlot(index).generation;
+	}
+
+	/*!
+	* \brief Gets the object referenced by a handle
+	* \return Pointer to the object, or nullptr if the slot was freed since the handle was made
+	*
+	* \param index Index of the slot
+	* \param generation Generation of the slot when the handle was made
+	*
+	* \remark NullIndex is a valid index, which never references an object
+	*/
+	inline void* HandleTable::GetObject(UInt32 index, UInt32 generation)
+	{
+		const Slot& slot = GetSlot(index);
+		return (slot.generation == generation) ? slot.object : nullptr;
+	}
+
+	/*!
+	* \brief Changes the object referenced by a slot, keeping handles to it valid
+	*
+	* \param index Index of an allocated slot
+	* \param object New address of the object
+	*/
+	inline void HandleTable::SetObject(UInt32 index, void* object)
+	{
+		NazaraAssert(index != NullIndex, "Null slot cannot reference an object");
+
+		GetSlot(index).object = object;
+	}
+
+	inline HandleTable::Slot& HandleTable::GetSlot(UInt32 index)
+	{
+		return s_blocks[index >> BlockShift][index & (BlockSize - 1)];
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
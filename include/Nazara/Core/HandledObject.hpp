@@ -8,22 +8,12 @@
 #define NAZARA_OBJECTHANDLER_HPP
 
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 #include <Nazara/Core/Signal.hpp>
-#include <memory>
 #include <vector>
 
 namespace Nz
 {
-	namespace Detail
-	{
-		struct NAZARA_CORE_API HandleData
-		{
-			void* object;
-
-			static std::shared_ptr<HandleData> GetEmptyObject();
-		};
-	}
-
 	template<typename T> class ObjectHandle;
 
 	template<typename T>
@@ -48,10 +38,9 @@ namespace Nz
 			void UnregisterAllHandles() noexcept;
 
 		private:
-			std::shared_ptr<const Detail::HandleData> GetHandleData();
-			void InitHandleData();
+			UInt32 GetHandleIndex();
 
-			std::shared_ptr<Detail::HandleData> m_handleData;
+			UInt32 m_handleIndex = HandleTable::NullIndex;
 	};
 }
 
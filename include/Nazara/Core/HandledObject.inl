@@ -4,10 +4,6 @@
 
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/Error.hpp>
-#include <algorithm>
-#include <cassert>
-#include <type_traits>
-#include <utility>
 
 namespace Nz
 {
@@ -36,10 +32,12 @@ namespace Nz
 	*/
 	template<typename T>
 	HandledObject<T>::HandledObject(HandledObject&& object) noexcept :
-	m_handleData(std::move(object.m_handleData))
+	m_handleIndex(object.m_handleIndex)
 	{
-		if (m_handleData)
-			m_handleData->object = static_cast<T*>(this);
+		object.m_handleIndex = HandleTable::NullIndex;
+
+		if (m_handleIndex != HandleTable::NullIndex)
+			HandleTable::SetObject(m_handleIndex, static_cast<T*>(this));
 	}
 
 	/*!
@@ -89,44 +87,42 @@ namespace Nz
 	{
 		UnregisterAllHandles();
 
-		m_handleData = std::move(object.m_handleData);
+		m_handleIndex = object.m_handleIndex;
+		object.m_handleIndex = HandleTable::NullIndex;
 
-		if (m_handleData)
-			m_handleData->object = static_cast<T*>(this);
+		if (m_handleIndex != HandleTable::NullIndex)
+			HandleTable::SetObject(m_handleIndex, static_cast<T*>(this));
 
 		return *this;
 	}
 
 	/*!
 	* \brief Unregisters all handles
+	*
+	* Frees the slot of this object, making all handles to it invalid
 	*/
 	template<typename T>
 	void HandledObject<T>::UnregisterAllHandles() noexcept
 	{
-		if (m_handleData)
+		if (m_handleIndex != HandleTable::NullIndex)
 		{
 			OnHandledObjectDestruction(this);
 
-			m_handleData->object = nullptr;
-			m_handleData.reset();
+			HandleTable::Free(m_handleIndex);
+			m_handleIndex = HandleTable::NullIndex;
 		}
 	}
 
+	/*!
+	* \brief Gets the slot of this object in the handle table, allocating it if needed
+	* \return Index of the slot
+	*/
 	template<typename T>
-	std::shared_ptr<const Detail::HandleData> HandledObject<T>::GetHandleData()
-	{
-		if (!m_handleData)
-			InitHandleData();
-
-		return std::shared_ptr<const Detail::HandleData>(m_handleData);
-	}
-
-	template<typename T>
-	void HandledObject<T>::InitHandleData()
+	UInt32 HandledObject<T>::GetHandleIndex()
 	{
-		assert(!m_handleData);
+		if (m_handleIndex == HandleTable::NullIndex)
+			m_handleIndex = HandleTable::Allocate(static_cast<T*>(this));
 
-		m_handleData = std::make_shared<Detail::HandleData>();
-		m_handleData->object = static_cast<T*>(this);
+		return m_handleIndex;
 	}
 }
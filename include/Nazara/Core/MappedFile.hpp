@@ -0,0 +1,66 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILE_HPP
+#define NAZARA_MAPPEDFILE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/String.hpp>
+
+namespace Nz
+{
+	class MappedFileImpl;
+
+	class NAZARA_CORE_API MappedFile : public Stream
+	{
+		public:
+			MappedFile();
+			MappedFile(const String& filePath, MappedFileMode mode = MappedFileMode_ReadOnly);
+			MappedFile(const MappedFile&) = delete;
+			MappedFile(MappedFile&& file) noexcept = default;
+			~MappedFile();
+
+			bool Advise(MemoryAccessHint hint);
+			bool Advise(MemoryAccessHint hint, UInt64 offset, UInt64 size);
+
+			void Close();
+
+			bool EndOfStream() const override;
+
+			UInt64 GetCursorPos() const override;
+			String GetDirectory() const override;
+			const UInt8* GetMemoryView() const override;
+			inline MappedFileMode GetMode() const;
+			String GetPath() const override;
+			UInt64 GetSize() const override;
+			UInt8* GetWritableMemoryView();
+
+			bool IsOpen() const;
+
+			bool Open(const String& filePath, MappedFileMode mode = MappedFileMode_ReadOnly);
+
+			bool SetCursorPos(UInt64 offset) override;
+
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile& operator=(MappedFile&& file) noexcept;
+
+		private:
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			MappedFileMode m_mode;
+			MovablePtr<MappedFileImpl> m_impl;
+			String m_filePath;
+			UInt64 m_cursorPos;
+	};
+}
+
+#include <Nazara/Core/MappedFile.inl>
+
+#endif // NAZARA_MAPPEDFILE_HPP
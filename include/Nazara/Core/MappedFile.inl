@@ -0,0 +1,19 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the mode the file was mapped with
+	* \return Mapping mode
+	*/
+	inline MappedFileMode MappedFile::GetMode() const
+	{
+		return m_mode;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -31,6 +31,7 @@ namespace Nz
 			inline ByteArray& GetBuffer();
 			inline const ByteArray& GetBuffer() const;
 			UInt64 GetCursorPos() const override;
+			const UInt8* GetMemoryView() const override;
 			UInt64 GetSize() const override;
 
 			void SetBuffer(ByteArray* byteArray, OpenModeFlags openMode = OpenMode_ReadWrite);
@@ -9,7 +9,6 @@
 
 #include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/HandledObject.hpp>
-#include <memory>
 #include <ostream>
 
 namespace Nz
@@ -24,7 +23,7 @@ namespace Nz
 			explicit ObjectHandle(T* object);
 			ObjectHandle(const ObjectHandle& handle) = default;
 			ObjectHandle(ObjectHandle&& handle) noexcept;
-			~ObjectHandle();
+			~ObjectHandle() = default;
 
 			T* GetObject() const;
 
@@ -49,7 +48,8 @@ namespace Nz
 			static const ObjectHandle InvalidHandle;
 
 		protected:
-			std::shared_ptr<const Detail::HandleData> m_handleData;
+			UInt32 m_generation;
+			UInt32 m_index;
 	};
 
 	template<typename T> std::ostream& operator<<(std::ostream& out, const ObjectHandle<T>& handle);
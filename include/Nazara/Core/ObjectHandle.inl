@@ -13,6 +13,8 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ObjectHandle
 	* \brief Core class that represents a object handle
+	*
+	* A handle is made of the index and generation of the object slot in the HandleTable, copying it involves no reference counting
 	*/
 
 	/*!
@@ -22,7 +24,8 @@ namespace Nz
 	*/
 	template<typename T>
 	ObjectHandle<T>::ObjectHandle() :
-	m_handleData(Detail::HandleData::GetEmptyObject())
+	m_generation(0),
+	m_index(HandleTable::NullIndex)
 	{
 	}
 
@@ -32,9 +35,12 @@ namespace Nz
 	* \param handle ObjectHandle to move into this
 	*/
 	template<typename T>
-	ObjectHandle<T>::ObjectHandle(ObjectHandle&& handle) noexcept
+	ObjectHandle<T>::ObjectHandle(ObjectHandle&& handle) noexcept :
+	m_generation(handle.m_generation),
+	m_index(handle.m_index)
 	{
-		Reset(std::move(handle));
+		handle.m_generation = 0;
+		handle.m_index = HandleTable::NullIndex;
 	}
 
 	/*!
@@ -48,17 +54,6 @@ namespace Nz
 		Reset(object);
 	}
 
-	/*!
-	* \brief Destructs the object and calls reset with nullptr
-	*
-	* \see Reset
-	*/
-	template<typename T>
-	ObjectHandle<T>::~ObjectHandle()
-	{
-		Reset(nullptr);
-	}
-
 	/*!
 	* \brief Gets the underlying object
 	* \return Underlying object
@@ -66,7 +61,7 @@ namespace Nz
 	template<typename T>
 	T* ObjectHandle<T>::GetObject() const
 	{
-		return static_cast<T*>(m_handleData->object);
+		return static_cast<T*>(HandleTable::GetObject(m_index, m_generation));
 	}
 
 	/*!
@@ -76,7 +71,7 @@ namespace Nz
 	template<typename T>
 	bool ObjectHandle<T>::IsValid() const
 	{
-		return m_handleData->object != nullptr;
+		return HandleTable::GetObject(m_index, m_generation) != nullptr;
 	}
 
 	/*!
@@ -88,9 +83,15 @@ namespace Nz
 	void ObjectHandle<T>::Reset(T* object)
 	{
 		if (object)
-			m_handleData = object->GetHandleData();
+		{
+			m_index = object->GetHandleIndex();
+			m_generation = HandleTable::GetGeneration(m_index);
+		}
 		else
-			m_handleData = Detail::HandleData::GetEmptyObject();
+		{
+			m_generation = 0;
+			m_index = HandleTable::NullIndex;
+		}
 	}
 
 	/*!
@@ -101,7 +102,8 @@ namespace Nz
 	template<typename T>
 	void ObjectHandle<T>::Reset(const ObjectHandle& handle)
 	{
-		m_handleData = handle.m_handleData;
+		m_generation = handle.m_generation;
+		m_index = handle.m_index;
 	}
 
 	/*!
@@ -112,8 +114,11 @@ namespace Nz
 	template<typename T>
 	void ObjectHandle<T>::Reset(ObjectHandle&& handle) noexcept
 	{
-		m_handleData = std::move(handle.m_handleData);
-		handle.m_handleData = Detail::HandleData::GetEmptyObject();
+		m_generation = handle.m_generation;
+		m_index = handle.m_index;
+
+		handle.m_generation = 0;
+		handle.m_index = HandleTable::NullIndex;
 	}
 
 	/*!
@@ -126,7 +131,8 @@ namespace Nz
 	ObjectHandle<T>& ObjectHandle<T>::Swap(ObjectHandle& handle)
 	{
 		// We do the swap
-		std::swap(m_handleData, handle.m_handleData);
+		std::swap(m_generation, handle.m_generation);
+		std::swap(m_index, handle.m_index);
 		return *this;
 	}
 
@@ -0,0 +1,93 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PACKFILE_HPP
+#define NAZARA_PACKFILE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/String.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API PackFile
+	{
+		public:
+			struct BuildEntry;
+			struct EntryInfo;
+
+			PackFile() = default;
+			PackFile(const String& filePath);
+			PackFile(const PackFile&) = delete;
+			PackFile(PackFile&&) noexcept = default;
+			~PackFile() = default;
+
+			void Close();
+
+			bool Contains(const String& entryPath) const;
+
+			inline std::size_t GetEntryCount() const;
+			EntryInfo GetEntryInfo(std::size_t entryIndex) const;
+			inline String GetPath() const;
+
+			inline bool IsOpen() const;
+
+			bool Open(const String& filePath);
+			std::unique_ptr<Stream> OpenEntry(const String& entryPath) const;
+
+			PackFile& operator=(const PackFile&) = delete;
+			PackFile& operator=(PackFile&&) noexcept = default;
+
+			static bool Build(const String& packPath, const std::vector<BuildEntry>& entries, bool compress = true, UInt32 alignment = 16);
+			static bool IsFileMounted(const String& filePath);
+			static bool Mount(const String& packPath, const String& mountPoint = String());
+			static std::unique_ptr<Stream> OpenMountedFile(const String& filePath);
+			static bool Unmount(const String& packPath);
+			static void UnmountAll();
+
+			struct BuildEntry
+			{
+				String entryPath;  //< Path of the entry in the pack, using '/' as separator
+				String sourcePath; //< Path of the file to store
+			};
+
+			struct EntryInfo
+			{
+				String path;
+				UInt64 size;
+				UInt64 storedSize;
+				bool compressed;
+			};
+
+			static constexpr UInt32 FormatVersion = 1;
+
+		private:
+			struct IndexEntry
+			{
+				UInt64 hash;
+				UInt64 offset;
+				UInt64 size;
+				UInt64 storedSize;
+				UInt32 compression;
+				UInt32 nameLength;
+				UInt32 nameOffset;
+			};
+
+			const IndexEntry* FindEntry(const String& entryPath) const;
+			std::unique_ptr<Stream> OpenEntry(const IndexEntry& entry, String streamPath, std::shared_ptr<const PackFile> owner) const;
+
+			static UInt64 HashEntryPath(const char* entryPath, std::size_t length);
+
+			std::vector<IndexEntry> m_entries; //< Sorted by hash
+			MappedFile m_file;
+	};
+}
+
+#include <Nazara/Core/PackFile.inl>
+
+#endif // NAZARA_PACKFILE_HPP
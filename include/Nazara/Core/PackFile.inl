@@ -0,0 +1,37 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of entries of the pack
+	* \return Entry count
+	*/
+	inline std::size_t PackFile::GetEntryCount() const
+	{
+		return m_entries.size();
+	}
+
+	/*!
+	* \brief Gets the path of the pack
+	* \return Path of the pack file
+	*/
+	inline String PackFile::GetPath() const
+	{
+		return m_file.GetPath();
+	}
+
+	/*!
+	* \brief Checks whether a pack is open
+	* \return true if it is the case
+	*/
+	inline bool PackFile::IsOpen() const
+	{
+		return m_file.IsOpen();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,137 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		// Chunks per worker, more chunks than workers allow idle workers to steal from busy ones
+		constexpr std::size_t ParallelChunksPerWorker = 4;
+
+		inline std::size_t ComputeParallelChunkSize(std::size_t count, std::size_t grain)
+		{
+			std::size_t chunkSize = count / (TaskScheduler::GetWorkerCount() * ParallelChunksPerWorker);
+			return std::max<std::size_t>({chunkSize, grain, 1});
+		}
+
+		template<typename F>
+		void ParallelSplit(TaskGroup& group, std::size_t firstChunk, std::size_t lastChunk, const F& chunkFunction)
+		{
+			// Give the upper half away until a single chunk remains, thieves take the oldest (and thus biggest) halves first
+			while (lastChunk - firstChunk > 1)
+			{
+				std::size_t middleChunk = firstChunk + (lastChunk - firstChunk) / 2;
+				group.AddTask([&group, middleChunk, lastChunk, &chunkFunction]()
+				{
+					ParallelSplit(group, middleChunk, lastChunk, chunkFunction);
+				});
+
+				lastChunk = middleChunk;
+			}
+
+			chunkFunction(firstChunk);
+		}
+
+		template<typename T, typename F>
+		void ParallelChunks(T begin, T end, std::size_t chunkSize, std::size_t chunkCount, const F& function)
+		{
+			auto chunkFunction = [begin, end, chunkSize, chunkCount, &function](std::size_t chunkIndex)
+			{
+				T first = begin + static_cast<T>(chunkIndex * chunkSize);
+				T last = (chunkIndex == chunkCount - 1) ? end : first + static_cast<T>(chunkSize);
+
+				function(chunkIndex, first, last);
+			};
+
+			if (chunkCount == 1)
+			{
+				// Not worth it
+				chunkFunction(0);
+				return;
+			}
+
+			TaskGroup group;
+			ParallelSplit(group, 0, chunkCount, chunkFunction);
+			group.Wait();
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Calls a function over a range, splitting it in chunks executed in parallel by the task scheduler
+	*
+	* \param begin First index of the range
+	* \param end Index past the last one of the range
+	* \param grain Minimal number of indices per chunk, chunks are made bigger if the range is large enough for every worker to get a few of them
+	* \param function Function called with the bounds of each chunk, as function(first, last)
+	*
+	* The calling thread takes part in the work and only returns once every chunk has been processed,
+	* making this safe to call from a task.
+	*
+	* \remark Chunks may be processed concurrently and in any order
+	*
+	* \see ParallelReduce
+	*/
+	template<typename T, typename F>
+	void ParallelFor(T begin, T end, T grain, F function)
+	{
+		if (begin >= end)
+			return;
+
+		std::size_t count = static_cast<std::size_t>(end - begin);
+		std::size_t chunkSize = Detail::ComputeParallelChunkSize(count, static_cast<std::size_t>(grain));
+		std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+		Detail::ParallelChunks(begin, end, chunkSize, chunkCount, [&function](std::size_t /*chunkIndex*/, T first, T last)
+		{
+			function(first, last);
+		});
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Reduces a range to a single value, splitting it in chunks executed in parallel by the task scheduler
+	* \return Reduction of every chunk result, or identity if the range is empty
+	*
+	* \param begin First index of the range
+	* \param end Index past the last one of the range
+	* \param grain Minimal number of indices per chunk, chunks are made bigger if the range is large enough for every worker to get a few of them
+	* \param identity Neutral value of the reduction
+	* \param function Function computing the value of a chunk, as function(first, last) -> V
+	* \param reduction Function combining two values, as reduction(V, V) -> V
+	*
+	* \remark Chunk results are combined in the order of the range, so the reduction only needs to be associative
+	*
+	* \see ParallelFor
+	*/
+	template<typename T, typename V, typename F, typename R>
+	V ParallelReduce(T begin, T end, T grain, V identity, F function, R reduction)
+	{
+		if (begin >= end)
+			return identity;
+
+		std::size_t count = static_cast<std::size_t>(end - begin);
+		std::size_t chunkSize = Detail::ComputeParallelChunkSize(count, static_cast<std::size_t>(grain));
+		std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+		std::vector<V> chunkResults(chunkCount, identity);
+		Detail::ParallelChunks(begin, end, chunkSize, chunkCount, [&chunkResults, &function](std::size_t chunkIndex, T first, T last)
+		{
+			chunkResults[chunkIndex] = function(first, last);
+		});
+
+		V result = std::move(identity);
+		for (V& chunkResult : chunkResults)
+			result = reduction(std::move(result), std::move(chunkResult));
+
+		return result;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,56 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARAMETERKEY_HPP
+#define NAZARA_PARAMETERKEY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/StringView.hpp>
+#include <functional>
+
+namespace Nz
+{
+	class String;
+
+	class NAZARA_CORE_API ParameterKey
+	{
+		public:
+			inline ParameterKey();
+			explicit ParameterKey(StringView name);
+			ParameterKey(const ParameterKey&) = default;
+			~ParameterKey() = default;
+
+			inline UInt32 GetId() const;
+			const String& GetName() const;
+
+			inline bool IsValid() const;
+
+			ParameterKey& operator=(const ParameterKey&) = default;
+
+			inline bool operator==(ParameterKey key) const;
+			inline bool operator!=(ParameterKey key) const;
+			inline bool operator<(ParameterKey key) const;
+
+			static ParameterKey Find(StringView name);
+
+			static constexpr UInt32 InvalidId = 0xFFFFFFFF;
+
+		private:
+			inline explicit ParameterKey(UInt32 id);
+
+			UInt32 m_id;
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::ParameterKey>;
+}
+
+#include <Nazara/Core/ParameterKey.inl>
+
+#endif // NAZARA_PARAMETERKEY_HPP
@@ -0,0 +1,99 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an invalid ParameterKey object
+	*/
+	inline ParameterKey::ParameterKey() :
+	m_id(InvalidId)
+	{
+	}
+
+	/*!
+	* \brief Constructs a ParameterKey object from an already interned identifier
+	*
+	* \param id Identifier of the key
+	*/
+	inline ParameterKey::ParameterKey(UInt32 id) :
+	m_id(id)
+	{
+	}
+
+	/*!
+	* \brief Gets the identifier of the key
+	* \return Identifier, unique to the name of the key for the lifetime of the program
+	*/
+	inline UInt32 ParameterKey::GetId() const
+	{
+		return m_id;
+	}
+
+	/*!
+	* \brief Checks whether the key references a name
+	* \return true if it is the case
+	*/
+	inline bool ParameterKey::IsValid() const
+	{
+		return m_id != InvalidId;
+	}
+
+	/*!
+	* \brief Checks whether two keys reference the same name
+	* \return true if it is the case
+	*
+	* \param key Other key
+	*/
+	inline bool ParameterKey::operator==(ParameterKey key) const
+	{
+		return m_id == key.m_id;
+	}
+
+	/*!
+	* \brief Checks whether two keys reference different names
+	* \return true if it is the case
+	*
+	* \param key Other key
+	*/
+	inline bool ParameterKey::operator!=(ParameterKey key) const
+	{
+		return m_id != key.m_id;
+	}
+
+	/*!
+	* \brief Compares the identifiers of two keys
+	* \return true if this key was interned before the other one
+	*
+	* \param key Other key
+	*
+	* \remark This order has nothing to do with the alphabetical order of the names
+	*/
+	inline bool ParameterKey::operator<(ParameterKey key) const
+	{
+		return m_id < key.m_id;
+	}
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::ParameterKey>
+	{
+		/*!
+		* \brief Specialisation of std to hash
+		* \return Result of the hash
+		*
+		* \param key Key to hash
+		*/
+		size_t operator()(Nz::ParameterKey key) const
+		{
+			return key.GetId();
+		}
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
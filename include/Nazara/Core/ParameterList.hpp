@@ -10,9 +10,10 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/ParameterKey.hpp>
 #include <Nazara/Core/String.hpp>
 #include <atomic>
-#include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -22,46 +23,75 @@ namespace Nz
 			using Destructor = void (*)(void* value);
 
 			ParameterList() = default;
-			ParameterList(const ParameterList& list);
+			ParameterList(const ParameterList&) = default;
 			ParameterList(ParameterList&&) = default;
-			~ParameterList();
+			~ParameterList() = default;
 
 			void Clear();
 
 			inline void ForEach(const std::function<bool(const ParameterList& list, const String& name)>& callback);
 			inline void ForEach(const std::function<void(const ParameterList& list, const String& name)>& callback) const;
 
-			bool GetBooleanParameter(const String& name, bool* value) const;
-			bool GetColorParameter(const String& name, Color* value) const;
-			bool GetDoubleParameter(const String& name, double* value) const;
-			bool GetIntegerParameter(const String& name, long long* value) const;
-			bool GetParameterType(const String& name, ParameterType* type) const;
-			bool GetPointerParameter(const String& name, void** value) const;
-			bool GetStringParameter(const String& name, String* value) const;
-			bool GetUserdataParameter(const String& name, void** value) const;
-
-			bool HasParameter(const String& name) const;
-
-			void RemoveParameter(const String& name);
-
-			void SetParameter(const String& name);
-			void SetParameter(const String& name, const Color& value);
-			void SetParameter(const String& name, const String& value);
-			void SetParameter(const String& name, const char* value);
-			void SetParameter(const String& name, bool value);
-			void SetParameter(const String& name, double value);
-			void SetParameter(const String& name, long long value);
-			void SetParameter(const String& name, void* value);
-			void SetParameter(const String& name, void* value, Destructor destructor);
+			bool GetBooleanParameter(StringView name, bool* value) const;
+			bool GetBooleanParameter(ParameterKey key, bool* value) const;
+			bool GetColorParameter(StringView name, Color* value) const;
+			bool GetColorParameter(ParameterKey key, Color* value) const;
+			bool GetDoubleParameter(StringView name, double* value) const;
+			bool GetDoubleParameter(ParameterKey key, double* value) const;
+			bool GetIntegerParameter(StringView name, long long* value) const;
+			bool GetIntegerParameter(ParameterKey key, long long* value) const;
+			bool GetParameterType(StringView name, ParameterType* type) const;
+			bool GetParameterType(ParameterKey key, ParameterType* type) const;
+			bool GetPointerParameter(StringView name, void** value) const;
+			bool GetPointerParameter(ParameterKey key, void** value) const;
+			bool GetStringParameter(StringView name, String* value) const;
+			bool GetStringParameter(ParameterKey key, String* value) const;
+			bool GetUserdataParameter(StringView name, void** value) const;
+			bool GetUserdataParameter(ParameterKey key, void** value) const;
+
+			bool HasParameter(StringView name) const;
+			bool HasParameter(ParameterKey key) const;
+
+			void RemoveParameter(StringView name);
+			void RemoveParameter(ParameterKey key);
+
+			void SetParameter(StringView name);
+			void SetParameter(StringView name, const Color& value);
+			void SetParameter(StringView name, const String& value);
+			void SetParameter(StringView name, const char* value);
+			void SetParameter(StringView name, bool value);
+			void SetParameter(StringView name, double value);
+			void SetParameter(StringView name, long long value);
+			void SetParameter(StringView name, void* value);
+			void SetParameter(StringView name, void* value, Destructor destructor);
+			void SetParameter(ParameterKey key);
+			void SetParameter(ParameterKey key, const Color& value);
+			void SetParameter(ParameterKey key, const String& value);
+			void SetParameter(ParameterKey key, const char* value);
+			void SetParameter(ParameterKey key, bool value);
+			void SetParameter(ParameterKey key, double value);
+			void SetParameter(ParameterKey key, long long value);
+			void SetParameter(ParameterKey key, void* value);
+			void SetParameter(ParameterKey key, void* value, Destructor destructor);
 
 			String ToString() const;
 
-			ParameterList& operator=(const ParameterList& list);
+			ParameterList& operator=(const ParameterList&) = default;
 			ParameterList& operator=(ParameterList&&) = default;
 
 		private:
 			struct Parameter
 			{
+				Parameter() : type(ParameterType_None) {}
+				Parameter(const Parameter& parameter);
+				Parameter(Parameter&& parameter) noexcept;
+				~Parameter();
+
+				void Destroy();
+
+				Parameter& operator=(const Parameter& parameter);
+				Parameter& operator=(Parameter&& parameter) noexcept;
+
 				struct UserdataValue
 				{
 					UserdataValue(Destructor func, void* ud) :
@@ -97,10 +127,19 @@ namespace Nz
 				Value value;
 			};
 
-			Parameter& CreateValue(const String& name);
-			void DestroyValue(Parameter& parameter);
+			struct KeyComparator
+			{
+				bool operator()(const std::pair<ParameterKey, Parameter>& entry, ParameterKey key) const
+				{
+					return entry.first < key;
+				}
+			};
+
+			Parameter& CreateValue(ParameterKey key);
+			const Parameter* FindParameter(ParameterKey key) const;
 
-			using ParameterMap = std::unordered_map<String, Parameter>;
+			// Sorted by key, a few parameters are usually set and a binary search over them is cheaper than hashing a name
+			using ParameterMap = std::vector<std::pair<ParameterKey, Parameter>>;
 			ParameterMap m_parameters;
 	};
 }
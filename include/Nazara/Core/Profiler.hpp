@@ -0,0 +1,81 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PROFILER_HPP
+#define NAZARA_PROFILER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <atomic>
+
+namespace Nz
+{
+	class Stream;
+	class String;
+
+	class NAZARA_CORE_API Profiler
+	{
+		public:
+			Profiler() = delete;
+			~Profiler() = delete;
+
+			static void BeginZone(const char* name);
+
+			static void Clear();
+
+			static inline void Disable();
+			static void Enable(bool enable = true);
+
+			static void EndZone();
+
+			static bool ExportChromeTrace(const String& filePath);
+
+			static std::size_t GetEventCount();
+
+			static inline bool IsEnabled();
+
+			static void MarkFrame(const char* name = "Frame");
+
+			static void RecordCounter(const char* name, double value);
+
+			static void SetThreadName(const String& name);
+
+			static void WriteChromeTrace(Stream& stream);
+
+		private:
+			static std::atomic_bool s_enabled;
+	};
+
+	class ProfilerZone
+	{
+		public:
+			inline explicit ProfilerZone(const char* name);
+			ProfilerZone(const ProfilerZone&) = delete;
+			ProfilerZone(ProfilerZone&&) = delete;
+			inline ~ProfilerZone();
+
+			ProfilerZone& operator=(const ProfilerZone&) = delete;
+			ProfilerZone& operator=(ProfilerZone&&) = delete;
+
+		private:
+			bool m_recorded;
+	};
+}
+
+#if NAZARA_CORE_ENABLE_PROFILER
+	// Names must be string literals (or at least outlive the profiler data)
+	#define NazaraProfileCounter(name, value) do { if (Nz::Profiler::IsEnabled()) Nz::Profiler::RecordCounter(name, static_cast<double>(value)); } while (false)
+	#define NazaraProfileFrame(name) do { if (Nz::Profiler::IsEnabled()) Nz::Profiler::MarkFrame(name); } while (false)
+	#define NazaraProfileZone(name) Nz::ProfilerZone NazaraSuffixMacro(nazaraProfilerZone, __LINE__)(name)
+#else
+	#define NazaraProfileCounter(name, value) ((void) 0)
+	#define NazaraProfileFrame(name) ((void) 0)
+	#define NazaraProfileZone(name) ((void) 0)
+#endif
+
+#include <Nazara/Core/Profiler.inl>
+
+#endif // NAZARA_PROFILER_HPP
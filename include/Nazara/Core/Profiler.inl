@@ -0,0 +1,63 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Disables the profiler
+	*
+	* This is just a shortcut to Enable(false)
+	*
+	* \see Enable
+	*/
+	inline void Profiler::Disable()
+	{
+		Enable(false);
+	}
+
+	/*!
+	* \brief Checks whether the profiler is currently recording events
+	* \return true If the profiler is enabled
+	*/
+	inline bool Profiler::IsEnabled()
+	{
+		return s_enabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ProfilerZone
+	* \brief Core class that records a profiler zone for the duration of its lifetime
+	*
+	* Nothing is recorded if the profiler is disabled when the zone is constructed; a zone which started while the profiler was enabled always ends, keeping the events balanced
+	*
+	* \see NazaraProfileZone
+	*/
+
+	/*!
+	* \brief Begins a zone, if the profiler is enabled
+	*
+	* \param name Name of the zone, must outlive the profiler data (usually a string literal)
+	*/
+	inline ProfilerZone::ProfilerZone(const char* name) :
+	m_recorded(Profiler::IsEnabled())
+	{
+		if (m_recorded)
+			Profiler::BeginZone(name);
+	}
+
+	/*!
+	* \brief Ends the zone, if it was recorded
+	*/
+	inline ProfilerZone::~ProfilerZone()
+	{
+		if (m_recorded)
+			Profiler::EndZone();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
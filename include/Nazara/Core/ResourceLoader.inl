@@ -4,8 +4,12 @@
 
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/PackFile.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/Debug.hpp>
 
@@ -49,12 +53,18 @@ namespace Nz
 	* \remark Produces a NazaraError if parameters are invalid with NAZARA_CORE_SAFE defined
 	* \remark Produces a NazaraError if filePath has no extension
 	* \remark Produces a NazaraError if file count not be opened
+	* \remark Files of mounted packs (see PackFile::Mount) are loaded in place of files of the filesystem, using stream loaders only
+	* \remark Files are read through a MappedFile, or through a File if they cannot be mapped.
+	*         Truncating a mapped file while it is being loaded (an editor saving it for example) makes the process crash on access (SIGBUS)
+	*         instead of failing the load, files which may be rewritten concurrently should be loaded from a File with LoadFromStream
 	* \remark Produces a NazaraWarning if loader failed
 	* \remark Produces a NazaraError if all loaders failed or no loader was found
 	*/
 	template<typename Type, typename Parameters>
 	ObjectRef<Type> ResourceLoader<Type, Parameters>::LoadFromFile(const String& filePath, const Parameters& parameters)
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromFile");
+
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
 		String path = File::NormalizePath(filePath);
@@ -65,7 +75,12 @@ namespace Nz
 			return nullptr;
 		}
 
-		File file(path); // Open only if needed
+		// Files of mounted packs take precedence over the filesystem and can only be loaded from a stream
+		std::unique_ptr<Stream> packedFile = PackFile::OpenMountedFile(path);
+
+		MappedFile mappedFile; // Open only if needed
+		File regularFile;      // Used if the file cannot be mapped
+		Stream* file = packedFile.get();
 
 		bool found = false;
 		for (Loader& loader : Type::s_loaders)
@@ -78,12 +93,37 @@ namespace Nz
 			StreamLoader streamLoader = std::get<2>(loader);
 			FileLoader fileLoader = std::get<3>(loader);
 
-			if (checkFunc && !file.IsOpen())
+			if (packedFile)
+			{
+				if (!streamLoader)
+					continue;
+
+				fileLoader = nullptr;
+			}
+			else if (checkFunc && !file)
 			{
-				if (!file.Open(OpenMode_ReadOnly))
+				bool mapped;
 				{
-					NazaraError("Failed to load file: unable to open \"" + filePath + '"');
-					return nullptr;
+					// Some filesystems don't support mapping (or report an empty size, as procfs does), the file is read the usual way in that case
+					ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+					mapped = mappedFile.Open(path) && mappedFile.GetSize() > 0;
+				}
+
+				if (mapped)
+				{
+					// Most loaders parse their file from beginning to end
+					mappedFile.Advise(MemoryAccessHint_Sequential);
+					file = &mappedFile;
+				}
+				else
+				{
+					if (!regularFile.Open(path, OpenMode_ReadOnly))
+					{
+						NazaraError("Failed to load file: unable to open \"" + filePath + '"');
+						return nullptr;
+					}
+
+					file = &regularFile;
 				}
 			}
 
@@ -92,9 +132,9 @@ namespace Nz
 			{
 				if (checkFunc)
 				{
-					file.SetCursorPos(0);
+					file->SetCursorPos(0);
 
-					recognized = checkFunc(file, parameters);
+					recognized = checkFunc(*file, parameters);
 					if (recognized == Ternary_False)
 						continue;
 					else
@@ -115,17 +155,17 @@ namespace Nz
 			}
 			else
 			{
-				file.SetCursorPos(0);
+				file->SetCursorPos(0);
 
-				recognized = checkFunc(file, parameters);
+				recognized = checkFunc(*file, parameters);
 				if (recognized == Ternary_False)
 					continue;
 				else if (recognized == Ternary_True)
 					found = true;
 
-				file.SetCursorPos(0);
+				file->SetCursorPos(0);
 
-				ObjectRef<Type> resource = streamLoader(file, parameters);
+				ObjectRef<Type> resource = streamLoader(*file, parameters);
 				if (resource)
 				{
 					resource->SetFilePath(filePath);
@@ -163,6 +203,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	ObjectRef<Type> ResourceLoader<Type, Parameters>::LoadFromMemory(const void* data, std::size_t size, const Parameters& parameters)
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromMemory");
+
 		NazaraAssert(data, "Invalid data pointer");
 		NazaraAssert(size, "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
@@ -245,6 +287,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	ObjectRef<Type> ResourceLoader<Type, Parameters>::LoadFromStream(Stream& stream, const Parameters& parameters)
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromStream");
+
 		NazaraAssert(stream.GetCursorPos() < stream.GetSize(), "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
@@ -7,10 +7,15 @@
 #ifndef NAZARA_RESOURCEMANAGER_HPP
 #define NAZARA_RESOURCEMANAGER_HPP
 
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/String.hpp>
+#include <functional>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -19,25 +24,94 @@ namespace Nz
 	{
 		friend Type;
 
+		struct LoadState;
+
 		public:
+			class AsyncResource;
+			using LoadCallback = std::function<void(const ObjectRef<Type>& resource)>;
+
 			ResourceManager() = delete;
 			~ResourceManager() = delete;
 
 			static void Clear();
 
-			static ObjectRef<Type> Get(const String& filePath);
+			static ObjectRef<Type> Get(StringView filePath);
+			static AsyncResource GetAsync(StringView filePath, int priority = 0, LoadCallback callback = nullptr);
 			static const Parameters& GetDefaultParameters();
 
 			static void Purge();
-			static void Register(const String& filePath, ObjectRef<Type> resource);
+			static void Register(StringView filePath, ObjectRef<Type> resource);
 			static void SetDefaultParameters(const Parameters& params);
-			static void Unregister(const String& filePath);
+			static void Unregister(StringView filePath);
+
+			class AsyncResource
+			{
+				friend ResourceManager;
+
+				public:
+					AsyncResource() = default;
+					AsyncResource(const AsyncResource&) = default;
+					AsyncResource(AsyncResource&&) noexcept = default;
+					~AsyncResource() = default;
+
+					ObjectRef<Type> Get() const;
+
+					bool IsReady() const;
+					inline bool IsValid() const;
+
+					void Wait() const;
+
+					AsyncResource& operator=(const AsyncResource&) = default;
+					AsyncResource& operator=(AsyncResource&&) noexcept = default;
+
+				private:
+					inline AsyncResource(std::shared_ptr<LoadState> state);
+
+					std::shared_ptr<LoadState> m_state;
+			};
 
 		private:
 			static bool Initialize();
 			static void Uninitialize();
 
-			using ManagerMap = std::unordered_map<String, ObjectRef<Type>>;
+			static void Load(const std::shared_ptr<LoadState>& state);
+			static void LoadNextQueued();
+			static std::shared_ptr<LoadState> Request(const String& filePath, int priority, LoadCallback callback, bool* shouldLoad);
+
+			enum class LoadStatus
+			{
+				Queued,
+				Loading,
+				Done
+			};
+
+			struct LoadState
+			{
+				ObjectRef<Type> resource;
+				String filePath;
+				std::vector<LoadCallback> callbacks;
+				LoadStatus status;
+				int priority;
+			};
+
+			struct QueueEntry
+			{
+				std::shared_ptr<LoadState> state;
+				int priority;
+				UInt64 sequence;
+			};
+
+			// Everything is protected by mutex, loads happen outside of it
+			struct ManagerMap
+			{
+				std::unordered_map<String, ObjectRef<Type>> resources;
+				std::unordered_map<String, std::shared_ptr<LoadState>> pendingLoads;
+				std::vector<QueueEntry> queue; //< Heap of queued asynchronous loads, entries whose priority doesn't match their state are outdated
+				ConditionVariable loadCondition;
+				Mutex mutex;
+				UInt64 nextSequence = 0;
+			};
+
 			using ManagerParams = Parameters;
 	};
 }
@@ -4,24 +4,47 @@
 
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename Entry>
+		bool CompareResourceQueueEntries(const Entry& lhs, const Entry& rhs)
+		{
+			// Highest priority first, then first requested first
+			if (lhs.priority != rhs.priority)
+				return lhs.priority < rhs.priority;
+
+			return lhs.sequence > rhs.sequence;
+		}
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::ResourceManager
 	* \brief Core class that represents a resource manager
+	*
+	* The manager is thread-safe, resources can be requested from any thread.
+	* Resources are loaded only once, even if they are requested by multiple threads (or multiple asynchronous requests) at the same time.
 	*/
 
 	/*!
 	* \brief Clears the content of the manager
+	*
+	* \remark Loads in progress are not cancelled
 	*/
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Clear()
 	{
-		Type::s_managerMap.clear();
+		LockGuard lock(Type::s_managerMap.mutex);
+
+		Type::s_managerMap.resources.clear();
 	}
 
 	/*!
@@ -29,27 +52,127 @@ namespace Nz
 	* \return Reference to the object
 	*
 	* \param filePath Path to the asset that will be loaded
+	*
+	* \remark If the asset is being loaded asynchronously, waits for it instead of loading it a second time
+	*/
+	template<typename Type, typename Parameters>
+	ObjectRef<Type> ResourceManager<Type, Parameters>::Get(StringView filePath)
+	{
+		String absolutePath = File::AbsolutePath(String(filePath));
+
+		std::shared_ptr<LoadState> state;
+		bool shouldLoad = false;
+		{
+			LockGuard lock(Type::s_managerMap.mutex);
+
+			auto it = Type::s_managerMap.resources.find(absolutePath);
+			if (it != Type::s_managerMap.resources.end())
+				return it->second;
+
+			auto pendingIt = Type::s_managerMap.pendingLoads.find(absolutePath);
+			if (pendingIt == Type::s_managerMap.pendingLoads.end())
+			{
+				state = std::make_shared<LoadState>();
+				state->filePath = absolutePath;
+				state->priority = 0;
+				state->status = LoadStatus::Loading;
+
+				Type::s_managerMap.pendingLoads.emplace(std::move(absolutePath), state);
+				shouldLoad = true;
+			}
+			else
+				state = pendingIt->second;
+		}
+
+		if (shouldLoad)
+			Load(state);
+		else
+			AsyncResource(state).Wait();
+
+		return state->resource;
+	}
+
+	/*!
+	* \brief Gets an object loaded from file without waiting for it
+	* \return Asynchronous resource, which will hold a reference to the object once loaded
+	*
+	* The load happens on the TaskScheduler workers (see TaskScheduler::SubmitTask), unless someone waits for the resource before it started.
+	* Multiple requests of the same file share the same load, queued loads are started by decreasing priority.
+	*
+	* \param filePath Path to the asset that will be loaded
+	* \param priority Priority of the load, higher priorities are loaded first (if the file is already queued, its priority is raised if lower)
+	* \param callback Optional function called with the resource (which may be null if the load failed) once loaded, immediately if it already is, from the thread which loaded it otherwise
+	*
+	* \remark Type::LoadFromFile will be called from another thread, resources requiring a context bound to a thread should not be loaded asynchronously
 	*/
 	template<typename Type, typename Parameters>
-	ObjectRef<Type> ResourceManager<Type, Parameters>::Get(const String& filePath)
+	typename ResourceManager<Type, Parameters>::AsyncResource ResourceManager<Type, Parameters>::GetAsync(StringView filePath, int priority, LoadCallback callback)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
-		auto it = Type::s_managerMap.find(absolutePath);
-		if (it == Type::s_managerMap.end())
+		String absolutePath = File::AbsolutePath(String(filePath));
+
+		std::shared_ptr<LoadState> state;
+		bool shouldQueue = false;
 		{
-			ObjectRef<Type> resource = Type::LoadFromFile(absolutePath, GetDefaultParameters());
-			if (!resource)
+			LockGuard lock(Type::s_managerMap.mutex);
+
+			auto it = Type::s_managerMap.resources.find(absolutePath);
+			if (it != Type::s_managerMap.resources.end())
 			{
-				NazaraError("Failed to load resource from file: " + absolutePath);
-				return ObjectRef<Type>();
+				state = std::make_shared<LoadState>();
+				state->filePath = std::move(absolutePath);
+				state->priority = priority;
+				state->resource = it->second;
+				state->status = LoadStatus::Done;
 			}
+			else
+			{
+				auto pendingIt = Type::s_managerMap.pendingLoads.find(absolutePath);
+				if (pendingIt == Type::s_managerMap.pendingLoads.end())
+				{
+					state = std::make_shared<LoadState>();
+					state->filePath = absolutePath;
+					state->priority = priority;
+					state->status = LoadStatus::Queued;
+
+					Type::s_managerMap.pendingLoads.emplace(std::move(absolutePath), state);
+					shouldQueue = true;
+				}
+				else
+				{
+					state = pendingIt->second;
+					if (state->status == LoadStatus::Queued && priority > state->priority)
+					{
+						// The previous entry becomes outdated and will be skipped
+						state->priority = priority;
 
-			NazaraDebug("Loaded resource from file " + absolutePath);
+						Type::s_managerMap.queue.push_back({state, priority, Type::s_managerMap.nextSequence++});
+						std::push_heap(Type::s_managerMap.queue.begin(), Type::s_managerMap.queue.end(), Detail::CompareResourceQueueEntries<QueueEntry>);
+					}
+				}
 
-			it = Type::s_managerMap.insert(std::make_pair(absolutePath, resource)).first;
+				if (callback)
+				{
+					state->callbacks.emplace_back(std::move(callback));
+					callback = nullptr;
+				}
+
+				if (shouldQueue)
+				{
+					Type::s_managerMap.queue.push_back({state, priority, Type::s_managerMap.nextSequence++});
+					std::push_heap(Type::s_managerMap.queue.begin(), Type::s_managerMap.queue.end(), Detail::CompareResourceQueueEntries<QueueEntry>);
+				}
+			}
 		}
 
-		return it->second;
+		// Only set if the resource was already loaded
+		if (callback)
+			callback(state->resource);
+
+		// Tasks don't load a specific file but the one with the highest priority at the time they run
+		if (shouldQueue)
+			TaskScheduler::SubmitTask([]() { LoadNextQueued(); });
+
+		return AsyncResource(std::move(state));
 	}
 
 	/*!
@@ -68,14 +191,16 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Purge()
 	{
-		auto it = Type::s_managerMap.begin();
-		while (it != Type::s_managerMap.end())
+		LockGuard lock(Type::s_managerMap.mutex);
+
+		auto it = Type::s_managerMap.resources.begin();
+		while (it != Type::s_managerMap.resources.end())
 		{
 			const ObjectRef<Type>& ref = it->second;
 			if (ref->GetReferenceCount() == 1) // Are we the only ones to own the resource ?
 			{
 				NazaraDebug("Purging resource from file " + ref->GetFilePath());
-				Type::s_managerMap.erase(it++); // Then we erase it
+				Type::s_managerMap.resources.erase(it++); // Then we erase it
 			}
 			else
 				++it;
@@ -89,11 +214,13 @@ namespace Nz
 	* \param resource Object to associate with
 	*/
 	template<typename Type, typename Parameters>
-	void ResourceManager<Type, Parameters>::Register(const String& filePath, ObjectRef<Type> resource)
+	void ResourceManager<Type, Parameters>::Register(StringView filePath, ObjectRef<Type> resource)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
+		String absolutePath = File::AbsolutePath(String(filePath));
+
+		LockGuard lock(Type::s_managerMap.mutex);
 
-		Type::s_managerMap[absolutePath] = resource;
+		Type::s_managerMap.resources[absolutePath] = resource;
 	}
 
 	/*!
@@ -104,6 +231,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::SetDefaultParameters(const Parameters& params)
 	{
+		LockGuard lock(Type::s_managerMap.mutex);
+
 		Type::s_managerParameters = params;
 	}
 
@@ -113,11 +242,13 @@ namespace Nz
 	* \param filePath Path for the resource
 	*/
 	template<typename Type, typename Parameters>
-	void ResourceManager<Type, Parameters>::Unregister(const String& filePath)
+	void ResourceManager<Type, Parameters>::Unregister(StringView filePath)
 	{
-		String absolutePath = File::AbsolutePath(filePath);
+		String absolutePath = File::AbsolutePath(String(filePath));
+
+		LockGuard lock(Type::s_managerMap.mutex);
 
-		Type::s_managerMap.erase(absolutePath);
+		Type::s_managerMap.resources.erase(absolutePath);
 	}
 
 	/*!
@@ -138,6 +269,155 @@ namespace Nz
 	{
 		Clear();
 	}
+
+	/*!
+	* \brief Loads a resource on the calling thread and signals its completion
+	*
+	* \param state Load state of the resource, whose status must be Loading
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::Load(const std::shared_ptr<LoadState>& state)
+	{
+		Parameters parameters;
+		{
+			LockGuard lock(Type::s_managerMap.mutex);
+			parameters = Type::s_managerParameters;
+		}
+
+		ObjectRef<Type> resource = Type::LoadFromFile(state->filePath, parameters);
+		if (resource)
+			NazaraDebug("Loaded resource from file " + state->filePath);
+		else
+			NazaraError("Failed to load resource from file: " + state->filePath);
+
+		std::vector<LoadCallback> callbacks;
+		{
+			LockGuard lock(Type::s_managerMap.mutex);
+
+			// A resource registered in the meantime takes precedence
+			if (resource)
+				resource = Type::s_managerMap.resources.emplace(state->filePath, resource).first->second;
+
+			Type::s_managerMap.pendingLoads.erase(state->filePath);
+
+			state->resource = resource;
+			state->status = LoadStatus::Done;
+
+			callbacks = std::move(state->callbacks);
+		}
+
+		Type::s_managerMap.loadCondition.SignalAll();
+
+		for (const LoadCallback& callback : callbacks)
+			callback(resource);
+	}
+
+	/*!
+	* \brief Loads the queued resource with the highest priority, if any
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::LoadNextQueued()
+	{
+		std::shared_ptr<LoadState> state;
+		{
+			LockGuard lock(Type::s_managerMap.mutex);
+
+			auto& queue = Type::s_managerMap.queue;
+			while (!queue.empty())
+			{
+				std::pop_heap(queue.begin(), queue.end(), Detail::CompareResourceQueueEntries<QueueEntry>);
+				QueueEntry entry = std::move(queue.back());
+				queue.pop_back();
+
+				// Skip loads already started by a waiting thread and entries outdated by a priority change
+				if (entry.state->status == LoadStatus::Queued && entry.priority == entry.state->priority)
+				{
+					state = std::move(entry.state);
+					state->status = LoadStatus::Loading;
+					break;
+				}
+			}
+		}
+
+		if (state)
+			Load(state);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ResourceManager::AsyncResource
+	* \brief Core class that represents a resource being loaded by a ResourceManager
+	*/
+
+	/*!
+	* \brief Gets the loaded resource, waiting for it if required
+	* \return Reference to the resource, which is null if the load failed
+	*
+	* \see Wait
+	*/
+	template<typename Type, typename Parameters>
+	ObjectRef<Type> ResourceManager<Type, Parameters>::AsyncResource::Get() const
+	{
+		Wait();
+
+		return m_state->resource;
+	}
+
+	/*!
+	* \brief Checks whether the load is over
+	* \return true if Get won't block
+	*/
+	template<typename Type, typename Parameters>
+	bool ResourceManager<Type, Parameters>::AsyncResource::IsReady() const
+	{
+		NazaraAssert(IsValid(), "Invalid async resource");
+
+		LockGuard lock(Type::s_managerMap.mutex);
+
+		return m_state->status == LoadStatus::Done;
+	}
+
+	/*!
+	* \brief Checks whether the object refers to a resource
+	* \return true if it was returned by ResourceManager::GetAsync
+	*/
+	template<typename Type, typename Parameters>
+	inline bool ResourceManager<Type, Parameters>::AsyncResource::IsValid() const
+	{
+		return m_state != nullptr;
+	}
+
+	/*!
+	* \brief Waits for the load to be over
+	*
+	* If the load has not started yet, it is done by the calling thread instead of waiting for a worker.
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::AsyncResource::Wait() const
+	{
+		NazaraAssert(IsValid(), "Invalid async resource");
+
+		LockGuard lock(Type::s_managerMap.mutex);
+		while (m_state->status != LoadStatus::Done)
+		{
+			if (m_state->status == LoadStatus::Queued)
+			{
+				m_state->status = LoadStatus::Loading;
+				lock.Unlock();
+
+				Load(m_state);
+				return;
+			}
+
+			Type::s_managerMap.loadCondition.Wait(&Type::s_managerMap.mutex);
+		}
+	}
+
+	template<typename Type, typename Parameters>
+	inline ResourceManager<Type, Parameters>::AsyncResource::AsyncResource(std::shared_ptr<LoadState> state) :
+	m_state(std::move(state))
+	{
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
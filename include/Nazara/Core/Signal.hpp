@@ -7,8 +7,12 @@
 #ifndef NAZARA_SIGNAL_HPP
 #define NAZARA_SIGNAL_HPP
 
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/HandleTable.hpp>
 #include <functional>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 #define NazaraDetailSignal(Keyword, SignalName, ...) using SignalName ## Type = Nz::Signal<__VA_ARGS__>; \
@@ -34,45 +38,113 @@ namespace Nz
 			Signal();
 			Signal(const Signal&);
 			Signal(Signal&& signal) noexcept;
-			~Signal() = default;
+			~Signal();
 
 			void Clear();
 
-			Connection Connect(const Callback& func);
-			Connection Connect(Callback&& func);
+			template<typename F> Connection Connect(F&& func);
 			template<typename O> Connection Connect(O& object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(O* object, void (O::*method)(Args...));
 			template<typename O> Connection Connect(const O& object, void (O::*method)(Args...) const);
 			template<typename O> Connection Connect(const O* object, void (O::*method)(Args...) const);
 
+			void Defer(Args... args) const;
+
+			void Flush() const;
+
+			std::size_t GetDeferredCount() const;
+			std::size_t GetSlotCount() const;
+
 			void operator()(Args... args) const;
 
 			Signal& operator=(const Signal&);
 			Signal& operator=(Signal&& signal) noexcept;
 
 		private:
-			struct Slot;
+			class Slot;
+			struct DeferredCalls;
 
-			using SlotPtr = std::shared_ptr<Slot>;
-			using SlotList = std::vector<SlotPtr>;
-			using SlotListIndex = typename SlotList::size_type;
+			struct DeferredCallsBase
+			{
+				virtual ~DeferredCallsBase() = default;
+			};
 
-			struct Slot
+			struct EmissionGuard
 			{
-				Slot(Signal* me) :
-				signal(me)
-				{
-				}
-
-				Callback callback;
-				Signal* signal;
-				SlotListIndex index;
+				EmissionGuard(const Signal& emittingSignal);
+				~EmissionGuard();
+
+				const Signal& signal;
 			};
 
-			void Disconnect(const SlotPtr& slot) noexcept;
+			struct Entry
+			{
+				UInt32 slotIndex; //< Index of the next free entry while the entry is unused
+				UInt32 generation;
+			};
 
-			SlotList m_slots;
-			mutable SlotListIndex m_slotIterator;
+			UInt32 AllocateEntry();
+			void ApplyPendingChanges();
+			void Disconnect(UInt32 entryIndex, UInt32 generation) noexcept;
+			void Emit(Args&... args) const;
+			void FreeEntry(UInt32 entryIndex);
+			UInt32 GetHandleIndex();
+			bool IsConnected(UInt32 entryIndex, UInt32 generation) const;
+			void RemoveSlot(std::size_t slotIndex);
+
+			static constexpr UInt32 InvalidIndex = 0xFFFFFFFF;
+			static constexpr UInt32 PendingFlag = 0x80000000;
+
+			std::unique_ptr<std::vector<Slot>> m_pendingSlots;
+			std::vector<Entry> m_entries;
+			std::vector<Slot> m_slots;
+			mutable std::unique_ptr<DeferredCallsBase> m_deferredCalls;
+			UInt32 m_firstFreeEntry;
+			UInt32 m_handleIndex;
+			mutable UInt32 m_emissionDepth;
+			bool m_hasPendingChanges;
+	};
+
+	template<typename... Args>
+	class Signal<Args...>::Slot
+	{
+		public:
+			template<typename F> Slot(F&& func, UInt32 entry);
+			Slot(const Slot&) = delete;
+			Slot(Slot&& slot) noexcept;
+			~Slot();
+
+			void operator()(Args&... args) const;
+
+			Slot& operator=(const Slot&) = delete;
+			Slot& operator=(Slot&& slot) noexcept;
+
+			UInt32 entryIndex; //< InvalidIndex once disconnected during an emission
+
+		private:
+			static constexpr std::size_t InlineSize = 3 * sizeof(void*);
+
+			template<typename F> using IsStoredInline = std::integral_constant<bool, sizeof(F) <= InlineSize && alignof(F) <= alignof(void*) && std::is_nothrow_move_constructible<F>::value>;
+
+			using Invoker = void (*)(void* storage, Args&... args);
+			using Manager = void (*)(void* destination, void* source);
+
+			template<typename F> static F* GetFunctor(void* storage, std::true_type);
+			template<typename F> static F* GetFunctor(void* storage, std::false_type);
+			template<typename F> static void Invoke(void* storage, Args&... args);
+			template<typename F> static void Manage(void* destination, void* source);
+			template<typename F> static void Manage(void* destination, void* source, std::true_type);
+			template<typename F> static void Manage(void* destination, void* source, std::false_type);
+
+			mutable std::aligned_storage_t<InlineSize, alignof(void*)> m_storage;
+			Invoker m_invoker;
+			Manager m_manager;
+	};
+
+	template<typename... Args>
+	struct Signal<Args...>::DeferredCalls : DeferredCallsBase
+	{
+		std::vector<std::tuple<std::decay_t<Args>...>> calls;
 	};
 
 	template<typename... Args>
@@ -97,9 +169,14 @@ namespace Nz
 			Connection& operator=(Connection&& connection) noexcept;
 
 		private:
-			Connection(const SlotPtr& slot);
+			Connection(UInt32 signalIndex, UInt32 signalGeneration, UInt32 entryIndex, UInt32 entryGeneration);
+
+			BaseClass* GetSignal() const;
 
-			std::weak_ptr<Slot> m_ptr;
+			UInt32 m_entryGeneration = 0;
+			UInt32 m_entryIndex = 0;
+			UInt32 m_signalGeneration = 0;
+			UInt32 m_signalIndex = HandleTable::NullIndex;
 	};
 
 	template<typename... Args>
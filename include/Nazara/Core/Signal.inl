@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
 #include <utility>
 #include <Nazara/Core/Debug.hpp>
 
@@ -13,6 +15,11 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::Signal
 	* \brief Core class that represents a signal, a list of objects waiting for its message
+	*
+	* Slots are stored contiguously, and callables small enough (such as a member function bound to an object) are stored inside of them.
+	* Connections are indices into the signal and into its slots, checked by generation, so connecting, copying a connection and emitting don't allocate.
+	*
+	* Slots connected while the signal is emitted are only called from the next emission, slots disconnected while the signal is emitted are no longer called.
 	*/
 
 	/*!
@@ -20,7 +27,10 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Signal() :
-	m_slotIterator(0)
+	m_firstFreeEntry(InvalidIndex),
+	m_handleIndex(HandleTable::NullIndex),
+	m_emissionDepth(0),
+	m_hasPendingChanges(false)
 	{
 	}
 
@@ -42,61 +52,97 @@ namespace Nz
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Signal(Signal&& signal) noexcept
+	Signal<Args...>::Signal(Signal&& signal) noexcept :
+	Signal()
 	{
 		operator=(std::move(signal));
 	}
 
 	/*!
-	* \brief Clears the list of actions attached to the signal
+	* \brief Destructs the object and disconnects every connection
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Clear()
+	Signal<Args...>::~Signal()
 	{
-		m_slots.clear();
-		m_slotIterator = 0;
+		if (m_handleIndex != HandleTable::NullIndex)
+			HandleTable::Free(m_handleIndex);
 	}
 
 	/*!
-	* \brief Connects a function to the signal
-	* \return Connection attached to the signal
-	*
-	* \param func Non-member function
+	* \brief Clears the list of actions attached to the signal
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(const Callback& func)
+	void Signal<Args...>::Clear()
 	{
-		return Connect(Callback(func));
+		for (Slot& slot : m_slots)
+		{
+			if (slot.entryIndex != InvalidIndex)
+			{
+				FreeEntry(slot.entryIndex);
+				slot.entryIndex = InvalidIndex;
+			}
+		}
+
+		if (m_pendingSlots)
+		{
+			for (Slot& slot : *m_pendingSlots)
+			{
+				if (slot.entryIndex != InvalidIndex)
+				{
+					FreeEntry(slot.entryIndex);
+					slot.entryIndex = InvalidIndex;
+				}
+			}
+		}
+
+		if (m_emissionDepth > 0)
+			m_hasPendingChanges = true; //< Slots will be removed once the emission is over
+		else
+		{
+			m_slots.clear();
+			if (m_pendingSlots)
+				m_pendingSlots->clear();
+		}
 	}
 
 	/*!
 	* \brief Connects a function to the signal
 	* \return Connection attached to the signal
 	*
-	* \param func Non-member function
+	* \param func Function object (function, lambda, std::function, ...) callable with the signal arguments
 	*/
 
 	template<typename... Args>
-	typename Signal<Args...>::Connection Signal<Args...>::Connect(Callback&& func)
+	template<typename F>
+	typename Signal<Args...>::Connection Signal<Args...>::Connect(F&& func)
 	{
-		NazaraAssert(func, "Invalid function");
+		UInt32 handleIndex = GetHandleIndex();
 
-		// Since we're incrementing the slot vector size, we need to replace our iterator at the end
-		// (Except when we are iterating on the signal)
-		bool resetIt = (m_slotIterator >= m_slots.size());
+		Slot slot(std::forward<F>(func), AllocateEntry());
+		Entry& entry = m_entries[slot.entryIndex];
 
-		auto tempPtr = std::make_shared<Slot>(this);
-		tempPtr->callback = std::move(func);
-		tempPtr->index = m_slots.size();
+		Connection connection(handleIndex, HandleTable::GetGeneration(handleIndex), slot.entryIndex, entry.generation);
 
-		m_slots.emplace_back(std::move(tempPtr));
+		if (m_emissionDepth > 0)
+		{
+			// Adding a slot now would move the slot being called
+			if (!m_pendingSlots)
+				m_pendingSlots = std::make_unique<std::vector<Slot>>();
+
+			entry.slotIndex = static_cast<UInt32>(m_pendingSlots->size()) | PendingFlag;
+			m_pendingSlots->emplace_back(std::move(slot));
 
-		if (resetIt)
-			m_slotIterator = m_slots.size(); //< Replace the iterator to the end
+			m_hasPendingChanges = true;
+		}
+		else
+		{
+			entry.slotIndex = static_cast<UInt32>(m_slots.size());
+			m_slots.emplace_back(std::move(slot));
+		}
 
-		return Connection(m_slots.back());
+		return connection;
 	}
 
 	/*!
@@ -111,7 +157,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O& object, void (O::*method) (Args...))
 	{
-		return Connect([&object, method] (Args&&... args)
+		return Connect([&object, method] (Args... args)
 		{
 			return (object .* method) (std::forward<Args>(args)...);
 		});
@@ -129,7 +175,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(O* object, void (O::*method)(Args...))
 	{
-		return Connect([object, method] (Args&&... args)
+		return Connect([object, method] (Args... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
 		});
@@ -147,7 +193,7 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O& object, void (O::*method) (Args...) const)
 	{
-		return Connect([&object, method] (Args&&... args)
+		return Connect([&object, method] (Args... args)
 		{
 			return (object .* method) (std::forward<Args>(args)...);
 		});
@@ -165,12 +211,104 @@ namespace Nz
 	template<typename O>
 	typename Signal<Args...>::Connection Signal<Args...>::Connect(const O* object, void (O::*method)(Args...) const)
 	{
-		return Connect([object, method] (Args&&... args)
+		return Connect([object, method] (Args... args)
 		{
 			return (object ->* method) (std::forward<Args>(args)...);
 		});
 	}
 
+	/*!
+	* \brief Queues an emission of the signal, until the next call to Flush
+	*
+	* This allows an object to batch the emissions of a signal and to emit them at a time where it is safe for listeners to react.
+	*
+	* \param args Arguments to send with the message, they are copied
+	*
+	* \see Flush
+	*/
+
+	template<typename... Args>
+	void Signal<Args...>::Defer(Args... args) const
+	{
+		if (!m_deferredCalls)
+			m_deferredCalls = std::make_unique<DeferredCalls>();
+
+		static_cast<DeferredCalls&>(*m_deferredCalls).calls.emplace_back(std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \brief Emits every deferred emission, in the order they were queued
+	*
+	* \remark Emissions deferred by the listeners during the flush are kept until the next call to Flush
+	*
+	* \see Defer
+	*/
+
+	template<typename... Args>
+	void Signal<Args...>::Flush() const
+	{
+		if (!m_deferredCalls)
+			return;
+
+		auto& queuedCalls = static_cast<DeferredCalls&>(*m_deferredCalls).calls;
+		if (queuedCalls.empty())
+			return;
+
+		std::vector<std::tuple<std::decay_t<Args>...>> calls;
+		std::swap(calls, queuedCalls);
+
+		for (auto& call : calls)
+			Apply(*this, &Signal::operator(), call);
+
+		// Give back the memory to the queue if no emission was deferred in the meantime
+		if (queuedCalls.empty())
+		{
+			calls.clear();
+			std::swap(calls, queuedCalls);
+		}
+	}
+
+	/*!
+	* \brief Gets the number of emissions waiting for a flush
+	* \return Number of deferred emissions
+	*/
+
+	template<typename... Args>
+	std::size_t Signal<Args...>::GetDeferredCount() const
+	{
+		if (!m_deferredCalls)
+			return 0;
+
+		return static_cast<const DeferredCalls&>(*m_deferredCalls).calls.size();
+	}
+
+	/*!
+	* \brief Gets the number of slots connected to the signal
+	* \return Number of connected slots, including the ones connected during an emission
+	*/
+
+	template<typename... Args>
+	std::size_t Signal<Args...>::GetSlotCount() const
+	{
+		std::size_t slotCount = 0;
+		for (const Slot& slot : m_slots)
+		{
+			if (slot.entryIndex != InvalidIndex)
+				slotCount++;
+		}
+
+		if (m_pendingSlots)
+		{
+			for (const Slot& slot : *m_pendingSlots)
+			{
+				if (slot.entryIndex != InvalidIndex)
+					slotCount++;
+			}
+		}
+
+		return slotCount;
+	}
+
 	/*!
 	* \brief Applies the list of arguments to every callback functions
 	*
@@ -180,8 +318,9 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::operator()(Args... args) const
 	{
-		for (m_slotIterator = 0; m_slotIterator < m_slots.size(); ++m_slotIterator)
-			m_slots[m_slotIterator]->callback(args...);
+		// Most signals have no listener, keep this check inlinable
+		if (!m_slots.empty())
+			Emit(args...);
 	}
 
 	/*!
@@ -201,70 +340,315 @@ namespace Nz
 	* \return A reference to this
 	*
 	* \param signal Signal to move in this
+	*
+	* \remark Connections to this signal are disconnected, while connections to the moved signal are now attached to this one
 	*/
 	template<typename... Args>
 	Signal<Args...>& Signal<Args...>::operator=(Signal&& signal) noexcept
 	{
+		if (m_handleIndex != HandleTable::NullIndex)
+			HandleTable::Free(m_handleIndex);
+
+		m_deferredCalls = std::move(signal.m_deferredCalls);
+		m_entries = std::move(signal.m_entries);
+		m_firstFreeEntry = signal.m_firstFreeEntry;
+		m_handleIndex = signal.m_handleIndex;
+		m_hasPendingChanges = signal.m_hasPendingChanges;
+		m_pendingSlots = std::move(signal.m_pendingSlots);
 		m_slots = std::move(signal.m_slots);
-		m_slotIterator = signal.m_slotIterator;
 
-		// We need to update the signal pointer inside of each slot
-		for (SlotPtr& slot : m_slots)
-			slot->signal = this;
+		signal.m_entries.clear();
+		signal.m_firstFreeEntry = InvalidIndex;
+		signal.m_handleIndex = HandleTable::NullIndex;
+		signal.m_hasPendingChanges = false;
+		signal.m_slots.clear();
+
+		// Connections find their signal through the handle table
+		if (m_handleIndex != HandleTable::NullIndex)
+			HandleTable::SetObject(m_handleIndex, this);
 
 		return *this;
 	}
 
+	template<typename... Args>
+	UInt32 Signal<Args...>::AllocateEntry()
+	{
+		if (m_firstFreeEntry != InvalidIndex)
+		{
+			UInt32 entryIndex = m_firstFreeEntry;
+			m_firstFreeEntry = m_entries[entryIndex].slotIndex;
+
+			return entryIndex;
+		}
+
+		m_entries.push_back({InvalidIndex, 0});
+		return static_cast<UInt32>(m_entries.size() - 1);
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::ApplyPendingChanges()
+	{
+		NazaraAssert(m_emissionDepth == 0, "Signal is being emitted");
+
+		// Remove slots disconnected during the emission
+		std::size_t slotIndex = 0;
+		while (slotIndex < m_slots.size())
+		{
+			if (m_slots[slotIndex].entryIndex == InvalidIndex)
+			{
+				if (slotIndex != m_slots.size() - 1)
+					m_slots[slotIndex] = std::move(m_slots.back());
+
+				m_slots.pop_back();
+			}
+			else
+			{
+				m_entries[m_slots[slotIndex].entryIndex].slotIndex = static_cast<UInt32>(slotIndex);
+				slotIndex++;
+			}
+		}
+
+		// Add slots connected during the emission
+		if (m_pendingSlots)
+		{
+			for (Slot& slot : *m_pendingSlots)
+			{
+				if (slot.entryIndex != InvalidIndex)
+				{
+					m_entries[slot.entryIndex].slotIndex = static_cast<UInt32>(m_slots.size());
+					m_slots.emplace_back(std::move(slot));
+				}
+			}
+
+			m_pendingSlots->clear();
+		}
+
+		m_hasPendingChanges = false;
+	}
+
 	/*!
 	* \brief Disconnects a listener from this signal
 	*
-	* \param slot Pointer to the ith listener of the signal
+	* \param entryIndex Index of the entry of the listener
+	* \param generation Generation of the entry when the listener was connected
 	*
-	* \remark Produces a NazaraAssert if slot is invalid (nullptr)
-	* \remark Produces a NazaraAssert if index of slot is invalid
-	* \remark Produces a NazaraAssert if slot is not attached to this signal
+	* \remark Produces a NazaraAssert if entryIndex is invalid
 	*/
 
 	template<typename... Args>
-	void Signal<Args...>::Disconnect(const SlotPtr& slot) noexcept
+	void Signal<Args...>::Disconnect(UInt32 entryIndex, UInt32 generation) noexcept
 	{
-		NazaraAssert(slot, "Invalid slot pointer");
-		NazaraAssert(slot->index < m_slots.size(), "Invalid slot index");
-		NazaraAssert(slot->signal == this, "Slot is not attached to this signal");
+		NazaraAssert(entryIndex < m_entries.size(), "Invalid entry index");
 
-		// "Swap this slot with the last one and pop" idiom
-		// This will preserve slot indexes
+		Entry& entry = m_entries[entryIndex];
+		if (entry.generation != generation)
+			return; //< Already disconnected
 
-		// Can we safely "remove" this slot?
-		if (m_slotIterator >= (m_slots.size() - 1) || slot->index > m_slotIterator)
+		UInt32 slotIndex = entry.slotIndex;
+		FreeEntry(entryIndex);
+
+		if (slotIndex & PendingFlag)
+			(*m_pendingSlots)[slotIndex & ~PendingFlag].entryIndex = InvalidIndex;
+		else if (m_emissionDepth > 0)
 		{
-			// Yes we can
-			SlotPtr& newSlot = m_slots[slot->index];
-			newSlot = std::move(m_slots.back());
-			newSlot->index = slot->index; //< Update the moved slot index before resizing (in case it's the last one)
+			// The slot may be the one being called, it will be removed once the emission is over
+			m_slots[slotIndex].entryIndex = InvalidIndex;
+			m_hasPendingChanges = true;
 		}
 		else
+			RemoveSlot(slotIndex);
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::Emit(Args&... args) const
+	{
+		EmissionGuard guard(*this);
+
+		// Slots are not moved during the emission
+		std::size_t slotCount = m_slots.size();
+		for (std::size_t i = 0; i < slotCount; ++i)
 		{
-			// Nope, let's be tricky
-			SlotPtr& current = m_slots[m_slotIterator];
-			SlotPtr& newSlot = m_slots[slot->index];
+			const Slot& slot = m_slots[i];
+			if (slot.entryIndex != InvalidIndex)
+				slot(args...);
+		}
+	}
 
-			newSlot = std::move(current);
-			newSlot->index = slot->index; //< Update the moved slot index
+	template<typename... Args>
+	void Signal<Args...>::FreeEntry(UInt32 entryIndex)
+	{
+		Entry& entry = m_entries[entryIndex];
+		entry.generation++;
+		entry.slotIndex = m_firstFreeEntry;
 
-			current = std::move(m_slots.back());
-			current->index = m_slotIterator; //< Update the moved slot index
+		m_firstFreeEntry = entryIndex;
+	}
+
+	template<typename... Args>
+	UInt32 Signal<Args...>::GetHandleIndex()
+	{
+		if (m_handleIndex == HandleTable::NullIndex)
+			m_handleIndex = HandleTable::Allocate(this);
+
+		return m_handleIndex;
+	}
 
-			--m_slotIterator;
+	template<typename... Args>
+	bool Signal<Args...>::IsConnected(UInt32 entryIndex, UInt32 generation) const
+	{
+		return entryIndex < m_entries.size() && m_entries[entryIndex].generation == generation;
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::RemoveSlot(std::size_t slotIndex)
+	{
+		// "Swap this slot with the last one and pop" idiom
+		if (slotIndex != m_slots.size() - 1)
+		{
+			Slot& slot = m_slots[slotIndex];
+			slot = std::move(m_slots.back());
+
+			m_entries[slot.entryIndex].slotIndex = static_cast<UInt32>(slotIndex);
 		}
 
-		// Pop the last entry (from where we moved our slot)
 		m_slots.pop_back();
 	}
 
+	template<typename... Args>
+	Signal<Args...>::EmissionGuard::EmissionGuard(const Signal& emittingSignal) :
+	signal(emittingSignal)
+	{
+		signal.m_emissionDepth++;
+	}
+
+	template<typename... Args>
+	Signal<Args...>::EmissionGuard::~EmissionGuard()
+	{
+		// Pending changes can only be made by a listener holding a non-const reference to the signal
+		if (--signal.m_emissionDepth == 0 && signal.m_hasPendingChanges)
+			const_cast<Signal&>(signal).ApplyPendingChanges();
+	}
+
+	template<typename... Args>
+	template<typename F>
+	Signal<Args...>::Slot::Slot(F&& func, UInt32 entry) :
+	entryIndex(entry),
+	m_invoker(&Invoke<std::decay_t<F>>),
+	m_manager(&Manage<std::decay_t<F>>)
+	{
+		using Callable = std::decay_t<F>;
+
+		if (IsStoredInline<Callable>::value)
+			PlacementNew(reinterpret_cast<Callable*>(&m_storage), std::forward<F>(func));
+		else
+			*reinterpret_cast<Callable**>(&m_storage) = new Callable(std::forward<F>(func));
+	}
+
+	template<typename... Args>
+	Signal<Args...>::Slot::Slot(Slot&& slot) noexcept :
+	entryIndex(slot.entryIndex),
+	m_invoker(slot.m_invoker),
+	m_manager(slot.m_manager)
+	{
+		m_manager(&m_storage, &slot.m_storage);
+		slot.m_manager = nullptr;
+	}
+
+	template<typename... Args>
+	Signal<Args...>::Slot::~Slot()
+	{
+		if (m_manager)
+			m_manager(&m_storage, nullptr);
+	}
+
+	template<typename... Args>
+	void Signal<Args...>::Slot::operator()(Args&... args) const
+	{
+		m_invoker(&m_storage, args...);
+	}
+
+	template<typename... Args>
+	typename Signal<Args...>::Slot& Signal<Args...>::Slot::operator=(Slot&& slot) noexcept
+	{
+		if (&slot != this)
+		{
+			if (m_manager)
+				m_manager(&m_storage, nullptr);
+
+			entryIndex = slot.entryIndex;
+			m_invoker = slot.m_invoker;
+			m_manager = slot.m_manager;
+
+			m_manager(&m_storage, &slot.m_storage);
+			slot.m_manager = nullptr;
+		}
+
+		return *this;
+	}
+
+	template<typename... Args>
+	template<typename F>
+	F* Signal<Args...>::Slot::GetFunctor(void* storage, std::true_type)
+	{
+		return reinterpret_cast<F*>(storage);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	F* Signal<Args...>::Slot::GetFunctor(void* storage, std::false_type)
+	{
+		return *reinterpret_cast<F**>(storage);
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::Slot::Invoke(void* storage, Args&... args)
+	{
+		(*GetFunctor<F>(storage, IsStoredInline<F>()))(args...);
+	}
+
+	/*!
+	* \brief Moves a functor from a storage to another, or destroys it if source is null
+	*/
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::Slot::Manage(void* destination, void* source)
+	{
+		Manage<F>(destination, source, IsStoredInline<F>());
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::Slot::Manage(void* destination, void* source, std::true_type)
+	{
+		F* functor = reinterpret_cast<F*>(destination);
+		if (source)
+		{
+			F* sourceFunctor = reinterpret_cast<F*>(source);
+
+			PlacementNew(functor, std::move(*sourceFunctor));
+			sourceFunctor->~F();
+		}
+		else
+			functor->~F();
+	}
+
+	template<typename... Args>
+	template<typename F>
+	void Signal<Args...>::Slot::Manage(void* destination, void* source, std::false_type)
+	{
+		F*& functor = *reinterpret_cast<F**>(destination);
+		if (source)
+			functor = *reinterpret_cast<F**>(source);
+		else
+			delete functor;
+	}
+
 	/*!
 	* \class Nz::Signal::Connection
 	* \brief Core class that represents a connection attached to a signal
+	*
+	* A connection is made of indices, it stays valid when the signal is moved and knows when the signal is destroyed.
 	*/
 
 	/*!
@@ -274,20 +658,27 @@ namespace Nz
 	*/
 	template<typename... Args>
 	Signal<Args...>::Connection::Connection(Connection&& connection) noexcept :
-	m_ptr(std::move(connection.m_ptr))
+	Connection(connection)
 	{
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		connection.m_signalIndex = HandleTable::NullIndex;
+		connection.m_signalGeneration = 0;
 	}
-	
+
 	/*!
-	* \brief Constructs a Signal::Connection object with a slot
+	* \brief Constructs a Signal::Connection object referencing a slot
 	*
-	* \param slot Slot of the listener
+	* \param signalIndex Index of the signal in the handle table
+	* \param signalGeneration Generation of the signal handle
+	* \param entryIndex Index of the entry of the slot in the signal
+	* \param entryGeneration Generation of the entry
 	*/
 
 	template<typename... Args>
-	Signal<Args...>::Connection::Connection(const SlotPtr& slot) :
-	m_ptr(slot)
+	Signal<Args...>::Connection::Connection(UInt32 signalIndex, UInt32 signalGeneration, UInt32 entryIndex, UInt32 entryGeneration) :
+	m_entryGeneration(entryGeneration),
+	m_entryIndex(entryIndex),
+	m_signalGeneration(signalGeneration),
+	m_signalIndex(signalIndex)
 	{
 	}
 
@@ -312,8 +703,8 @@ namespace Nz
 	template<typename... Args>
 	void Signal<Args...>::Connection::Disconnect() noexcept
 	{
-		if (SlotPtr ptr = m_ptr.lock())
-			ptr->signal->Disconnect(ptr);
+		if (BaseClass* signal = GetSignal())
+			signal->Disconnect(m_entryIndex, m_entryGeneration);
 	}
 
 	/*!
@@ -324,7 +715,8 @@ namespace Nz
 	template<typename... Args>
 	bool Signal<Args...>::Connection::IsConnected() const
 	{
-		return !m_ptr.expired();
+		BaseClass* signal = GetSignal();
+		return signal && signal->IsConnected(m_entryIndex, m_entryGeneration);
 	}
 
 	/*!
@@ -335,12 +727,23 @@ namespace Nz
 	template<typename... Args>
 	typename Signal<Args...>::Connection& Signal<Args...>::Connection::operator=(Connection&& connection) noexcept
 	{
-		m_ptr = std::move(connection.m_ptr);
-		connection.m_ptr.reset(); //< Fuck you GCC 4.9
+		m_entryGeneration = connection.m_entryGeneration;
+		m_entryIndex = connection.m_entryIndex;
+		m_signalGeneration = connection.m_signalGeneration;
+		m_signalIndex = connection.m_signalIndex;
+
+		connection.m_signalIndex = HandleTable::NullIndex;
+		connection.m_signalGeneration = 0;
 
 		return *this;
 	}
-	
+
+	template<typename... Args>
+	typename Signal<Args...>::Connection::BaseClass* Signal<Args...>::Connection::GetSignal() const
+	{
+		return static_cast<BaseClass*>(HandleTable::GetObject(m_signalIndex, m_signalGeneration));
+	}
+
 	/*!
 	* \class Nz::Signal::ConnectionGuard
 	* \brief Core class that represents a RAII for a connection attached to a signal
@@ -0,0 +1,81 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SMALLOBJECTALLOCATOR_HPP
+#define NAZARA_SMALLOBJECTALLOCATOR_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <array>
+#include <cstddef>
+
+namespace Nz
+{
+	class NAZARA_CORE_API SmallObjectAllocator
+	{
+		public:
+			static constexpr std::size_t MaxSmallSize = 512;
+			static constexpr std::size_t SizeClassCount = 16;
+
+			struct SizeClassStats
+			{
+				std::size_t blockSize;
+				UInt64 allocationCount;
+				UInt64 blocksInUse;
+				UInt64 cacheHitCount; //< Allocations served by the calling thread cache, without touching shared memory
+			};
+
+			struct Stats
+			{
+				std::array<SizeClassStats, SizeClassCount> sizeClasses;
+				UInt64 bytesInUse;           //< Memory used by live allocations (small objects being rounded to their size class)
+				UInt64 bytesReserved;        //< Memory requested from the system for small objects
+				UInt64 largeAllocationCount; //< Allocations too big for a size class, forwarded to operator new
+			};
+
+			SmallObjectAllocator() = delete;
+			~SmallObjectAllocator() = delete;
+
+			static void* Allocate(std::size_t size);
+
+			template<typename T> static void Delete(T* ptr);
+
+			static void Free(void* ptr, std::size_t size);
+
+			static std::size_t GetBlockSize(std::size_t size);
+			static Stats GetStats();
+
+			template<typename T, typename... Args> static T* New(Args&&... args);
+	};
+
+	template<typename T>
+	class SmallObjectStlAllocator
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = SmallObjectStlAllocator<U>;
+			};
+
+			SmallObjectStlAllocator() = default;
+			template<typename U> SmallObjectStlAllocator(const SmallObjectStlAllocator<U>&) noexcept;
+			~SmallObjectStlAllocator() = default;
+
+			T* allocate(std::size_t n);
+			void deallocate(T* ptr, std::size_t n);
+	};
+
+	template<typename T, typename U> bool operator==(const SmallObjectStlAllocator<T>&, const SmallObjectStlAllocator<U>&);
+	template<typename T, typename U> bool operator!=(const SmallObjectStlAllocator<T>&, const SmallObjectStlAllocator<U>&);
+}
+
+#include <Nazara/Core/SmallObjectAllocator.inl>
+
+#endif // NAZARA_SMALLOBJECTALLOCATOR_HPP
@@ -0,0 +1,105 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Destroys an object created by New and frees its memory
+	*
+	* \param ptr Object to delete
+	*
+	* \remark If ptr is null, nothing is done
+	* \remark T must be the exact type of the object (not one of its base classes), as the size of T is used to find its block
+	*/
+	template<typename T>
+	void SmallObjectAllocator::Delete(T* ptr)
+	{
+		if (ptr)
+		{
+			PlacementDestroy(ptr);
+			Free(ptr, sizeof(T));
+		}
+	}
+
+	/*!
+	* \brief Allocates memory for an object and constructs it
+	* \return Pointer to the new object
+	*
+	* \param args Arguments for the constructor of the object
+	*/
+	template<typename T, typename... Args>
+	T* SmallObjectAllocator::New(Args&&... args)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+		return PlacementNew(static_cast<T*>(Allocate(sizeof(T))), std::forward<Args>(args)...);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::SmallObjectStlAllocator
+	* \brief Core class that represents a standard allocator relying on SmallObjectAllocator
+	*
+	* Best suited for node-based containers (std::list, std::map, std::unordered_map, ...) as big allocations are forwarded to operator new.
+	*/
+
+	/*!
+	* \brief Constructs a SmallObjectStlAllocator object from another one (rebinding)
+	*/
+	template<typename T>
+	template<typename U>
+	SmallObjectStlAllocator<T>::SmallObjectStlAllocator(const SmallObjectStlAllocator<U>&) noexcept
+	{
+	}
+
+	/*!
+	* \brief Allocates memory for n objects
+	* \return Pointer to the allocated (but not constructed) objects
+	*
+	* \param n Number of objects
+	*/
+	template<typename T>
+	T* SmallObjectStlAllocator<T>::allocate(std::size_t n)
+	{
+		return static_cast<T*>(SmallObjectAllocator::Allocate(n * sizeof(T)));
+	}
+
+	/*!
+	* \brief Frees memory previously allocated by allocate
+	*
+	* \param ptr Pointer returned by allocate
+	* \param n Number of objects given to allocate
+	*/
+	template<typename T>
+	void SmallObjectStlAllocator<T>::deallocate(T* ptr, std::size_t n)
+	{
+		SmallObjectAllocator::Free(ptr, n * sizeof(T));
+	}
+
+	/*!
+	* \brief Compares two SmallObjectStlAllocator
+	* \return Always true, as memory allocated by one can be freed by any other
+	*/
+	template<typename T, typename U>
+	bool operator==(const SmallObjectStlAllocator<T>&, const SmallObjectStlAllocator<U>&)
+	{
+		return true;
+	}
+
+	/*!
+	* \brief Compares two SmallObjectStlAllocator
+	* \return Always false, as memory allocated by one can be freed by any other
+	*/
+	template<typename T, typename U>
+	bool operator!=(const SmallObjectStlAllocator<T>&, const SmallObjectStlAllocator<U>&)
+	{
+		return false;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
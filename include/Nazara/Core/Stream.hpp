@@ -31,6 +31,7 @@ namespace Nz
 
 			virtual UInt64 GetCursorPos() const = 0;
 			virtual String GetDirectory() const;
+			virtual const UInt8* GetMemoryView() const;
 			virtual String GetPath() const;
 			inline OpenModeFlags GetOpenMode() const;
 			inline StreamOptionFlags GetStreamOptions() const;
@@ -39,6 +40,7 @@ namespace Nz
 
 			inline std::size_t Read(void* buffer, std::size_t size);
 			virtual String ReadLine(unsigned int lineSize = 0);
+			const UInt8* ReadView(std::size_t size);
 
 			inline bool IsReadable() const;
 			inline bool IsSequential() const;
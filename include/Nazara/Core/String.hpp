@@ -9,7 +9,9 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/StringView.hpp>
 #include <Nazara/Core/TypeTag.hpp>
+#include <atomic>
 #include <cstdarg>
 #include <iosfwd>
 #include <memory>
@@ -41,9 +43,10 @@ namespace Nz
 			String(const char* string);
 			String(const char* string, std::size_t length);
 			String(const std::string& string);
-			String(const String& string) = default;
+			explicit String(StringView view);
+			inline String(const String& string);
 			inline String(String&& string) noexcept;
-			~String() = default;
+			inline ~String();
 
 			String& Append(char character);
 			String& Append(const char* string);
@@ -198,6 +201,8 @@ namespace Nz
 			char& operator[](std::size_t pos);
 			char operator[](std::size_t pos) const;
 
+			inline operator StringView() const;
+
 			String& operator=(char character);
 			String& operator=(const char* string);
 			String& operator=(const std::string& string);
@@ -305,24 +310,28 @@ namespace Nz
 		private:
 			struct SharedString;
 
-			String(std::shared_ptr<SharedString>&& sharedString);
-
+			void AllocateBuffer(std::size_t size, std::size_t capacity = 0);
 			void EnsureOwnership(bool discardContent = false);
 			inline void ReleaseString();
 
-			static const std::shared_ptr<SharedString>& GetEmptyString();
+			static void FreeSharedString(SharedString* sharedString);
 
-			std::shared_ptr<SharedString> m_sharedString;
+			static constexpr std::size_t LocalCapacity = 15;
 
+			// Header of heap buffers, characters are stored right after it
 			struct SharedString
 			{
-				inline SharedString();
-				inline SharedString(std::size_t strSize);
-				inline SharedString(std::size_t strSize, std::size_t strCapacity);
-
+				std::atomic_uint refCount;
 				std::size_t capacity;
-				std::size_t size;
-				std::unique_ptr<char[]> string;
+			};
+
+			char* m_buffer; //< Points to m_localBuffer or to the characters following m_sharedString
+			std::size_t m_size;
+
+			union
+			{
+				SharedString* m_sharedString;
+				char m_localBuffer[LocalCapacity + 1];
 			};
 	};
 
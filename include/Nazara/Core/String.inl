@@ -3,19 +3,75 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/AbstractHash.hpp>
+#include <cstring>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	inline Nz::String::String(String&& string) noexcept :
-	m_sharedString(std::move(string.m_sharedString))
+	/*!
+	* \brief Constructs a String object which is a copy of another
+	*
+	* \param string String to copy
+	*
+	* \remark Short strings are copied, longer ones share their buffer until one of them is modified
+	*/
+	inline String::String(const String& string) :
+	m_size(string.m_size)
+	{
+		if (string.m_buffer == string.m_localBuffer)
+		{
+			m_buffer = m_localBuffer;
+			std::memcpy(m_localBuffer, string.m_localBuffer, sizeof(m_localBuffer));
+		}
+		else
+		{
+			m_buffer = string.m_buffer;
+			m_sharedString = string.m_sharedString;
+			m_sharedString->refCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \brief Constructs a String object by move semantic
+	*
+	* \param string String to move, left empty
+	*/
+	inline String::String(String&& string) noexcept :
+	m_size(string.m_size)
+	{
+		if (string.m_buffer == string.m_localBuffer)
+		{
+			m_buffer = m_localBuffer;
+			std::memcpy(m_localBuffer, string.m_localBuffer, sizeof(m_localBuffer));
+		}
+		else
+		{
+			m_buffer = string.m_buffer;
+			m_sharedString = string.m_sharedString;
+
+			string.m_buffer = string.m_localBuffer;
+		}
+
+		string.m_size = 0;
+		string.m_localBuffer[0] = '\0';
+	}
+
+	/*!
+	* \brief Destructs the object
+	*/
+	inline String::~String()
 	{
-		string.m_sharedString = GetEmptyString();
+		if (m_buffer != m_localBuffer && m_sharedString->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			FreeSharedString(m_sharedString);
 	}
 
-	inline String::String(std::shared_ptr<SharedString>&& sharedString) :
-	m_sharedString(std::move(sharedString))
+	/*!
+	* \brief Gets a view of the content of the string
+	* \return View referencing the characters of this string, valid until it is modified or destroyed
+	*/
+	inline String::operator StringView() const
 	{
+		return StringView(m_buffer, m_size);
 	}
 
 	/*!
@@ -41,46 +97,16 @@ namespace Nz
 
 	inline void String::ReleaseString()
 	{
-		m_sharedString = GetEmptyString();
-	}
-
-	/*!
-	* \brief Constructs a SharedString object by default
-	*/
-
-	inline String::SharedString::SharedString() : // Special case: empty string
-	capacity(0),
-	size(0)
-	{
-	}
-
-	/*!
-	* \brief Constructs a SharedString object with a size
-	*
-	* \param strSize Number of characters in the string
-	*/
-
-	inline String::SharedString::SharedString(std::size_t strSize) :
-	capacity(strSize),
-	size(strSize),
-	string(new char[strSize + 1])
-	{
-		string[strSize] = '\0';
-	}
+		if (m_buffer != m_localBuffer)
+		{
+			if (m_sharedString->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				FreeSharedString(m_sharedString);
 
-	/*!
-	* \brief Constructs a SharedString object with a size and a capacity
-	*
-	* \param strSize Number of characters in the string
-	* \param strCapacity Capacity in characters in the string
-	*/
+			m_buffer = m_localBuffer;
+		}
 
-	inline String::SharedString::SharedString(std::size_t strSize, std::size_t strCapacity) :
-	capacity(strCapacity),
-	size(strSize),
-	string(new char[strCapacity + 1])
-	{
-		string[strSize] = '\0';
+		m_size = 0;
+		m_localBuffer[0] = '\0';
 	}
 
 	/*!
@@ -111,20 +137,8 @@ namespace std
 		*/
 		size_t operator()(const Nz::String& str) const
 		{
-			// Algorithme DJB2
-			// http://www.cse.yorku.ca/~oz/hash.html
-
-			size_t h = 5381;
-			if (!str.IsEmpty())
-			{
-				const char* ptr = str.GetConstBuffer();
-
-				do
-					h = ((h << 5) + h) + static_cast<size_t>(*ptr);
-				while (*++ptr);
-			}
-
-			return h;
+			// Same hash as the view of the string, allowing lookups with either of them
+			return hash<Nz::StringView>()(str);
 		}
 	};
 }
@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_STRINGVIEW_HPP
+#define NAZARA_STRINGVIEW_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+namespace Nz
+{
+	class NAZARA_CORE_API StringView
+	{
+		public:
+			constexpr StringView();
+			inline StringView(const char* string);
+			constexpr StringView(const char* string, std::size_t size);
+			inline StringView(const std::string& string);
+			StringView(const StringView&) = default;
+			~StringView() = default;
+
+			inline int Compare(StringView view) const;
+
+			inline bool EndsWith(StringView view) const;
+
+			inline std::size_t Find(char character, std::size_t start = 0) const;
+			inline std::size_t FindLast(char character) const;
+
+			constexpr const char* GetConstBuffer() const;
+			constexpr std::size_t GetSize() const;
+
+			constexpr bool IsEmpty() const;
+
+			inline bool StartsWith(StringView view) const;
+
+			inline StringView SubView(std::size_t start, std::size_t size = npos) const;
+
+			inline std::string ToStdString() const;
+
+			// Méthodes STD
+			constexpr const char* begin() const;
+			constexpr const char* end() const;
+
+			using const_reference = const char&;
+			using iterator = const char*;
+			using value_type = char;
+			// Méthodes STD
+
+			constexpr char operator[](std::size_t pos) const;
+
+			StringView& operator=(const StringView&) = default;
+
+			static const std::size_t npos;
+
+		private:
+			const char* m_string;
+			std::size_t m_size;
+	};
+
+	inline bool operator==(StringView lhs, StringView rhs);
+	inline bool operator!=(StringView lhs, StringView rhs);
+	inline bool operator<(StringView lhs, StringView rhs);
+
+	inline std::ostream& operator<<(std::ostream& out, StringView view);
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::StringView>;
+}
+
+#include <Nazara/Core/StringView.inl>
+
+#endif // NAZARA_STRINGVIEW_HPP
@@ -0,0 +1,320 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs an empty StringView object
+	*/
+	constexpr StringView::StringView() :
+	m_string(""),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referencing a "C string"
+	*
+	* \param string Null-terminated string to reference (can be nullptr)
+	*/
+	inline StringView::StringView(const char* string) :
+	m_string((string) ? string : ""),
+	m_size((string) ? std::strlen(string) : 0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referencing a sequence of characters
+	*
+	* \param string Pointer to the first character
+	* \param size Number of characters
+	*/
+	constexpr StringView::StringView(const char* string, std::size_t size) :
+	m_string(string),
+	m_size(size)
+	{
+	}
+
+	/*!
+	* \brief Constructs a StringView object referencing the content of a std::string
+	*
+	* \param string String to reference
+	*/
+	inline StringView::StringView(const std::string& string) :
+	m_string(string.data()),
+	m_size(string.size())
+	{
+	}
+
+	/*!
+	* \brief Compares the view to another one, the same way std::strcmp does
+	* \return A negative value if this view is before, zero if both are equal or a positive value if this view is after
+	*
+	* \param view View to compare with
+	*/
+	inline int StringView::Compare(StringView view) const
+	{
+		std::size_t size = std::min(m_size, view.m_size);
+		if (size > 0)
+		{
+			int result = std::memcmp(m_string, view.m_string, size);
+			if (result != 0)
+				return result;
+		}
+
+		if (m_size == view.m_size)
+			return 0;
+
+		return (m_size < view.m_size) ? -1 : 1;
+	}
+
+	/*!
+	* \brief Checks whether the view ends with another one
+	* \return true if it is the case
+	*
+	* \param view Suffix to check
+	*/
+	inline bool StringView::EndsWith(StringView view) const
+	{
+		return view.m_size <= m_size && std::memcmp(m_string + m_size - view.m_size, view.m_string, view.m_size) == 0;
+	}
+
+	/*!
+	* \brief Finds the first occurrence of a character
+	* \return Position of the character, or npos if not found
+	*
+	* \param character Character to look for
+	* \param start Position to start the search from
+	*/
+	inline std::size_t StringView::Find(char character, std::size_t start) const
+	{
+		if (start >= m_size)
+			return npos;
+
+		const void* ptr = std::memchr(m_string + start, character, m_size - start);
+		return (ptr) ? static_cast<const char*>(ptr) - m_string : npos;
+	}
+
+	/*!
+	* \brief Finds the last occurrence of a character
+	* \return Position of the character, or npos if not found
+	*
+	* \param character Character to look for
+	*/
+	inline std::size_t StringView::FindLast(char character) const
+	{
+		for (std::size_t i = m_size; i > 0; --i)
+		{
+			if (m_string[i - 1] == character)
+				return i - 1;
+		}
+
+		return npos;
+	}
+
+	/*!
+	* \brief Gets the referenced characters
+	* \return Pointer to the first character, the sequence is not necessarily null-terminated
+	*/
+	constexpr const char* StringView::GetConstBuffer() const
+	{
+		return m_string;
+	}
+
+	/*!
+	* \brief Gets the number of referenced characters
+	* \return Size of the view
+	*/
+	constexpr std::size_t StringView::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Checks whether the view is empty
+	* \return true if it is the case
+	*/
+	constexpr bool StringView::IsEmpty() const
+	{
+		return m_size == 0;
+	}
+
+	/*!
+	* \brief Checks whether the view starts with another one
+	* \return true if it is the case
+	*
+	* \param view Prefix to check
+	*/
+	inline bool StringView::StartsWith(StringView view) const
+	{
+		return view.m_size <= m_size && std::memcmp(m_string, view.m_string, view.m_size) == 0;
+	}
+
+	/*!
+	* \brief Gets a view of a part of this view
+	* \return View of the characters in [start, start + size[, clamped to this view
+	*
+	* \param start Position of the first character
+	* \param size Number of characters, npos meaning until the end
+	*/
+	inline StringView StringView::SubView(std::size_t start, std::size_t size) const
+	{
+		start = std::min(start, m_size);
+		size = std::min(size, m_size - start);
+
+		return StringView(m_string + start, size);
+	}
+
+	/*!
+	* \brief Copies the referenced characters into a std::string
+	* \return Copy of the characters
+	*/
+	inline std::string StringView::ToStdString() const
+	{
+		return std::string(m_string, m_size);
+	}
+
+	/*!
+	* \brief Returns an iterator pointing to the beginning of the view
+	* \return Beginning of the view
+	*/
+	constexpr const char* StringView::begin() const
+	{
+		return m_string;
+	}
+
+	/*!
+	* \brief Returns an iterator pointing to the end of the view
+	* \return End of the view
+	*/
+	constexpr const char* StringView::end() const
+	{
+		return m_string + m_size;
+	}
+
+	/*!
+	* \brief Gets the ith character of the view
+	* \return The character
+	*
+	* \param pos Index of the character, must be lower than the size
+	*/
+	constexpr char StringView::operator[](std::size_t pos) const
+	{
+		return m_string[pos];
+	}
+
+	/*!
+	* \brief Checks whether two views reference equal sequences of characters
+	* \return true if it is the case
+	*
+	* \param lhs First view
+	* \param rhs Second view
+	*/
+	inline bool operator==(StringView lhs, StringView rhs)
+	{
+		return lhs.GetSize() == rhs.GetSize() && std::memcmp(lhs.GetConstBuffer(), rhs.GetConstBuffer(), lhs.GetSize()) == 0;
+	}
+
+	/*!
+	* \brief Checks whether two views reference different sequences of characters
+	* \return true if it is the case
+	*
+	* \param lhs First view
+	* \param rhs Second view
+	*/
+	inline bool operator!=(StringView lhs, StringView rhs)
+	{
+		return !operator==(lhs, rhs);
+	}
+
+	/*!
+	* \brief Checks whether the first view is lexicographically before the second one
+	* \return true if it is the case
+	*
+	* \param lhs First view
+	* \param rhs Second view
+	*/
+	inline bool operator<(StringView lhs, StringView rhs)
+	{
+		return lhs.Compare(rhs) < 0;
+	}
+
+	/*!
+	* \brief Outputs the view into the stream
+	* \return A reference to the stream
+	*
+	* \param out Stream to output to
+	* \param view View to output
+	*/
+	inline std::ostream& operator<<(std::ostream& out, StringView view)
+	{
+		return out.write(view.GetConstBuffer(), view.GetSize());
+	}
+}
+
+namespace std
+{
+	template<>
+	struct hash<Nz::StringView>
+	{
+		/*!
+		* \brief Specialisation of std to hash
+		* \return Result of the hash
+		*
+		* \param view View to hash
+		*
+		* \remark Nz::String hashes to the same value as a view of its content
+		*/
+		size_t operator()(Nz::StringView view) const
+		{
+			// MurmurHash64A by Austin Appleby (public domain), reads eight characters at once
+			const Nz::UInt64 m = 0xc6a4a7935bd1e995ULL;
+			const int r = 47;
+
+			const char* data = view.GetConstBuffer();
+			std::size_t size = view.GetSize();
+
+			Nz::UInt64 h = 0x8445d61a4e774912ULL ^ (size * m);
+
+			const char* end = data + (size & ~std::size_t(7));
+			for (; data != end; data += 8)
+			{
+				Nz::UInt64 k;
+				std::memcpy(&k, data, sizeof(k));
+
+				k *= m;
+				k ^= k >> r;
+				k *= m;
+
+				h ^= k;
+				h *= m;
+			}
+
+			switch (size & 7)
+			{
+				case 7: h ^= Nz::UInt64(static_cast<unsigned char>(data[6])) << 48;
+				case 6: h ^= Nz::UInt64(static_cast<unsigned char>(data[5])) << 40;
+				case 5: h ^= Nz::UInt64(static_cast<unsigned char>(data[4])) << 32;
+				case 4: h ^= Nz::UInt64(static_cast<unsigned char>(data[3])) << 24;
+				case 3: h ^= Nz::UInt64(static_cast<unsigned char>(data[2])) << 16;
+				case 2: h ^= Nz::UInt64(static_cast<unsigned char>(data[1])) << 8;
+				case 1: h ^= Nz::UInt64(static_cast<unsigned char>(data[0]));
+					h *= m;
+			}
+
+			h ^= h >> r;
+			h *= m;
+			h ^= h >> r;
+
+			return static_cast<size_t>(h);
+		}
+	};
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,68 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TASKGROUP_HPP
+#define NAZARA_TASKGROUP_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
+#include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class TaskSchedulerImpl;
+
+	class NAZARA_CORE_API TaskGroup
+	{
+		friend TaskScheduler;
+		friend TaskSchedulerImpl;
+
+		public:
+			struct Task;
+			using TaskId = Task*;
+
+			TaskGroup();
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup(TaskGroup&&) = delete;
+			~TaskGroup();
+
+			template<typename F> TaskId AddTask(F function);
+			template<typename F> TaskId AddTask(std::initializer_list<TaskId> dependencies, F function);
+
+			void Clear();
+
+			inline unsigned int GetPendingTaskCount() const;
+
+			inline bool IsDone() const;
+
+			void Wait();
+
+			TaskGroup& operator=(const TaskGroup&) = delete;
+			TaskGroup& operator=(TaskGroup&&) = delete;
+
+		private:
+			TaskId AddTaskSlot(TaskScheduler::TaskSlot* taskSlot, const TaskId* dependencies, std::size_t dependencyCount);
+			bool WaitForCompletion(UInt32 timeout);
+
+			static void OnTaskCompleted(Task* task);
+
+			std::atomic_uint m_pendingTaskCount;
+			std::size_t m_taskCount; //< Tasks of m_tasks in use, the others are kept for reuse
+			std::vector<std::unique_ptr<Task>> m_tasks;
+			ConditionVariable m_doneCondition;
+			Mutex m_mutex;
+	};
+}
+
+#include <Nazara/Core/TaskGroup.inl>
+
+#endif // NAZARA_TASKGROUP_HPP
@@ -0,0 +1,55 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Adds a task to the group and submits it to the task scheduler
+	* \return Identifier of the task, which can be used as a dependency of other tasks of this group
+	*
+	* \param function Task that the pool will execute
+	*
+	* \remark Unlike TaskScheduler::AddTask, the task does not wait for TaskScheduler::Run to be executed
+	*/
+	template<typename F>
+	TaskGroup::TaskId TaskGroup::AddTask(F function)
+	{
+		return AddTaskSlot(TaskScheduler::CreateTask<FunctorWithoutArgs<F>>(function), nullptr, 0);
+	}
+
+	/*!
+	* \brief Adds a task to the group which will only be submitted to the task scheduler once all its dependencies are completed
+	* \return Identifier of the task, which can be used as a dependency of other tasks of this group
+	*
+	* \param dependencies Tasks of this group which have to be completed before this one starts
+	* \param function Task that the pool will execute
+	*/
+	template<typename F>
+	TaskGroup::TaskId TaskGroup::AddTask(std::initializer_list<TaskId> dependencies, F function)
+	{
+		return AddTaskSlot(TaskScheduler::CreateTask<FunctorWithoutArgs<F>>(function), dependencies.begin(), dependencies.size());
+	}
+
+	/*!
+	* \brief Gets the number of tasks of this group which are not completed yet
+	* \return Number of pending tasks (including tasks waiting on their dependencies)
+	*/
+	inline unsigned int TaskGroup::GetPendingTaskCount() const
+	{
+		return m_pendingTaskCount.load();
+	}
+
+	/*!
+	* \brief Checks whether every task of this group is completed
+	* \return true if no task of the group is pending
+	*/
+	inline bool TaskGroup::IsDone() const
+	{
+		return m_pendingTaskCount.load() == 0;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -9,11 +9,18 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <cstddef>
 
 namespace Nz
 {
+	class TaskGroup;
+	class TaskSchedulerImpl;
+
 	class NAZARA_CORE_API TaskScheduler
 	{
+		friend TaskGroup;
+		friend TaskSchedulerImpl;
+
 		public:
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
@@ -25,11 +32,27 @@ namespace Nz
 			static bool Initialize();
 			static void Run();
 			static void SetWorkerCount(unsigned int workerCount);
+			template<typename F> static void SubmitTask(F function);
 			static void Uninitialize();
+			static void Wait(TaskGroup& group);
 			static void WaitForTasks();
 
+			static constexpr std::size_t MaxInlineCaptureSize = 64;
+
 		private:
-			static void AddTaskFunctor(Functor* taskFunctor);
+			struct TaskSlot
+			{
+				alignas(std::max_align_t) UInt8 storage[MaxInlineCaptureSize + sizeof(Functor)]; //< Functor is constructed here if it fits
+				Functor* functor;
+				TaskSlot* next; //< Used by free lists
+				void* groupTask; //< TaskGroup::Task this task belongs to, if any
+			};
+
+			static void AddTaskSlot(TaskSlot* task);
+			static TaskSlot* AllocateTaskSlot();
+			template<typename T, typename... Args> static TaskSlot* CreateTask(Args&&... args);
+			static void ReleaseTaskSlot(TaskSlot* task);
+			static void SubmitTask(TaskSlot* task);
 	};
 }
 
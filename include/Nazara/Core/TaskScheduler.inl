@@ -2,6 +2,8 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -21,7 +23,7 @@ namespace Nz
 	template<typename F>
 	void TaskScheduler::AddTask(F function)
 	{
-		AddTaskFunctor(new FunctorWithoutArgs<F>(function));
+		AddTaskSlot(CreateTask<FunctorWithoutArgs<F>>(function));
 	}
 
 	/*!
@@ -34,7 +36,7 @@ namespace Nz
 	template<typename F, typename... Args>
 	void TaskScheduler::AddTask(F function, Args&&... args)
 	{
-		AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
+		AddTaskSlot(CreateTask<FunctorWithArgs<F, Args...>>(function, std::forward<Args>(args)...));
 	}
 
 	/*!
@@ -47,7 +49,47 @@ namespace Nz
 	template<typename C>
 	void TaskScheduler::AddTask(void (C::*function)(), C* object)
 	{
-		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+		AddTaskSlot(CreateTask<MemberWithoutArgs<C>>(function, object));
+	}
+
+	/*!
+	* \brief Submits a task to the workers without waiting for Run
+	*
+	* \param function Task that the pool will execute
+	*
+	* \remark Unlike AddTask, this can be called from any thread at any time
+	*/
+
+	template<typename F>
+	void TaskScheduler::SubmitTask(F function)
+	{
+		SubmitTask(CreateTask<FunctorWithoutArgs<F>>(function));
+	}
+
+	/*!
+	* \brief Constructs a task functor in a pooled task slot
+	* \return Task slot holding the functor
+	*
+	* \param args Arguments used to construct the functor
+	*
+	* The functor is constructed inside the slot if it fits, which is the case when captured data does not exceed MaxInlineCaptureSize bytes,
+	* in which case submitting a task does not require any memory allocation.
+	*/
+
+	template<typename T, typename... Args>
+	TaskScheduler::TaskSlot* TaskScheduler::CreateTask(Args&&... args)
+	{
+		static_assert(std::is_base_of<Functor, T>::value, "T must inherit from Functor");
+
+		TaskSlot* task = AllocateTaskSlot();
+		if (sizeof(T) <= sizeof(task->storage) && alignof(T) <= alignof(std::max_align_t))
+			task->functor = PlacementNew(reinterpret_cast<T*>(task->storage), std::forward<Args>(args)...);
+		else
+			task->functor = new T(std::forward<Args>(args)...);
+
+		task->groupTask = nullptr;
+
+		return task;
 	}
 }
 
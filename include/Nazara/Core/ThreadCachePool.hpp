@@ -0,0 +1,78 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_THREADCACHEPOOL_HPP
+#define NAZARA_THREADCACHEPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Nz
+{
+	template<typename Traits>
+	class ThreadCachePool
+	{
+		public:
+			using Batch = typename Traits::Batch;
+			using Counters = typename Traits::Counters;
+			using ThreadCache = typename Traits::ThreadCache;
+
+			static constexpr std::size_t ClassCount = Traits::ClassCount;
+
+			struct ThreadData
+			{
+				ThreadCache cache;
+				Counters counters;
+				Batch* reservedBatches[ClassCount]; //< Batches taken from the shared stacks, not used yet
+			};
+
+			ThreadCachePool() = delete;
+			~ThreadCachePool() = delete;
+
+			static void AccumulateCounters(Counters& counters);
+
+			static ThreadData* GetThreadData();
+
+			static inline void IncreaseCounter(std::atomic<UInt64>& counter, UInt64 value = 1);
+
+			static Batch* PopBatch(std::size_t classIndex, ThreadData* threadData);
+			static void PushBatch(std::size_t classIndex, Batch* batch);
+			static void PushBatch(std::atomic<Batch*>& stack, Batch* batch);
+
+			static Batch* TakeBatches(std::size_t classIndex);
+
+			template<typename F> static void UpdateRetiredCounters(F&& update);
+
+		private:
+			struct SharedData
+			{
+				std::atomic<Batch*> batches[ClassCount]; //< Lock-free stacks of batches
+				Mutex mutex;                              //< Protects the fields below
+				std::vector<ThreadData*> threads;
+				Counters retiredCounters;                 //< Counters of exited threads (and of operations made while a thread exits)
+			};
+
+			struct ThreadDataOwner
+			{
+				ThreadDataOwner();
+				~ThreadDataOwner();
+
+				ThreadData data = {};
+			};
+
+			static SharedData& GetSharedData();
+
+			static thread_local ThreadData* s_threadData;
+			static thread_local bool s_threadDataDestroyed;
+	};
+}
+
+#include <Nazara/Core/ThreadCachePool.inl>
+
+#endif // NAZARA_THREADCACHEPOOL_HPP
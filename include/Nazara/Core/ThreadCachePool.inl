@@ -0,0 +1,234 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ThreadCachePool
+	* \brief Core class that shares pooled items between per-thread caches, by batches
+	*
+	* Each thread owns a cache (and counters) it accesses without any lock or atomic read-modify-write operation,
+	* and gives its surplus to the other threads by batches, through a lock-free stack per class (size class, capacity class, ...).
+	* A thread running out of items takes a whole stack and keeps the batches it doesn't need yet reserved for itself.
+	*
+	* Traits has to provide:
+	* - Batch, the batch type, and a static `Batch*& NextBatch(Batch* batch)` function giving access to its link
+	* - ThreadCache, the per-thread cache type, and a static `void FlushThreadCache(ThreadCache& cache)` function giving its items back when its thread exits
+	* - Counters, the per-thread counters type, and a static `void MergeCounters(Counters& target, const Counters& source)` function
+	* - ClassCount, the number of classes
+	*
+	* \remark Batches are never freed by the pool, items are expected to be reused rather than given back to the system
+	*/
+
+	/*!
+	* \brief Adds the counters of every thread (including the exited ones) to counters
+	*
+	* \param counters Counters to accumulate into
+	*
+	* \remark Counters of other threads are read without stopping them, values are only consistent if no other thread is using the pool
+	*/
+	template<typename Traits>
+	void ThreadCachePool<Traits>::AccumulateCounters(Counters& counters)
+	{
+		SharedData& sharedData = GetSharedData();
+
+		LockGuard lock(sharedData.mutex);
+
+		Traits::MergeCounters(counters, sharedData.retiredCounters);
+		for (ThreadData* threadData : sharedData.threads)
+			Traits::MergeCounters(counters, threadData->counters);
+	}
+
+	/*!
+	* \brief Gets the data owned by the calling thread, creating it if required
+	* \return Thread data, or nullptr if the calling thread is exiting (and has already released its data)
+	*/
+	template<typename Traits>
+	auto ThreadCachePool<Traits>::GetThreadData() -> ThreadData*
+	{
+		if (s_threadData)
+			return s_threadData;
+
+		if (s_threadDataDestroyed)
+			return nullptr;
+
+		thread_local ThreadDataOwner owner;
+		return s_threadData;
+	}
+
+	/*!
+	* \brief Increases a counter owned by the calling thread
+	*
+	* \param counter Counter to increase
+	* \param value Value to add
+	*/
+	template<typename Traits>
+	inline void ThreadCachePool<Traits>::IncreaseCounter(std::atomic<UInt64>& counter, UInt64 value)
+	{
+		// Cheaper than an atomic increment, which is not required as only the owner thread writes to it
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Takes a batch given by a thread
+	* \return Batch, or nullptr if none is available
+	*
+	* \param classIndex Class of the batch
+	* \param threadData Data of the calling thread (as returned by GetThreadData), batches it reserved are used first
+	*/
+	template<typename Traits>
+	auto ThreadCachePool<Traits>::PopBatch(std::size_t classIndex, ThreadData* threadData) -> Batch*
+	{
+		Batch* batch;
+		if (threadData)
+		{
+			Batch*& reservedBatches = threadData->reservedBatches[classIndex];
+			if (!reservedBatches)
+				reservedBatches = TakeBatches(classIndex);
+
+			batch = reservedBatches;
+			if (batch)
+				reservedBatches = Traits::NextBatch(batch);
+		}
+		else
+		{
+			// Exiting thread, it can't keep anything for itself
+			batch = TakeBatches(classIndex);
+			if (batch)
+			{
+				Batch* otherBatch = Traits::NextBatch(batch);
+				while (otherBatch)
+				{
+					Batch* nextBatch = Traits::NextBatch(otherBatch);
+					PushBatch(classIndex, otherBatch);
+					otherBatch = nextBatch;
+				}
+			}
+		}
+
+		if (batch)
+			Traits::NextBatch(batch) = nullptr;
+
+		return batch;
+	}
+
+	/*!
+	* \brief Gives a batch to the other threads
+	*
+	* \param classIndex Class of the batch
+	* \param batch Batch to give
+	*/
+	template<typename Traits>
+	void ThreadCachePool<Traits>::PushBatch(std::size_t classIndex, Batch* batch)
+	{
+		PushBatch(GetSharedData().batches[classIndex], batch);
+	}
+
+	/*!
+	* \brief Pushes a batch on a lock-free stack
+	*
+	* \param stack Stack to push the batch on, which must only be emptied as a whole
+	* \param batch Batch to push
+	*/
+	template<typename Traits>
+	void ThreadCachePool<Traits>::PushBatch(std::atomic<Batch*>& stack, Batch* batch)
+	{
+		Batch*& next = Traits::NextBatch(batch);
+
+		next = stack.load(std::memory_order_relaxed);
+		while (!stack.compare_exchange_weak(next, batch, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	/*!
+	* \brief Takes every batch of a class given by the threads
+	* \return Batches linked together, or nullptr if there is none
+	*
+	* \param classIndex Class of the batches
+	*/
+	template<typename Traits>
+	auto ThreadCachePool<Traits>::TakeBatches(std::size_t classIndex) -> Batch*
+	{
+		// Taking the whole stack is immune to the ABA problem, unlike popping a single batch
+		return GetSharedData().batches[classIndex].exchange(nullptr, std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Updates the counters of exited threads, for operations made by a thread without data
+	*
+	* \param update Function called with the counters, while they are locked
+	*/
+	template<typename Traits>
+	template<typename F>
+	void ThreadCachePool<Traits>::UpdateRetiredCounters(F&& update)
+	{
+		SharedData& sharedData = GetSharedData();
+
+		LockGuard lock(sharedData.mutex);
+		update(sharedData.retiredCounters);
+	}
+
+	template<typename Traits>
+	auto ThreadCachePool<Traits>::GetSharedData() -> SharedData&
+	{
+		// Never destroyed, as items may be given back by static destructors or by threads outliving the main function
+		static std::aligned_storage_t<sizeof(SharedData), alignof(SharedData)> storage;
+		static SharedData* sharedData = PlacementNew(reinterpret_cast<SharedData*>(&storage));
+
+		return *sharedData;
+	}
+
+	template<typename Traits>
+	ThreadCachePool<Traits>::ThreadDataOwner::ThreadDataOwner()
+	{
+		SharedData& sharedData = GetSharedData();
+
+		LockGuard lock(sharedData.mutex);
+		sharedData.threads.push_back(&data);
+
+		s_threadData = &data;
+	}
+
+	template<typename Traits>
+	ThreadCachePool<Traits>::ThreadDataOwner::~ThreadDataOwner()
+	{
+		s_threadData = nullptr;
+		s_threadDataDestroyed = true;
+
+		// Give our items to the other threads
+		Traits::FlushThreadCache(data.cache);
+
+		for (std::size_t i = 0; i < ClassCount; ++i)
+		{
+			Batch* batch = data.reservedBatches[i];
+			while (batch)
+			{
+				Batch* nextBatch = Traits::NextBatch(batch);
+				PushBatch(i, batch);
+				batch = nextBatch;
+			}
+		}
+
+		SharedData& sharedData = GetSharedData();
+
+		LockGuard lock(sharedData.mutex);
+		Traits::MergeCounters(sharedData.retiredCounters, data.counters);
+		sharedData.threads.erase(std::find(sharedData.threads.begin(), sharedData.threads.end(), &data));
+	}
+
+	// Trivially destructible, so that they stay usable while thread_local objects get destroyed
+	template<typename Traits>
+	thread_local typename ThreadCachePool<Traits>::ThreadData* ThreadCachePool<Traits>::s_threadData = nullptr;
+
+	template<typename Traits>
+	thread_local bool ThreadCachePool<Traits>::s_threadDataDestroyed = false;
+}
+
+#include <Nazara/Core/DebugOff.hpp>
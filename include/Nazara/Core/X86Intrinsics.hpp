@@ -0,0 +1,36 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_X86INTRINSICS_HPP
+#define NAZARA_X86INTRINSICS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+
+// Hardware accelerated paths are compiled for every x86 build and selected at runtime (see HasProcessorCapabilities)
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define NAZARA_X86_INTRINSICS
+
+	#if defined(NAZARA_COMPILER_MSVC)
+		#include <intrin.h>
+
+		#define NAZARA_X86_TARGET(features)
+	#else
+		#include <immintrin.h>
+
+		// Allows the use of instruction sets not enabled for the whole module
+		#define NAZARA_X86_TARGET(features) __attribute__((target(features)))
+	#endif
+#endif
+
+namespace Nz
+{
+	template<ProcessorCap... Capabilities> bool HasProcessorCapabilities();
+}
+
+#include <Nazara/Core/X86Intrinsics.inl>
+
+#endif // NAZARA_X86INTRINSICS_HPP
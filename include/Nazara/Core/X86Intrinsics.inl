@@ -0,0 +1,39 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \brief Checks whether the processor supports every capability, to select a hardware accelerated path
+	* \return true If all the capabilities are supported
+	*
+	* \remark The result is computed once, making this function cheap enough to be called before each accelerated operation
+	*/
+	template<ProcessorCap... Capabilities>
+	bool HasProcessorCapabilities()
+	{
+		static bool supported = [] ()
+		{
+			if (!HardwareInfo::Initialize())
+				return false;
+
+			bool capabilities[] = { HardwareInfo::HasCapability(Capabilities)... };
+			for (bool capability : capabilities)
+			{
+				if (!capability)
+					return false;
+			}
+
+			return true;
+		}();
+
+		return supported;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
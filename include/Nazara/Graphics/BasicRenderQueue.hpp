@@ -8,6 +8,7 @@
 #define NAZARA_BASICRENDERQUEUE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ArenaAllocator.hpp>
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
@@ -16,11 +17,11 @@
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Plane.hpp>
+#include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Utility/IndexBuffer.hpp>
 #include <Nazara/Utility/MeshData.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
 #include <map>
-#include <unordered_map>
 #include <vector>
 
 namespace Nz
@@ -34,7 +35,9 @@ namespace Nz
 		public:
 			struct BillboardData;
 
-			BasicRenderQueue() = default;
+			inline BasicRenderQueue();
+			BasicRenderQueue(const BasicRenderQueue&) = delete;
+			BasicRenderQueue(BasicRenderQueue&&) noexcept = default;
 			~BasicRenderQueue() = default;
 
 			void AddBillboards(int renderOrder, const Material* material, std::size_t billboardCount, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
@@ -49,12 +52,18 @@ namespace Nz
 			void AddMesh(int renderOrder, const Material* material, const MeshData& meshData, const Boxf& meshAABB, const Matrix4f& transformMatrix, const Recti& scissorRect) override;
 			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
 
+			void Append(const BasicRenderQueue& queue);
+
 			void Clear(bool fully = false) override;
 
 			inline const BillboardData* GetBillboardData(std::size_t billboardIndex) const;
+			inline const ArenaAllocator& GetTransientAllocator() const;
 
 			void Sort(const AbstractViewer* viewer);
 
+			BasicRenderQueue& operator=(const BasicRenderQueue&) = delete;
+			BasicRenderQueue& operator=(BasicRenderQueue&&) noexcept = default;
+
 			struct BillboardData
 			{
 				Color color;
@@ -124,16 +133,16 @@ namespace Nz
 
 			inline void RegisterLayer(int layerIndex);
 
-			std::unordered_map<const MaterialPipeline*, std::size_t> m_pipelineCache;
-			std::unordered_map<const Material*, std::size_t> m_materialCache;
-			std::unordered_map<const Texture*, std::size_t> m_overlayCache;
-			std::unordered_map<const UberShader*, std::size_t> m_shaderCache;
-			std::unordered_map<const Texture*, std::size_t> m_textureCache;
-			std::unordered_map<const VertexBuffer*, std::size_t> m_vertexBufferCache;
-			std::unordered_map<int, std::size_t> m_layerCache;
+			static inline UInt64 ComputeDepthSortKey(std::size_t layer, float depth);
+			static inline UInt64 ComputeSortKey(std::size_t layer, std::size_t pipeline, std::size_t material, std::size_t shader, std::size_t texture, std::size_t buffer, std::size_t scissor);
 
+			ArenaAllocator m_transientAllocator; //< Reset every sort
 			std::vector<BillboardData> m_billboards;
 			std::vector<int> m_renderLayers;
+			Planef m_sortNearPlane;
+			ProjectionType m_sortProjectionType;
+			Vector3f m_sortEyePosition;
+			bool m_sortInvalidated; //< Content changed since the last sort
 	};
 }
 
@@ -4,15 +4,34 @@
 
 #include <Nazara/Graphics/BasicRenderQueue.hpp>
 #include <cassert>
+#include <cstring>
+#include <limits>
 
 namespace Nz
 {
+	/*!
+	* \brief Constructs a BasicRenderQueue object
+	*/
+	inline BasicRenderQueue::BasicRenderQueue() :
+	m_sortInvalidated(true)
+	{
+	}
+
 	inline const BasicRenderQueue::BillboardData* BasicRenderQueue::GetBillboardData(std::size_t billboardIndex) const
 	{
 		assert(billboardIndex < m_billboards.size());
 		return &m_billboards[billboardIndex];
 	}
 
+	/*!
+	* \brief Gets the allocator used for the temporary data of the last sort
+	* \return Arena allocator, whose heap allocation count should be zero when the scene does not change much
+	*/
+	inline const ArenaAllocator& BasicRenderQueue::GetTransientAllocator() const
+	{
+		return m_transientAllocator;
+	}
+
 	inline Color BasicRenderQueue::ComputeColor(float alpha)
 	{
 		return Color(255, 255, 255, static_cast<UInt8>(255.f * alpha));
@@ -29,8 +48,62 @@ namespace Nz
 		return Vector2f(size, size);
 	}
 
+	/*!
+	* \brief Computes the key of an object in a depth-sorted queue, sorting it by layer then from the furthest to the nearest
+	* \return Layer index in the upper 16 bits followed by the inverted bits of the depth on 32 bits, lower 16 bits are unused
+	*
+	* \param layer Index of the layer in the sorted layer list
+	* \param depth Positive distance of the object to the viewer
+	*/
+	inline UInt64 BasicRenderQueue::ComputeDepthSortKey(std::size_t layer, float depth)
+	{
+		static_assert(std::numeric_limits<float>::is_iec559, "The following sorting functions relies on IEEE 754 floatings-points");
+
+#if defined(arm) && \
+    ((defined(__MAVERICK__) && defined(NAZARA_BIG_ENDIAN)) || \
+    (!defined(__SOFTFP__) && !defined(__VFP_FP__) && !defined(__MAVERICK__)))
+	#error The following code relies on native-endian IEEE-754 representation, which your platform does not guarantee
+#endif
+
+		// Reinterpret depth as UInt32 (this will work as long as they're all either positive or negative,
+		// a negative distance may happen with objects behind the camera which we don't care about since they'll not be rendered)
+		UInt32 depthBits;
+		std::memcpy(&depthBits, &depth, sizeof(float));
+
+		return (UInt64(layer & 0xFFFF) << 48) |
+		       (UInt64(~depthBits)     << 16);
+	}
+
+	/*!
+	* \brief Computes the key of an object in a queue sorted by render states, grouping objects sharing the same states
+	* \return Key made of the layer (16 bits), pipeline (8 bits), material (8 bits), shader (8 bits), texture (8 bits), buffer (8 bits) and scissor (4 bits) indices, lower 4 bits are unused
+	*
+	* \param layer Index of the layer in the sorted layer list
+	* \param pipeline Index of the material pipeline
+	* \param material Index of the material
+	* \param shader Index of the shader
+	* \param texture Index of the diffuse texture
+	* \param buffer Index of the vertex buffer, or of the overlay texture for sprites
+	* \param scissor Index of the scissor rectangle
+	*
+	* \remark Indices overflowing their bits only weaken the grouping, the layer order is always respected
+	*/
+	inline UInt64 BasicRenderQueue::ComputeSortKey(std::size_t layer, std::size_t pipeline, std::size_t material, std::size_t shader, std::size_t texture, std::size_t buffer, std::size_t scissor)
+	{
+		return (UInt64(layer    & 0xFFFF) << 48) |
+		       (UInt64(pipeline & 0xFF)   << 40) |
+		       (UInt64(material & 0xFF)   << 32) |
+		       (UInt64(shader   & 0xFF)   << 24) |
+		       (UInt64(texture  & 0xFF)   << 16) |
+		       (UInt64(buffer   & 0xFF)   <<  8) |
+		       (UInt64(scissor  & 0x0F)   <<  4);
+	}
+
 	inline void BasicRenderQueue::RegisterLayer(int layerIndex)
 	{
+		// Every insertion goes through here, which makes it the place to know the queue has to be sorted again
+		m_sortInvalidated = true;
+
 		auto it = std::lower_bound(m_renderLayers.begin(), m_renderLayers.end(), layerIndex);
 		if (it == m_renderLayers.end() || *it != layerIndex)
 			m_renderLayers.insert(it, layerIndex);
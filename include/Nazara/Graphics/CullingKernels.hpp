@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CULLINGKERNELS_HPP
+#define NAZARA_CULLINGKERNELS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Enums.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <vector>
+
+namespace Nz
+{
+	// Boxes stored as structure of arrays, so that culling kernels can load several of them at once
+	struct CullingBoxArray
+	{
+		inline void Add(const Boxf& box);
+		inline void Clear();
+		inline std::size_t GetSize() const;
+		inline void Remove(std::size_t index);
+		inline void Set(std::size_t index, const Boxf& box);
+
+		std::vector<float> minX;
+		std::vector<float> minY;
+		std::vector<float> minZ;
+		std::vector<float> maxX;
+		std::vector<float> maxY;
+		std::vector<float> maxZ;
+	};
+
+	struct CullingSphereArray
+	{
+		inline void Add(const Spheref& sphere);
+		inline void Clear();
+		inline std::size_t GetSize() const;
+		inline void Remove(std::size_t index);
+		inline void Set(std::size_t index, const Spheref& sphere);
+
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+		std::vector<float> radius;
+	};
+
+	class NAZARA_GRAPHICS_API CullingKernels
+	{
+		public:
+			enum Implementation
+			{
+				Implementation_Scalar,
+				Implementation_SSE2, //< Four volumes at once
+				Implementation_AVX,  //< Eight volumes at once
+
+				Implementation_Max = Implementation_AVX
+			};
+
+			CullingKernels() = delete;
+			~CullingKernels() = delete;
+
+			static IntersectionSide CullBox(const Frustumf& frustum, const CullingBoxArray& boxes, std::size_t index);
+			static void CullBoxes(const Frustumf& frustum, const CullingBoxArray& boxes, UInt8* results);
+			static IntersectionSide CullSphere(const Frustumf& frustum, const CullingSphereArray& spheres, std::size_t index);
+			static void CullSpheres(const Frustumf& frustum, const CullingSphereArray& spheres, UInt8* results);
+
+			static Implementation GetImplementation();
+			static bool IsImplementationSupported(Implementation implementation);
+
+			static bool SetImplementation(Implementation implementation);
+	};
+}
+
+#include <Nazara/Graphics/CullingKernels.inl>
+
+#endif // NAZARA_CULLINGKERNELS_HPP
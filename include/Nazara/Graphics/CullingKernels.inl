@@ -0,0 +1,163 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/CullingKernels.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::CullingBoxArray
+	* \brief Graphics structure storing boxes as arrays of their minimal and maximal coordinates
+	*
+	* \see CullingKernels::CullBoxes
+	*/
+
+	/*!
+	* \brief Adds a box at the end of the array
+	*
+	* \param box Box to add
+	*/
+	inline void CullingBoxArray::Add(const Boxf& box)
+	{
+		minX.push_back(box.x);
+		minY.push_back(box.y);
+		minZ.push_back(box.z);
+		maxX.push_back(box.x + box.width);
+		maxY.push_back(box.y + box.height);
+		maxZ.push_back(box.z + box.depth);
+	}
+
+	/*!
+	* \brief Removes every box
+	*/
+	inline void CullingBoxArray::Clear()
+	{
+		minX.clear();
+		minY.clear();
+		minZ.clear();
+		maxX.clear();
+		maxY.clear();
+		maxZ.clear();
+	}
+
+	/*!
+	* \brief Gets the number of boxes
+	* \return Box count
+	*/
+	inline std::size_t CullingBoxArray::GetSize() const
+	{
+		return minX.size();
+	}
+
+	/*!
+	* \brief Removes a box by moving the last box in its place
+	*
+	* \param index Index of the box to remove
+	*/
+	inline void CullingBoxArray::Remove(std::size_t index)
+	{
+		NazaraAssert(index < GetSize(), "Index out of range");
+
+		for (std::vector<float>* component : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ })
+		{
+			(*component)[index] = component->back();
+			component->pop_back();
+		}
+	}
+
+	/*!
+	* \brief Changes a box
+	*
+	* \param index Index of the box
+	* \param box New box
+	*/
+	inline void CullingBoxArray::Set(std::size_t index, const Boxf& box)
+	{
+		NazaraAssert(index < GetSize(), "Index out of range");
+
+		minX[index] = box.x;
+		minY[index] = box.y;
+		minZ[index] = box.z;
+		maxX[index] = box.x + box.width;
+		maxY[index] = box.y + box.height;
+		maxZ[index] = box.z + box.depth;
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::CullingSphereArray
+	* \brief Graphics structure storing spheres as arrays of their components
+	*
+	* \see CullingKernels::CullSpheres
+	*/
+
+	/*!
+	* \brief Adds a sphere at the end of the array
+	*
+	* \param sphere Sphere to add
+	*/
+	inline void CullingSphereArray::Add(const Spheref& sphere)
+	{
+		x.push_back(sphere.x);
+		y.push_back(sphere.y);
+		z.push_back(sphere.z);
+		radius.push_back(sphere.radius);
+	}
+
+	/*!
+	* \brief Removes every sphere
+	*/
+	inline void CullingSphereArray::Clear()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+		radius.clear();
+	}
+
+	/*!
+	* \brief Gets the number of spheres
+	* \return Sphere count
+	*/
+	inline std::size_t CullingSphereArray::GetSize() const
+	{
+		return x.size();
+	}
+
+	/*!
+	* \brief Removes a sphere by moving the last sphere in its place
+	*
+	* \param index Index of the sphere to remove
+	*/
+	inline void CullingSphereArray::Remove(std::size_t index)
+	{
+		NazaraAssert(index < GetSize(), "Index out of range");
+
+		for (std::vector<float>* component : { &x, &y, &z, &radius })
+		{
+			(*component)[index] = component->back();
+			component->pop_back();
+		}
+	}
+
+	/*!
+	* \brief Changes a sphere
+	*
+	* \param index Index of the sphere
+	* \param sphere New sphere
+	*/
+	inline void CullingSphereArray::Set(std::size_t index, const Spheref& sphere)
+	{
+		NazaraAssert(index < GetSize(), "Index out of range");
+
+		x[index] = sphere.x;
+		y[index] = sphere.y;
+		z[index] = sphere.z;
+		radius[index] = sphere.radius;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
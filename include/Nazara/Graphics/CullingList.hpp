@@ -8,8 +8,10 @@
 #define NAZARA_CULLINGLIST_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/DynamicAABBTree.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/CullingKernels.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Frustum.hpp>
@@ -36,7 +38,7 @@ namespace Nz
 
 			using ResultContainer = std::vector<const T*>;
 
-			CullingList() = default;
+			CullingList();
 			CullingList(const CullingList& renderable) = delete;
 			CullingList(CullingList&& renderable) = delete;
 			~CullingList();
@@ -45,6 +47,7 @@ namespace Nz
 
 			std::size_t FillWithAllEntries(bool* forceInvalidation = nullptr);
 
+			inline CullingBackend GetBackend() const;
 			const ResultContainer& GetFullyVisibleResults() const;
 			const ResultContainer& GetPartiallyVisibleResults() const;
 
@@ -53,12 +56,15 @@ namespace Nz
 			SphereEntry RegisterSphereTest(const T* renderable);
 			VolumeEntry RegisterVolumeTest(const T* renderable);
 
+			void SetBackend(CullingBackend backend);
+
 			CullingList& operator=(const CullingList& renderable) = delete;
 			CullingList& operator=(CullingList&& renderable) = delete;
 
 			NazaraSignal(OnCullingListRelease, CullingList* /*cullingList*/);
 
 		private:
+			template<typename VisibilityEntry> void AddResult(VisibilityEntry& entry, UInt8 side, std::size_t& fullyVisibleHash, std::size_t& partiallyVisibleHash, bool& forcedInvalidation);
 			inline void NotifyBoxUpdate(std::size_t index, const Boxf& boundingVolume);
 			inline void NotifyForceInvalidation(CullTest type, std::size_t index);
 			inline void NotifyMovement(CullTest type, std::size_t index, void* oldPtr, void* newPtr);
@@ -66,11 +72,14 @@ namespace Nz
 			inline void NotifySphereUpdate(std::size_t index, const Spheref& sphere);
 			inline void NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume);
 
+			static inline Boxf GetSphereBox(const Spheref& sphere);
+			static inline std::size_t GetTreeKey(CullTest type, std::size_t index);
+
 			struct BoxVisibilityEntry
 			{
-				Boxf box;
 				BoxEntry* entry;
 				const T* renderable;
+				std::size_t proxyId;
 				bool forceInvalidation;
 			};
 
@@ -83,9 +92,9 @@ namespace Nz
 
 			struct SphereVisibilityEntry
 			{
-				Spheref sphere;
 				SphereEntry* entry;
 				const T* renderable;
+				std::size_t proxyId;
 				bool forceInvalidation;
 			};
 
@@ -101,6 +110,12 @@ namespace Nz
 			std::vector<NoTestVisibilityEntry> m_noTestList;
 			std::vector<SphereVisibilityEntry> m_sphereTestList;
 			std::vector<VolumeVisibilityEntry> m_volumeTestList;
+			std::vector<std::size_t> m_treeResults;
+			std::vector<UInt8> m_cullResults;
+			CullingBackend m_backend;
+			CullingBoxArray m_boxes; //< Parallel to m_boxTestList
+			CullingSphereArray m_spheres; //< Parallel to m_sphereTestList
+			DynamicAABBTree m_tree; //< Boxes and spheres, with the dynamic tree backend
 			ResultContainer m_fullyVisibleResults;
 			ResultContainer m_partiallyVisibleResults;
 	};
@@ -3,10 +3,18 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/CullingList.hpp>
+#include <algorithm>
+#include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	template<typename T>
+	CullingList<T>::CullingList() :
+	m_backend(CullingBackend_Linear)
+	{
+	}
+
 	template<typename T>
 	CullingList<T>::~CullingList()
 	{
@@ -24,98 +32,64 @@ namespace Nz
 		std::size_t fullyVisibleHash = 5U;
 		std::size_t partiallyVisibleHash = 5U;
 
-		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
+		if (m_backend == CullingBackend_DynamicTree)
 		{
-			return currentHash * 23 + newHash;
-		};
-
-		for (BoxVisibilityEntry& entry : m_boxTestList)
-		{
-			switch (frustum.Intersect(entry.box))
+			// Only entries whose fat box is visible are reported, sorting their keys gives the order of the linear backend (boxes first)
+			m_treeResults.clear();
+			m_tree.Query(frustum, [&](std::size_t proxyId, IntersectionSide side)
 			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
+				m_treeResults.push_back(m_tree.GetUserData(proxyId) | side);
+			});
 
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+			std::sort(m_treeResults.begin(), m_treeResults.end());
 
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
+			std::size_t sphereKey = GetTreeKey(CullTest::Sphere, 0);
+			auto firstSphereResult = std::lower_bound(m_treeResults.begin(), m_treeResults.end(), sphereKey);
 
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+			// Fat boxes partially visible may contain a volume which is not, which has to be tested
+			for (auto it = m_treeResults.begin(); it != firstSphereResult; ++it)
+			{
+				std::size_t index = *it >> 2;
+				UInt8 side = static_cast<UInt8>(*it & 3);
+				if (side == IntersectionSide_Intersecting)
+					side = static_cast<UInt8>(CullingKernels::CullBox(frustum, m_boxes, index));
 
-				case IntersectionSide_Outside:
-					break;
+				AddResult(m_boxTestList[index], side, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 			}
-		}
 
-		for (NoTestVisibilityEntry& entry : m_noTestList)
-		{
-			m_fullyVisibleResults.push_back(entry.renderable);
-			CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
+			for (NoTestVisibilityEntry& entry : m_noTestList)
+				AddResult(entry, IntersectionSide_Inside, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 
-			if (entry.forceInvalidation)
+			for (auto it = firstSphereResult; it != m_treeResults.end(); ++it)
 			{
-				forcedInvalidation = true;
-				entry.forceInvalidation = false;
-			}
-		}
+				std::size_t index = (*it - sphereKey) >> 2;
+				UInt8 side = static_cast<UInt8>(*it & 3);
+				if (side == IntersectionSide_Intersecting)
+					side = static_cast<UInt8>(CullingKernels::CullSphere(frustum, m_spheres, index));
 
-		for (SphereVisibilityEntry& entry : m_sphereTestList)
-		{
-			switch (frustum.Intersect(entry.sphere))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Outside:
-					break;
+				AddResult(m_sphereTestList[index], side, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 			}
 		}
-		
-		for (VolumeVisibilityEntry& entry : m_volumeTestList)
+		else
 		{
-			switch (frustum.Intersect(entry.volume))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+			// Boxes and spheres are tested in batches by the culling kernels, results are then read in order
+			m_cullResults.resize(std::max(m_boxes.GetSize(), m_spheres.GetSize()));
 
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
+			CullingKernels::CullBoxes(frustum, m_boxes, m_cullResults.data());
+			for (std::size_t i = 0; i < m_boxTestList.size(); ++i)
+				AddResult(m_boxTestList[i], m_cullResults[i], fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
+			for (NoTestVisibilityEntry& entry : m_noTestList)
+				AddResult(entry, IntersectionSide_Inside, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 
-				case IntersectionSide_Outside:
-					break;
-			}
+			CullingKernels::CullSpheres(frustum, m_spheres, m_cullResults.data());
+			for (std::size_t i = 0; i < m_sphereTestList.size(); ++i)
+				AddResult(m_sphereTestList[i], m_cullResults[i], fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 		}
 
+		for (VolumeVisibilityEntry& entry : m_volumeTestList)
+			AddResult(entry, static_cast<UInt8>(frustum.Intersect(entry.volume)), fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
+
 		if (forceInvalidation)
 			*forceInvalidation = forcedInvalidation;
 
@@ -155,6 +129,12 @@ namespace Nz
 		return visibleHash;
 	}
 
+	template<typename T>
+	inline CullingBackend CullingList<T>::GetBackend() const
+	{
+		return m_backend;
+	}
+
 	template<typename T>
 	auto CullingList<T>::GetFullyVisibleResults() const -> const ResultContainer&
 	{
@@ -170,8 +150,13 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterBoxTest(const T* renderable) -> BoxEntry
 	{
+		std::size_t proxyId = DynamicAABBTree::InvalidProxy;
+		if (m_backend == CullingBackend_DynamicTree)
+			proxyId = m_tree.CreateProxy(Nz::Boxf(), GetTreeKey(CullTest::Box, m_boxTestList.size()));
+
 		BoxEntry newEntry(this, m_boxTestList.size());
-		m_boxTestList.emplace_back(BoxVisibilityEntry{ Nz::Boxf(), &newEntry, renderable, false }); //< Address of entry will be updated when moving
+		m_boxTestList.emplace_back(BoxVisibilityEntry{&newEntry, renderable, proxyId, false}); //< Address of entry will be updated when moving
+		m_boxes.Add(Nz::Boxf());
 
 		return newEntry;
 	}
@@ -179,7 +164,7 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterNoTest(const T* renderable) -> NoTestEntry
 	{
-		NoTestEntry newEntry(this, m_volumeTestList.size());
+		NoTestEntry newEntry(this, m_noTestList.size());
 		m_noTestList.emplace_back(NoTestVisibilityEntry{&newEntry, renderable, false}); //< Address of entry will be updated when moving
 
 		return newEntry;
@@ -188,8 +173,13 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterSphereTest(const T* renderable) -> SphereEntry
 	{
+		std::size_t proxyId = DynamicAABBTree::InvalidProxy;
+		if (m_backend == CullingBackend_DynamicTree)
+			proxyId = m_tree.CreateProxy(Nz::Boxf(), GetTreeKey(CullTest::Sphere, m_sphereTestList.size()));
+
 		SphereEntry newEntry(this, m_sphereTestList.size());
-		m_sphereTestList.emplace_back(SphereVisibilityEntry{Nz::Spheref(), &newEntry, renderable, false}); //< Address of entry will be updated when moving
+		m_sphereTestList.emplace_back(SphereVisibilityEntry{&newEntry, renderable, proxyId, false}); //< Address of entry will be updated when moving
+		m_spheres.Add(Nz::Spheref());
 
 		return newEntry;
 	}
@@ -203,10 +193,82 @@ namespace Nz
 		return newEntry;
 	}
 
+	/*!
+	* \brief Changes the way boxes and spheres are culled
+	*
+	* \param backend Culling backend, either testing every volume or using a DynamicAABBTree to skip whole parts of the scene
+	*
+	* \remark Results are the same with every backend
+	*/
+	template<typename T>
+	void CullingList<T>::SetBackend(CullingBackend backend)
+	{
+		if (m_backend == backend)
+			return;
+
+		m_backend = backend;
+		m_tree.Clear();
+
+		if (m_backend == CullingBackend_DynamicTree)
+		{
+			for (std::size_t i = 0; i < m_boxTestList.size(); ++i)
+			{
+				Boxf box(Vector3f(m_boxes.minX[i], m_boxes.minY[i], m_boxes.minZ[i]), Vector3f(m_boxes.maxX[i], m_boxes.maxY[i], m_boxes.maxZ[i]));
+				m_boxTestList[i].proxyId = m_tree.CreateProxy(box, GetTreeKey(CullTest::Box, i));
+			}
+
+			for (std::size_t i = 0; i < m_sphereTestList.size(); ++i)
+			{
+				Spheref sphere(m_spheres.x[i], m_spheres.y[i], m_spheres.z[i], m_spheres.radius[i]);
+				m_sphereTestList[i].proxyId = m_tree.CreateProxy(GetSphereBox(sphere), GetTreeKey(CullTest::Sphere, i));
+			}
+		}
+		else
+		{
+			for (BoxVisibilityEntry& entry : m_boxTestList)
+				entry.proxyId = DynamicAABBTree::InvalidProxy;
+
+			for (SphereVisibilityEntry& entry : m_sphereTestList)
+				entry.proxyId = DynamicAABBTree::InvalidProxy;
+		}
+	}
+
+	template<typename T>
+	template<typename VisibilityEntry>
+	void CullingList<T>::AddResult(VisibilityEntry& entry, UInt8 side, std::size_t& fullyVisibleHash, std::size_t& partiallyVisibleHash, bool& forcedInvalidation)
+	{
+		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
+		{
+			return currentHash * 23 + newHash;
+		};
+
+		switch (side)
+		{
+			case IntersectionSide_Inside:
+				m_fullyVisibleResults.push_back(entry.renderable);
+				fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
+				break;
+
+			case IntersectionSide_Intersecting:
+				m_partiallyVisibleResults.push_back(entry.renderable);
+				partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
+				break;
+
+			case IntersectionSide_Outside:
+				return;
+		}
+
+		forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
+		entry.forceInvalidation = false;
+	}
+
 	template<typename T>
 	inline void CullingList<T>::NotifyBoxUpdate(std::size_t index, const Boxf& box)
 	{
-		m_boxTestList[index].box = box;
+		m_boxes.Set(index, box);
+
+		if (m_backend == CullingBackend_DynamicTree)
+			m_tree.MoveProxy(m_boxTestList[index].proxyId, box);
 	}
 
 	template<typename T>
@@ -300,9 +362,17 @@ namespace Nz
 		{
 			case CullTest::Box:
 			{
+				if (m_backend == CullingBackend_DynamicTree)
+					m_tree.DestroyProxy(m_boxTestList[index].proxyId);
+
 				m_boxTestList[index] = std::move(m_boxTestList.back());
 				m_boxTestList[index].entry->UpdateIndex(index);
 				m_boxTestList.pop_back();
+				m_boxes.Remove(index);
+
+				if (m_backend == CullingBackend_DynamicTree && index < m_boxTestList.size())
+					m_tree.SetUserData(m_boxTestList[index].proxyId, GetTreeKey(CullTest::Box, index));
+
 				break;
 			}
 
@@ -316,9 +386,17 @@ namespace Nz
 
 			case CullTest::Sphere:
 			{
+				if (m_backend == CullingBackend_DynamicTree)
+					m_tree.DestroyProxy(m_sphereTestList[index].proxyId);
+
 				m_sphereTestList[index] = std::move(m_sphereTestList.back());
 				m_sphereTestList[index].entry->UpdateIndex(index);
 				m_sphereTestList.pop_back();
+				m_spheres.Remove(index);
+
+				if (m_backend == CullingBackend_DynamicTree && index < m_sphereTestList.size())
+					m_tree.SetUserData(m_sphereTestList[index].proxyId, GetTreeKey(CullTest::Sphere, index));
+
 				break;
 			}
 
@@ -339,7 +417,10 @@ namespace Nz
 	template<typename T>
 	void CullingList<T>::NotifySphereUpdate(std::size_t index, const Spheref& sphere)
 	{
-		m_sphereTestList[index].sphere = sphere;
+		m_spheres.Set(index, sphere);
+
+		if (m_backend == CullingBackend_DynamicTree)
+			m_tree.MoveProxy(m_sphereTestList[index].proxyId, GetSphereBox(sphere));
 	}
 
 	template<typename T>
@@ -348,6 +429,24 @@ namespace Nz
 		m_volumeTestList[index].volume = boundingVolume;
 	}
 
+	template<typename T>
+	inline Boxf CullingList<T>::GetSphereBox(const Spheref& sphere)
+	{
+		return Boxf(sphere.x - sphere.radius, sphere.y - sphere.radius, sphere.z - sphere.radius, 2.f * sphere.radius, 2.f * sphere.radius, 2.f * sphere.radius);
+	}
+
+	template<typename T>
+	inline std::size_t CullingList<T>::GetTreeKey(CullTest type, std::size_t index)
+	{
+		// Keys sort boxes before spheres and then by index, leaving two bits for the intersection side
+		constexpr std::size_t SphereBit = std::size_t(1) << (std::numeric_limits<std::size_t>::digits - 1);
+
+		NazaraAssert(type == CullTest::Box || type == CullTest::Sphere, "Only boxes and spheres are stored in the tree");
+		NazaraAssert(index < (SphereBit >> 2), "Index is too big");
+
+		return ((type == CullTest::Sphere) ? SphereBit : 0) | (index << 2);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	template<typename T>
@@ -410,6 +509,10 @@ namespace Nz
 	template<CullTest Type>
 	typename CullingList<T>::template Entry<Type>& CullingList<T>::Entry<Type>::operator=(Entry&& entry)
 	{
+		// Release our own registration first, this may update the index of the moved entry
+		if (m_parent)
+			m_parent->NotifyRelease(Type, m_index);
+
 		m_index = entry.m_index;
 		m_parent = entry.m_parent;
 		if (m_parent)
@@ -18,6 +18,8 @@ namespace Nz
 	{
 		public:
 			DepthRenderQueue();
+			DepthRenderQueue(const DepthRenderQueue&) = delete;
+			DepthRenderQueue(DepthRenderQueue&&) noexcept = default;
 			~DepthRenderQueue() = default;
 
 			void AddBillboards(int renderOrder, const Material* material, std::size_t count, const Recti& scissorRect, SparsePtr<const Vector3f> positionPtr, SparsePtr<const Vector2f> sizePtr, SparsePtr<const Vector2f> sinCosPtr = nullptr, SparsePtr<const Color> colorPtr = nullptr) override;
@@ -34,6 +36,9 @@ namespace Nz
 			void AddSpotLight(const SpotLight& light) override;
 			void AddSprites(int renderOrder, const Material* material, const VertexStruct_XYZ_Color_UV* vertices, std::size_t spriteCount, const Recti& scissorRect, const Texture* overlay = nullptr) override;
 
+			DepthRenderQueue& operator=(const DepthRenderQueue&) = delete;
+			DepthRenderQueue& operator=(DepthRenderQueue&&) noexcept = default;
+
 	private:
 			inline bool IsMaterialSuitable(const Material* material) const;
 
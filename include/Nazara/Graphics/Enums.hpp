@@ -19,6 +19,14 @@ namespace Nz
 		BackgroundType_Max = BackgroundType_User
 	};
 
+	enum CullingBackend
+	{
+		CullingBackend_DynamicTree, // Boxes and spheres are stored in a DynamicAABBTree
+		CullingBackend_Linear,      // Every volume is tested
+
+		CullingBackend_Max = CullingBackend_Linear
+	};
+
 	enum class CullTest
 	{
 		Box,
@@ -56,6 +56,7 @@ namespace Nz
 			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
 			inline void AddToRenderQueue(AbstractRenderQueue* renderQueue, const Matrix4f& transformMatrix, int renderOrder = 0, const Recti& scissorRect = Recti(-1, -1, -1, -1)) const;
 
+			bool CanAddToRenderQueueConcurrently() const override;
 			std::unique_ptr<InstancedRenderable> Clone() const override;
 
 			using InstancedRenderable::GetMaterial;
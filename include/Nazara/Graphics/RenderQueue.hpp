@@ -32,6 +32,7 @@ namespace Nz
 			void Sort();
 
 			std::vector<RenderDataPair> m_orderedRenderQueue;
+			std::vector<RenderDataPair> m_sortBuffer; //< Scratch memory of Sort, kept between sorts
 	};
 
 	template<typename RenderData>
@@ -47,6 +48,9 @@ namespace Nz
 			RenderQueue(RenderQueue&&) noexcept = default;
 			~RenderQueue() = default;
 
+			void Append(const RenderQueue& queue);
+			template<typename Func> void Append(const RenderQueue& queue, Func&& func);
+
 			void Clear();
 
 			void Insert(RenderData&& data);
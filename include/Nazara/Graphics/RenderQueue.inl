@@ -7,6 +7,38 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Inserts the data of another queue after the data of this one, in the same order
+	*
+	* \param queue Queue to copy data from
+	*
+	* \remark As with Insert, the queue has to be sorted again before being iterated
+	*/
+	template<typename RenderData>
+	void RenderQueue<RenderData>::Append(const RenderQueue& queue)
+	{
+		m_data.insert(m_data.end(), queue.m_data.begin(), queue.m_data.end());
+	}
+
+	/*!
+	* \brief Inserts the data of another queue after the data of this one, in the same order, and calls a function on each inserted copy
+	*
+	* \param queue Queue to copy data from
+	* \param func Function called with a reference to every copy, allowing to fix indices which were relative to the other queue
+	*
+	* \remark As with Insert, the queue has to be sorted again before being iterated
+	*/
+	template<typename RenderData>
+	template<typename Func>
+	void RenderQueue<RenderData>::Append(const RenderQueue& queue, Func&& func)
+	{
+		std::size_t firstIndex = m_data.size();
+		Append(queue);
+
+		for (std::size_t i = firstIndex; i < m_data.size(); ++i)
+			func(m_data[i]);
+	}
+
 	template<typename RenderData>
 	void RenderQueue<RenderData>::Clear()
 	{
@@ -39,6 +39,7 @@ namespace Nz
 			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
 			void AdvanceAnimation(float elapsedTime);
 
+			bool CanAddToRenderQueueConcurrently() const override;
 			std::unique_ptr<InstancedRenderable> Clone() const override;
 			SkeletalModel* Create() const;
 
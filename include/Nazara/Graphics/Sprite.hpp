@@ -35,6 +35,7 @@ namespace Nz
 
 			void AddToRenderQueue(AbstractRenderQueue* renderQueue, const InstanceData& instanceData, const Recti& scissorRect) const override;
 
+			bool CanAddToRenderQueueConcurrently() const override;
 			std::unique_ptr<InstancedRenderable> Clone() const override;
 
 			inline const Color& GetColor() const;
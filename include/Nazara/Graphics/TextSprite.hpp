@@ -34,6 +34,7 @@ namespace Nz
 
 			inline void Clear();
 
+			bool CanAddToRenderQueueConcurrently() const override;
 			std::unique_ptr<InstancedRenderable> Clone() const override;
 
 			inline const Color& GetColor() const;
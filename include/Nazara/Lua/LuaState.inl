@@ -63,6 +63,17 @@ namespace Nz
 		return 1;
 	}
 
+	inline unsigned int LuaImplQueryArg(const LuaState& instance, int index, StringView* arg, TypeTag<StringView>)
+	{
+		std::size_t strLength = 0;
+		const char* str = instance.CheckString(index, &strLength);
+
+		// The string stays on the Lua stack for the duration of the call
+		*arg = StringView(str, strLength);
+
+		return 1;
+	}
+
 	template<typename T>
 	std::enable_if_t<std::is_enum<T>::value && !IsEnumFlag<T>::value, unsigned int> LuaImplQueryArg(const LuaState& instance, int index, T* arg, TypeTag<T>)
 	{
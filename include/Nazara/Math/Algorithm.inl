@@ -9,6 +9,11 @@
 #include <cstdlib>
 #include <cstring>
 #include <type_traits>
+
+#ifdef NAZARA_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -168,6 +173,22 @@ namespace Nz
 	template<typename T>
 	constexpr inline std::size_t CountBits(T value)
 	{
+		if (std::is_integral<T>::value && sizeof(T) <= sizeof(UInt64))
+		{
+			UInt64 bits = static_cast<std::make_unsigned_t<T>>(value);
+
+			#if defined(__POPCNT__) && (defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC))
+			return __builtin_popcountll(bits);
+			#else
+			// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel (branchless, which lets loops be vectorized)
+			bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+			bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+			bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+			return static_cast<std::size_t>((bits * 0x0101010101010101ULL) >> 56);
+			#endif
+		}
+
 		// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetKernighan
 		std::size_t count = 0;
 		while (value)
@@ -179,6 +200,44 @@ namespace Nz
 		return count;
 	}
 
+	/*!
+	* \ingroup math
+	* \brief Gets the index of the least significant bit set in the number
+	* \return Index of the first bit set, starting from the least significant one
+	*
+	* \param number Number to scan, must not be zero
+	*
+	* \remark Uses the bit scan instruction of the processor when the compiler exposes it
+	*/
+	template<typename T>
+	//TODO: Mark as constexpr when supported by all major compilers
+	/*constexpr*/ inline unsigned int FindFirstBit(T number)
+	{
+		static_assert(std::is_integral<T>::value, "T must be an integral type");
+		NazaraAssert(number != 0, "Number must not be zero");
+
+		#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+		if (sizeof(T) <= sizeof(unsigned int))
+			return static_cast<unsigned int>(__builtin_ctz(static_cast<std::make_unsigned_t<T>>(number)));
+		else if (sizeof(T) <= sizeof(unsigned long long))
+			return static_cast<unsigned int>(__builtin_ctzll(static_cast<std::make_unsigned_t<T>>(number)));
+		#elif defined(NAZARA_COMPILER_MSVC)
+		if (sizeof(T) <= sizeof(unsigned long long))
+		{
+			unsigned long long value = static_cast<std::make_unsigned_t<T>>(number);
+
+			unsigned long index;
+			if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+				return index;
+
+			_BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+			return index + 32;
+		}
+		#endif
+
+		return IntegralLog2Pot(number & -number);
+	}
+
 	/*!
 	* \ingroup math
 	* \brief Converts degree to radian
@@ -20,7 +20,6 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
-#include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
@@ -145,7 +144,6 @@ namespace Nz
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
 			MovablePtr<UInt8> m_receivedData;
 			Bitset<UInt64> m_dispatchQueue;
-			MemoryPool m_packetPool;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
 			SocketPoller m_poller;
@@ -9,7 +9,6 @@
 namespace Nz
 {
 	inline ENetHost::ENetHost() :
-	m_packetPool(sizeof(ENetPacket)),
 	m_isUsingDualStack(false),
 	m_isSimulationEnabled(false)
 	{
@@ -29,11 +29,8 @@ namespace Nz
 
 	constexpr ENetPacketFlags ENetPacketFlag_Unreliable = 0;
 
-	class MemoryPool;
-
 	struct ENetPacket
 	{
-		MemoryPool* owner;
 		ENetPacketFlags flags;
 		NetPacket data;
 		std::size_t referenceCount = 0;
@@ -10,8 +10,9 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
-#include <Nazara/Core/Mutex.hpp>
 #include <Nazara/Network/Config.hpp>
+#include <array>
+#include <memory>
 
 namespace Nz
 {
@@ -20,6 +21,22 @@ namespace Nz
 		friend class Network;
 
 		public:
+			static constexpr std::size_t BufferCapacityClassCount = 11; //< From 64 bytes to 64 KiB
+
+			struct BufferCapacityClassStats
+			{
+				std::size_t bufferCapacity;
+				UInt64 acquireCount;
+				UInt64 allocationCount; //< Buffers allocated because none of this class was available
+				UInt64 cacheHitCount;   //< Buffers taken from the calling thread cache, without touching shared memory
+				UInt64 releaseCount;
+			};
+
+			struct BufferPoolStats
+			{
+				std::array<BufferCapacityClassStats, BufferCapacityClassCount> capacityClasses;
+			};
+
 			inline NetPacket();
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
@@ -49,6 +66,8 @@ namespace Nz
 			static bool DecodeHeader(const void* data, UInt32* packetSize, UInt16* netCode);
 			static bool EncodeHeader(void* data, UInt32 packetSize, UInt16 netCode);
 
+			static BufferPoolStats GetBufferPoolStats();
+
 			static constexpr std::size_t HeaderSize = sizeof(UInt32) + sizeof(UInt16); //< PacketSize + NetCode
 
 		private:
@@ -63,9 +82,6 @@ namespace Nz
 			std::unique_ptr<ByteArray> m_buffer;
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
-
-			static std::unique_ptr<Mutex> s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
@@ -201,30 +201,6 @@ namespace Nz
 		return true;
 	}
 
-	inline bool PixelFormat::Convert(PixelFormatType srcFormat, PixelFormatType dstFormat, const void* start, const void* end, void* dst)
-	{
-		if (srcFormat == dstFormat)
-		{
-			std::memcpy(dst, start, reinterpret_cast<const UInt8*>(end)-reinterpret_cast<const UInt8*>(start));
-			return true;
-		}
-
-		ConvertFunction func = s_convertFunctions[srcFormat][dstFormat];
-		if (!func)
-		{
-			NazaraError("Pixel format conversion from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " is not supported");
-			return false;
-		}
-
-		if (!func(reinterpret_cast<const UInt8*>(start), reinterpret_cast<const UInt8*>(end), reinterpret_cast<UInt8*>(dst)))
-		{
-			NazaraError("Pixel format conversion from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " failed");
-			return false;
-		}
-
-		return true;
-	}
-
 	inline UInt8 PixelFormat::GetBitsPerPixel(PixelFormatType format)
 	{
 		return s_pixelFormatInfos[format].bitsPerPixel;
@@ -0,0 +1,130 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ArenaAllocator
+	* \brief Core class that represents a linear allocator for short-lived memory
+	*
+	* Allocations are made by moving a cursor forward in a block of memory and are all released at once by Reset.
+	* Blocks are kept across resets and reused in the same order, which means an arena used with the same pattern over and over (like every frame) stops allocating from the heap after a few uses.
+	*
+	* \remark This class is not thread-safe
+	*/
+
+	/*!
+	* \brief Constructs a ArenaAllocator object
+	*
+	* \param blockSize Size of the blocks requested from the heap (bigger allocations get their own block)
+	*
+	* \remark No memory is allocated until the first allocation
+	*/
+
+	ArenaAllocator::ArenaAllocator(std::size_t blockSize) :
+	m_allocationCount(0),
+	m_blockSize(blockSize),
+	m_currentBlock(0),
+	m_heapAllocationCount(0),
+	m_offset(0),
+	m_previousBlocksUsage(0)
+	{
+		NazaraAssert(blockSize > 0, "Block size must be over zero");
+	}
+
+	/*!
+	* \brief Releases every allocation made from the arena
+	*
+	* Memory is kept for the next allocations, pointers to previous allocations become invalid.
+	*/
+
+	void ArenaAllocator::Reset()
+	{
+		m_allocationCount = 0;
+		m_currentBlock = 0;
+		m_heapAllocationCount = 0;
+		m_offset = 0;
+		m_previousBlocksUsage = 0;
+	}
+
+	/*!
+	* \brief Moves to the next block able to hold an allocation, allocating it from the heap if required
+	* \return Pointer to the allocated memory
+	*
+	* \param size Size of the memory to allocate
+	* \param alignment Alignment of the memory
+	*/
+
+	void* ArenaAllocator::AllocateFromNextBlock(std::size_t size, std::size_t alignment)
+	{
+		if (m_currentBlock < m_blocks.size())
+		{
+			m_previousBlocksUsage += m_offset;
+			m_currentBlock++;
+		}
+
+		// Block memory is aligned on alignof(std::max_align_t), allocations at its start never need padding
+		if (m_currentBlock >= m_blocks.size() || m_blocks[m_currentBlock].size < size)
+		{
+			Block block;
+			block.size = std::max(m_blockSize, size);
+			block.memory.reset(new UInt8[block.size]);
+
+			m_blocks.insert(m_blocks.begin() + m_currentBlock, std::move(block));
+			m_heapAllocationCount++;
+		}
+
+		NazaraUnused(alignment);
+
+		m_offset = size;
+		return m_blocks[m_currentBlock].memory.get();
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::FrameAllocator
+	* \brief Core class that represents a set of arenas used in turns, one per frame
+	*
+	* Memory allocated during a frame stays valid for FrameCount frames, allowing a frame to be processed (by the GPU or another thread) while the next one is being prepared.
+	*
+	* \remark This class is not thread-safe
+	*/
+
+	/*!
+	* \brief Constructs a FrameAllocator object
+	*
+	* \param frameCount Number of frames allocated memory stays valid, usually two (double-buffering) or three (triple-buffering)
+	* \param blockSize Size of the blocks of each arena
+	*/
+
+	FrameAllocator::FrameAllocator(std::size_t frameCount, std::size_t blockSize) :
+	m_currentFrame(0),
+	m_lastFrameHeapAllocationCount(0)
+	{
+		NazaraAssert(frameCount > 0, "Frame count must be over zero");
+
+		m_frames.reserve(frameCount);
+		for (std::size_t i = 0; i < frameCount; ++i)
+			m_frames.emplace_back(blockSize);
+	}
+
+	/*!
+	* \brief Starts a new frame
+	*
+	* The arena of the oldest frame is reset and becomes the current one, invalidating memory allocated FrameCount frames ago.
+	*/
+
+	void FrameAllocator::NextFrame()
+	{
+		m_lastFrameHeapAllocationCount = m_frames[m_currentFrame].GetHeapAllocationCount();
+
+		m_currentFrame = (m_currentFrame + 1) % m_frames.size();
+		m_frames[m_currentFrame].Reset();
+	}
+}
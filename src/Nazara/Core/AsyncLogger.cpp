@@ -0,0 +1,464 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		const char* errorType[] = {
+			"Assert failed: ",  // ErrorType_AssertFailed
+			"Internal error: ", // ErrorType_Internal
+			"Error: ",          // ErrorType_Normal
+			"Warning: "         // ErrorType_Warning
+		};
+
+		static_assert(sizeof(errorType) / sizeof(const char*) == ErrorType_Max + 1, "Error type array is incomplete");
+
+		// Messages logged by the worker thread itself (ex: failing to open the file) can't go through the queue
+		thread_local const AsyncLogger* s_currentWorker = nullptr;
+
+		constexpr UInt32 WorkerWakeupInterval = 100; //< Milliseconds, in case a wakeup signal was missed
+
+		// String reallocates to the exact size when appending, grow geometrically to keep batches linear
+		void ReserveAppend(String& buffer, std::size_t appendSize)
+		{
+			std::size_t requiredSize = buffer.GetSize() + appendSize;
+			if (buffer.GetCapacity() < requiredSize)
+				buffer.Reserve(std::max(requiredSize, buffer.GetCapacity() * 2));
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::AsyncLogger
+	* \brief Core class that represents a file logger writing from a background thread
+	*
+	* Writing a message only stores it in a bounded lock-free queue; timestamps and error messages are formatted
+	* and written to the file by a worker thread, which groups every pending message in a single write.
+	*
+	* Every batch is handed to the system right away, so messages survive a crash of the application without
+	* synchronizing the file to the disk (as FileLogger does on errors).
+	*
+	* \remark Use Flush to wait until every message written so far is in the file
+	*/
+
+	/*!
+	* \brief Constructs an AsyncLogger object with a file name
+	*
+	* \param logPath Path to log file
+	* \param queueCapacity Maximum number of messages waiting to be written, rounded up to a power of two
+	* \param overflowPolicy Behavior of writing threads when the queue is full
+	*/
+
+	AsyncLogger::AsyncLogger(const String& logPath, std::size_t queueCapacity, LogOverflowPolicy overflowPolicy) :
+	m_enqueuePosition(0),
+	m_dequeuePosition(0),
+	m_droppedMessageCount(0),
+	m_writtenMessageCount(0),
+	m_overflowPolicy(overflowPolicy),
+	m_running(true),
+	m_stdReplicationEnabled(true),
+	m_timeLoggingEnabled(true),
+	m_workerSleeping(false),
+	m_lastTime(0),
+	m_writtenPosition(0),
+	m_outputFile(logPath),
+	m_reportedDroppedMessageCount(0)
+	{
+		std::size_t capacity = 2;
+		while (capacity < queueCapacity)
+			capacity *= 2;
+
+		m_queueMask = capacity - 1;
+
+		m_slots.reset(new Slot[capacity]);
+		for (std::size_t i = 0; i < capacity; ++i)
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+
+		m_worker = Thread(&AsyncLogger::WorkerThread, this);
+		m_worker.SetName("AsyncLogger");
+	}
+
+	/*!
+	* \brief Destructs the object, writing every queued message before returning
+	*/
+
+	AsyncLogger::~AsyncLogger()
+	{
+		{
+			LockGuard lock(m_mutex);
+			m_running.store(false);
+			m_wakeCondition.Signal();
+		}
+
+		m_worker.Join();
+	}
+
+	/*!
+	* \brief Enables replication to standard output
+	*
+	* \param enable If true, enables replication
+	*/
+
+	void AsyncLogger::EnableStdReplication(bool enable)
+	{
+		m_stdReplicationEnabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Enables the days/hours prefix
+	*
+	* \param enable If true, enables the prefix
+	*/
+
+	void AsyncLogger::EnableTimeLogging(bool enable)
+	{
+		m_timeLoggingEnabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Waits until every message written before this call is in the file
+	*
+	* \remark Does nothing when called from the worker thread
+	*/
+
+	void AsyncLogger::Flush()
+	{
+		if (s_currentWorker == this)
+			return;
+
+		std::size_t targetPosition = m_enqueuePosition.load();
+
+		LockGuard lock(m_mutex);
+		while (targetPosition > m_writtenPosition)
+		{
+			m_wakeCondition.Signal();
+			m_flushCondition.Wait(&m_mutex);
+		}
+	}
+
+	/*!
+	* \brief Checks whether or not the replication to standard output is enabled
+	* \return true If replication is enabled
+	*/
+
+	bool AsyncLogger::IsStdReplicationEnabled() const
+	{
+		return m_stdReplicationEnabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Checks whether or not the days/hours prefix is enabled
+	* \return true If prefix is enabled
+	*/
+
+	bool AsyncLogger::IsTimeLoggingEnabled() const
+	{
+		return m_timeLoggingEnabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Queues a string to be written in the log file
+	*
+	* \param string String to log
+	*
+	* \see WriteError
+	*/
+
+	void AsyncLogger::Write(const String& string)
+	{
+		if (s_currentWorker == this)
+		{
+			m_stdLogger.Write(string);
+			return;
+		}
+
+		Message message;
+		message.text = string;
+		message.file = nullptr;
+		message.function = nullptr;
+		message.time = std::time(nullptr);
+		message.line = 0;
+		message.errorType = ErrorType_Normal;
+		message.isError = false;
+
+		Enqueue(std::move(message));
+	}
+
+	/*!
+	* \brief Queues an error to be written in the log file, formatting is done by the worker thread
+	*
+	* \param type Enumeration of type ErrorType
+	* \param error String describing the error
+	* \param line Line number in the file
+	* \param file Filename, must stay valid until the error is written (string literals like __FILE__ are)
+	* \param function Name of the function throwing the error, must stay valid until the error is written
+	*
+	* \see Write
+	*/
+
+	void AsyncLogger::WriteError(ErrorType type, const String& error, unsigned int line, const char* file, const char* function)
+	{
+		if (s_currentWorker == this)
+		{
+			m_stdLogger.WriteError(type, error, line, file, function);
+			return;
+		}
+
+		Message message;
+		message.text = error;
+		message.file = file;
+		message.function = function;
+		message.time = std::time(nullptr);
+		message.line = line;
+		message.errorType = type;
+		message.isError = true;
+
+		Enqueue(std::move(message));
+	}
+
+	/*!
+	* \brief Pops the oldest message of the queue, only called by the worker thread
+	* \return true if a message was retrieved
+	*
+	* \param message Output message
+	*/
+
+	bool AsyncLogger::Dequeue(Message* message)
+	{
+		std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+		Slot& slot = m_slots[position & m_queueMask];
+
+		// The slot sequence is position + 1 once a producer finished writing it
+		if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+			return false;
+
+		*message = std::move(slot.message);
+		slot.message.text.Clear(); // Moving swaps strings, don't keep the previous message alive in the slot
+
+		// Give the slot back to producers for the next lap
+		slot.sequence.store(position + m_queueMask + 1, std::memory_order_release);
+		m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	/*!
+	* \brief Pushes a message in the queue, applying the overflow policy if it's full
+	*
+	* \param message Message to push
+	*/
+
+	void AsyncLogger::Enqueue(Message&& message)
+	{
+		while (!TryEnqueue(message))
+		{
+			if (m_overflowPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy_Drop)
+			{
+				m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			WakeWorker();
+			Thread::Sleep(0); // Yield, the worker is emptying the queue
+		}
+
+		// Pairs with the worker storing m_workerSleeping before checking the queue (no wakeup can be missed)
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_workerSleeping.load(std::memory_order_relaxed))
+			WakeWorker();
+	}
+
+	/*!
+	* \brief Appends a message to the batch buffers
+	*
+	* \param message Message to format
+	*/
+
+	void AsyncLogger::FormatMessage(const Message& message)
+	{
+		std::size_t maxSize = 24 + 16 + message.text.GetSize() + 1;
+		if (message.isError && message.line != 0 && message.file && message.function)
+			maxSize += std::strlen(message.file) + std::strlen(message.function) + 16;
+
+		ReserveAppend(m_fileBuffer, maxSize);
+
+		if (m_timeLoggingEnabled.load(std::memory_order_relaxed))
+		{
+			// localtime/strftime are only called once per second of log
+			if (message.time != m_lastTime || m_timePrefix.IsEmpty())
+			{
+				std::array<char, 24> buffer;
+				std::strftime(buffer.data(), 24, "%d/%m/%Y - %H:%M:%S: ", std::localtime(&message.time));
+
+				m_lastTime = message.time;
+				m_timePrefix = buffer.data();
+			}
+
+			m_fileBuffer += m_timePrefix;
+		}
+
+		// Standard output doesn't get the time prefix
+		std::size_t lineStart = m_fileBuffer.GetSize();
+
+		if (message.isError)
+		{
+			m_fileBuffer += errorType[message.errorType];
+			m_fileBuffer += message.text;
+
+			if (message.line != 0 && message.file && message.function)
+			{
+				m_fileBuffer += " (";
+				m_fileBuffer += message.file;
+				m_fileBuffer += ':';
+				m_fileBuffer += String::Number(message.line);
+				m_fileBuffer += ": ";
+				m_fileBuffer += message.function;
+				m_fileBuffer += ')';
+			}
+		}
+		else
+			m_fileBuffer += message.text;
+
+		m_fileBuffer += '\n';
+
+		if (m_stdReplicationEnabled.load(std::memory_order_relaxed))
+		{
+			std::size_t lineSize = m_fileBuffer.GetSize() - lineStart;
+
+			ReserveAppend(m_stdBuffer, lineSize);
+			m_stdBuffer.Append(m_fileBuffer.GetConstBuffer() + lineStart, lineSize);
+		}
+	}
+
+	/*!
+	* \brief Tries to push a message in the queue
+	* \return false if the queue is full
+	*
+	* \param message Message to push, moved from on success
+	*/
+
+	bool AsyncLogger::TryEnqueue(Message& message)
+	{
+		std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Slot& slot = m_slots[position & m_queueMask];
+			std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - position);
+			if (diff == 0)
+			{
+				// Slot is free for this lap, try to claim it
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					slot.message = std::move(message);
+					slot.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+				return false; // Slot still holds a message from the previous lap: the queue is full
+			else
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \brief Wakes the worker thread up
+	*/
+
+	void AsyncLogger::WakeWorker()
+	{
+		LockGuard lock(m_mutex);
+		m_wakeCondition.Signal();
+	}
+
+	/*!
+	* \brief Worker thread loop, batching every queued message in a single write
+	*/
+
+	void AsyncLogger::WorkerThread()
+	{
+		s_currentWorker = this;
+
+		Message message;
+		for (;;)
+		{
+			// Read before draining, so that every message queued before the destruction is written
+			bool running = m_running.load();
+
+			std::size_t messageCount = 0;
+			while (messageCount <= m_queueMask && Dequeue(&message))
+			{
+				FormatMessage(message);
+				messageCount++;
+			}
+
+			if (messageCount > 0)
+			{
+				WriteBatch(messageCount);
+				continue;
+			}
+
+			if (!running)
+				break;
+
+			LockGuard lock(m_mutex);
+			m_workerSleeping.store(true);
+			if (m_running.load() && m_enqueuePosition.load() == m_dequeuePosition.load(std::memory_order_relaxed))
+				m_wakeCondition.Wait(&m_mutex, WorkerWakeupInterval);
+
+			m_workerSleeping.store(false, std::memory_order_relaxed);
+		}
+
+		s_currentWorker = nullptr;
+	}
+
+	/*!
+	* \brief Writes the batch buffers and wakes up threads waiting for them
+	*
+	* \param messageCount Number of messages in the batch
+	*/
+
+	void AsyncLogger::WriteBatch(std::size_t messageCount)
+	{
+		UInt64 droppedMessageCount = m_droppedMessageCount.load(std::memory_order_relaxed);
+		if (droppedMessageCount != m_reportedDroppedMessageCount)
+		{
+			String notice = String::Number(droppedMessageCount - m_reportedDroppedMessageCount) + " log message(s) dropped (queue full)\n";
+			m_fileBuffer += notice;
+			if (m_stdReplicationEnabled.load(std::memory_order_relaxed))
+				m_stdBuffer += notice;
+
+			m_reportedDroppedMessageCount = droppedMessageCount;
+		}
+
+		if (!m_stdBuffer.IsEmpty())
+		{
+			std::fwrite(m_stdBuffer.GetConstBuffer(), 1, m_stdBuffer.GetSize(), stdout);
+			m_stdBuffer.Clear(true);
+		}
+
+		if (m_outputFile.IsOpen() || m_outputFile.Open(OpenMode_Text | OpenMode_Truncate | OpenMode_WriteOnly))
+			m_outputFile.Write(m_fileBuffer);
+		else
+			NazaraError("Failed to open output file");
+
+		m_fileBuffer.Clear(true);
+		m_writtenMessageCount.fetch_add(messageCount, std::memory_order_relaxed);
+
+		LockGuard lock(m_mutex);
+		m_writtenPosition = m_dequeuePosition.load(std::memory_order_relaxed);
+		m_flushCondition.SignalAll();
+	}
+}
@@ -0,0 +1,365 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/DynamicAABBTree.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		Vector3f Maximum(const Vector3f& lhs, const Vector3f& rhs)
+		{
+			return Vector3f(std::max(lhs.x, rhs.x), std::max(lhs.y, rhs.y), std::max(lhs.z, rhs.z));
+		}
+
+		Vector3f Minimum(const Vector3f& lhs, const Vector3f& rhs)
+		{
+			return Vector3f(std::min(lhs.x, rhs.x), std::min(lhs.y, rhs.y), std::min(lhs.z, rhs.z));
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::DynamicAABBTree
+	* \brief Core class organizing axis-aligned boxes in a balanced bounding volume hierarchy, for fast box, frustum and ray queries
+	*
+	* Every box (called a proxy) is stored enlarged by a margin, so that moving it only updates the tree when it leaves its enlarged (fat) box.
+	* Leaves are inserted next to the sibling minimizing the surface area of the tree, and the tree is kept balanced by rotations.
+	*
+	* Proxy identifiers stay valid until the proxy is destroyed.
+	*/
+
+	constexpr std::size_t DynamicAABBTree::InvalidProxy;
+
+	/*!
+	* \brief Constructs an empty tree
+	*
+	* \param margin Margin added around proxy boxes
+	*/
+	DynamicAABBTree::DynamicAABBTree(float margin) :
+	m_freeList(InvalidProxy),
+	m_proxyCount(0),
+	m_root(InvalidProxy),
+	m_margin(margin)
+	{
+		NazaraAssert(margin >= 0.f, "Margin must be positive");
+	}
+
+	/*!
+	* \brief Destroys every proxy
+	*/
+	void DynamicAABBTree::Clear()
+	{
+		m_nodes.clear();
+		m_freeList = InvalidProxy;
+		m_proxyCount = 0;
+		m_root = InvalidProxy;
+	}
+
+	/*!
+	* \brief Inserts a box in the tree
+	* \return Identifier of the new proxy
+	*
+	* \param aabb Box of the proxy
+	* \param userData Value which can be retrieved with GetUserData
+	*/
+	std::size_t DynamicAABBTree::CreateProxy(const Boxf& aabb, std::size_t userData)
+	{
+		std::size_t proxyId = AllocateNode();
+
+		Vector3f margin(m_margin);
+
+		Node& node = m_nodes[proxyId];
+		node.minimum = aabb.GetMinimum() - margin;
+		node.maximum = aabb.GetMaximum() + margin;
+		node.height = 0;
+		node.userData = userData;
+
+		InsertLeaf(proxyId);
+		m_proxyCount++;
+
+		return proxyId;
+	}
+
+	/*!
+	* \brief Removes a proxy from the tree
+	*
+	* \param proxyId Identifier of the proxy, which may be reused by a new proxy afterwards
+	*/
+	void DynamicAABBTree::DestroyProxy(std::size_t proxyId)
+	{
+		NazaraAssert(proxyId < m_nodes.size() && IsLeaf(m_nodes[proxyId]), "Invalid proxy");
+
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+		m_proxyCount--;
+	}
+
+	/*!
+	* \brief Updates the box of a proxy
+	* \return true if the proxy has been moved in the tree, false if the box still fits in its fat AABB
+	*
+	* \param proxyId Identifier of the proxy
+	* \param aabb New box of the proxy
+	* \param displacement Expected movement of the proxy until its next update, the fat AABB is extended in this direction to predict it
+	*/
+	bool DynamicAABBTree::MoveProxy(std::size_t proxyId, const Boxf& aabb, const Vector3f& displacement)
+	{
+		NazaraAssert(proxyId < m_nodes.size() && IsLeaf(m_nodes[proxyId]), "Invalid proxy");
+
+		Vector3f minimum = aabb.GetMinimum();
+		Vector3f maximum = aabb.GetMaximum();
+
+		Node& node = m_nodes[proxyId];
+		if (node.minimum.x <= minimum.x && node.minimum.y <= minimum.y && node.minimum.z <= minimum.z &&
+		    node.maximum.x >= maximum.x && node.maximum.y >= maximum.y && node.maximum.z >= maximum.z)
+			return false;
+
+		RemoveLeaf(proxyId);
+
+		Vector3f margin(m_margin);
+		minimum -= margin;
+		maximum += margin;
+
+		Vector3f prediction = 2.f * displacement;
+		minimum += Minimum(prediction, Vector3f::Zero());
+		maximum += Maximum(prediction, Vector3f::Zero());
+
+		node.minimum = minimum;
+		node.maximum = maximum;
+
+		InsertLeaf(proxyId);
+		return true;
+	}
+
+	std::size_t DynamicAABBTree::AllocateNode()
+	{
+		std::size_t nodeId;
+		if (m_freeList != InvalidProxy)
+		{
+			nodeId = m_freeList;
+			m_freeList = m_nodes[nodeId].parent;
+		}
+		else
+		{
+			nodeId = m_nodes.size();
+			m_nodes.emplace_back();
+		}
+
+		Node& node = m_nodes[nodeId];
+		node.children[0] = InvalidProxy;
+		node.children[1] = InvalidProxy;
+		node.parent = InvalidProxy;
+		node.height = 0;
+
+		return nodeId;
+	}
+
+	/*!
+	* \brief Rotates a node with its highest child if they are unbalanced
+	* \return Identifier of the node now at the place of the given node
+	*/
+	std::size_t DynamicAABBTree::Balance(std::size_t nodeId)
+	{
+		Node& a = m_nodes[nodeId];
+		if (IsLeaf(a) || a.height < 2)
+			return nodeId;
+
+		std::size_t bId = a.children[0];
+		std::size_t cId = a.children[1];
+		Node& b = m_nodes[bId];
+		Node& c = m_nodes[cId];
+
+		int balance = c.height - b.height;
+		if (balance > -2 && balance < 2)
+			return nodeId;
+
+		// Promote the highest child (up) in place of the node, which takes the place of one of its children
+		std::size_t upId = (balance > 0) ? cId : bId;
+		std::size_t otherId = (balance > 0) ? bId : cId;
+		std::size_t upSlot = (balance > 0) ? 1 : 0;
+		Node& up = m_nodes[upId];
+		Node& other = m_nodes[otherId];
+
+		std::size_t fId = up.children[0];
+		std::size_t gId = up.children[1];
+		Node& f = m_nodes[fId];
+		Node& g = m_nodes[gId];
+
+		up.children[0] = nodeId;
+		up.parent = a.parent;
+		a.parent = upId;
+
+		if (up.parent != InvalidProxy)
+		{
+			Node& parent = m_nodes[up.parent];
+			if (parent.children[0] == nodeId)
+				parent.children[0] = upId;
+			else
+				parent.children[1] = upId;
+		}
+		else
+			m_root = upId;
+
+		// The highest grandchild stays under the promoted node, the other one replaces it under the node
+		std::size_t keptId = (f.height > g.height) ? fId : gId;
+		std::size_t movedId = (f.height > g.height) ? gId : fId;
+		Node& kept = m_nodes[keptId];
+		Node& moved = m_nodes[movedId];
+
+		up.children[1] = keptId;
+		a.children[upSlot] = movedId;
+		moved.parent = nodeId;
+
+		a.minimum = Minimum(other.minimum, moved.minimum);
+		a.maximum = Maximum(other.maximum, moved.maximum);
+		a.height = 1 + std::max(other.height, moved.height);
+
+		up.minimum = Minimum(a.minimum, kept.minimum);
+		up.maximum = Maximum(a.maximum, kept.maximum);
+		up.height = 1 + std::max(a.height, kept.height);
+
+		return upId;
+	}
+
+	void DynamicAABBTree::FreeNode(std::size_t nodeId)
+	{
+		Node& node = m_nodes[nodeId];
+		node.parent = m_freeList;
+		node.height = -1;
+
+		m_freeList = nodeId;
+	}
+
+	void DynamicAABBTree::InsertLeaf(std::size_t leafId)
+	{
+		if (m_root == InvalidProxy)
+		{
+			m_root = leafId;
+			m_nodes[leafId].parent = InvalidProxy;
+			return;
+		}
+
+		Vector3f leafMinimum = m_nodes[leafId].minimum;
+		Vector3f leafMaximum = m_nodes[leafId].maximum;
+
+		// Find the best sibling, by descending the tree while it reduces the area increase of the tree
+		std::size_t siblingId = m_root;
+		while (!IsLeaf(m_nodes[siblingId]))
+		{
+			const Node& node = m_nodes[siblingId];
+
+			float area = ComputeArea(node.minimum, node.maximum);
+			float combinedArea = ComputeArea(Minimum(node.minimum, leafMinimum), Maximum(node.maximum, leafMaximum));
+
+			// Cost of making the leaf a sibling of this node
+			float cost = 2.f * combinedArea;
+
+			// Minimal cost of pushing the leaf further down, paid by every ancestor
+			float inheritanceCost = 2.f * (combinedArea - area);
+
+			float childCosts[2];
+			for (std::size_t i = 0; i < 2; ++i)
+			{
+				const Node& child = m_nodes[node.children[i]];
+
+				float childCombinedArea = ComputeArea(Minimum(child.minimum, leafMinimum), Maximum(child.maximum, leafMaximum));
+				if (IsLeaf(child))
+					childCosts[i] = childCombinedArea + inheritanceCost;
+				else
+					childCosts[i] = childCombinedArea - ComputeArea(child.minimum, child.maximum) + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			siblingId = (childCosts[0] < childCosts[1]) ? node.children[0] : node.children[1];
+		}
+
+		// Create a new parent for the sibling and the leaf (may reallocate nodes)
+		std::size_t newParentId = AllocateNode();
+
+		Node& sibling = m_nodes[siblingId];
+		Node& leaf = m_nodes[leafId];
+		Node& newParent = m_nodes[newParentId];
+
+		std::size_t oldParentId = sibling.parent;
+
+		newParent.parent = oldParentId;
+		newParent.minimum = Minimum(sibling.minimum, leaf.minimum);
+		newParent.maximum = Maximum(sibling.maximum, leaf.maximum);
+		newParent.height = sibling.height + 1;
+		newParent.children[0] = siblingId;
+		newParent.children[1] = leafId;
+		sibling.parent = newParentId;
+		leaf.parent = newParentId;
+
+		if (oldParentId != InvalidProxy)
+		{
+			Node& oldParent = m_nodes[oldParentId];
+			if (oldParent.children[0] == siblingId)
+				oldParent.children[0] = newParentId;
+			else
+				oldParent.children[1] = newParentId;
+		}
+		else
+			m_root = newParentId;
+
+		RefitAncestors(leaf.parent);
+	}
+
+	/*!
+	* \brief Rebalances and updates the boxes and heights of a node and its ancestors
+	*/
+	void DynamicAABBTree::RefitAncestors(std::size_t nodeId)
+	{
+		while (nodeId != InvalidProxy)
+		{
+			nodeId = Balance(nodeId);
+
+			Node& node = m_nodes[nodeId];
+			const Node& firstChild = m_nodes[node.children[0]];
+			const Node& secondChild = m_nodes[node.children[1]];
+
+			node.minimum = Minimum(firstChild.minimum, secondChild.minimum);
+			node.maximum = Maximum(firstChild.maximum, secondChild.maximum);
+			node.height = 1 + std::max(firstChild.height, secondChild.height);
+
+			nodeId = node.parent;
+		}
+	}
+
+	void DynamicAABBTree::RemoveLeaf(std::size_t leafId)
+	{
+		if (leafId == m_root)
+		{
+			m_root = InvalidProxy;
+			return;
+		}
+
+		std::size_t parentId = m_nodes[leafId].parent;
+		Node& parent = m_nodes[parentId];
+
+		std::size_t grandParentId = parent.parent;
+		std::size_t siblingId = (parent.children[0] == leafId) ? parent.children[1] : parent.children[0];
+
+		// The sibling takes the place of the parent
+		m_nodes[siblingId].parent = grandParentId;
+		FreeNode(parentId);
+
+		if (grandParentId != InvalidProxy)
+		{
+			Node& grandParent = m_nodes[grandParentId];
+			if (grandParent.children[0] == parentId)
+				grandParent.children[0] = siblingId;
+			else
+				grandParent.children[1] = siblingId;
+
+			RefitAncestors(grandParentId);
+		}
+		else
+			m_root = siblingId;
+	}
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/HandleTable.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct TableData
+		{
+			Mutex mutex;
+			std::vector<UInt32> freeIndices;
+			UInt32 slotCount = 1; //< Slot zero is the null slot
+		};
+
+		TableData& GetTableData()
+		{
+			// Never destroyed, as handled objects may be destroyed by static destructors
+			static std::aligned_storage_t<sizeof(TableData), alignof(TableData)> storage;
+			static TableData* tableData = PlacementNew(reinterpret_cast<TableData*>(&storage));
+
+			return *tableData;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::HandleTable
+	* \brief Core class that holds the slots referenced by object handles
+	*
+	* Every handled object owning handles is given a slot, holding its address and a generation.
+	* A handle is made of a slot index and of the generation of the slot at the time the handle was made, copying it is free
+	* and checking its validity is a comparison of the generations. Freeing a slot increments its generation, invalidating every handle to it.
+	*
+	* Slots are stored in blocks which are never moved nor freed, allowing slots to be read without locking.
+	*/
+
+	/*!
+	* \brief Allocates a slot referencing an object
+	* \return Index of the slot
+	*
+	* \param object Object referenced by the slot
+	*
+	* \remark Produces a std::bad_alloc exception if every slot is in use
+	*/
+	UInt32 HandleTable::Allocate(void* object)
+	{
+		TableData& tableData = GetTableData();
+
+		LockGuard lock(tableData.mutex);
+
+		UInt32 index;
+		if (!tableData.freeIndices.empty())
+		{
+			index = tableData.freeIndices.back();
+			tableData.freeIndices.pop_back();
+		}
+		else
+		{
+			if (tableData.slotCount == MaxBlockCount * BlockSize)
+				throw std::bad_alloc();
+
+			index = tableData.slotCount++;
+
+			Slot*& block = s_blocks[index >> BlockShift];
+			if (!block)
+			{
+				// Blocks are never freed, keep them out of the memory manager leak tracking
+				block = static_cast<Slot*>(std::calloc(BlockSize, sizeof(Slot)));
+				if (!block)
+				{
+					tableData.slotCount--;
+					throw std::bad_alloc();
+				}
+			}
+		}
+
+		GetSlot(index).object = object;
+
+		return index;
+	}
+
+	/*!
+	* \brief Frees a slot, invalidating every handle to it
+	*
+	* \param index Index of the slot
+	*/
+	void HandleTable::Free(UInt32 index)
+	{
+		NazaraAssert(index != NullIndex, "Null slot cannot be freed");
+
+		TableData& tableData = GetTableData();
+
+		LockGuard lock(tableData.mutex);
+
+		Slot& slot = GetSlot(index);
+		slot.generation++;
+		slot.object = nullptr;
+
+		tableData.freeIndices.push_back(index);
+	}
+
+	/*!
+	* \brief Gets the number of slots ever allocated
+	* \return Number of slots, including freed ones and the null slot
+	*/
+	std::size_t HandleTable::GetSlotCount()
+	{
+		TableData& tableData = GetTableData();
+
+		LockGuard lock(tableData.mutex);
+		return tableData.slotCount;
+	}
+
+	HandleTable::Slot* HandleTable::s_blocks[MaxBlockCount] = { HandleTable::s_firstBlock };
+	HandleTable::Slot HandleTable::s_firstBlock[BlockSize];
+
+	constexpr UInt32 HandleTable::BlockShift;
+	constexpr UInt32 HandleTable::BlockSize;
+	constexpr UInt32 HandleTable::MaxBlockCount;
+	constexpr UInt32 HandleTable::NullIndex;
+}
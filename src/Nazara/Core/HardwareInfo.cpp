@@ -175,6 +175,7 @@ namespace Nz
 	* \brief Checks whether the processor owns the capacity to handle certain instructions
 	* \return true If instructions supported
 	*
+	* \remark Capabilities using AVX registers (AVX, AVX2, FMA3, FMA4 and XOP) are only reported if the OS supports them as well
 	* \remark Produces a NazaraError if capability is a wrong enum with NAZARA_DEBUG defined
 	*/
 
@@ -222,6 +223,8 @@ namespace Nz
 		// To begin, we get the id of the constructor and the id of maximal functions supported by the CPUID
 		HardwareInfoImpl::Cpuid(0, 0, registers);
 
+		UInt32 maxSupportedFunction = eax;
+
 		// Note the order: EBX, EDX, ECX
 		UInt32 manufacturerId[3] = {ebx, edx, ecx};
 
@@ -236,14 +239,21 @@ namespace Nz
 			}
 		}
 
-		if (eax >= 1)
+		// AVX registers can only be used if the OS saves them on context switches (XSAVE enabled, with SSE and AVX states in XCR0)
+		bool avxStateSupported = false;
+
+		if (maxSupportedFunction >= 1)
 		{
 			// Retrieval of certain capacities of the processor (ECX et EDX, function 1)
 			HardwareInfoImpl::Cpuid(1, 0, registers);
 
-			s_capabilities[ProcessorCap_AVX]   = (ecx & (1U << 28)) != 0;
-			s_capabilities[ProcessorCap_FMA3]  = (ecx & (1U << 12)) != 0;
+			if (ecx & (1U << 27)) // OSXSAVE
+				avxStateSupported = (HardwareInfoImpl::Xgetbv(0) & 0x6) == 0x6;
+
+			s_capabilities[ProcessorCap_AVX]   = (ecx & (1U << 28)) != 0 && avxStateSupported;
+			s_capabilities[ProcessorCap_FMA3]  = (ecx & (1U << 12)) != 0 && avxStateSupported;
 			s_capabilities[ProcessorCap_MMX]   = (edx & (1U << 23)) != 0;
+			s_capabilities[ProcessorCap_PCLMULQDQ] = (ecx & (1U << 1)) != 0;
 			s_capabilities[ProcessorCap_SSE]   = (edx & (1U << 25)) != 0;
 			s_capabilities[ProcessorCap_SSE2]  = (edx & (1U << 26)) != 0;
 			s_capabilities[ProcessorCap_SSE3]  = (ecx & (1U <<  0)) != 0;
@@ -252,6 +262,15 @@ namespace Nz
 			s_capabilities[ProcessorCap_SSE42] = (ecx & (1U << 20)) != 0;
 		}
 
+		if (maxSupportedFunction >= 7)
+		{
+			// Retrieval of extended features (EBX, function 7)
+			HardwareInfoImpl::Cpuid(7, 0, registers);
+
+			s_capabilities[ProcessorCap_AVX2] = (ebx & (1U <<  5)) != 0 && avxStateSupported;
+			s_capabilities[ProcessorCap_SHA]  = (ebx & (1U << 29)) != 0;
+		}
+
 		// Retrieval of biggest extended function handled (EAX, function 0x80000000)
 		HardwareInfoImpl::Cpuid(0x80000000, 0, registers);
 
@@ -262,9 +281,9 @@ namespace Nz
 			HardwareInfoImpl::Cpuid(0x80000001, 0, registers);
 
 			s_capabilities[ProcessorCap_x64]   = (edx & (1U << 29)) != 0; // Support of 64bits, independent of the OS
-			s_capabilities[ProcessorCap_FMA4]  = (ecx & (1U << 16)) != 0;
+			s_capabilities[ProcessorCap_FMA4]  = (ecx & (1U << 16)) != 0 && avxStateSupported;
 			s_capabilities[ProcessorCap_SSE4a] = (ecx & (1U <<  6)) != 0;
-			s_capabilities[ProcessorCap_XOP]   = (ecx & (1U << 11)) != 0;
+			s_capabilities[ProcessorCap_XOP]   = (ecx & (1U << 11)) != 0 && avxStateSupported;
 
 			if (maxSupportedExtendedFunction >= 0x80000004)
 			{
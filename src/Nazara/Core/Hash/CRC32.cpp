@@ -4,14 +4,40 @@
 
 #include <Nazara/Core/Hash/CRC32.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/X86Intrinsics.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr std::size_t crc32_sliceCount = 16;
+		constexpr UInt32 crc32_defaultPolynomial = 0x04c11db7;
+		constexpr UInt32 crc32_castagnoliPolynomial = 0x1edc6f41;
+
+		struct CRC32Tables
+		{
+			UInt32 slices[crc32_sliceCount][256];
+		};
+
+		enum CRC32Implementation
+		{
+			CRC32Implementation_Table,
+			CRC32Implementation_PCLMUL, // CRC-32 (IEEE) only
+			CRC32Implementation_SSE42   // CRC-32C (Castagnoli) only
+		};
+	}
+
 	struct HashCRC32_state
 	{
 		UInt32 crc;
-		const UInt32* table;
+		CRC32Implementation implementation;
+		const CRC32Tables* tables;
+		std::unique_ptr<CRC32Tables> customTables;
 	};
 
 	namespace
@@ -65,43 +91,275 @@ namespace Nz
 			0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
 			0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 		};
+
+		void crc32_buildSlices(CRC32Tables& crcTables)
+		{
+			auto& tables = crcTables.slices;
+
+			// Slice k gives the CRC of a byte followed by k zero bytes
+			for (std::size_t i = 0; i < 256; ++i)
+			{
+				for (std::size_t k = 1; k < crc32_sliceCount; ++k)
+					tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+			}
+		}
+
+		const CRC32Tables& crc32_defaultTables()
+		{
+			struct DefaultTables
+			{
+				DefaultTables()
+				{
+					std::copy(std::begin(crc32_table), std::end(crc32_table), tables.slices[0]);
+					crc32_buildSlices(tables);
+				}
+
+				CRC32Tables tables;
+			};
+
+			static DefaultTables defaultTables;
+			return defaultTables.tables;
+		}
+
+		inline UInt32 crc32_readWord(const UInt8* data)
+		{
+			return UInt32(data[0]) | (UInt32(data[1]) << 8) | (UInt32(data[2]) << 16) | (UInt32(data[3]) << 24);
+		}
+
+		// Slicing-by-16, processes 16 bytes per iteration with independent table lookups
+		UInt32 crc32_slicing(const CRC32Tables& crcTables, UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			const auto& tables = crcTables.slices;
+
+			while (len >= 16)
+			{
+				UInt32 a = crc32_readWord(data) ^ crc;
+				UInt32 b = crc32_readWord(data + 4);
+				UInt32 c = crc32_readWord(data + 8);
+				UInt32 d = crc32_readWord(data + 12);
+
+				crc = tables[15][a & 0xFF] ^ tables[14][(a >> 8) & 0xFF] ^ tables[13][(a >> 16) & 0xFF] ^ tables[12][a >> 24] ^
+				      tables[11][b & 0xFF] ^ tables[10][(b >> 8) & 0xFF] ^ tables[ 9][(b >> 16) & 0xFF] ^ tables[ 8][b >> 24] ^
+				      tables[ 7][c & 0xFF] ^ tables[ 6][(c >> 8) & 0xFF] ^ tables[ 5][(c >> 16) & 0xFF] ^ tables[ 4][c >> 24] ^
+				      tables[ 3][d & 0xFF] ^ tables[ 2][(d >> 8) & 0xFF] ^ tables[ 1][(d >> 16) & 0xFF] ^ tables[ 0][d >> 24];
+
+				data += 16;
+				len -= 16;
+			}
+
+			while (len--)
+				crc = tables[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+			return crc;
+		}
+
+		#ifdef NAZARA_X86_INTRINSICS
+		/*
+		* Folding with carry-less multiplications, from "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel)
+		* Constants are for the bit-reflected IEEE polynomial, len must be a multiple of 16 and at least 64
+		*/
+		NAZARA_X86_TARGET("pclmul,sse4.1")
+		inline __m128i crc32_pclmulFold(__m128i value, __m128i constants, __m128i next)
+		{
+			__m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+			__m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+
+			return _mm_xor_si128(_mm_xor_si128(high, next), low);
+		}
+
+		NAZARA_X86_TARGET("pclmul,sse4.1")
+		UInt32 crc32_pclmul(UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+			const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+			const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+			const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+			const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+			__m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+			__m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+			__m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+			__m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+
+			x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+			data += 64;
+			len -= 64;
+
+			// Fold four blocks of 128 bits in parallel
+			while (len >= 64)
+			{
+				__m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+				__m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+				__m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+				__m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+				x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+				x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+				x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+				x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+				x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+				x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+				x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+				x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+
+				data += 64;
+				len -= 64;
+			}
+
+			// Fold into a single block of 128 bits
+			x1 = crc32_pclmulFold(x1, k3k4, x2);
+			x1 = crc32_pclmulFold(x1, k3k4, x3);
+			x1 = crc32_pclmulFold(x1, k3k4, x4);
+
+			while (len >= 16)
+			{
+				x1 = crc32_pclmulFold(x1, k3k4, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+
+				data += 16;
+				len -= 16;
+			}
+
+			// Fold 128 bits to 64 bits
+			x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+			x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+			x2 = _mm_srli_si128(x1, 4);
+			x1 = _mm_and_si128(x1, mask32);
+			x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+
+			// Barrett reduction to 32 bits
+			x2 = _mm_and_si128(x1, mask32);
+			x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+			x2 = _mm_and_si128(x2, mask32);
+			x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+			x1 = _mm_xor_si128(x1, x2);
+
+			return static_cast<UInt32>(_mm_extract_epi32(x1, 1));
+		}
+
+		NAZARA_X86_TARGET("sse4.2")
+		UInt32 crc32c_sse42(UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			#ifdef NAZARA_PLATFORM_x64
+			UInt64 crc64 = crc;
+			while (len >= 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(UInt64));
+
+				crc64 = _mm_crc32_u64(crc64, value);
+
+				data += 8;
+				len -= 8;
+			}
+			crc = static_cast<UInt32>(crc64);
+			#endif
+
+			while (len >= 4)
+			{
+				UInt32 value;
+				std::memcpy(&value, data, sizeof(UInt32));
+
+				crc = _mm_crc32_u32(crc, value);
+
+				data += 4;
+				len -= 4;
+			}
+
+			while (len--)
+				crc = _mm_crc32_u8(crc, *data++);
+
+			return crc;
+		}
+		#endif
 	}
 
+	/*!
+	* \ingroup core
+	* \class Nz::HashCRC32
+	* \brief Core class that represents the CRC-32 hash
+	*
+	* Data is processed with slicing-by-16 tables, or with hardware instructions when available:
+	* PCLMULQDQ for the IEEE polynomial (default) and SSE 4.2 for the Castagnoli polynomial (CRC-32C).
+	*/
+
 	HashCRC32::HashCRC32(UInt32 polynomial)
 	{
 		m_state = new HashCRC32_state;
+		m_state->implementation = CRC32Implementation_Table;
+
+		if (polynomial == crc32_defaultPolynomial)
+		{
+			m_state->tables = &crc32_defaultTables(); // Precomputed
 
-		if (polynomial == 0x04c11db7)
-			m_state->table = crc32_table; // Table précalculée (Bien plus rapide)
+			#ifdef NAZARA_X86_INTRINSICS
+			if (HasProcessorCapabilities<ProcessorCap_PCLMULQDQ, ProcessorCap_SSE41>())
+				m_state->implementation = CRC32Implementation_PCLMUL;
+			#endif
+		}
 		else
 		{
-			UInt32* table = new UInt32[256];
+			m_state->customTables.reset(new CRC32Tables);
+
+			CRC32Tables& tables = *m_state->customTables;
 
-			for (unsigned int i = 0; i < 256; ++i)
+			UInt32 reflectedPolynomial = crc32_reflect(polynomial, 32);
+			for (UInt32 i = 0; i < 256; ++i)
 			{
-				table[i] = crc32_reflect(i, 8) << 24;
+				UInt32 value = i;
 				for (unsigned int j = 0; j < 8; ++j)
-					table[i] = (table[i] << 1) ^ (table[i] & ((1 << 31) ? polynomial : 0));
+					value = (value >> 1) ^ ((value & 1) ? reflectedPolynomial : 0);
 
-				table[i] = crc32_reflect(table[i], 32);
+				tables.slices[0][i] = value;
 			}
 
-			m_state->table = table;
+			crc32_buildSlices(tables);
+
+			m_state->tables = &tables;
+
+			#ifdef NAZARA_X86_INTRINSICS
+			if (polynomial == crc32_castagnoliPolynomial && HasProcessorCapabilities<ProcessorCap_SSE42>())
+				m_state->implementation = CRC32Implementation_SSE42;
+			#endif
 		}
 	}
 
 	HashCRC32::~HashCRC32()
 	{
-		if (m_state->table != crc32_table)
-			delete[] m_state->table;
-
 		delete m_state;
 	}
 
 	void HashCRC32::Append(const UInt8* data, std::size_t len)
 	{
-		while (len--)
-			m_state->crc = m_state->table[(m_state->crc ^ *data++) & 0xFF] ^ (m_state->crc >> 8);
+		#ifdef NAZARA_X86_INTRINSICS
+		switch (m_state->implementation)
+		{
+			case CRC32Implementation_PCLMUL:
+			{
+				if (len >= 64)
+				{
+					std::size_t foldedLength = len & ~std::size_t(15);
+					m_state->crc = crc32_pclmul(m_state->crc, data, foldedLength);
+
+					data += foldedLength;
+					len -= foldedLength;
+				}
+				break;
+			}
+
+			case CRC32Implementation_SSE42:
+				m_state->crc = crc32c_sse42(m_state->crc, data, len);
+				return;
+
+			case CRC32Implementation_Table:
+				break;
+		}
+		#endif
+
+		m_state->crc = crc32_slicing(*m_state->tables, m_state->crc, data, len);
 	}
 
 	void HashCRC32::Begin()
@@ -4,6 +4,8 @@
 
 #include <Nazara/Core/Hash/CRC64.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <algorithm>
+#include <iterator>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -81,12 +83,51 @@ namespace Nz
 			0x66e7a46c27f3aa2cULL, 0x1c3fd4a417c62355ULL, 0x935745fc4798b8deULL, 0xe98f353477ad31a7ULL,
 			0xa6df411fbfb21ca3ULL, 0xdc0731d78f8795daULL, 0x536fa08fdfd90e51ULL, 0x29b7d047efec8728ULL
 		};
+
+		struct CRC64Tables
+		{
+			CRC64Tables()
+			{
+				std::copy(std::begin(crc64_table), std::end(crc64_table), slices[0]);
+
+				// Slice k gives the CRC of a byte followed by k zero bytes
+				for (std::size_t i = 0; i < 256; ++i)
+				{
+					for (std::size_t k = 1; k < 8; ++k)
+						slices[k][i] = (slices[k - 1][i] >> 8) ^ slices[0][slices[k - 1][i] & 0xFF];
+				}
+			}
+
+			UInt64 slices[8][256];
+		};
+
+		const CRC64Tables& crc64_tables()
+		{
+			static CRC64Tables tables;
+			return tables;
+		}
 	}
 
 	void HashCRC64::Append(const UInt8* data, std::size_t len)
 	{
+		const auto& tables = crc64_tables().slices;
+
+		// Slicing-by-8
+		while (len >= 8)
+		{
+			UInt64 value = m_crc;
+			for (unsigned int i = 0; i < 8; ++i)
+				value ^= UInt64(data[i]) << (i * 8);
+
+			m_crc = tables[7][value & 0xFF] ^ tables[6][(value >> 8) & 0xFF] ^ tables[5][(value >> 16) & 0xFF] ^ tables[4][(value >> 24) & 0xFF] ^
+			        tables[3][(value >> 32) & 0xFF] ^ tables[2][(value >> 40) & 0xFF] ^ tables[1][(value >> 48) & 0xFF] ^ tables[0][value >> 56];
+
+			data += 8;
+			len -= 8;
+		}
+
 		while (len--)
-			m_crc = crc64_table[(m_crc ^ *data++) & 0xFF] ^ (m_crc >> 8);
+			m_crc = tables[0][(m_crc ^ *data++) & 0xFF] ^ (m_crc >> 8);
 	}
 
 	void HashCRC64::Begin()
@@ -39,6 +39,7 @@
 
 #include <Nazara/Core/Hash/SHA/Internal.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/X86Intrinsics.hpp>
 #include <cstring>
 #include <Nazara/Core/Debug.hpp>
 
@@ -267,6 +268,140 @@ namespace Nz
 	};
 
 
+	/*** SHA EXTENSIONS (x86): *******************************************/
+	#ifdef NAZARA_X86_INTRINSICS
+
+	#define SHANI_SHA1_ROUNDS(msg, func) \
+		e1 = _mm_sha1nexte_epu32(e0, (msg)); \
+		e0 = abcd; \
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, (func));
+
+	#define SHANI_SHA1_SCHEDULE(m0, m1, m2, m3) \
+		(m0) = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32((m0), (m1)), (m2)), (m3));
+
+	#define SHANI_SHA256_ROUNDS(msg, k) \
+		tmp = _mm_add_epi32((msg), _mm_loadu_si128(reinterpret_cast<const __m128i*>(k))); \
+		state1 = _mm_sha256rnds2_epu32(state1, state0, tmp); \
+		state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(tmp, 0x0E));
+
+	#define SHANI_SHA256_SCHEDULE(m0, m1, m2, m3) \
+		(m0) = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32((m0), (m1)), _mm_alignr_epi8((m3), (m2), 4)), (m3));
+
+	namespace
+	{
+		inline bool SHA_HasExtensions()
+		{
+			return HasProcessorCapabilities<ProcessorCap_SHA, ProcessorCap_SSE41>();
+		}
+
+		NAZARA_X86_TARGET("sha,sse4.1")
+		void SHA1_Internal_TransformSHANI(UInt32* state, const UInt8* data, std::size_t blockCount)
+		{
+			const __m128i byteSwapMask = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+
+			__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+			__m128i e = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+			for (; blockCount > 0; --blockCount, data += 64)
+			{
+				__m128i abcdSave = abcd;
+				__m128i eSave = e;
+				__m128i e0, e1;
+
+				__m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data +  0)), byteSwapMask);
+				__m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), byteSwapMask);
+				__m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), byteSwapMask);
+				__m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), byteSwapMask);
+
+				/* Rounds 0 to 15: */
+				e1 = _mm_add_epi32(e, msg0);
+				e0 = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+				SHANI_SHA1_ROUNDS(msg1, 0);
+				SHANI_SHA1_ROUNDS(msg2, 0);
+				SHANI_SHA1_ROUNDS(msg3, 0);
+
+				/* Rounds 16 to 79: */
+				SHANI_SHA1_SCHEDULE(msg0, msg1, msg2, msg3); SHANI_SHA1_ROUNDS(msg0, 0);
+				SHANI_SHA1_SCHEDULE(msg1, msg2, msg3, msg0); SHANI_SHA1_ROUNDS(msg1, 1);
+				SHANI_SHA1_SCHEDULE(msg2, msg3, msg0, msg1); SHANI_SHA1_ROUNDS(msg2, 1);
+				SHANI_SHA1_SCHEDULE(msg3, msg0, msg1, msg2); SHANI_SHA1_ROUNDS(msg3, 1);
+				SHANI_SHA1_SCHEDULE(msg0, msg1, msg2, msg3); SHANI_SHA1_ROUNDS(msg0, 1);
+				SHANI_SHA1_SCHEDULE(msg1, msg2, msg3, msg0); SHANI_SHA1_ROUNDS(msg1, 1);
+				SHANI_SHA1_SCHEDULE(msg2, msg3, msg0, msg1); SHANI_SHA1_ROUNDS(msg2, 2);
+				SHANI_SHA1_SCHEDULE(msg3, msg0, msg1, msg2); SHANI_SHA1_ROUNDS(msg3, 2);
+				SHANI_SHA1_SCHEDULE(msg0, msg1, msg2, msg3); SHANI_SHA1_ROUNDS(msg0, 2);
+				SHANI_SHA1_SCHEDULE(msg1, msg2, msg3, msg0); SHANI_SHA1_ROUNDS(msg1, 2);
+				SHANI_SHA1_SCHEDULE(msg2, msg3, msg0, msg1); SHANI_SHA1_ROUNDS(msg2, 2);
+				SHANI_SHA1_SCHEDULE(msg3, msg0, msg1, msg2); SHANI_SHA1_ROUNDS(msg3, 3);
+				SHANI_SHA1_SCHEDULE(msg0, msg1, msg2, msg3); SHANI_SHA1_ROUNDS(msg0, 3);
+				SHANI_SHA1_SCHEDULE(msg1, msg2, msg3, msg0); SHANI_SHA1_ROUNDS(msg1, 3);
+				SHANI_SHA1_SCHEDULE(msg2, msg3, msg0, msg1); SHANI_SHA1_ROUNDS(msg2, 3);
+				SHANI_SHA1_SCHEDULE(msg3, msg0, msg1, msg2); SHANI_SHA1_ROUNDS(msg3, 3);
+
+				/* Compute the current intermediate hash value */
+				e = _mm_sha1nexte_epu32(e0, eSave);
+				abcd = _mm_add_epi32(abcd, abcdSave);
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+			state[4] = static_cast<UInt32>(_mm_extract_epi32(e, 3));
+		}
+
+		NAZARA_X86_TARGET("sha,sse4.1")
+		void SHA256_Internal_TransformSHANI(UInt32* state, const UInt8* data, std::size_t blockCount, const UInt32* k)
+		{
+			const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+			/* Registers are expected as ABEF and CDGH */
+			__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1); // CDAB
+			__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B); // EFGH
+			__m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+			state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+			for (; blockCount > 0; --blockCount, data += 64)
+			{
+				__m128i state0Save = state0;
+				__m128i state1Save = state1;
+
+				__m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data +  0)), byteSwapMask);
+				__m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), byteSwapMask);
+				__m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), byteSwapMask);
+				__m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), byteSwapMask);
+
+				/* Rounds 0 to 15: */
+				SHANI_SHA256_ROUNDS(msg0, &k[0]);
+				SHANI_SHA256_ROUNDS(msg1, &k[4]);
+				SHANI_SHA256_ROUNDS(msg2, &k[8]);
+				SHANI_SHA256_ROUNDS(msg3, &k[12]);
+
+				/* Rounds 16 to 63: */
+				for (unsigned int j = 16; j < 64; j += 16)
+				{
+					SHANI_SHA256_SCHEDULE(msg0, msg1, msg2, msg3); SHANI_SHA256_ROUNDS(msg0, &k[j + 0]);
+					SHANI_SHA256_SCHEDULE(msg1, msg2, msg3, msg0); SHANI_SHA256_ROUNDS(msg1, &k[j + 4]);
+					SHANI_SHA256_SCHEDULE(msg2, msg3, msg0, msg1); SHANI_SHA256_ROUNDS(msg2, &k[j + 8]);
+					SHANI_SHA256_SCHEDULE(msg3, msg0, msg1, msg2); SHANI_SHA256_ROUNDS(msg3, &k[j + 12]);
+				}
+
+				/* Compute the current intermediate hash value */
+				state0 = _mm_add_epi32(state0, state0Save);
+				state1 = _mm_add_epi32(state1, state1Save);
+			}
+
+			tmp = _mm_shuffle_epi32(state0, 0x1B); // FEBA
+			state1 = _mm_shuffle_epi32(state1, 0xB1); // DCHG
+			state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+			state1 = _mm_alignr_epi8(state1, tmp, 8); // HGFE
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+		}
+	}
+
+	#endif // NAZARA_X86_INTRINSICS
+
+
 	/*** SHA-1: ***********************************************************/
 	void SHA1_Init(SHA_CTX* context)
 	{
@@ -323,6 +458,14 @@ namespace Nz
 	{
 		void SHA1_Internal_Transform(SHA_CTX* context, const UInt32* data)
 		{
+			#ifdef NAZARA_X86_INTRINSICS
+			if (SHA_HasExtensions())
+			{
+				SHA1_Internal_TransformSHANI(context->s1.state, reinterpret_cast<const UInt8*>(data), 1);
+				return;
+			}
+			#endif
+
 			UInt32 a, b, c, d, e;
 			UInt32 T1, *W1;
 			int	j;
@@ -467,6 +610,18 @@ namespace Nz
 			}
 		}
 
+		#ifdef NAZARA_X86_INTRINSICS
+		if (len >= 64 && SHA_HasExtensions())
+		{
+			/* Process every complete block at once */
+			std::size_t blockCount = len / 64;
+			SHA1_Internal_TransformSHANI(context->s1.state, data, blockCount);
+			context->s1.bitcount += blockCount * 512;
+			len -= blockCount * 64;
+			data += blockCount * 64;
+		}
+		#endif
+
 		while (len >= 64)
 		{
 			/* Process as many complete blocks as we can */
@@ -522,8 +677,7 @@ namespace Nz
 		/* Convert FROM host byte order */
 		REVERSE64(context->s1.bitcount,context->s1.bitcount);
 	#endif
-		UInt64* length = reinterpret_cast<UInt64*>(&context->s1.buffer[56]);
-		*length = context->s1.bitcount;
+		std::memcpy(&context->s1.buffer[56], &context->s1.bitcount, sizeof(UInt64));
 
 		/* Final transform: */
 		SHA1_Internal_Transform(context, reinterpret_cast<UInt32*>(context->s1.buffer));
@@ -591,6 +745,14 @@ namespace Nz
 
 	void SHA256_Internal_Transform(SHA_CTX* context, const UInt32* data)
 	{
+		#ifdef NAZARA_X86_INTRINSICS
+		if (SHA_HasExtensions())
+		{
+			SHA256_Internal_TransformSHANI(context->s256.state, reinterpret_cast<const UInt8*>(data), 1, K256);
+			return;
+		}
+		#endif
+
 		UInt32 a, b, c, d, e, f, g, h;
 		UInt32 T1, *W256;
 		int	j;
@@ -679,6 +841,18 @@ namespace Nz
 			}
 		}
 
+		#ifdef NAZARA_X86_INTRINSICS
+		if (len >= 64 && SHA_HasExtensions())
+		{
+			/* Process every complete block at once */
+			std::size_t blockCount = len / 64;
+			SHA256_Internal_TransformSHANI(context->s256.state, data, blockCount, K256);
+			context->s256.bitcount += blockCount * 512;
+			len -= blockCount * 64;
+			data += blockCount * 64;
+		}
+		#endif
+
 		while (len >= 64)
 		{
 			/* Process as many complete blocks as we can */
@@ -733,8 +907,7 @@ namespace Nz
 		}
 
 		/* Set the bit count: */
-		UInt64* length = reinterpret_cast<UInt64*>(&context->s256.buffer[56]);
-		*length = context->s256.bitcount;
+		std::memcpy(&context->s256.buffer[56], &context->s256.bitcount, sizeof(UInt64));
 
 		/* Final transform: */
 		SHA256_Internal_Transform(context, reinterpret_cast<UInt32*>(context->s256.buffer));
@@ -992,9 +1165,8 @@ namespace Nz
 		}
 
 		/* Store the length of input data (in bits): */
-		UInt64* length = reinterpret_cast<UInt64*>(&context->s512.buffer[112]);
-		length[0] = context->s512.bitcount[1];
-		length[1] = context->s512.bitcount[0];
+		std::memcpy(&context->s512.buffer[112], &context->s512.bitcount[1], sizeof(UInt64));
+		std::memcpy(&context->s512.buffer[120], &context->s512.bitcount[0], sizeof(UInt64));
 
 		/* Final transform: */
 		SHA512_Internal_Transform(context, reinterpret_cast<UInt64*>(context->s512.buffer));
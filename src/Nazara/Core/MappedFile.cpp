@@ -0,0 +1,314 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MappedFile
+	* \brief Core class that represents a file mapped in memory
+	*
+	* The content of the file is loaded by the operating system as it gets accessed, without going through intermediate buffers.
+	* Its memory can be accessed directly with GetMemoryView (or Stream::ReadView), reading it as a stream only copies the requested bytes.
+	*
+	* In copy-on-write mode, the memory can also be modified (see GetWritableMemoryView), but changes are private to the process and never written back to the file.
+	*
+	* \remark The file should not be truncated while it is mapped, accessing memory past its new end would crash the process
+	*/
+
+	/*!
+	* \brief Constructs a MappedFile object by default
+	*/
+
+	MappedFile::MappedFile() :
+	m_mode(MappedFileMode_ReadOnly),
+	m_cursorPos(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MappedFile object and maps a file
+	*
+	* \param filePath Path to the file
+	* \param mode Mapping mode
+	*
+	* \see Open
+	*/
+
+	MappedFile::MappedFile(const String& filePath, MappedFileMode mode) :
+	MappedFile()
+	{
+		Open(filePath, mode);
+	}
+
+	/*!
+	* \brief Destructs the object and unmaps the file
+	*/
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Tells the operating system how the whole file is going to be accessed
+	* \return true if the hint was given successfully
+	*
+	* \param hint Access pattern
+	*/
+
+	bool MappedFile::Advise(MemoryAccessHint hint)
+	{
+		return Advise(hint, 0, GetSize());
+	}
+
+	/*!
+	* \brief Tells the operating system how a part of the file is going to be accessed
+	* \return true if the hint was given successfully
+	*
+	* \param hint Access pattern
+	* \param offset Offset of the part
+	* \param size Size of the part
+	*
+	* \remark Produces a NazaraAssert if the file is not open or if the part is out of the file
+	*/
+
+	bool MappedFile::Advise(MemoryAccessHint hint, UInt64 offset, UInt64 size)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+		NazaraAssert(offset <= GetSize() && size <= GetSize() - offset, "Part is out of the file");
+
+		return m_impl->Advise(hint, offset, size);
+	}
+
+	/*!
+	* \brief Unmaps the file
+	*
+	* \remark Pointers previously returned by GetMemoryView become invalid
+	*/
+
+	void MappedFile::Close()
+	{
+		if (m_impl)
+		{
+			delete m_impl;
+			m_impl = nullptr;
+
+			m_cursorPos = 0;
+			m_openMode = OpenMode_NotOpen;
+		}
+	}
+
+	/*!
+	* \brief Checks whether the cursor reached the end of the file
+	* \return true if cursor is at the end of the file
+	*/
+
+	bool MappedFile::EndOfStream() const
+	{
+		return m_cursorPos >= GetSize();
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor
+	*/
+
+	UInt64 MappedFile::GetCursorPos() const
+	{
+		return m_cursorPos;
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+
+	String MappedFile::GetDirectory() const
+	{
+		return File::GetDirectory(m_filePath);
+	}
+
+	/*!
+	* \brief Gets a direct view of the file content
+	* \return Pointer to the beginning of the file, or nullptr if the file is not open or empty
+	*/
+
+	const UInt8* MappedFile::GetMemoryView() const
+	{
+		return (m_impl) ? m_impl->GetPointer() : nullptr;
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+
+	String MappedFile::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file, or zero if it is not open
+	*/
+
+	UInt64 MappedFile::GetSize() const
+	{
+		return (m_impl) ? m_impl->GetSize() : 0;
+	}
+
+	/*!
+	* \brief Gets a modifiable view of the file content
+	* \return Pointer to the beginning of the file, or nullptr if the file is not open, empty or not mapped in copy-on-write mode
+	*/
+
+	UInt8* MappedFile::GetWritableMemoryView()
+	{
+		return (m_impl && m_mode == MappedFileMode_CopyOnWrite) ? m_impl->GetPointer() : nullptr;
+	}
+
+	/*!
+	* \brief Checks whether the file is mapped
+	* \return true if it is the case
+	*/
+
+	bool MappedFile::IsOpen() const
+	{
+		return m_impl != nullptr;
+	}
+
+	/*!
+	* \brief Maps a file in memory
+	* \return true if the file was mapped successfully
+	*
+	* \param filePath Path to the file
+	* \param mode Mapping mode, copy-on-write allows writing to the stream (without modifying the file)
+	*
+	* \remark Produces a NazaraError if the file could not be mapped
+	*/
+
+	bool MappedFile::Open(const String& filePath, MappedFileMode mode)
+	{
+		Close();
+
+		String path = File::NormalizePath(filePath);
+
+		std::unique_ptr<MappedFileImpl> impl(new MappedFileImpl);
+		if (!impl->Map(path, mode))
+			return false;
+
+		m_filePath = std::move(path);
+		m_impl = impl.release();
+		m_mode = mode;
+		m_openMode = (mode == MappedFileMode_CopyOnWrite) ? OpenMode_ReadWrite : OpenModeFlags(OpenMode_ReadOnly);
+
+		return true;
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset according to the beginning of the file, clamped to its size
+	*/
+
+	bool MappedFile::SetCursorPos(UInt64 offset)
+	{
+		m_cursorPos = std::min(offset, GetSize());
+
+		return true;
+	}
+
+	/*!
+	* \brief Moves the mapping of another MappedFile into this one, unmapping the current file
+	* \return A reference to this
+	*
+	* \param file MappedFile to move from
+	*/
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+	{
+		Close();
+
+		Stream::operator=(std::move(file));
+
+		m_cursorPos = file.m_cursorPos;
+		m_filePath = std::move(file.m_filePath);
+		m_impl = std::move(file.m_impl);
+		m_mode = file.m_mode;
+
+		return *this;
+	}
+
+	/*!
+	* \brief Flushes the stream
+	*/
+
+	void MappedFile::FlushStream()
+	{
+		// Nothing to do, changes are never written to the file
+	}
+
+	/*!
+	* \brief Reads blocks
+	* \return Number of blocks read
+	*
+	* \param buffer Preallocated buffer to contain information read, or nullptr to skip bytes
+	* \param size Size of the read and thus of the buffer
+	*/
+
+	std::size_t MappedFile::ReadBlock(void* buffer, std::size_t size)
+	{
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, GetSize() - m_cursorPos));
+
+		if (buffer && readSize > 0)
+			std::memcpy(buffer, m_impl->GetPointer() + m_cursorPos, readSize);
+
+		m_cursorPos += readSize;
+		return readSize;
+	}
+
+	/*!
+	* \brief Writes blocks in the mapped memory
+	* \return Number of blocks written
+	*
+	* \param buffer Preallocated buffer containing information to write
+	* \param size Size of the writing and thus of the buffer
+	*
+	* \remark Writing cannot grow the file
+	*/
+
+	std::size_t MappedFile::WriteBlock(const void* buffer, std::size_t size)
+	{
+		NazaraAssert(buffer, "Invalid buffer");
+		NazaraAssert(m_mode == MappedFileMode_CopyOnWrite, "File is not mapped in copy-on-write mode");
+
+		std::size_t writeSize = static_cast<std::size_t>(std::min<UInt64>(size, GetSize() - m_cursorPos));
+
+		if (writeSize > 0)
+			std::memcpy(m_impl->GetPointer() + m_cursorPos, buffer, writeSize);
+
+		m_cursorPos += writeSize;
+		return writeSize;
+	}
+}
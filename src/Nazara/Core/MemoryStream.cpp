@@ -46,6 +46,16 @@ namespace Nz
 		return m_pos;
 	}
 
+	/*!
+	* \brief Gets a direct view of the buffer
+	* \return Pointer to the beginning of the buffer, or nullptr if there is none
+	*/
+
+	const UInt8* MemoryStream::GetMemoryView() const
+	{
+		return (m_buffer) ? m_buffer->GetConstBuffer() : nullptr;
+	}
+
 	/*!
 	* \brief Gets the size of the raw memory
 	* \return Size of the memory
@@ -69,6 +69,16 @@ namespace Nz
 		return m_pos;
 	}
 
+	/*!
+	* \brief Gets a direct view of the memory
+	* \return Pointer to the beginning of the memory
+	*/
+
+	const UInt8* MemoryView::GetMemoryView() const
+	{
+		return m_ptr;
+	}
+
 	/*!
 	* \brief Gets the size of the raw memory
 	* \return Size of the memory
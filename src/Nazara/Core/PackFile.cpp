@@ -0,0 +1,831 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PackFile.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 PackMagic = 0x4B505A4E; // "NZPK" in little-endian
+		constexpr std::size_t HeaderSize = 32;
+		constexpr std::size_t IndexEntrySize = 48;
+
+		enum PackCompression : UInt32
+		{
+			PackCompression_None,
+			PackCompression_LZ4
+		};
+
+		/*
+		* LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+		* Compression is greedy with a single hash table, favoring speed over ratio, decompression is bound-checked
+		*/
+		constexpr std::size_t LZ4HashLog = 14;
+		constexpr std::size_t LZ4LastLiterals = 5;
+		constexpr std::size_t LZ4MatchSearchLimit = 12;
+		constexpr std::size_t LZ4MaxOffset = 0xFFFF;
+		constexpr std::size_t LZ4MinMatch = 4;
+
+		UInt32 ReadUInt32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(UInt32));
+
+			return value;
+		}
+
+		void WriteLZ4Length(std::vector<UInt8>& output, std::size_t length)
+		{
+			while (length >= 255)
+			{
+				output.push_back(255);
+				length -= 255;
+			}
+
+			output.push_back(static_cast<UInt8>(length));
+		}
+
+		void WriteLZ4Sequence(std::vector<UInt8>& output, const UInt8* literals, std::size_t literalLength, std::size_t matchOffset, std::size_t matchLength)
+		{
+			std::size_t tokenMatchLength = (matchLength > 0) ? matchLength - LZ4MinMatch : 0;
+
+			UInt8 token = static_cast<UInt8>((std::min<std::size_t>(literalLength, 15) << 4) | std::min<std::size_t>(tokenMatchLength, 15));
+			output.push_back(token);
+
+			if (literalLength >= 15)
+				WriteLZ4Length(output, literalLength - 15);
+
+			output.insert(output.end(), literals, literals + literalLength);
+
+			// The last sequence has no match
+			if (matchLength > 0)
+			{
+				output.push_back(static_cast<UInt8>(matchOffset & 0xFF));
+				output.push_back(static_cast<UInt8>(matchOffset >> 8));
+
+				if (tokenMatchLength >= 15)
+					WriteLZ4Length(output, tokenMatchLength - 15);
+			}
+		}
+
+		std::vector<UInt8> CompressLZ4(const UInt8* input, std::size_t inputSize)
+		{
+			std::vector<UInt8> output;
+			output.reserve(inputSize / 2 + 16);
+
+			std::size_t anchor = 0;
+			if (inputSize > LZ4MatchSearchLimit)
+			{
+				std::vector<std::size_t> hashTable(std::size_t(1) << LZ4HashLog, std::numeric_limits<std::size_t>::max());
+
+				std::size_t matchEndLimit = inputSize - LZ4LastLiterals;
+				std::size_t position = 0;
+				while (position < inputSize - LZ4MatchSearchLimit)
+				{
+					UInt32 sequence = ReadUInt32(&input[position]);
+					UInt32 hash = (sequence * 2654435761U) >> (32 - LZ4HashLog);
+
+					std::size_t candidate = hashTable[hash];
+					hashTable[hash] = position;
+
+					if (candidate == std::numeric_limits<std::size_t>::max() || position - candidate > LZ4MaxOffset || ReadUInt32(&input[candidate]) != sequence)
+					{
+						position++;
+						continue;
+					}
+
+					std::size_t matchLength = LZ4MinMatch;
+					while (position + matchLength < matchEndLimit && input[candidate + matchLength] == input[position + matchLength])
+						matchLength++;
+
+					WriteLZ4Sequence(output, &input[anchor], position - anchor, position - candidate, matchLength);
+
+					position += matchLength;
+					anchor = position;
+				}
+			}
+
+			WriteLZ4Sequence(output, &input[anchor], inputSize - anchor, 0, 0);
+
+			return output;
+		}
+
+		bool DecompressLZ4(const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t outputSize)
+		{
+			const UInt8* inputEnd = input + inputSize;
+			UInt8* outputStart = output;
+			UInt8* outputEnd = output + outputSize;
+
+			auto ReadLength = [&](std::size_t& length) -> bool
+			{
+				UInt8 byte;
+				do
+				{
+					if (input == inputEnd)
+						return false;
+
+					byte = *input++;
+					length += byte;
+				}
+				while (byte == 255);
+
+				return true;
+			};
+
+			while (input < inputEnd)
+			{
+				UInt8 token = *input++;
+
+				std::size_t literalLength = token >> 4;
+				if (literalLength == 15 && !ReadLength(literalLength))
+					return false;
+
+				if (literalLength > static_cast<std::size_t>(inputEnd - input) || literalLength > static_cast<std::size_t>(outputEnd - output))
+					return false;
+
+				std::memcpy(output, input, literalLength);
+				input += literalLength;
+				output += literalLength;
+
+				// Last sequence
+				if (input == inputEnd)
+					break;
+
+				if (inputEnd - input < 2)
+					return false;
+
+				std::size_t offset = input[0] | (input[1] << 8);
+				input += 2;
+
+				if (offset == 0 || offset > static_cast<std::size_t>(output - outputStart))
+					return false;
+
+				std::size_t matchLength = token & 0x0F;
+				if (matchLength == 15 && !ReadLength(matchLength))
+					return false;
+
+				matchLength += LZ4MinMatch;
+				if (matchLength > static_cast<std::size_t>(outputEnd - output))
+					return false;
+
+				// Matches may overlap their own output
+				const UInt8* match = output - offset;
+				for (std::size_t i = 0; i < matchLength; ++i)
+					output[i] = match[i];
+
+				output += matchLength;
+			}
+
+			return output == outputEnd;
+		}
+
+		class PackEntryData
+		{
+			protected:
+				PackEntryData(ByteArray data, String path, std::shared_ptr<const PackFile> owner) :
+				m_data(std::move(data)),
+				m_path(std::move(path)),
+				m_owner(std::move(owner))
+				{
+				}
+
+				ByteArray m_data;
+				String m_path;
+				std::shared_ptr<const PackFile> m_owner;
+		};
+
+		// Base-from-member: owned data has to be constructed before the view on it
+		class PackEntryStream : private PackEntryData, public MemoryView
+		{
+			public:
+				PackEntryStream(const UInt8* ptr, UInt64 size, String path, std::shared_ptr<const PackFile> owner) :
+				PackEntryData(ByteArray(), std::move(path), std::move(owner)),
+				MemoryView(ptr, size)
+				{
+				}
+
+				PackEntryStream(ByteArray data, String path, std::shared_ptr<const PackFile> owner) :
+				PackEntryData(std::move(data), std::move(path), std::move(owner)),
+				MemoryView(m_data.GetConstBuffer(), m_data.GetSize())
+				{
+				}
+
+				String GetDirectory() const override
+				{
+					return File::GetDirectory(m_path);
+				}
+
+				String GetPath() const override
+				{
+					return m_path;
+				}
+		};
+
+		struct MountedPack
+		{
+			String directory; //< Absolute, ends with a separator
+			std::shared_ptr<PackFile> pack;
+		};
+
+		struct MountRegistry
+		{
+			std::vector<MountedPack> packs;
+			Mutex mutex;
+		};
+
+		MountRegistry& GetMountRegistry()
+		{
+			static MountRegistry registry;
+			return registry;
+		}
+
+		template<typename F>
+		bool FindMountedFile(const String& filePath, F&& callback)
+		{
+			String absolutePath = File::AbsolutePath(filePath);
+
+			MountRegistry& registry = GetMountRegistry();
+			LockGuard lock(registry.mutex);
+
+			// Last mounted packs take precedence
+			for (auto it = registry.packs.rbegin(); it != registry.packs.rend(); ++it)
+			{
+				if (!absolutePath.StartsWith(it->directory))
+					continue;
+
+				String entryPath = absolutePath.SubString(it->directory.GetSize());
+				#ifdef NAZARA_PLATFORM_WINDOWS
+				entryPath.Replace('\\', '/');
+				#endif
+
+				if (it->pack->Contains(entryPath))
+				{
+					std::shared_ptr<PackFile> pack = it->pack;
+					lock.Unlock();
+
+					callback(pack, entryPath, absolutePath);
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::PackFile
+	* \brief Core class that represents an archive of files (a pack)
+	*
+	* A pack stores many files in a single one, avoiding filesystem calls when opening each of them.
+	* It is memory-mapped, entries are located with a binary search in an index sorted by path hash and can be compressed (LZ4).
+	* Uncompressed entries are read in place, aligned in the pack to allow direct access to their content (see Stream::GetMemoryView).
+	*
+	* Packs can be mounted at a directory, their entries are then found by ResourceLoader::LoadFromFile (and thus ResourceManager) as if they were files of this directory.
+	*
+	* Format (little-endian):
+	* - Header: magic ("NZPK"), version, entry count, alignment (UInt32), index offset, names offset (UInt64)
+	* - Entries data, each entry starting at a multiple of the alignment
+	* - Index: hash, offset, size, stored size (UInt64), compression, name length, name offset, reserved (UInt32) for each entry, sorted by hash
+	* - Names: entry paths, relative to the pack and using '/' as separator
+	*
+	* \see Build
+	*/
+
+	constexpr UInt32 PackFile::FormatVersion;
+
+	/*!
+	* \brief Constructs a PackFile object and opens a pack
+	*
+	* \param filePath Path to the pack
+	*/
+
+	PackFile::PackFile(const String& filePath)
+	{
+		Open(filePath);
+	}
+
+	/*!
+	* \brief Closes the pack
+	*
+	* \remark Streams over uncompressed entries become invalid
+	*/
+
+	void PackFile::Close()
+	{
+		m_entries.clear();
+		m_file.Close();
+	}
+
+	/*!
+	* \brief Checks whether the pack contains an entry
+	* \return true if it is the case
+	*
+	* \param entryPath Path of the entry in the pack
+	*/
+
+	bool PackFile::Contains(const String& entryPath) const
+	{
+		return FindEntry(entryPath) != nullptr;
+	}
+
+	/*!
+	* \brief Gets informations about an entry
+	* \return Path, size and storage of the entry
+	*
+	* \param entryIndex Index of the entry, entries are sorted by path hash
+	*
+	* \remark Produces a NazaraAssert if entryIndex is out of range
+	*/
+
+	PackFile::EntryInfo PackFile::GetEntryInfo(std::size_t entryIndex) const
+	{
+		NazaraAssert(entryIndex < m_entries.size(), "Entry index out of range");
+
+		const IndexEntry& entry = m_entries[entryIndex];
+
+		EntryInfo info;
+		info.compressed = (entry.compression != PackCompression_None);
+		info.path.Set(reinterpret_cast<const char*>(m_file.GetMemoryView() + entry.nameOffset), entry.nameLength);
+		info.size = entry.size;
+		info.storedSize = entry.storedSize;
+
+		return info;
+	}
+
+	/*!
+	* \brief Opens a pack
+	* \return true if the pack was opened and its index is valid
+	*
+	* \param filePath Path to the pack
+	*
+	* \remark Produces a NazaraError if the pack could not be opened or is invalid
+	*/
+
+	bool PackFile::Open(const String& filePath)
+	{
+		Close();
+
+		if (!m_file.Open(filePath))
+		{
+			NazaraError("Failed to open pack \"" + filePath + '"');
+			return false;
+		}
+
+		UInt64 fileSize = m_file.GetSize();
+		if (fileSize < HeaderSize)
+		{
+			NazaraError("Pack \"" + filePath + "\" is too small");
+			Close();
+			return false;
+		}
+
+		ByteStream stream(m_file.GetMemoryView(), fileSize);
+		stream.SetDataEndianness(Endianness_LittleEndian);
+
+		UInt32 magic, version, entryCount, alignment;
+		UInt64 indexOffset, namesOffset;
+		stream >> magic >> version >> entryCount >> alignment >> indexOffset >> namesOffset;
+
+		if (magic != PackMagic)
+		{
+			NazaraError('"' + filePath + "\" is not a pack");
+			Close();
+			return false;
+		}
+
+		if (version != FormatVersion)
+		{
+			NazaraError("Pack \"" + filePath + "\" has unsupported version " + String::Number(version));
+			Close();
+			return false;
+		}
+
+		if (indexOffset > fileSize || (fileSize - indexOffset) / IndexEntrySize < entryCount || namesOffset > fileSize)
+		{
+			NazaraError("Pack \"" + filePath + "\" index is out of the file");
+			Close();
+			return false;
+		}
+
+		m_file.Advise(MemoryAccessHint_WillNeed, indexOffset, fileSize - indexOffset);
+		m_file.Advise(MemoryAccessHint_Random);
+
+		stream.GetStream()->SetCursorPos(indexOffset);
+
+		m_entries.resize(entryCount);
+		for (IndexEntry& entry : m_entries)
+		{
+			UInt32 reserved;
+			stream >> entry.hash >> entry.offset >> entry.size >> entry.storedSize >> entry.compression >> entry.nameLength >> entry.nameOffset >> reserved;
+
+			bool valid = true;
+			valid = valid && entry.offset <= fileSize && entry.storedSize <= fileSize - entry.offset;
+			valid = valid && entry.nameOffset >= namesOffset && entry.nameOffset <= fileSize && entry.nameLength <= fileSize - entry.nameOffset;
+			valid = valid && (entry.compression == PackCompression_LZ4 || (entry.compression == PackCompression_None && entry.size == entry.storedSize));
+			valid = valid && (&entry == m_entries.data() || (&entry - 1)->hash <= entry.hash);
+
+			if (!valid)
+			{
+				NazaraError("Pack \"" + filePath + "\" has an invalid entry");
+				Close();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Opens an entry of the pack as a stream
+	* \return Stream over the entry content or nullptr if the pack has no such entry or it could not be decompressed
+	*
+	* Uncompressed entries are read directly from the mapped pack, compressed entries are decompressed in memory.
+	* The stream path is the entry path relative to the pack directory.
+	*
+	* \param entryPath Path of the entry in the pack
+	*
+	* \remark The pack must stay open as long as the stream is used
+	*/
+
+	std::unique_ptr<Stream> PackFile::OpenEntry(const String& entryPath) const
+	{
+		const IndexEntry* entry = FindEntry(entryPath);
+		if (!entry)
+			return nullptr;
+
+		return OpenEntry(*entry, File::GetDirectory(m_file.GetPath()) + File::NormalizeSeparators(entryPath), nullptr);
+	}
+
+	/*!
+	* \brief Builds a pack from files
+	* \return true if the pack was written successfully
+	*
+	* \param packPath Path of the pack to write
+	* \param entries Files to store and their path in the pack
+	* \param compress Compress entries with LZ4 when it saves enough space
+	* \param alignment Alignment of entries data in the pack, in bytes (must be a power of two)
+	*
+	* \remark Produces a NazaraError if a file could not be read, if two entries have the same path or if the pack could not be written
+	*/
+
+	bool PackFile::Build(const String& packPath, const std::vector<BuildEntry>& entries, bool compress, UInt32 alignment)
+	{
+		NazaraAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		struct SortedEntry
+		{
+			const BuildEntry* entry;
+			UInt64 hash;
+		};
+
+		std::vector<SortedEntry> sortedEntries;
+		sortedEntries.reserve(entries.size());
+		for (const BuildEntry& entry : entries)
+			sortedEntries.push_back({&entry, HashEntryPath(entry.entryPath.GetConstBuffer(), entry.entryPath.GetSize())});
+
+		std::sort(sortedEntries.begin(), sortedEntries.end(), [](const SortedEntry& lhs, const SortedEntry& rhs)
+		{
+			if (lhs.hash != rhs.hash)
+				return lhs.hash < rhs.hash;
+
+			return lhs.entry->entryPath < rhs.entry->entryPath;
+		});
+
+		for (std::size_t i = 1; i < sortedEntries.size(); ++i)
+		{
+			if (sortedEntries[i].entry->entryPath == sortedEntries[i - 1].entry->entryPath)
+			{
+				NazaraError("Entry \"" + sortedEntries[i].entry->entryPath + "\" is present multiple times");
+				return false;
+			}
+		}
+
+		File file(packPath, OpenMode_WriteOnly | OpenMode_Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("Failed to open \"" + packPath + "\" for writing");
+			return false;
+		}
+
+		UInt64 position = 0;
+		auto Write = [&](const void* data, std::size_t size) -> bool
+		{
+			if (file.Write(data, size) != size)
+			{
+				NazaraError("Failed to write pack \"" + packPath + '"');
+				return false;
+			}
+
+			position += size;
+			return true;
+		};
+
+		auto Align = [&](UInt64 boundary) -> bool
+		{
+			static const UInt8 padding[4096] = {};
+
+			while (position % boundary != 0)
+			{
+				std::size_t paddingSize = static_cast<std::size_t>(std::min<UInt64>(boundary - position % boundary, sizeof(padding)));
+				if (!Write(padding, paddingSize))
+					return false;
+			}
+
+			return true;
+		};
+
+		// Header is written at the end, once offsets are known
+		UInt8 emptyHeader[HeaderSize] = {};
+		if (!Write(emptyHeader, HeaderSize))
+			return false;
+
+		std::vector<IndexEntry> index;
+		index.reserve(sortedEntries.size());
+
+		UInt64 namesSize = 0;
+		for (const SortedEntry& sortedEntry : sortedEntries)
+		{
+			// Names are referenced by 32 bits offsets
+			namesSize += sortedEntry.entry->entryPath.GetSize();
+			if (namesSize > std::numeric_limits<UInt32>::max())
+			{
+				NazaraError("Pack \"" + packPath + "\" is too big");
+				return false;
+			}
+
+			MappedFile source;
+			if (!source.Open(sortedEntry.entry->sourcePath))
+			{
+				NazaraError("Failed to open \"" + sortedEntry.entry->sourcePath + '"');
+				return false;
+			}
+
+			source.Advise(MemoryAccessHint_Sequential);
+
+			const UInt8* data = source.GetMemoryView();
+			std::size_t size = static_cast<std::size_t>(source.GetSize());
+
+			IndexEntry entry;
+			entry.compression = PackCompression_None;
+			entry.hash = sortedEntry.hash;
+			entry.nameLength = static_cast<UInt32>(sortedEntry.entry->entryPath.GetSize());
+			entry.nameOffset = static_cast<UInt32>(namesSize - entry.nameLength);
+			entry.size = size;
+			entry.storedSize = size;
+
+			std::vector<UInt8> compressedData;
+			if (compress && size > 0)
+			{
+				compressedData = CompressLZ4(data, size);
+
+				// Keep the entry uncompressed (and readable in place) unless it saves at least an eighth of its size
+				if (compressedData.size() < size - size / 8)
+				{
+					entry.compression = PackCompression_LZ4;
+					entry.storedSize = compressedData.size();
+					data = compressedData.data();
+				}
+			}
+
+			if (!Align(alignment))
+				return false;
+
+			entry.offset = position;
+			if (entry.storedSize > 0 && !Write(data, static_cast<std::size_t>(entry.storedSize)))
+				return false;
+
+			index.push_back(entry);
+		}
+
+		if (!Align(8))
+			return false;
+
+		UInt64 indexOffset = position;
+		UInt64 namesOffset = indexOffset + index.size() * IndexEntrySize;
+		if (namesOffset + namesSize > std::numeric_limits<UInt32>::max())
+		{
+			NazaraError("Pack \"" + packPath + "\" is too big");
+			return false;
+		}
+
+		// Index and header are serialized in memory first, so their writes can be checked like the others
+		std::vector<UInt8> indexData(index.size() * IndexEntrySize);
+		if (!index.empty())
+		{
+			ByteStream indexStream(indexData.data(), indexData.size());
+			indexStream.SetDataEndianness(Endianness_LittleEndian);
+
+			for (const IndexEntry& entry : index)
+				indexStream << entry.hash << entry.offset << entry.size << entry.storedSize << entry.compression << entry.nameLength << static_cast<UInt32>(namesOffset + entry.nameOffset) << UInt32(0);
+
+			if (!Write(indexData.data(), indexData.size()))
+				return false;
+		}
+
+		for (const SortedEntry& sortedEntry : sortedEntries)
+		{
+			const String& entryPath = sortedEntry.entry->entryPath;
+			if (!entryPath.IsEmpty() && !Write(entryPath.GetConstBuffer(), entryPath.GetSize()))
+				return false;
+		}
+
+		UInt8 header[HeaderSize];
+		{
+			ByteStream headerStream(header, HeaderSize);
+			headerStream.SetDataEndianness(Endianness_LittleEndian);
+
+			headerStream << PackMagic << FormatVersion << static_cast<UInt32>(index.size()) << alignment << indexOffset << namesOffset;
+		}
+
+		if (!file.SetCursorPos(0))
+		{
+			NazaraError("Failed to write pack \"" + packPath + '"');
+			return false;
+		}
+
+		if (!Write(header, HeaderSize))
+			return false;
+
+		return true;
+	}
+
+	/*!
+	* \brief Checks whether a file is found in a mounted pack
+	* \return true if it is the case
+	*
+	* \param filePath Path to the file, as if the pack were extracted at its mount point
+	*/
+
+	bool PackFile::IsFileMounted(const String& filePath)
+	{
+		return FindMountedFile(filePath, [](const std::shared_ptr<PackFile>& /*pack*/, const String& /*entryPath*/, const String& /*absolutePath*/) {});
+	}
+
+	/*!
+	* \brief Mounts a pack, making its entries available as files of a directory
+	* \return true if the pack was opened successfully
+	*
+	* \param packPath Path to the pack
+	* \param mountPoint Directory the pack entries appear in, the current directory if empty
+	*
+	* \remark Packs mounted last take precedence over previously mounted packs
+	* \remark Mounted packs are only used by OpenMountedFile (used by ResourceLoader::LoadFromFile), not by File
+	*/
+
+	bool PackFile::Mount(const String& packPath, const String& mountPoint)
+	{
+		std::shared_ptr<PackFile> pack = std::make_shared<PackFile>();
+		if (!pack->Open(packPath))
+			return false;
+
+		MountedPack mountedPack;
+		mountedPack.directory = File::AbsolutePath((mountPoint.IsEmpty()) ? Directory::GetCurrent() : mountPoint);
+		mountedPack.pack = std::move(pack);
+
+		if (!mountedPack.directory.EndsWith(NAZARA_DIRECTORY_SEPARATOR))
+			mountedPack.directory += NAZARA_DIRECTORY_SEPARATOR;
+
+		MountRegistry& registry = GetMountRegistry();
+		LockGuard lock(registry.mutex);
+
+		registry.packs.emplace_back(std::move(mountedPack));
+
+		return true;
+	}
+
+	/*!
+	* \brief Opens a file from the mounted packs
+	* \return Stream over the file content, or nullptr if no mounted pack contains it
+	*
+	* \param filePath Path to the file, as if the pack were extracted at its mount point
+	*/
+
+	std::unique_ptr<Stream> PackFile::OpenMountedFile(const String& filePath)
+	{
+		std::unique_ptr<Stream> stream;
+		FindMountedFile(filePath, [&](const std::shared_ptr<PackFile>& pack, const String& entryPath, const String& absolutePath)
+		{
+			stream = pack->OpenEntry(*pack->FindEntry(entryPath), absolutePath, pack);
+		});
+
+		return stream;
+	}
+
+	/*!
+	* \brief Unmounts a pack
+	* \return true if the pack was mounted
+	*
+	* \param packPath Path to the pack, as given to Mount
+	*
+	* \remark Streams opened from the pack stay valid
+	*/
+
+	bool PackFile::Unmount(const String& packPath)
+	{
+		String path = File::NormalizePath(packPath);
+
+		MountRegistry& registry = GetMountRegistry();
+		LockGuard lock(registry.mutex);
+
+		auto it = std::remove_if(registry.packs.begin(), registry.packs.end(), [&](const MountedPack& mountedPack) { return mountedPack.pack->GetPath() == path; });
+		if (it == registry.packs.end())
+			return false;
+
+		registry.packs.erase(it, registry.packs.end());
+		return true;
+	}
+
+	/*!
+	* \brief Unmounts every pack
+	*/
+
+	void PackFile::UnmountAll()
+	{
+		MountRegistry& registry = GetMountRegistry();
+		LockGuard lock(registry.mutex);
+
+		registry.packs.clear();
+	}
+
+	/*!
+	* \brief Finds an entry in the index
+	* \return Pointer to the index entry, or nullptr if there is none
+	*
+	* \param entryPath Path of the entry in the pack
+	*/
+
+	const PackFile::IndexEntry* PackFile::FindEntry(const String& entryPath) const
+	{
+		UInt64 hash = HashEntryPath(entryPath.GetConstBuffer(), entryPath.GetSize());
+
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const IndexEntry& entry, UInt64 value) { return entry.hash < value; });
+		for (; it != m_entries.end() && it->hash == hash; ++it)
+		{
+			if (it->nameLength == entryPath.GetSize() && std::memcmp(m_file.GetMemoryView() + it->nameOffset, entryPath.GetConstBuffer(), it->nameLength) == 0)
+				return &*it;
+		}
+
+		return nullptr;
+	}
+
+	/*!
+	* \brief Opens an entry as a stream
+	* \return Stream over the entry content, or nullptr if it could not be decompressed
+	*
+	* \param entry Index entry
+	* \param streamPath Path returned by the stream
+	* \param owner Pack kept alive by the stream, if any
+	*/
+
+	std::unique_ptr<Stream> PackFile::OpenEntry(const IndexEntry& entry, String streamPath, std::shared_ptr<const PackFile> owner) const
+	{
+		const UInt8* data = m_file.GetMemoryView() + entry.offset;
+
+		if (entry.compression == PackCompression_None)
+			return std::make_unique<PackEntryStream>(data, entry.size, std::move(streamPath), std::move(owner));
+
+		ByteArray decompressedData(static_cast<std::size_t>(entry.size), 0);
+		if (!DecompressLZ4(data, static_cast<std::size_t>(entry.storedSize), decompressedData.GetBuffer(), decompressedData.GetSize()))
+		{
+			NazaraError("Failed to decompress \"" + streamPath + "\": corrupted data");
+			return nullptr;
+		}
+
+		return std::make_unique<PackEntryStream>(std::move(decompressedData), std::move(streamPath), std::move(owner));
+	}
+
+	/*!
+	* \brief Hashes an entry path (64-bit FNV-1a)
+	* \return Hash of the path
+	*
+	* \param entryPath Path of the entry
+	* \param length Length of the path
+	*/
+
+	UInt64 PackFile::HashEntryPath(const char* entryPath, std::size_t length)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			hash ^= static_cast<UInt8>(entryPath[i]);
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+}
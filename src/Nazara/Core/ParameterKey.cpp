@@ -0,0 +1,102 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParameterKey.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/String.hpp>
+#include <deque>
+#include <unordered_map>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct KeyRegistry
+		{
+			Mutex mutex;
+			std::deque<String> names; //< Never moves its elements, views of them stay valid
+			std::unordered_map<StringView, UInt32> ids;
+		};
+
+		KeyRegistry& GetRegistry()
+		{
+			// Keys may be interned during static initialization of other translation units
+			static KeyRegistry registry;
+			return registry;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ParameterKey
+	* \brief Core class that represents an interned parameter name
+	*
+	* Every name is given an unique identifier the first time it is interned, comparing and hashing keys only involves this identifier.
+	* Keys are meant to be built once (for example as static variables) and reused for every lookup in a ParameterList.
+	*/
+
+	/*!
+	* \brief Constructs a ParameterKey object from a name, interning it if needed
+	*
+	* \param name Name of the key
+	*
+	* \remark This locks a global mutex and hashes the name, hot code should keep the key around instead of building it again
+	*/
+	ParameterKey::ParameterKey(StringView name)
+	{
+		KeyRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+
+		auto it = registry.ids.find(name);
+		if (it == registry.ids.end())
+		{
+			UInt32 id = static_cast<UInt32>(registry.names.size());
+			registry.names.emplace_back(name);
+
+			it = registry.ids.emplace(registry.names.back(), id).first;
+		}
+
+		m_id = it->second;
+	}
+
+	/*!
+	* \brief Gets the name of the key
+	* \return Name used to intern the key, or an empty string if the key is invalid
+	*/
+	const String& ParameterKey::GetName() const
+	{
+		static String emptyName;
+		if (m_id == InvalidId)
+			return emptyName;
+
+		KeyRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+		return registry.names[m_id];
+	}
+
+	/*!
+	* \brief Finds the key of a name without interning it
+	* \return Key of the name, or an invalid key if this name was never interned
+	*
+	* \param name Name of the key
+	*/
+	ParameterKey ParameterKey::Find(StringView name)
+	{
+		KeyRegistry& registry = GetRegistry();
+
+		LockGuard lock(registry.mutex);
+
+		auto it = registry.ids.find(name);
+		if (it == registry.ids.end())
+			return ParameterKey();
+
+		return ParameterKey(it->second);
+	}
+
+	constexpr UInt32 ParameterKey::InvalidId;
+}
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/MemoryHelper.hpp>
+#include <algorithm>
 #include <cstring>
 #include <Nazara/Core/Debug.hpp>
 
@@ -18,37 +19,42 @@ namespace Nz
 	*/
 
 	/*!
-	* \brief Constructs a ParameterList object by copy
+	* \brief Clears all the parameters
 	*/
-	ParameterList::ParameterList(const ParameterList& list)
+	void ParameterList::Clear()
 	{
-		operator=(list);
+		m_parameters.clear();
 	}
 
 	/*!
-	* \brief Destructs the object and clears
+	* \brief Gets a parameter as a boolean
+	* \return true if the parameter could be represented as a boolean
+	*
+	* \param name Name of the parameter
+	* \param value Pointer to a boolean to hold the retrieved value
+	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
 	*/
-	ParameterList::~ParameterList()
+	bool ParameterList::GetBooleanParameter(StringView name, bool* value) const
 	{
-		Clear();
-	}
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-	/*!
-	* \brief Clears all the parameters
-	*/
-	void ParameterList::Clear()
-	{
-		for (auto it = m_parameters.begin(); it != m_parameters.end(); ++it)
-			DestroyValue(it->second);
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
 
-		m_parameters.clear();
+		return GetBooleanParameter(key, value);
 	}
 
 	/*!
 	* \brief Gets a parameter as a boolean
 	* \return true if the parameter could be represented as a boolean
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value Pointer to a boolean to hold the retrieved value
 	*
 	* \remark value must be a valid pointer
@@ -57,33 +63,33 @@ namespace Nz
 	          Integer: 0 is interpreted as false, any other value is interpreted as true
 	          String:  Conversion obeys the rule as described by String::ToBool
 	*/
-	bool ParameterList::GetBooleanParameter(const String& name, bool* value) const
+	bool ParameterList::GetBooleanParameter(ParameterKey key, bool* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = it->second.value.boolVal;
+				*value = parameter->value.boolVal;
 				return true;
 
 			case ParameterType_Integer:
-				*value = (it->second.value.intVal != 0);
+				*value = (parameter->value.intVal != 0);
 				return true;
 
 			case ParameterType_String:
 			{
 				bool converted;
-				if (it->second.value.stringVal.ToBool(&converted, String::CaseInsensitive))
+				if (parameter->value.stringVal.ToBool(&converted, String::CaseInsensitive))
 				{
 					*value = converted;
 					return true;
@@ -111,27 +117,51 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to a color to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetColorParameter(StringView name, Color* value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetColorParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as a color
+	* \return true if the parameter could be represented as a color
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to a color to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not a color, the function fails
 	*/
-	bool ParameterList::GetColorParameter(const String& name, Color* value) const
+	bool ParameterList::GetColorParameter(ParameterKey key, Color* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Color:
-				*value = it->second.value.colorVal;
+				*value = parameter->value.colorVal;
 				return true;
 
 			case ParameterType_Boolean:
@@ -155,39 +185,63 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to a double to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetDoubleParameter(StringView name, double* value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetDoubleParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as a double
+	* \return true if the parameter could be represented as a double
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to a double to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not a double, a conversion will be performed, compatibles types are:
 	          Integer: The integer value is converted to its double representation
 	          String:  Conversion obeys the rule as described by String::ToDouble
 	*/
-	bool ParameterList::GetDoubleParameter(const String& name, double* value) const
+	bool ParameterList::GetDoubleParameter(ParameterKey key, double* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Double:
-				*value = it->second.value.doubleVal;
+				*value = parameter->value.doubleVal;
 				return true;
 
 			case ParameterType_Integer:
-				*value = static_cast<double>(it->second.value.intVal);
+				*value = static_cast<double>(parameter->value.intVal);
 				return true;
 
 			case ParameterType_String:
 				{
 					double converted;
-					if (it->second.value.stringVal.ToDouble(&converted))
+					if (parameter->value.stringVal.ToDouble(&converted))
 					{
 						*value = converted;
 						return true;
@@ -215,6 +269,30 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to an integer to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetIntegerParameter(StringView name, long long* value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetIntegerParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as an integer
+	* \return true if the parameter could be represented as an integer
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to an integer to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not an integer, a conversion will be performed, compatibles types are:
@@ -222,37 +300,37 @@ namespace Nz
 	          Double:  The floating-point value is truncated and converted to a integer
 	          String:  Conversion obeys the rule as described by String::ToInteger
 	*/
-	bool ParameterList::GetIntegerParameter(const String& name, long long* value) const
+	bool ParameterList::GetIntegerParameter(ParameterKey key, long long* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = (it->second.value.boolVal) ? 1 : 0;
+				*value = (parameter->value.boolVal) ? 1 : 0;
 				return true;
 
 			case ParameterType_Double:
-				*value = static_cast<long long>(it->second.value.doubleVal);
+				*value = static_cast<long long>(parameter->value.doubleVal);
 				return true;
 
 			case ParameterType_Integer:
-				*value = it->second.value.intVal;
+				*value = parameter->value.intVal;
 				return true;
 
 			case ParameterType_String:
 				{
 					long long converted;
-					if (it->second.value.stringVal.ToInteger(&converted))
+					if (parameter->value.stringVal.ToInteger(&converted))
 					{
 						*value = converted;
 						return true;
@@ -280,15 +358,29 @@ namespace Nz
 	*
 	* \remark type must be a valid pointer to a ParameterType variable
 	*/
-	bool ParameterList::GetParameterType(const String& name, ParameterType* type) const
+	bool ParameterList::GetParameterType(StringView name, ParameterType* type) const
+	{
+		return GetParameterType(ParameterKey::Find(name), type);
+	}
+
+	/*!
+	* \brief Gets a parameter type
+	* \return true if the parameter is present, its type being written to type
+	*
+	* \param key Key of the variable
+	* \param type Pointer to a variable to hold the result
+	*
+	* \remark type must be a valid pointer to a ParameterType variable
+	*/
+	bool ParameterList::GetParameterType(ParameterKey key, ParameterType* type) const
 	{
 		NazaraAssert(type, "Invalid pointer");
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return false;
 
-		*type = it->second.type;
+		*type = parameter->type;
 
 		return true;
 	}
@@ -300,32 +392,56 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to a pointer to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetPointerParameter(StringView name, void** value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetPointerParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as a pointer
+	* \return true if the parameter could be represented as a pointer
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to a pointer to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not a pointer, a conversion will be performed, compatibles types are:
 	          Userdata: The pointer part of the userdata is returned
 	*/
-	bool ParameterList::GetPointerParameter(const String& name, void** value) const
+	bool ParameterList::GetPointerParameter(ParameterKey key, void** value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Pointer:
-				*value = it->second.value.ptrVal;
+				*value = parameter->value.ptrVal;
 				return true;
 
 			case ParameterType_Userdata:
-				*value = it->second.value.userdataVal->ptr;
+				*value = parameter->value.userdataVal->ptr;
 				return true;
 
 			case ParameterType_Boolean:
@@ -348,6 +464,30 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to a pointer to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetStringParameter(StringView name, String* value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetStringParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as a string
+	* \return true if the parameter could be represented as a string
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to a pointer to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not a string, a conversion will be performed, all types are compatibles:
@@ -359,47 +499,47 @@ namespace Nz
 	          Pointer:  Conversion obeys the rules of String::Pointer
 	          Userdata: Conversion obeys the rules of String::Pointer
 	*/
-	bool ParameterList::GetStringParameter(const String& name, String* value) const
+	bool ParameterList::GetStringParameter(ParameterKey key, String* value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType_Boolean:
-				*value = String::Boolean(it->second.value.boolVal);
+				*value = String::Boolean(parameter->value.boolVal);
 				return true;
 
 			case ParameterType_Color:
-				*value = it->second.value.colorVal.ToString();
+				*value = parameter->value.colorVal.ToString();
 				return true;
 
 			case ParameterType_Double:
-				*value = String::Number(it->second.value.doubleVal);
+				*value = String::Number(parameter->value.doubleVal);
 				return true;
 
 			case ParameterType_Integer:
-				*value = String::Number(it->second.value.intVal);
+				*value = String::Number(parameter->value.intVal);
 				return true;
 
 			case ParameterType_String:
-				*value = it->second.value.stringVal;
+				*value = parameter->value.stringVal;
 				return true;
 
 			case ParameterType_Pointer:
-				*value = String::Pointer(it->second.value.ptrVal);
+				*value = String::Pointer(parameter->value.ptrVal);
 				return true;
 
 			case ParameterType_Userdata:
-				*value = String::Pointer(it->second.value.userdataVal->ptr);
+				*value = String::Pointer(parameter->value.userdataVal->ptr);
 				return true;
 
 			case ParameterType_None:
@@ -418,28 +558,52 @@ namespace Nz
 	* \param name Name of the parameter
 	* \param value Pointer to a pointer to hold the retrieved value
 	*
+	* \remark The name is looked up in the key registry first (without interning it), hot code should keep a ParameterKey around and use the other overload
+	*/
+	bool ParameterList::GetUserdataParameter(StringView name, void** value) const
+	{
+		ParameterKey key = ParameterKey::Find(name);
+		if (!key.IsValid())
+		{
+			// No parameter was ever set with this name, fail the same way as the key overload
+			ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
+
+			NazaraError("Parameter \"" + String(name) + "\" is not present");
+			return false;
+		}
+
+		return GetUserdataParameter(key, value);
+	}
+
+	/*!
+	* \brief Gets a parameter as an userdata
+	* \return true if the parameter could be represented as a userdata
+	*
+	* \param key Key of the parameter
+	* \param value Pointer to a pointer to hold the retrieved value
+	*
 	* \remark value must be a valid pointer
 	* \remark In case of failure, the variable pointed by value keep its value
 	* \remark If the parameter is not an userdata, the function fails
 	*
 	* \see GetPointerParameter
 	*/
-	bool ParameterList::GetUserdataParameter(const String& name, void** value) const
+	bool ParameterList::GetUserdataParameter(ParameterKey key, void** value) const
 	{
 		NazaraAssert(value, "Invalid pointer");
 
 		ErrorFlags flags(ErrorFlag_Silent | ErrorFlag_ThrowExceptionDisabled);
 
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 		{
-			NazaraError("Parameter \"" + name + "\" is not present");
+			NazaraError("Parameter \"" + key.GetName() + "\" is not present");
 			return false;
 		}
 
-		if (it->second.type == ParameterType_Userdata)
+		if (parameter->type == ParameterType_Userdata)
 		{
-			*value = it->second.value.userdataVal->ptr;
+			*value = parameter->value.userdataVal->ptr;
 			return true;
 		}
 		else
@@ -455,9 +619,20 @@ namespace Nz
 	*
 	* \param name Name of the parameter
 	*/
-	bool ParameterList::HasParameter(const String& name) const
+	bool ParameterList::HasParameter(StringView name) const
 	{
-		return m_parameters.find(name) != m_parameters.end();
+		return HasParameter(ParameterKey::Find(name));
+	}
+
+	/*!
+	* \brief Checks whether the parameter list contains a parameter identified by `key`
+	* \return true if found
+	*
+	* \param key Key of the parameter
+	*/
+	bool ParameterList::HasParameter(ParameterKey key) const
+	{
+		return FindParameter(key) != nullptr;
 	}
 
 	/*!
@@ -468,40 +643,75 @@ namespace Nz
 	*
 	* \param name Name of the parameter
 	*/
-	void ParameterList::RemoveParameter(const String& name)
+	void ParameterList::RemoveParameter(StringView name)
 	{
-		auto it = m_parameters.find(name);
-		if (it != m_parameters.end())
-		{
-			DestroyValue(it->second);
+		RemoveParameter(ParameterKey::Find(name));
+	}
+
+	/*!
+	* \brief Removes the parameter identified by `key`
+	*
+	* Search for a parameter identified by `key` and remove it from the parameter list, freeing up its memory
+	* Nothing is done if the parameter is not present in the parameter list
+	*
+	* \param key Key of the parameter
+	*/
+	void ParameterList::RemoveParameter(ParameterKey key)
+	{
+		auto it = std::lower_bound(m_parameters.begin(), m_parameters.end(), key, KeyComparator());
+		if (it != m_parameters.end() && it->first == key)
 			m_parameters.erase(it);
-		}
 	}
 
 	/*!
 	* \brief Sets a null parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
 	*/
-	void ParameterList::SetParameter(const String& name)
+	void ParameterList::SetParameter(StringView name)
 	{
-		Parameter& parameter = CreateValue(name);
+		SetParameter(ParameterKey(name));
+	}
+
+	/*!
+	* \brief Sets a null parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	*/
+	void ParameterList::SetParameter(ParameterKey key)
+	{
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_None;
 	}
 
 	/*!
 	* \brief Sets a color parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The color value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, const Color& value)
+	{
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets a color parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The color value
 	*/
-	void ParameterList::SetParameter(const String& name, const Color& value)
+	void ParameterList::SetParameter(ParameterKey key, const Color& value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Color;
 
 		PlacementNew(&parameter.value.colorVal, value);
@@ -510,14 +720,27 @@ namespace Nz
 	/*!
 	* \brief Sets a string parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The string value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, const String& value)
+	{
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets a string parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The string value
 	*/
-	void ParameterList::SetParameter(const String& name, const String& value)
+	void ParameterList::SetParameter(ParameterKey key, const String& value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_String;
 
 		PlacementNew(&parameter.value.stringVal, value);
@@ -526,14 +749,27 @@ namespace Nz
 	/*!
 	* \brief Sets a string parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The string value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
 	*/
-	void ParameterList::SetParameter(const String& name, const char* value)
+	void ParameterList::SetParameter(StringView name, const char* value)
 	{
-		Parameter& parameter = CreateValue(name);
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets a string parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The string value
+	*/
+	void ParameterList::SetParameter(ParameterKey key, const char* value)
+	{
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_String;
 
 		PlacementNew(&parameter.value.stringVal, value);
@@ -542,14 +778,27 @@ namespace Nz
 	/*!
 	* \brief Sets a boolean parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The boolean value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, bool value)
+	{
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets a boolean parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The boolean value
 	*/
-	void ParameterList::SetParameter(const String& name, bool value)
+	void ParameterList::SetParameter(ParameterKey key, bool value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Boolean;
 		parameter.value.boolVal = value;
 	}
@@ -557,14 +806,27 @@ namespace Nz
 	/*!
 	* \brief Sets a double parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The double value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
 	*/
-	void ParameterList::SetParameter(const String& name, double value)
+	void ParameterList::SetParameter(StringView name, double value)
 	{
-		Parameter& parameter = CreateValue(name);
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets a double parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The double value
+	*/
+	void ParameterList::SetParameter(ParameterKey key, double value)
+	{
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Double;
 		parameter.value.doubleVal = value;
 	}
@@ -572,32 +834,58 @@ namespace Nz
 	/*!
 	* \brief Sets an integer parameter named `name`
 	*
-	* If a parameter already exists with that name, it is destroyed and replaced by this call
-	*
 	* \param name Name of the parameter
 	* \param value The integer value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, long long value)
+	{
+		SetParameter(ParameterKey(name), value);
+	}
+
+	/*!
+	* \brief Sets an integer parameter identified by `key`
+	*
+	* If a parameter already exists with that key, it is destroyed and replaced by this call
+	*
+	* \param key Key of the parameter
+	* \param value The integer value
 	*/
-	void ParameterList::SetParameter(const String& name, long long value)
+	void ParameterList::SetParameter(ParameterKey key, long long value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Integer;
 		parameter.value.intVal = value;
 	}
 
+	/*!
+	* \brief Sets a pointer parameter named `name`
+	*
+	* \param name Name of the parameter
+	* \param value The pointer value
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, void* value)
+	{
+		SetParameter(ParameterKey(name), value);
+	}
+
 	/*!
 	* \brief Sets a pointer parameter named `name`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The pointer value
 	*
 	* \remark This sets a raw pointer, this class takes no responsibility toward it,
 	          if you wish to destroy the pointed variable along with the parameter list, you should set a userdata
 	*/
-	void ParameterList::SetParameter(const String& name, void* value)
+	void ParameterList::SetParameter(ParameterKey key, void* value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Pointer;
 		parameter.value.ptrVal = value;
 	}
@@ -613,7 +901,7 @@ namespace Nz
 		ss << "ParameterList(";
 		for (auto it = m_parameters.cbegin(); it != m_parameters.cend();)
 		{
-			ss << it->first << ": ";
+			ss << it->first.GetName() << ": ";
 			switch (it->second.type)
 			{
 				case ParameterType_Boolean:
@@ -650,104 +938,161 @@ namespace Nz
 		return ss;
 	}
 
+	/*!
+	* \brief Sets a userdata parameter named `name`
+	*
+	* \param name Name of the parameter
+	* \param value The pointer value
+	* \param destructor The destructor function to be called upon parameter suppression
+	*
+	* \remark The name is interned first, hot code should keep a ParameterKey around and use the other overload
+	*/
+	void ParameterList::SetParameter(StringView name, void* value, Destructor destructor)
+	{
+		SetParameter(ParameterKey(name), value, destructor);
+	}
+
 	/*!
 	* \brief Sets a userdata parameter named `name`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The pointer value
 	* \param destructor The destructor function to be called upon parameter suppression
 	*
 	* \remark The destructor is called once when all copies of the userdata are destroyed, which means
 	          you can safely copy the parameter list around.
 	*/
-	void ParameterList::SetParameter(const String& name, void* value, Destructor destructor)
+	void ParameterList::SetParameter(ParameterKey key, void* value, Destructor destructor)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType_Userdata;
 		parameter.value.userdataVal = new Parameter::UserdataValue(destructor, value);
 	}
 
 	/*!
-	* \brief Copies the content of the other parameter list to this
-	* \return A reference to this
+	* \brief Create an uninitialized value for a key
+	*
+	* \param key Key of the parameter
 	*
-	* \param list List to assign
+	* \remark The previous value if any gets destroyed
 	*/
-	ParameterList& ParameterList::operator=(const ParameterList& list)
+	ParameterList::Parameter& ParameterList::CreateValue(ParameterKey key)
 	{
-		Clear();
-
-		for (auto it = list.m_parameters.begin(); it != list.m_parameters.end(); ++it)
-		{
-			Parameter& parameter = m_parameters[it->first];
-
-			switch (it->second.type)
-			{
-				case ParameterType_Boolean:
-				case ParameterType_Color:
-				case ParameterType_Double:
-				case ParameterType_Integer:
-				case ParameterType_Pointer:
-					std::memcpy(&parameter, &it->second, sizeof(Parameter));
-					break;
+		NazaraAssert(key.IsValid(), "Invalid key");
 
-				case ParameterType_String:
-					parameter.type = ParameterType_String;
-
-					PlacementNew(&parameter.value.stringVal, it->second.value.stringVal);
-					break;
+		auto it = std::lower_bound(m_parameters.begin(), m_parameters.end(), key, KeyComparator());
+		if (it != m_parameters.end() && it->first == key)
+			it->second.Destroy();
+		else
+			it = m_parameters.emplace(it, key, Parameter());
 
-				case ParameterType_Userdata:
-					parameter.type = ParameterType_Userdata;
-					parameter.value.userdataVal = it->second.value.userdataVal;
-					++(parameter.value.userdataVal->counter);
-					break;
+		return it->second;
+	}
 
-				case ParameterType_None:
-					parameter.type = ParameterType_None;
-					break;
-			}
-		}
+	/*!
+	* \brief Finds the parameter identified by a key
+	* \return Pointer to the parameter, or nullptr if the list does not contain it
+	*
+	* \param key Key of the parameter
+	*/
+	const ParameterList::Parameter* ParameterList::FindParameter(ParameterKey key) const
+	{
+		auto it = std::lower_bound(m_parameters.begin(), m_parameters.end(), key, KeyComparator());
+		if (it == m_parameters.end() || it->first != key)
+			return nullptr;
 
-		return *this;
+		return &it->second;
 	}
 
 	/*!
-	* \brief Create an uninitialized value of a set name
+	* \brief Constructs a Parameter object by copy
 	*
-	* \param name Name of the parameter
+	* \param parameter Parameter to copy
 	*
-	* \remark The previous value if any gets destroyed
+	* \remark Userdata are shared between copies
 	*/
-	ParameterList::Parameter& ParameterList::CreateValue(const String& name)
+	ParameterList::Parameter::Parameter(const Parameter& parameter) :
+	type(parameter.type)
 	{
-		std::pair<ParameterMap::iterator, bool> pair = m_parameters.insert(std::make_pair(name, Parameter()));
-		Parameter& parameter = pair.first->second;
+		switch (type)
+		{
+			case ParameterType_Boolean:
+			case ParameterType_Color:
+			case ParameterType_Double:
+			case ParameterType_Integer:
+			case ParameterType_Pointer:
+				std::memcpy(&value, &parameter.value, sizeof(Value));
+				break;
 
-		if (!pair.second)
-			DestroyValue(parameter);
+			case ParameterType_String:
+				PlacementNew(&value.stringVal, parameter.value.stringVal);
+				break;
 
-		return parameter;
+			case ParameterType_Userdata:
+				value.userdataVal = parameter.value.userdataVal;
+				++(value.userdataVal->counter);
+				break;
+
+			case ParameterType_None:
+				break;
+		}
 	}
 
 	/*!
-	* \brief Destroys the value for the parameter
+	* \brief Constructs a Parameter object by move semantic
 	*
-	* \param parameter Parameter to destroy
+	* \param parameter Parameter to move, left with no value
 	*/
-	void ParameterList::DestroyValue(Parameter& parameter)
+	ParameterList::Parameter::Parameter(Parameter&& parameter) noexcept :
+	type(parameter.type)
 	{
-		switch (parameter.type)
+		switch (type)
 		{
+			case ParameterType_Boolean:
+			case ParameterType_Color:
+			case ParameterType_Double:
+			case ParameterType_Integer:
+			case ParameterType_Pointer:
+			case ParameterType_Userdata:
+				std::memcpy(&value, &parameter.value, sizeof(Value));
+				break;
+
 			case ParameterType_String:
+				PlacementNew(&value.stringVal, std::move(parameter.value.stringVal));
 				parameter.value.stringVal.~String();
 				break;
 
+			case ParameterType_None:
+				break;
+		}
+
+		parameter.type = ParameterType_None;
+	}
+
+	/*!
+	* \brief Destructs the object and its value
+	*/
+	ParameterList::Parameter::~Parameter()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Destroys the value of the parameter, leaving it with no value
+	*/
+	void ParameterList::Parameter::Destroy()
+	{
+		switch (type)
+		{
+			case ParameterType_String:
+				value.stringVal.~String();
+				break;
+
 			case ParameterType_Userdata:
 				{
-					Parameter::UserdataValue* userdata = parameter.value.userdataVal;
+					UserdataValue* userdata = value.userdataVal;
 					if (--userdata->counter == 0)
 					{
 						userdata->destructor(userdata->ptr);
@@ -764,6 +1109,42 @@ namespace Nz
 			case ParameterType_Pointer:
 				break;
 		}
+
+		type = ParameterType_None;
+	}
+
+	/*!
+	* \brief Copies the content of another parameter
+	* \return A reference to this
+	*
+	* \param parameter Parameter to copy
+	*/
+	ParameterList::Parameter& ParameterList::Parameter::operator=(const Parameter& parameter)
+	{
+		if (this != &parameter)
+		{
+			Destroy();
+			PlacementNew(this, parameter);
+		}
+
+		return *this;
+	}
+
+	/*!
+	* \brief Moves the content of another parameter
+	* \return A reference to this
+	*
+	* \param parameter Parameter to move, left with no value
+	*/
+	ParameterList::Parameter& ParameterList::Parameter::operator=(Parameter&& parameter) noexcept
+	{
+		if (this != &parameter)
+		{
+			Destroy();
+			PlacementNew(this, std::move(parameter));
+		}
+
+		return *this;
 	}
 }
 
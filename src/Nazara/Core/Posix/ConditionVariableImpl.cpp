@@ -43,7 +43,7 @@ namespace Nz
 
 		// construct the time limit (current time + time to wait)
 		timespec ti;
-		ti.tv_nsec = (tv.tv_usec + (timeout % 1000)) * 1000000;
+		ti.tv_nsec = tv.tv_usec * 1000 + (timeout % 1000) * 1000000;
 		ti.tv_sec = tv.tv_sec + (timeout / 1000) + (ti.tv_nsec / 1000000000);
 		ti.tv_nsec %= 1000000000;
 
@@ -75,4 +75,17 @@ namespace Nz
 		#endif
 	#endif
 	}
+
+	UInt64 HardwareInfoImpl::Xgetbv(UInt32 registerId)
+	{
+	#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
+		UInt32 eax, edx;
+		asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(registerId));
+
+		return (static_cast<UInt64>(edx) << 32) | eax;
+	#else
+		NazaraInternalError("Xgetbv has been called although it is not supported");
+		return 0;
+	#endif
+	}
 }
@@ -0,0 +1,140 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_ptr(nullptr),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		Unmap();
+	}
+
+	bool MappedFileImpl::Advise(MemoryAccessHint hint, UInt64 offset, UInt64 size)
+	{
+		if (!m_ptr)
+			return true;
+
+		int advice;
+		switch (hint)
+		{
+			case MemoryAccessHint_DontNeed:
+				advice = MADV_DONTNEED;
+				break;
+
+			case MemoryAccessHint_Normal:
+				advice = MADV_NORMAL;
+				break;
+
+			case MemoryAccessHint_Random:
+				advice = MADV_RANDOM;
+				break;
+
+			case MemoryAccessHint_Sequential:
+				advice = MADV_SEQUENTIAL;
+				break;
+
+			case MemoryAccessHint_WillNeed:
+				advice = MADV_WILLNEED;
+				break;
+
+			default:
+				NazaraError("Memory access hint 0x" + String::Number(hint, 16) + " is not handled");
+				return false;
+		}
+
+		// madvise requires a page-aligned address
+		UInt64 pageSize = static_cast<UInt64>(sysconf(_SC_PAGESIZE));
+		UInt64 alignedOffset = offset - offset % pageSize;
+
+		if (madvise(m_ptr + alignedOffset, static_cast<std::size_t>(size + offset - alignedOffset), advice) == -1)
+		{
+			NazaraError("Failed to advise kernel: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MappedFileImpl::Map(const String& filePath, MappedFileMode mode)
+	{
+		int fileDescriptor = open64(filePath.GetConstBuffer(), O_RDONLY);
+		if (fileDescriptor == -1)
+		{
+			NazaraError("Failed to open \"" + filePath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		struct stat64 fileStats;
+		if (fstat64(fileDescriptor, &fileStats) == -1)
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\": " + Error::GetLastSystemError());
+			close(fileDescriptor);
+			return false;
+		}
+
+		UInt64 size = static_cast<UInt64>(fileStats.st_size);
+		if (size > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("\"" + filePath + "\" is too big to be mapped");
+			close(fileDescriptor);
+			return false;
+		}
+
+		// Empty files cannot be mapped, but are still valid
+		if (size > 0)
+		{
+			int protection = PROT_READ;
+			int flags;
+			if (mode == MappedFileMode_CopyOnWrite)
+			{
+				protection |= PROT_WRITE;
+				flags = MAP_PRIVATE;
+			}
+			else
+				flags = MAP_SHARED;
+
+			void* ptr = mmap(nullptr, static_cast<std::size_t>(size), protection, flags, fileDescriptor, 0);
+			if (ptr == MAP_FAILED)
+			{
+				NazaraError("Failed to map \"" + filePath + "\": " + Error::GetLastSystemError());
+				close(fileDescriptor);
+				return false;
+			}
+
+			m_ptr = static_cast<UInt8*>(ptr);
+		}
+
+		// The mapping keeps a reference to the file
+		close(fileDescriptor);
+
+		m_size = size;
+		return true;
+	}
+
+	void MappedFileImpl::Unmap()
+	{
+		if (m_ptr)
+		{
+			munmap(m_ptr, static_cast<std::size_t>(m_size));
+			m_ptr = nullptr;
+		}
+
+		m_size = 0;
+	}
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILEIMPL_HPP
+#define NAZARA_MAPPEDFILEIMPL_HPP
+
+#ifndef _LARGEFILE64_SOURCE
+#define _LARGEFILE64_SOURCE
+#endif
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
+
+namespace Nz
+{
+	class String;
+
+	class MappedFileImpl
+	{
+		public:
+			MappedFileImpl();
+			MappedFileImpl(const MappedFileImpl&) = delete;
+			MappedFileImpl(MappedFileImpl&&) = delete;
+			~MappedFileImpl();
+
+			bool Advise(MemoryAccessHint hint, UInt64 offset, UInt64 size);
+
+			inline UInt8* GetPointer() const;
+			inline UInt64 GetSize() const;
+
+			bool Map(const String& filePath, MappedFileMode mode);
+			void Unmap();
+
+			MappedFileImpl& operator=(const MappedFileImpl&) = delete;
+			MappedFileImpl& operator=(MappedFileImpl&&) = delete;
+
+		private:
+			UInt8* m_ptr;
+			UInt64 m_size;
+	};
+
+	inline UInt8* MappedFileImpl::GetPointer() const
+	{
+		return m_ptr;
+	}
+
+	inline UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+}
+
+#endif // NAZARA_MAPPEDFILEIMPL_HPP
@@ -0,0 +1,474 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		enum class ProfilerEventType : UInt8
+		{
+			BeginZone,
+			Counter,
+			EndZone,
+			Frame
+		};
+
+		struct ProfilerEvent
+		{
+			const char* name;
+			double value;
+			UInt64 timestamp; //< In nanoseconds
+			ProfilerEventType type;
+		};
+
+		constexpr std::size_t EventsPerChunk = 1024;
+
+		// Events are only written by the thread owning the chunk, and published to readers through the count
+		struct EventChunk
+		{
+			std::array<ProfilerEvent, EventsPerChunk> events;
+			std::atomic<UInt32> count;
+			std::atomic<EventChunk*> next;
+		};
+
+		struct ThreadBuffer
+		{
+			std::atomic<EventChunk*> head;
+			EventChunk* tail; //< Only accessed by the owning thread (and Clear)
+			String name;
+			UInt32 threadId;
+		};
+
+		struct ProfilerData
+		{
+			ProfilerData() :
+			originTimestamp(0)
+			{
+			}
+
+			~ProfilerData()
+			{
+				for (auto& buffer : threadBuffers)
+					FreeChunks(buffer->head.load(std::memory_order_relaxed));
+			}
+
+			static void FreeChunks(EventChunk* chunk)
+			{
+				while (chunk)
+				{
+					EventChunk* next = chunk->next.load(std::memory_order_relaxed);
+					delete chunk;
+					chunk = next;
+				}
+			}
+
+			Mutex mutex;
+			std::atomic<UInt64> originTimestamp;
+			std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers; //< Never shrinks, as threads keep a pointer to their buffer
+		};
+
+		thread_local ThreadBuffer* t_threadBuffer = nullptr;
+		thread_local String t_threadName; //< Kept until the thread records its first event, as threads which never do have no buffer
+
+		ProfilerData& GetProfilerData()
+		{
+			static ProfilerData data;
+			return data;
+		}
+
+		UInt64 GetTimestamp()
+		{
+			return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!t_threadBuffer)
+			{
+				ProfilerData& data = GetProfilerData();
+
+				LockGuard lock(data.mutex);
+
+				std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+				buffer->head.store(nullptr, std::memory_order_relaxed);
+				buffer->tail = nullptr;
+				buffer->name = t_threadName;
+				buffer->threadId = static_cast<UInt32>(data.threadBuffers.size());
+
+				t_threadBuffer = buffer.get();
+				data.threadBuffers.emplace_back(std::move(buffer));
+			}
+
+			return *t_threadBuffer;
+		}
+
+		void RecordEvent(ProfilerEventType type, const char* name, double value)
+		{
+			UInt64 timestamp = GetTimestamp();
+
+			ThreadBuffer& buffer = GetThreadBuffer();
+
+			EventChunk* chunk = buffer.tail;
+			UInt32 index = (chunk) ? chunk->count.load(std::memory_order_relaxed) : EventsPerChunk;
+			if (index == EventsPerChunk)
+			{
+				EventChunk* newChunk = new EventChunk;
+				newChunk->count.store(0, std::memory_order_relaxed);
+				newChunk->next.store(nullptr, std::memory_order_relaxed);
+
+				if (chunk)
+					chunk->next.store(newChunk, std::memory_order_release);
+				else
+					buffer.head.store(newChunk, std::memory_order_release);
+
+				buffer.tail = newChunk;
+
+				chunk = newChunk;
+				index = 0;
+			}
+
+			ProfilerEvent& event = chunk->events[index];
+			event.name = name;
+			event.timestamp = timestamp;
+			event.type = type;
+			event.value = value;
+
+			chunk->count.store(index + 1, std::memory_order_release);
+		}
+
+		class TraceWriter
+		{
+			public:
+				TraceWriter(Stream& stream) :
+				m_stream(stream),
+				m_first(true)
+				{
+					m_buffer.reserve(FlushSize + 512);
+				}
+
+				~TraceWriter()
+				{
+					Flush();
+				}
+
+				void Append(const char* str)
+				{
+					m_buffer += str;
+				}
+
+				template<typename... Args> void AppendFormat(const char* format, Args... args)
+				{
+					char buffer[128];
+					int length = std::snprintf(buffer, sizeof(buffer), format, args...);
+					m_buffer.append(buffer, std::min<std::size_t>(length, sizeof(buffer) - 1));
+				}
+
+				void AppendString(const char* str)
+				{
+					m_buffer += '"';
+					for (; *str; ++str)
+					{
+						char c = *str;
+						if (c == '"' || c == '\\')
+						{
+							m_buffer += '\\';
+							m_buffer += c;
+						}
+						else if (static_cast<unsigned char>(c) < 0x20)
+							AppendFormat("\\u%04x", static_cast<unsigned int>(c));
+						else
+							m_buffer += c;
+					}
+					m_buffer += '"';
+				}
+
+				void BeginEvent(const char* name, const char* phase, UInt32 threadId)
+				{
+					Append((m_first) ? "\n\t\t{" : ",\n\t\t{");
+					m_first = false;
+
+					if (name)
+					{
+						Append("\"name\": ");
+						AppendString(name);
+						Append(", ");
+					}
+
+					AppendFormat("\"ph\": \"%s\", \"pid\": 0, \"tid\": %u", phase, static_cast<unsigned int>(threadId));
+				}
+
+				void EndEvent()
+				{
+					m_buffer += '}';
+
+					if (m_buffer.size() >= FlushSize)
+						Flush();
+				}
+
+				void Flush()
+				{
+					if (!m_buffer.empty())
+					{
+						m_stream.Write(m_buffer.data(), m_buffer.size());
+						m_buffer.clear();
+					}
+				}
+
+			private:
+				static constexpr std::size_t FlushSize = 64 * 1024;
+
+				std::string m_buffer;
+				Stream& m_stream;
+				bool m_first;
+		};
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Profiler
+	* \brief Core class that records hierarchical CPU zones, counters and frame markers from every thread
+	*
+	* Each thread records its events in its own buffer, without locking, and the whole capture can be exported as a Chrome trace (readable by chrome://tracing and Perfetto).
+	* Engine code is instrumented with the NazaraProfileZone, NazaraProfileCounter and NazaraProfileFrame macros, which are compiled out when NAZARA_CORE_ENABLE_PROFILER is 0 and only cost a test when the profiler is disabled.
+	*
+	* \remark Event names are stored by pointer and must outlive the profiler data, string literals are advised
+	*/
+
+	/*!
+	* \brief Begins a zone on the calling thread
+	*
+	* \param name Name of the zone
+	*
+	* \remark The zone is recorded even if the profiler is disabled, use ProfilerZone or NazaraProfileZone to take that into account
+	*
+	* \see EndZone
+	*/
+	void Profiler::BeginZone(const char* name)
+	{
+		RecordEvent(ProfilerEventType::BeginZone, name, 0.0);
+	}
+
+	/*!
+	* \brief Clears every recorded event
+	*
+	* \remark No thread may record events while the profiler is being cleared
+	*/
+	void Profiler::Clear()
+	{
+		ProfilerData& data = GetProfilerData();
+
+		LockGuard lock(data.mutex);
+
+		for (auto& buffer : data.threadBuffers)
+		{
+			EventChunk* head = buffer->head.load(std::memory_order_relaxed);
+			if (!head)
+				continue;
+
+			ProfilerData::FreeChunks(head->next.load(std::memory_order_relaxed));
+
+			head->count.store(0, std::memory_order_relaxed);
+			head->next.store(nullptr, std::memory_order_relaxed);
+			buffer->tail = head;
+		}
+
+		data.originTimestamp.store(GetTimestamp(), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Enables or disables the profiler
+	*
+	* \param enable Should the profiler record events
+	*
+	* \remark Disabling the profiler keeps the recorded events, call Clear to remove them
+	*/
+	void Profiler::Enable(bool enable)
+	{
+		if (enable)
+		{
+			UInt64 expected = 0;
+			GetProfilerData().originTimestamp.compare_exchange_strong(expected, GetTimestamp());
+		}
+
+		s_enabled.store(enable, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Ends the last zone begun on the calling thread
+	*
+	* \see BeginZone
+	*/
+	void Profiler::EndZone()
+	{
+		RecordEvent(ProfilerEventType::EndZone, nullptr, 0.0);
+	}
+
+	/*!
+	* \brief Exports the recorded events to a file, in the Chrome trace format
+	* \return true If the file has been written
+	*
+	* \param filePath Path of the file to write, usually with a .json extension
+	*
+	* \see WriteChromeTrace
+	*/
+	bool Profiler::ExportChromeTrace(const String& filePath)
+	{
+		File file(filePath);
+		if (!file.Open(OpenMode_WriteOnly | OpenMode_Truncate))
+		{
+			NazaraError("Failed to open \"" + filePath + '"');
+			return false;
+		}
+
+		WriteChromeTrace(file);
+		return true;
+	}
+
+	/*!
+	* \brief Gets the number of events recorded by every thread
+	* \return Number of events
+	*/
+	std::size_t Profiler::GetEventCount()
+	{
+		ProfilerData& data = GetProfilerData();
+
+		LockGuard lock(data.mutex);
+
+		std::size_t eventCount = 0;
+		for (auto& buffer : data.threadBuffers)
+		{
+			for (EventChunk* chunk = buffer->head.load(std::memory_order_acquire); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+				eventCount += chunk->count.load(std::memory_order_acquire);
+		}
+
+		return eventCount;
+	}
+
+	/*!
+	* \brief Marks the end of a frame
+	*
+	* \param name Name of the marker, frames of different loops should use different names
+	*/
+	void Profiler::MarkFrame(const char* name)
+	{
+		RecordEvent(ProfilerEventType::Frame, name, 0.0);
+	}
+
+	/*!
+	* \brief Records the value of a counter at the current time
+	*
+	* \param name Name of the counter
+	* \param value Value of the counter
+	*/
+	void Profiler::RecordCounter(const char* name, double value)
+	{
+		RecordEvent(ProfilerEventType::Counter, name, value);
+	}
+
+	/*!
+	* \brief Sets the name of the calling thread, as displayed in exported traces
+	*
+	* \param name Name of the thread
+	*
+	* \remark Thread::SetCurrentThreadName already calls this function
+	* \remark This does not allocate the thread buffer, which is only created when the thread records its first event
+	*/
+	void Profiler::SetThreadName(const String& name)
+	{
+		t_threadName = name;
+
+		if (t_threadBuffer)
+		{
+			LockGuard lock(GetProfilerData().mutex);
+			t_threadBuffer->name = name;
+		}
+	}
+
+	/*!
+	* \brief Writes the recorded events to a stream, in the Chrome trace format
+	*
+	* \param stream Stream to write the JSON document to
+	*
+	* Zones are written as begin/end pairs, counters as counter events and frame markers as global instant events, with timestamps in microseconds since the profiler was enabled (or cleared).
+	* Threads may keep recording while the trace is written, only events recorded before the call are exported.
+	*/
+	void Profiler::WriteChromeTrace(Stream& stream)
+	{
+		ProfilerData& data = GetProfilerData();
+
+		LockGuard lock(data.mutex);
+
+		UInt64 originTimestamp = data.originTimestamp.load(std::memory_order_relaxed);
+
+		TraceWriter writer(stream);
+		writer.Append("{\n\t\"displayTimeUnit\": \"ns\",\n\t\"traceEvents\": [");
+
+		for (auto& buffer : data.threadBuffers)
+		{
+			if (!buffer->name.IsEmpty())
+			{
+				writer.BeginEvent("thread_name", "M", buffer->threadId);
+				writer.Append(", \"args\": {\"name\": ");
+				writer.AppendString(buffer->name.GetConstBuffer());
+				writer.Append("}");
+				writer.EndEvent();
+			}
+
+			for (EventChunk* chunk = buffer->head.load(std::memory_order_acquire); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+			{
+				UInt32 eventCount = chunk->count.load(std::memory_order_acquire);
+				for (UInt32 i = 0; i < eventCount; ++i)
+				{
+					const ProfilerEvent& event = chunk->events[i];
+					double timestamp = static_cast<Int64>(event.timestamp - originTimestamp) / 1000.0;
+
+					switch (event.type)
+					{
+						case ProfilerEventType::BeginZone:
+							writer.BeginEvent(event.name, "B", buffer->threadId);
+							writer.AppendFormat(", \"ts\": %.3f", timestamp);
+							break;
+
+						case ProfilerEventType::Counter:
+							writer.BeginEvent(event.name, "C", buffer->threadId);
+							writer.AppendFormat(", \"ts\": %.3f, \"args\": {\"value\": %.17g}", timestamp, event.value);
+							break;
+
+						case ProfilerEventType::EndZone:
+							writer.BeginEvent(nullptr, "E", buffer->threadId);
+							writer.AppendFormat(", \"ts\": %.3f", timestamp);
+							break;
+
+						case ProfilerEventType::Frame:
+							writer.BeginEvent(event.name, "i", buffer->threadId);
+							writer.AppendFormat(", \"s\": \"g\", \"ts\": %.3f", timestamp);
+							break;
+					}
+
+					writer.EndEvent();
+				}
+			}
+		}
+
+		writer.Append("\n\t]\n}\n");
+	}
+
+	std::atomic_bool Profiler::s_enabled(false);
+}
@@ -0,0 +1,360 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SmallObjectAllocator.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <Nazara/Core/ThreadCachePool.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t s_blockSizes[SmallObjectAllocator::SizeClassCount] = {
+			16, 32, 48, 64, 80, 96, 112, 128, // 16 bytes steps
+			160, 192, 224, 256,               // 32 bytes steps
+			320, 384, 448, 512                // 64 bytes steps
+		};
+
+		static_assert(s_blockSizes[SmallObjectAllocator::SizeClassCount - 1] == SmallObjectAllocator::MaxSmallSize, "Size classes don't match MaxSmallSize");
+
+		// Free blocks are linked together, and batches of free blocks are linked together through their first block
+		struct FreeBlock
+		{
+			FreeBlock* next;
+			FreeBlock* nextBatch;
+		};
+
+		struct ClassCounters
+		{
+			std::atomic<UInt64> allocationCount;
+			std::atomic<UInt64> cacheHitCount;
+			std::atomic<UInt64> freeCount;
+		};
+
+		// Counters are only written by their owner thread, atomics are only there to allow GetStats to read them
+		struct AllocationCounters
+		{
+			ClassCounters classes[SmallObjectAllocator::SizeClassCount];
+			std::atomic<UInt64> largeAllocationCount;
+			std::atomic<UInt64> largeBytesAllocated;
+			std::atomic<UInt64> largeBytesFreed;
+		};
+
+		struct FreeList
+		{
+			FreeBlock* head;
+			std::size_t count;
+		};
+
+		struct BlockCache
+		{
+			FreeList freeLists[SmallObjectAllocator::SizeClassCount];
+		};
+
+		struct BlockPoolTraits
+		{
+			using Batch = FreeBlock;
+			using Counters = AllocationCounters;
+			using ThreadCache = BlockCache;
+
+			static constexpr std::size_t ClassCount = SmallObjectAllocator::SizeClassCount;
+
+			static void FlushThreadCache(BlockCache& cache);
+			static void MergeCounters(AllocationCounters& target, const AllocationCounters& source);
+			static FreeBlock*& NextBatch(FreeBlock* batch) { return batch->nextBatch; }
+		};
+
+		using BlockPool = ThreadCachePool<BlockPoolTraits>;
+
+		std::atomic<UInt64> s_bytesReserved(0);
+
+		constexpr std::size_t ComputeBatchSize(std::size_t blockSize)
+		{
+			return (4096 / blockSize > 16) ? 4096 / blockSize : 16; // Batches of about 4KiB, with at least 16 blocks
+		}
+
+		constexpr std::size_t s_batchSizes[SmallObjectAllocator::SizeClassCount] = {
+			ComputeBatchSize(16), ComputeBatchSize(32), ComputeBatchSize(48), ComputeBatchSize(64),
+			ComputeBatchSize(80), ComputeBatchSize(96), ComputeBatchSize(112), ComputeBatchSize(128),
+			ComputeBatchSize(160), ComputeBatchSize(192), ComputeBatchSize(224), ComputeBatchSize(256),
+			ComputeBatchSize(320), ComputeBatchSize(384), ComputeBatchSize(448), ComputeBatchSize(512)
+		};
+
+		inline std::size_t GetSizeClass(std::size_t size)
+		{
+			if (size <= 128)
+				return (size > 0) ? (size - 1) / 16 : 0;
+			else if (size <= 256)
+				return 8 + (size - 129) / 32;
+			else
+				return 12 + (size - 257) / 64;
+		}
+
+		FreeBlock* AllocateBatch(std::size_t sizeClass)
+		{
+			// No free block left, allocate a new batch (memory is never given back to the system, but reused by all threads)
+			std::size_t blockSize = s_blockSizes[sizeClass];
+			std::size_t batchSize = s_batchSizes[sizeClass];
+
+			UInt8* chunk = static_cast<UInt8*>(std::malloc(blockSize * batchSize));
+			if (!chunk)
+				throw std::bad_alloc();
+
+			s_bytesReserved += blockSize * batchSize;
+
+			for (std::size_t i = 0; i < batchSize; ++i)
+				reinterpret_cast<FreeBlock*>(&chunk[i * blockSize])->next = (i < batchSize - 1) ? reinterpret_cast<FreeBlock*>(&chunk[(i + 1) * blockSize]) : nullptr;
+
+			return reinterpret_cast<FreeBlock*>(chunk);
+		}
+
+		void BlockPoolTraits::FlushThreadCache(BlockCache& cache)
+		{
+			for (std::size_t i = 0; i < SmallObjectAllocator::SizeClassCount; ++i)
+			{
+				FreeList& freeList = cache.freeLists[i];
+				if (freeList.head)
+					BlockPool::PushBatch(i, freeList.head);
+
+				freeList.head = nullptr;
+				freeList.count = 0;
+			}
+		}
+
+		void BlockPoolTraits::MergeCounters(AllocationCounters& target, const AllocationCounters& source)
+		{
+			for (std::size_t i = 0; i < SmallObjectAllocator::SizeClassCount; ++i)
+			{
+				target.classes[i].allocationCount += source.classes[i].allocationCount.load(std::memory_order_relaxed);
+				target.classes[i].cacheHitCount += source.classes[i].cacheHitCount.load(std::memory_order_relaxed);
+				target.classes[i].freeCount += source.classes[i].freeCount.load(std::memory_order_relaxed);
+			}
+
+			target.largeAllocationCount += source.largeAllocationCount.load(std::memory_order_relaxed);
+			target.largeBytesAllocated += source.largeBytesAllocated.load(std::memory_order_relaxed);
+			target.largeBytesFreed += source.largeBytesFreed.load(std::memory_order_relaxed);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::SmallObjectAllocator
+	* \brief Core class that represents a general-purpose allocator for small objects
+	*
+	* Allocations are rounded up to one of the size classes (up to MaxSmallSize bytes) and served from a free list of the calling thread,
+	* without any lock or atomic read-modify-write operation.
+	* Blocks can be freed by any thread: they go to the free list of the freeing thread, which gives its surplus back to the other threads
+	* by batches, through a lock-free stack per size class (see ThreadCachePool).
+	*
+	* Allocations bigger than MaxSmallSize are forwarded to operator new.
+	*
+	* \remark Memory reserved for small objects is never given back to the system, but reused by every thread
+	*
+	* \see SmallObjectStlAllocator
+	*/
+
+	/*!
+	* \brief Allocates memory
+	* \return Pointer to memory aligned to alignof(std::max_align_t)
+	*
+	* \param size Size of the memory to allocate
+	*
+	* \remark Memory must be freed with Free, using the same size
+	*/
+
+	void* SmallObjectAllocator::Allocate(std::size_t size)
+	{
+		BlockPool::ThreadData* threadData = BlockPool::GetThreadData();
+
+		if (size > MaxSmallSize)
+		{
+			if (threadData)
+			{
+				BlockPool::IncreaseCounter(threadData->counters.largeAllocationCount);
+				BlockPool::IncreaseCounter(threadData->counters.largeBytesAllocated, size);
+			}
+			else
+			{
+				BlockPool::UpdateRetiredCounters([size](AllocationCounters& counters)
+				{
+					counters.largeAllocationCount++;
+					counters.largeBytesAllocated += size;
+				});
+			}
+
+			return OperatorNew(size);
+		}
+
+		std::size_t sizeClass = GetSizeClass(size);
+
+		if (!threadData)
+		{
+			// Take a block from a shared batch and give the others back (this only happens while the thread exits)
+			FreeBlock* batch = BlockPool::PopBatch(sizeClass, nullptr);
+			if (!batch)
+				batch = AllocateBatch(sizeClass);
+
+			if (batch->next)
+				BlockPool::PushBatch(sizeClass, batch->next);
+
+			BlockPool::UpdateRetiredCounters([sizeClass](AllocationCounters& counters)
+			{
+				counters.classes[sizeClass].allocationCount++;
+			});
+
+			return batch;
+		}
+
+		FreeList& freeList = threadData->cache.freeLists[sizeClass];
+		ClassCounters& counters = threadData->counters.classes[sizeClass];
+
+		BlockPool::IncreaseCounter(counters.allocationCount);
+
+		if (freeList.head)
+			BlockPool::IncreaseCounter(counters.cacheHitCount);
+		else
+		{
+			freeList.head = BlockPool::PopBatch(sizeClass, threadData);
+			if (!freeList.head)
+				freeList.head = AllocateBatch(sizeClass);
+
+			// Batches given back by exiting threads may have any size
+			freeList.count = 0;
+			for (FreeBlock* block = freeList.head; block; block = block->next)
+				freeList.count++;
+		}
+
+		FreeBlock* block = freeList.head;
+		freeList.head = block->next;
+		freeList.count--;
+
+		return block;
+	}
+
+	/*!
+	* \brief Frees memory allocated by Allocate
+	*
+	* \param ptr Pointer returned by Allocate
+	* \param size Size given to Allocate
+	*
+	* \remark If ptr is null, nothing is done
+	* \remark Memory can be freed from any thread
+	*/
+
+	void SmallObjectAllocator::Free(void* ptr, std::size_t size)
+	{
+		if (!ptr)
+			return;
+
+		BlockPool::ThreadData* threadData = BlockPool::GetThreadData();
+
+		if (size > MaxSmallSize)
+		{
+			if (threadData)
+				BlockPool::IncreaseCounter(threadData->counters.largeBytesFreed, size);
+			else
+			{
+				BlockPool::UpdateRetiredCounters([size](AllocationCounters& counters)
+				{
+					counters.largeBytesFreed += size;
+				});
+			}
+
+			OperatorDelete(ptr);
+			return;
+		}
+
+		std::size_t sizeClass = GetSizeClass(size);
+
+		FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+		if (!threadData)
+		{
+			block->next = nullptr;
+			BlockPool::PushBatch(sizeClass, block);
+
+			BlockPool::UpdateRetiredCounters([sizeClass](AllocationCounters& counters)
+			{
+				counters.classes[sizeClass].freeCount++;
+			});
+			return;
+		}
+
+		FreeList& freeList = threadData->cache.freeLists[sizeClass];
+
+		BlockPool::IncreaseCounter(threadData->counters.classes[sizeClass].freeCount);
+
+		block->next = freeList.head;
+		freeList.head = block;
+		freeList.count++;
+
+		// This thread frees more than it allocates (typically a consumer thread), give a batch to the others
+		std::size_t batchSize = s_batchSizes[sizeClass];
+		if (freeList.count >= batchSize * 2)
+		{
+			FreeBlock* lastBlock = freeList.head;
+			for (std::size_t i = 1; i < batchSize; ++i)
+				lastBlock = lastBlock->next;
+
+			FreeBlock* batch = freeList.head;
+			freeList.head = lastBlock->next;
+			freeList.count -= batchSize;
+			lastBlock->next = nullptr;
+
+			BlockPool::PushBatch(sizeClass, batch);
+		}
+	}
+
+	/*!
+	* \brief Gets the size of the block which would be used for an allocation
+	* \return Size of the block, which is size itself if it's too big for the size classes
+	*
+	* \param size Size of the allocation
+	*/
+
+	std::size_t SmallObjectAllocator::GetBlockSize(std::size_t size)
+	{
+		return (size <= MaxSmallSize) ? s_blockSizes[GetSizeClass(size)] : size;
+	}
+
+	/*!
+	* \brief Gets statistics about the allocator, summed over all threads
+	* \return Allocator statistics
+	*
+	* \remark Counters of other threads are read without stopping them, values are only consistent if no other thread is allocating
+	*/
+
+	SmallObjectAllocator::Stats SmallObjectAllocator::GetStats()
+	{
+		AllocationCounters counters = {};
+		BlockPool::AccumulateCounters(counters);
+
+		Stats stats;
+		stats.bytesReserved = s_bytesReserved.load();
+		stats.largeAllocationCount = counters.largeAllocationCount;
+
+		UInt64 largeBytesAllocated = counters.largeBytesAllocated;
+		UInt64 largeBytesFreed = counters.largeBytesFreed;
+		stats.bytesInUse = (largeBytesAllocated > largeBytesFreed) ? largeBytesAllocated - largeBytesFreed : 0;
+
+		for (std::size_t i = 0; i < SizeClassCount; ++i)
+		{
+			SizeClassStats& classStats = stats.sizeClasses[i];
+			classStats.allocationCount = counters.classes[i].allocationCount;
+			classStats.blockSize = s_blockSizes[i];
+			classStats.cacheHitCount = counters.classes[i].cacheHitCount;
+
+			UInt64 freeCount = counters.classes[i].freeCount;
+			classStats.blocksInUse = (classStats.allocationCount > freeCount) ? classStats.allocationCount - freeCount : 0;
+
+			stats.bytesInUse += classStats.blocksInUse * classStats.blockSize;
+		}
+
+		return stats;
+	}
+}
@@ -33,6 +33,18 @@ namespace Nz
 		return String();
 	}
 
+	/*!
+	* \brief Gets a direct view of the stream content
+	* \return Pointer to the beginning of the stream if its whole content is available in memory (GetSize() bytes can be read from it), nullptr otherwise
+	*
+	* \remark The pointer is invalidated by any operation modifying the stream
+	*/
+
+	const UInt8* Stream::GetMemoryView() const
+	{
+		return nullptr;
+	}
+
 	/*!
 	* \brief Gets the path of the stream
 	* \return Empty string (meant to be virtual)
@@ -59,8 +71,27 @@ namespace Nz
 	*/
 	String Stream::ReadLine(unsigned int lineSize)
 	{
+		NazaraAssert(IsReadable(), "Stream is not readable");
+
 		String line;
-		if (lineSize == 0) // Maximal size undefined
+		if (lineSize == 0 && GetMemoryView()) // Memory streams can look for the separator in place
+		{
+			UInt64 cursorPos = GetCursorPos();
+			std::size_t remainingSize = static_cast<std::size_t>(GetSize() - cursorPos);
+			const char* begin = reinterpret_cast<const char*>(GetMemoryView() + cursorPos);
+
+			const char* separator = static_cast<const char*>(std::memchr(begin, '\n', remainingSize));
+			std::size_t length = (separator) ? static_cast<std::size_t>(separator - begin) : remainingSize;
+
+			if (!SetCursorPos(cursorPos + length + ((separator) ? 1 : 0)))
+				NazaraWarning("Failed to reset cursor pos");
+
+			if (m_streamOptions & StreamOption_Text && length > 0 && begin[length - 1] == '\r')
+				length--;
+
+			line.Set(begin, length);
+		}
+		else if (lineSize == 0) // Maximal size undefined
 		{
 			const unsigned int bufferSize = 64;
 
@@ -127,6 +158,35 @@ namespace Nz
 		return line;
 	}
 
+	/*!
+	* \brief Reads a block of the stream without copying it
+	* \return Pointer to the next size bytes of the stream, or nullptr if the stream is not in memory (see GetMemoryView) or has less than size bytes left
+	*
+	* The cursor is moved after the block only if a pointer is returned, allowing the caller to fall back to Read otherwise.
+	*
+	* \param size Size of the block
+	*
+	* \remark The pointer is invalidated by any operation modifying the stream
+	*/
+
+	const UInt8* Stream::ReadView(std::size_t size)
+	{
+		NazaraAssert(IsReadable(), "Stream is not readable");
+
+		const UInt8* memory = GetMemoryView();
+		if (!memory)
+			return nullptr;
+
+		UInt64 cursorPos = GetCursorPos();
+		if (GetSize() - cursorPos < size)
+			return nullptr;
+
+		if (!SetCursorPos(cursorPos + size))
+			return nullptr;
+
+		return memory + cursorPos;
+	}
+
 	/*!
 	* \brief Writes a ByteArray into the stream
 	* \return true if successful
@@ -93,8 +93,10 @@ namespace Nz
 	*/
 
 	String::String() :
-	m_sharedString(GetEmptyString())
+	m_buffer(m_localBuffer),
+	m_size(0)
 	{
+		m_localBuffer[0] = '\0';
 	}
 
 	/*!
@@ -103,15 +105,14 @@ namespace Nz
 	* \param character Single character
 	*/
 
-	String::String(char character)
+	String::String(char character) :
+	String()
 	{
 		if (character != '\0')
 		{
-			m_sharedString = std::make_shared<SharedString>(1);
-			m_sharedString->string[0] = character;
+			AllocateBuffer(1);
+			m_buffer[0] = character;
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -121,17 +122,16 @@ namespace Nz
 	* \param character Single character
 	*/
 
-	String::String(std::size_t rep, char character)
+	String::String(std::size_t rep, char character) :
+	String()
 	{
 		if (rep > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(rep);
+			AllocateBuffer(rep);
 
 			if (character != '\0')
-				std::memset(m_sharedString->string.get(), character, rep);
+				std::memset(m_buffer, character, rep);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -154,19 +154,18 @@ namespace Nz
 	* \param length Length of the string
 	*/
 
-	String::String(std::size_t rep, const char* string, std::size_t length)
+	String::String(std::size_t rep, const char* string, std::size_t length) :
+	String()
 	{
 		std::size_t totalSize = rep*length;
 
 		if (totalSize > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(totalSize);
+			AllocateBuffer(totalSize);
 
 			for (std::size_t i = 0; i < rep; ++i)
-				std::memcpy(&m_sharedString->string[i*length], string, length);
+				std::memcpy(&m_buffer[i*length], string, length);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -199,15 +198,14 @@ namespace Nz
 	* \param length Length of the string
 	*/
 
-	String::String(const char* string, std::size_t length)
+	String::String(const char* string, std::size_t length) :
+	String()
 	{
 		if (length > 0)
 		{
-			m_sharedString = std::make_shared<SharedString>(length);
-			std::memcpy(m_sharedString->string.get(), string, length);
+			AllocateBuffer(length);
+			std::memcpy(m_buffer, string, length);
 		}
-		else
-			m_sharedString = GetEmptyString();
 	}
 
 	/*!
@@ -221,6 +219,17 @@ namespace Nz
 	{
 	}
 
+	/*!
+	* \brief Constructs a String object with a copy of the characters referenced by a view
+	*
+	* \param view View to copy
+	*/
+
+	String::String(StringView view) :
+	String(view.GetConstBuffer(), view.GetSize())
+	{
+	}
+
 	/*!
 	* \brief Appends the character to the string
 	* \return A reference to this
@@ -232,7 +241,7 @@ namespace Nz
 
 	String& String::Append(char character)
 	{
-		return Insert(m_sharedString->size, character);
+		return Insert(m_size, character);
 	}
 
 	/*!
@@ -246,7 +255,7 @@ namespace Nz
 
 	String& String::Append(const char* string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -261,7 +270,7 @@ namespace Nz
 
 	String& String::Append(const char* string, std::size_t length)
 	{
-		return Insert(m_sharedString->size, string, length);
+		return Insert(m_size, string, length);
 	}
 
 	/*!
@@ -275,7 +284,7 @@ namespace Nz
 
 	String& String::Append(const String& string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -289,7 +298,8 @@ namespace Nz
 		if (keepBuffer)
 		{
 			EnsureOwnership(true);
-			m_sharedString->size = 0;
+			m_size = 0;
+			m_buffer[0] = '\0';
 		}
 		else
 			ReleaseString();
@@ -354,17 +364,17 @@ namespace Nz
 
 	unsigned int String::Count(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		unsigned int count = 0;
 		if (flags & CaseInsensitive)
 		{
@@ -400,17 +410,17 @@ namespace Nz
 
 	unsigned int String::Count(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		unsigned int count = 0;
 		if (flags & CaseInsensitive)
 		{
@@ -520,17 +530,17 @@ namespace Nz
 
 	unsigned int String::CountAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		unsigned int count = 0;
 		if (flags & HandleUtf8)
 		{
@@ -632,13 +642,13 @@ namespace Nz
 
 	bool String::EndsWith(char character, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 
 		if (flags & CaseInsensitive)
-			return Detail::ToLower(m_sharedString->string[m_sharedString->size-1]) == Detail::ToLower(character);
+			return Detail::ToLower(m_buffer[m_size-1]) == Detail::ToLower(character);
 		else
-			return m_sharedString->string[m_sharedString->size-1] == character; // character == '\0' will always be false
+			return m_buffer[m_size-1] == character; // character == '\0' will always be false
 	}
 
 	/*!
@@ -669,18 +679,18 @@ namespace Nz
 
 	bool String::EndsWith(const char* string, std::size_t length, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0 || length > m_sharedString->size)
+		if (!string || !string[0] || m_size == 0 || length > m_size)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
-				return Detail::Unicodecasecmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+				return Detail::Unicodecasecmp(&m_buffer[m_size - length], string) == 0;
 			else
-				return Detail::Strcasecmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+				return Detail::Strcasecmp(&m_buffer[m_size - length], string) == 0;
 		}
 		else
-			return std::strcmp(&m_sharedString->string[m_sharedString->size - length], string) == 0;
+			return std::strcmp(&m_buffer[m_size - length], string) == 0;
 	}
 
 	/*!
@@ -695,7 +705,7 @@ namespace Nz
 
 	bool String::EndsWith(const String& string, UInt32 flags) const
 	{
-		return EndsWith(string.GetConstBuffer(), string.m_sharedString->size, flags);
+		return EndsWith(string.GetConstBuffer(), string.m_size, flags);
 	}
 
 	/*!
@@ -709,24 +719,24 @@ namespace Nz
 
 	std::size_t String::Find(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		if (flags & CaseInsensitive)
 		{
 			char ch = Detail::ToLower(character);
-			const char* str = m_sharedString->string.get();
+			const char* str = m_buffer;
 			do
 			{
 				if (Detail::ToLower(*str) == ch)
-					return str - m_sharedString->string.get();
+					return str - m_buffer;
 			}
 			while (*++str);
 
@@ -734,9 +744,9 @@ namespace Nz
 		}
 		else
 		{
-			char* ch = std::strchr(&m_sharedString->string[pos], character);
+			char* ch = std::strchr(&m_buffer[pos], character);
 			if (ch)
-				return ch - m_sharedString->string.get();
+				return ch - m_buffer;
 			else
 				return npos;
 		}
@@ -753,17 +763,17 @@ namespace Nz
 
 	std::size_t String::Find(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
@@ -786,7 +796,7 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return ptrPos - m_sharedString->string.get();
+								return ptrPos - m_buffer;
 
 							if (*it == '\0')
 								return npos;
@@ -815,7 +825,7 @@ namespace Nz
 						for (;;)
 						{
 							if (*ptr == '\0')
-								return ptrPos - m_sharedString->string.get();
+								return ptrPos - m_buffer;
 
 							if (*str == '\0')
 								return npos;
@@ -833,9 +843,9 @@ namespace Nz
 		}
 		else
 		{
-			char* ch = std::strstr(&m_sharedString->string[pos], string);
+			char* ch = std::strstr(&m_buffer[pos], string);
 			if (ch)
-				return ch - m_sharedString->string.get();
+				return ch - m_buffer;
 		}
 
 		return npos;
@@ -866,17 +876,17 @@ namespace Nz
 
 	std::size_t String::FindAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0 || !string || !string[0])
+		if (m_size == 0 || !string || !string[0])
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		if (flags & HandleUtf8)
 		{
 			while (utf8::internal::is_trail(*str))
@@ -893,7 +903,7 @@ namespace Nz
 					do
 					{
 						if (character == Unicode::GetLowercase(*it2))
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_buffer;
 					}
 					while (*++it2);
 				}
@@ -907,7 +917,7 @@ namespace Nz
 					do
 					{
 						if (*it == *it2)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_buffer;
 					}
 					while (*++it2);
 				}
@@ -925,7 +935,7 @@ namespace Nz
 					do
 					{
 						if (character == Detail::ToLower(*c))
-							return str - m_sharedString->string.get();
+							return str - m_buffer;
 					}
 					while (*++c);
 				}
@@ -935,7 +945,7 @@ namespace Nz
 			{
 				str = std::strpbrk(str, string);
 				if (str)
-					return str - m_sharedString->string.get();
+					return str - m_buffer;
 			}
 		}
 
@@ -967,17 +977,17 @@ namespace Nz
 
 	std::size_t String::FindLast(char character, std::intmax_t start, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_buffer[pos];
 
 		if (flags & CaseInsensitive)
 		{
@@ -985,18 +995,18 @@ namespace Nz
 			do
 			{
 				if (Detail::ToLower(*ptr) == character)
-					return ptr - m_sharedString->string.get();
+					return ptr - m_buffer;
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_buffer);
 		}
 		else
 		{
 			do
 			{
 				if (*ptr == character)
-					return ptr - m_sharedString->string.get();
+					return ptr - m_buffer;
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_buffer);
 		}
 
 		return npos;
@@ -1013,18 +1023,18 @@ namespace Nz
 
 	std::size_t String::FindLast(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 1.FindLast#3 (Size of the pattern unknown)
-		const char* ptr = &m_sharedString->string[pos];
+		const char* ptr = &m_buffer[pos];
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
@@ -1046,9 +1056,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return it.base() - m_sharedString->string.get();
+								return it.base() - m_buffer;
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*it2))
@@ -1059,7 +1069,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 			else
 			{
@@ -1073,9 +1083,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*p == '\0')
-								return ptr - m_sharedString->string.get();
+								return ptr - m_buffer;
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_buffer[pos])
 								break;
 
 							if (Detail::ToLower(*tPtr) != Detail::ToLower(*p))
@@ -1086,7 +1096,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_buffer);
 			}
 		}
 		else
@@ -1100,9 +1110,9 @@ namespace Nz
 					for (;;)
 					{
 						if (*p == '\0')
-							return ptr - m_sharedString->string.get();
+							return ptr - m_buffer;
 
-						if (tPtr > &m_sharedString->string[pos])
+						if (tPtr > &m_buffer[pos])
 							break;
 
 						if (*tPtr != *p)
@@ -1113,7 +1123,7 @@ namespace Nz
 					}
 				}
 			}
-			while (ptr-- != m_sharedString->string.get());
+			while (ptr-- != m_buffer);
 		}
 
 		return npos;
@@ -1130,18 +1140,18 @@ namespace Nz
 
 	std::size_t String::FindLast(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size || string.m_sharedString->size > m_sharedString->size)
+		if (pos >= m_size || string.m_size > m_size)
 			return npos;
 
-		const char* ptr = &m_sharedString->string[pos];
-		const char* limit = &m_sharedString->string[string.m_sharedString->size-1];
+		const char* ptr = &m_buffer[pos];
+		const char* limit = &m_buffer[string.m_size-1];
 
 		if (flags & CaseInsensitive)
 		{
@@ -1165,9 +1175,9 @@ namespace Nz
 						for (;;)
 						{
 							if (*it2 == '\0')
-								return it.base() - m_sharedString->string.get();
+								return it.base() - m_buffer;
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*it2))
@@ -1183,21 +1193,21 @@ namespace Nz
 			else
 			{
 				///Algo 1.FindLast#4 (Size of the pattern unknown)
-				char c = Detail::ToLower(string.m_sharedString->string[string.m_sharedString->size-1]);
+				char c = Detail::ToLower(string.m_buffer[string.m_size-1]);
 				for (;;)
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_buffer[string.m_size-1];
+						for (; p >= &string.m_buffer[0]; --p, --ptr)
 						{
 							if (Detail::ToLower(*ptr) != Detail::ToLower(*p))
 								break;
 
-							if (p == &string.m_sharedString->string[0])
-								return ptr-m_sharedString->string.get();
+							if (p == &string.m_buffer[0])
+								return ptr-m_buffer;
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_buffer)
 								return npos;
 						}
 					}
@@ -1211,18 +1221,18 @@ namespace Nz
 			///Algo 1.FindLast#4 (Size of the pattern known)
 			for (;;)
 			{
-				if (*ptr == string.m_sharedString->string[string.m_sharedString->size-1])
+				if (*ptr == string.m_buffer[string.m_size-1])
 				{
-					const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-					for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+					const char* p = &string.m_buffer[string.m_size-1];
+					for (; p >= &string.m_buffer[0]; --p, --ptr)
 					{
 						if (*ptr != *p)
 							break;
 
-						if (p == &string.m_sharedString->string[0])
-							return ptr-m_sharedString->string.get();
+						if (p == &string.m_buffer[0])
+							return ptr-m_buffer;
 
-						if (ptr == m_sharedString->string.get())
+						if (ptr == m_buffer)
 							return npos;
 					}
 				}
@@ -1245,17 +1255,17 @@ namespace Nz
 
 	std::size_t String::FindLastAny(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* str = &m_sharedString->string[pos];
+		char* str = &m_buffer[pos];
 		if (flags & HandleUtf8)
 		{
 			while (utf8::internal::is_trail(*str))
@@ -1272,11 +1282,11 @@ namespace Nz
 					do
 					{
 						if (character == Unicode::GetLowercase(*it2))
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_buffer;
 					}
 					while (*++it2);
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 			else
 			{
@@ -1286,11 +1296,11 @@ namespace Nz
 					do
 					{
 						if (*it == *it2)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_buffer;
 					}
 					while (*++it2);
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 		}
 		else
@@ -1304,11 +1314,11 @@ namespace Nz
 					do
 					{
 						if (character == Detail::ToLower(*c))
-							return str - m_sharedString->string.get();
+							return str - m_buffer;
 					}
 					while (*++c);
 				}
-				while (str-- != m_sharedString->string.get());
+				while (str-- != m_buffer);
 			}
 			else
 			{
@@ -1318,11 +1328,11 @@ namespace Nz
 					do
 					{
 						if (*str == *c)
-							return str - m_sharedString->string.get();
+							return str - m_buffer;
 					}
 					while (*++c);
 				}
-				while (str-- != m_sharedString->string.get());
+				while (str-- != m_buffer);
 			}
 		}
 
@@ -1354,18 +1364,18 @@ namespace Nz
 
 	std::size_t String::FindLastWord(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 2.FindLastWord#1 (Size of the pattern unknown)
-		const char* ptr = &m_sharedString->string[pos];
+		const char* ptr = &m_buffer[pos];
 
 		if (flags & HandleUtf8)
 		{
@@ -1382,7 +1392,7 @@ namespace Nz
 				{
 					if (Unicode::GetLowercase(*it) == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1398,12 +1408,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*p))
@@ -1414,7 +1424,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 			else
 			{
@@ -1424,7 +1434,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1440,12 +1450,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (*tIt != *p)
@@ -1456,7 +1466,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 		}
 		else
@@ -1468,7 +1478,7 @@ namespace Nz
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get())
+						if (ptr != m_buffer)
 						{
 							--ptr;
 							if (!Detail::IsSpace(*ptr++))
@@ -1482,12 +1492,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr-m_sharedString->string.get();
+									return ptr-m_buffer;
 								else
 									break;
 							}
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_buffer[pos])
 								break;
 
 							if (Detail::ToLower(*tPtr) != Detail::ToLower(*p))
@@ -1498,7 +1508,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_buffer);
 			}
 			else
 			{
@@ -1506,7 +1516,7 @@ namespace Nz
 				{
 					if (*ptr == string[0])
 					{
-						if (ptr != m_sharedString->string.get())
+						if (ptr != m_buffer)
 						{
 							--ptr;
 							if (!Detail::IsSpace(*ptr++))
@@ -1520,12 +1530,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr-m_sharedString->string.get();
+									return ptr-m_buffer;
 								else
 									break;
 							}
 
-							if (tPtr > &m_sharedString->string[pos])
+							if (tPtr > &m_buffer[pos])
 								break;
 
 							if (*tPtr != *p)
@@ -1536,7 +1546,7 @@ namespace Nz
 						}
 					}
 				}
-				while (ptr-- != m_sharedString->string.get());
+				while (ptr-- != m_buffer);
 			}
 		}
 
@@ -1554,18 +1564,18 @@ namespace Nz
 
 	std::size_t String::FindLastWord(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		const char* ptr = &m_sharedString->string[pos];
-		const char* limit = &m_sharedString->string[string.m_sharedString->size-1];
+		const char* ptr = &m_buffer[pos];
+		const char* limit = &m_buffer[string.m_size-1];
 
 		if (flags & HandleUtf8)
 		{
@@ -1582,7 +1592,7 @@ namespace Nz
 				{
 					if (Unicode::GetLowercase(*it) == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1598,12 +1608,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (Unicode::GetLowercase(*tIt) != Unicode::GetLowercase(*p))
@@ -1614,7 +1624,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 			else
 			{
@@ -1624,7 +1634,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1640,12 +1650,12 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*tIt))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
 
-							if (tIt.base() > &m_sharedString->string[pos])
+							if (tIt.base() > &m_buffer[pos])
 								break;
 
 							if (*tIt != *p)
@@ -1656,7 +1666,7 @@ namespace Nz
 						}
 					}
 				}
-				while (it--.base() != m_sharedString->string.get());
+				while (it--.base() != m_buffer);
 			}
 		}
 		else
@@ -1664,7 +1674,7 @@ namespace Nz
 			///Algo 2.FindLastWord#2 (Size of the pattern known)
 			if (flags & CaseInsensitive)
 			{
-				char c = Detail::ToLower(string.m_sharedString->string[string.m_sharedString->size-1]);
+				char c = Detail::ToLower(string.m_buffer[string.m_size-1]);
 				do
 				{
 					if (Detail::ToLower(*ptr) == c)
@@ -1673,21 +1683,21 @@ namespace Nz
 						if (nextC != '\0' && (Detail::IsSpace(nextC)) == 0)
 							continue;
 
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_buffer[string.m_size-1];
+						for (; p >= &string.m_buffer[0]; --p, --ptr)
 						{
 							if (Detail::ToLower(*ptr) != Detail::ToLower(*p))
 								break;
 
-							if (p == &string.m_sharedString->string[0])
+							if (p == &string.m_buffer[0])
 							{
-								if (ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr-1)))
-									return ptr-m_sharedString->string.get();
+								if (ptr == m_buffer || Detail::IsSpace(*(ptr-1)))
+									return ptr-m_buffer;
 								else
 									break;
 							}
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_buffer)
 								return npos;
 						}
 					}
@@ -1698,27 +1708,27 @@ namespace Nz
 			{
 				do
 				{
-					if (*ptr == string.m_sharedString->string[string.m_sharedString->size-1])
+					if (*ptr == string.m_buffer[string.m_size-1])
 					{
 						char nextC = *(ptr + 1);
 						if (nextC != '\0' && !Detail::IsSpace(nextC))
 							continue;
 
-						const char* p = &string.m_sharedString->string[string.m_sharedString->size-1];
-						for (; p >= &string.m_sharedString->string[0]; --p, --ptr)
+						const char* p = &string.m_buffer[string.m_size-1];
+						for (; p >= &string.m_buffer[0]; --p, --ptr)
 						{
 							if (*ptr != *p)
 								break;
 
-							if (p == &string.m_sharedString->string[0])
+							if (p == &string.m_buffer[0])
 							{
-								if (ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr - 1)))
-									return ptr-m_sharedString->string.get();
+								if (ptr == m_buffer || Detail::IsSpace(*(ptr - 1)))
+									return ptr-m_buffer;
 								else
 									break;
 							}
 
-							if (ptr == m_sharedString->string.get())
+							if (ptr == m_buffer)
 								return npos;
 						}
 					}
@@ -1741,18 +1751,18 @@ namespace Nz
 
 	std::size_t String::FindWord(const char* string, std::intmax_t start, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		///Algo 3.FindWord#3 (Size of the pattern unknown)
-		const char* ptr = &m_sharedString->string[pos];
+		const char* ptr = &m_buffer[pos];
 		if (flags & HandleUtf8)
 		{
 			if (utf8::internal::is_trail(*ptr))
@@ -1769,7 +1779,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1785,7 +1795,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
@@ -1809,7 +1819,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1825,7 +1835,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
@@ -1850,7 +1860,7 @@ namespace Nz
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr - 1)))
+						if (ptr != m_buffer && !Detail::IsSpace(*(ptr - 1)))
 							continue;
 
 						const char* p = &string[1];
@@ -1860,7 +1870,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_buffer;
 								else
 									break;
 							}
@@ -1881,7 +1891,7 @@ namespace Nz
 				{
 					if (*ptr == string[0])
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr-1)))
+						if (ptr != m_buffer && !Detail::IsSpace(*(ptr-1)))
 							continue;
 
 						const char* p = &string[1];
@@ -1891,7 +1901,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_buffer;
 								else
 									break;
 							}
@@ -1922,17 +1932,17 @@ namespace Nz
 
 	std::size_t String::FindWord(const String& string, std::intmax_t start, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0 || string.m_sharedString->size > m_sharedString->size)
+		if (string.m_size == 0 || string.m_size > m_size)
 			return npos;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_buffer[pos];
 		if (flags & HandleUtf8)
 		{
 			///Algo 3.FindWord#3 (Iterator too slow for #2)
@@ -1950,7 +1960,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -1966,7 +1976,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
@@ -1990,7 +2000,7 @@ namespace Nz
 				{
 					if (*it == c)
 					{
-						if (it.base() != m_sharedString->string.get())
+						if (it.base() != m_buffer)
 						{
 							--it;
 							if (!Detail::IsSpace(*it++))
@@ -2006,7 +2016,7 @@ namespace Nz
 							if (*p == '\0')
 							{
 								if (*tIt == '\0' || Detail::IsSpace(*it++))
-									return it.base() - m_sharedString->string.get();
+									return it.base() - m_buffer;
 								else
 									break;
 							}
@@ -2027,22 +2037,22 @@ namespace Nz
 			///Algo 3.FindWord#2 (Size of the pattern known)
 			if (flags & CaseInsensitive)
 			{
-				char c = Detail::ToLower(string.m_sharedString->string[0]);
+				char c = Detail::ToLower(string.m_buffer[0]);
 				do
 				{
 					if (Detail::ToLower(*ptr) == c)
 					{
-						if (ptr != m_sharedString->string.get() && !Detail::IsSpace(*(ptr-1)))
+						if (ptr != m_buffer && !Detail::IsSpace(*(ptr-1)))
 							continue;
 
-						const char* p = &string.m_sharedString->string[1];
+						const char* p = &string.m_buffer[1];
 						const char* tPtr = ptr+1;
 						for (;;)
 						{
 							if (*p == '\0')
 							{
 								if (*tPtr == '\0' || Detail::IsSpace(*tPtr))
-									return ptr - m_sharedString->string.get();
+									return ptr - m_buffer;
 								else
 									break;
 							}
@@ -2062,8 +2072,8 @@ namespace Nz
 				while ((ptr = std::strstr(ptr, string.GetConstBuffer())) != nullptr)
 				{
 					// If the word is really alone
-					if ((ptr == m_sharedString->string.get() || Detail::IsSpace(*(ptr-1))) && (*(ptr+m_sharedString->size) == '\0' || Detail::IsSpace(*(ptr+m_sharedString->size))))
-						return ptr - m_sharedString->string.get();
+					if ((ptr == m_buffer || Detail::IsSpace(*(ptr-1))) && (*(ptr+m_size) == '\0' || Detail::IsSpace(*(ptr+m_size))))
+						return ptr - m_buffer;
 
 					ptr++;
 				}
@@ -2082,7 +2092,7 @@ namespace Nz
 	{
 		EnsureOwnership();
 
-		return m_sharedString->string.get();
+		return m_buffer;
 	}
 
 	/*!
@@ -2092,7 +2102,7 @@ namespace Nz
 
 	std::size_t String::GetCapacity() const
 	{
-		return m_sharedString->capacity;
+		return (m_buffer == m_localBuffer) ? LocalCapacity : m_sharedString->capacity;
 	}
 
 	/*!
@@ -2107,14 +2117,14 @@ namespace Nz
 	*/
 	std::size_t String::GetCharacterPosition(std::size_t characterIndex) const
 	{
-		const char* ptr = m_sharedString->string.get();
-		const char* end = &m_sharedString->string[m_sharedString->size];
+		const char* ptr = m_buffer;
+		const char* end = &m_buffer[m_size];
 
 		try
 		{
 			utf8::advance(ptr, characterIndex, end);
 
-			return ptr - m_sharedString->string.get();
+			return ptr - m_buffer;
 		}
 		catch (utf8::not_enough_room& /*e*/)
 		{
@@ -2139,7 +2149,7 @@ namespace Nz
 
 	const char* String::GetConstBuffer() const
 	{
-		return m_sharedString->string.get();
+		return m_buffer;
 	}
 
 	/*!
@@ -2149,7 +2159,7 @@ namespace Nz
 
 	std::size_t String::GetLength() const
 	{
-		return utf8::distance(m_sharedString->string.get(), &m_sharedString->string[m_sharedString->size]);
+		return utf8::distance(m_buffer, &m_buffer[m_size]);
 	}
 
 	/*!
@@ -2159,7 +2169,7 @@ namespace Nz
 
 	std::size_t String::GetSize() const
 	{
-		return m_sharedString->size;
+		return m_size;
 	}
 
 	/*!
@@ -2169,7 +2179,7 @@ namespace Nz
 
 	std::string String::GetUtf8String() const
 	{
-		return std::string(m_sharedString->string.get(), m_sharedString->size);
+		return std::string(m_buffer, m_size);
 	}
 
 	/*!
@@ -2179,11 +2189,11 @@ namespace Nz
 
 	std::u16string String::GetUtf16String() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::u16string();
 
 		std::u16string str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		utf8::utf8to16(begin(), end(), std::back_inserter(str));
 
@@ -2197,11 +2207,11 @@ namespace Nz
 
 	std::u32string String::GetUtf32String() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::u32string();
 
 		std::u32string str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		utf8::utf8to32(begin(), end(), std::back_inserter(str));
 
@@ -2216,17 +2226,17 @@ namespace Nz
 	std::wstring String::GetWideString() const
 	{
 		static_assert(sizeof(wchar_t) == 2 || sizeof(wchar_t) == 4, "wchar_t size is not supported");
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return std::wstring();
 
 		std::wstring str;
-		str.reserve(m_sharedString->size);
+		str.reserve(m_size);
 
 		if (sizeof(wchar_t) == 4) // I want a static_if :(
 			utf8::utf8to32(begin(), end(), std::back_inserter(str));
 		else
 		{
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			utf8::unchecked::iterator<const char*> it(m_buffer);
 			do
 			{
 				char32_t cp = *it;
@@ -2256,7 +2266,7 @@ namespace Nz
 			return String();
 
 		std::intmax_t endPos = -1;
-		const char* ptr = &m_sharedString->string[startPos];
+		const char* ptr = &m_buffer[startPos];
 		if (flags & HandleUtf8)
 		{
 			utf8::unchecked::iterator<const char*> it(ptr);
@@ -2264,7 +2274,7 @@ namespace Nz
 			{
 				if (Detail::IsSpace(*it))
 				{
-					endPos = static_cast<std::intmax_t>(it.base() - m_sharedString->string.get() - 1);
+					endPos = static_cast<std::intmax_t>(it.base() - m_buffer - 1);
 					break;
 				}
 			}
@@ -2276,7 +2286,7 @@ namespace Nz
 			{
 				if (Detail::IsSpace(*ptr))
 				{
-					endPos = static_cast<std::intmax_t>(ptr - m_sharedString->string.get() - 1);
+					endPos = static_cast<std::intmax_t>(ptr - m_buffer - 1);
 					break;
 				}
 			}
@@ -2296,13 +2306,13 @@ namespace Nz
 
 	std::size_t String::GetWordPosition(unsigned int index, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return npos;
 
 		unsigned int currentWord = 0;
 		bool inWord = false;
 
-		const char* ptr = m_sharedString->string.get();
+		const char* ptr = m_buffer;
 		if (flags & HandleUtf8)
 		{
 			utf8::unchecked::iterator<const char*> it(ptr);
@@ -2316,7 +2326,7 @@ namespace Nz
 					{
 						inWord = true;
 						if (++currentWord > index)
-							return it.base() - m_sharedString->string.get();
+							return it.base() - m_buffer;
 					}
 				}
 			}
@@ -2334,7 +2344,7 @@ namespace Nz
 					{
 						inWord = true;
 						if (++currentWord > index)
-							return ptr - m_sharedString->string.get();
+							return ptr - m_buffer;
 					}
 				}
 			}
@@ -2385,40 +2395,42 @@ namespace Nz
 			return *this;
 
 		if (pos < 0)
-			pos = std::max<std::size_t>(m_sharedString->size + pos, 0);
+			pos = std::max<std::size_t>(m_size + pos, 0);
 
-		std::size_t start = std::min<std::size_t>(pos, m_sharedString->size);
+		std::size_t start = std::min<std::size_t>(pos, m_size);
 
 		// If buffer is already big enough
-		if (m_sharedString->capacity >= m_sharedString->size + length)
+		if (GetCapacity() >= m_size + length)
 		{
 			EnsureOwnership();
 
-			std::memmove(&m_sharedString->string[start+length], &m_sharedString->string[start], m_sharedString->size - start);
-			std::memcpy(&m_sharedString->string[start], string, length);
+			std::memmove(&m_buffer[start+length], &m_buffer[start], m_size - start);
+			std::memcpy(&m_buffer[start], string, length);
 
-			m_sharedString->size += length;
-			m_sharedString->string[m_sharedString->size] = '\0';
+			m_size += length;
+			m_buffer[m_size] = '\0';
 		}
 		else
 		{
-			auto newString = std::make_shared<SharedString>(m_sharedString->size + length);
+			// Leave some room for the next insertions, appending in a loop would otherwise reallocate every time
+			String newString;
+			newString.AllocateBuffer(m_size + length, Detail::GetNewSize(m_size + length));
 
-			char* ptr = newString->string.get();
+			char* ptr = newString.m_buffer;
 
 			if (start > 0)
 			{
-				std::memcpy(ptr, m_sharedString->string.get(), start*sizeof(char));
+				std::memcpy(ptr, m_buffer, start*sizeof(char));
 				ptr += start;
 			}
 
 			std::memcpy(ptr, string, length*sizeof(char));
 			ptr += length;
 
-			if (m_sharedString->size > start)
-				std::memcpy(ptr, &m_sharedString->string[start], m_sharedString->size - start);
+			if (m_size > start)
+				std::memcpy(ptr, &m_buffer[start], m_size - start);
 
-			m_sharedString = std::move(newString);
+			*this = std::move(newString);
 		}
 
 		return *this;
@@ -2434,7 +2446,7 @@ namespace Nz
 
 	String& String::Insert(std::intmax_t pos, const String& string)
 	{
-		return Insert(pos, string.GetConstBuffer(), string.m_sharedString->size);
+		return Insert(pos, string.GetConstBuffer(), string.m_size);
 	}
 
 	/*!
@@ -2444,7 +2456,7 @@ namespace Nz
 
 	bool String::IsEmpty() const
 	{
-		return m_sharedString->size == 0;
+		return m_size == 0;
 	}
 
 	/*!
@@ -2454,7 +2466,7 @@ namespace Nz
 
 	bool String::IsNull() const
 	{
-		return m_sharedString.get() == GetEmptyString().get();
+		return m_size == 0 && m_buffer == m_localBuffer;
 	}
 
 	/*!
@@ -2477,14 +2489,14 @@ namespace Nz
 		}
 		#endif
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		String check = Simplified();
-		if (check.m_sharedString->size == 0)
+		if (check.m_size == 0)
 			return false;
 
-		char* ptr = (check.m_sharedString->string[0] == '-') ? &check.m_sharedString->string[1] : check.m_sharedString->string.get();
+		char* ptr = (check.m_buffer[0] == '-') ? &check.m_buffer[1] : check.m_buffer;
 
 		if (base > 10)
 		{
@@ -2538,12 +2550,12 @@ namespace Nz
 
 	bool String::Match(const char* pattern) const
 	{
-		if (m_sharedString->size == 0 || !pattern)
+		if (m_size == 0 || !pattern)
 			return false;
 
 		// Par Jack Handy - akkhandy@hotmail.com
 		// From : http://www.codeproject.com/Articles/1088/Wildcard-string-compare-globbing
-		const char* str = m_sharedString->string.get();
+		const char* str = m_buffer;
 		while (*str && *pattern != '*')
 		{
 			if (*pattern != *str && *pattern != '?')
@@ -2592,7 +2604,7 @@ namespace Nz
 
 	bool String::Match(const String& pattern) const
 	{
-		return Match(pattern.m_sharedString->string.get());
+		return Match(pattern.m_buffer);
 	}
 
 	/*!
@@ -2671,14 +2683,14 @@ namespace Nz
 			return Replace(String(oldCharacter), String(), start);
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		unsigned int count = 0;
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_buffer[pos];
 		bool found = false;
 		if (flags & CaseInsensitive)
 		{
@@ -2690,11 +2702,11 @@ namespace Nz
 				{
 					if (!found)
 					{
-						std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+						std::ptrdiff_t offset = ptr - m_buffer;
 
 						EnsureOwnership();
 
-						ptr = &m_sharedString->string[offset];
+						ptr = &m_buffer[offset];
 						found = true;
 					}
 
@@ -2710,11 +2722,11 @@ namespace Nz
 			{
 				if (!found)
 				{
-					std::ptrdiff_t offset = ptr-m_sharedString->string.get();
+					std::ptrdiff_t offset = ptr-m_buffer;
 
 					EnsureOwnership();
 
-					ptr = &m_sharedString->string[offset];
+					ptr = &m_buffer[offset];
 					found = true;
 				}
 
@@ -2759,10 +2771,10 @@ namespace Nz
 			return 0;
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return 0;
 
 		unsigned int count = 0;
@@ -2779,7 +2791,7 @@ namespace Nz
 					found = true;
 				}
 
-				std::memcpy(&m_sharedString->string[pos], replaceString, oldLength);
+				std::memcpy(&m_buffer[pos], replaceString, oldLength);
 				pos += oldLength;
 
 				++count;
@@ -2787,19 +2799,20 @@ namespace Nz
 		}
 		else ///TODO: Replacement algorithm without changing the buffer (if replaceLength < oldLength)
 		{
-			std::size_t newSize = m_sharedString->size + Count(oldString)*(replaceLength - oldLength);
-			if (newSize == m_sharedString->size) // Then it's the fact that Count(oldString) == 0
+			std::size_t newSize = m_size + Count(oldString)*(replaceLength - oldLength);
+			if (newSize == m_size) // Then it's the fact that Count(oldString) == 0
 				return 0;
 
-			auto newString = std::make_shared<SharedString>(newSize);
+			String newString;
+			newString.AllocateBuffer(newSize);
 
 			///Algo 4.Replace#2
-			char* ptr = newString->string.get();
-			const char* p = m_sharedString->string.get();
+			char* ptr = newString.m_buffer;
+			const char* p = m_buffer;
 
 			while ((pos = Find(oldString, pos, flags)) != npos)
 			{
-				const char* r = &m_sharedString->string[pos];
+				const char* r = &m_buffer[pos];
 
 				std::memcpy(ptr, p, r-p);
 				ptr += r-p;
@@ -2813,7 +2826,7 @@ namespace Nz
 
 			std::strcpy(ptr, p);
 
-			m_sharedString = std::move(newString);
+			*this = std::move(newString);
 		}
 
 		return count;
@@ -2831,7 +2844,7 @@ namespace Nz
 
 	unsigned int String::Replace(const String& oldString, const String& replaceString, std::intmax_t start, UInt32 flags)
 	{
-		return Replace(oldString.GetConstBuffer(), oldString.m_sharedString->size, replaceString.GetConstBuffer(), replaceString.m_sharedString->size, start, flags);
+		return Replace(oldString.GetConstBuffer(), oldString.m_size, replaceString.GetConstBuffer(), replaceString.m_size, start, flags);
 	}
 
 	/*!
@@ -2856,14 +2869,14 @@ namespace Nz
 			return ReplaceAny(String(oldCharacters), String(), start);*/
 
 		if (start < 0)
-			start = std::max<std::size_t>(m_sharedString->size + start, 0);
+			start = std::max<std::size_t>(m_size + start, 0);
 
 		std::size_t pos = static_cast<std::size_t>(start);
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			return npos;
 
 		unsigned int count = 0;
-		char* ptr = &m_sharedString->string[pos];
+		char* ptr = &m_buffer[pos];
 		if (flags & CaseInsensitive)
 		{
 			do
@@ -2877,11 +2890,11 @@ namespace Nz
 					{
 						if (!found)
 						{
-							std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+							std::ptrdiff_t offset = ptr - m_buffer;
 
 							EnsureOwnership();
 
-							ptr = &m_sharedString->string[offset];
+							ptr = &m_buffer[offset];
 							found = true;
 						}
 
@@ -2901,11 +2914,11 @@ namespace Nz
 			{
 				if (!found)
 				{
-					std::ptrdiff_t offset = ptr - m_sharedString->string.get();
+					std::ptrdiff_t offset = ptr - m_buffer;
 
 					EnsureOwnership();
 
-					ptr = &m_sharedString->string[offset];
+					ptr = &m_buffer[offset];
 					found = true;
 				}
 
@@ -2921,7 +2934,7 @@ namespace Nz
 		{
 			if (start < 0)
 			{
-				start = m_sharedString->size+start;
+				start = m_size+start;
 				if (start < 0)
 					start = 0;
 			}
@@ -2930,7 +2943,7 @@ namespace Nz
 			unsigned int oSize = (oldCharacters) ? std::strlen(oldCharacters) : 0;
 			unsigned int rSize = (replaceString) ? std::strlen(replaceString) : 0;
 
-			if (pos >= m_sharedString->size || m_sharedString->size == 0 || oSize == 0)
+			if (pos >= m_size || m_size == 0 || oSize == 0)
 				return 0;
 
 			unsigned int count = 0;
@@ -2939,13 +2952,13 @@ namespace Nz
 			{
 				EnsureOwnership();
 
-				f or (; pos < m_sharedString->size; ++pos)
+				f or (; pos < m_size; ++pos)
 				{
 					for (unsigned int i = 0; i < oSize; ++i)
 					{
-						if (m_sharedString->string[pos] == oldCharacters[i])
+						if (m_buffer[pos] == oldCharacters[i])
 						{
-							m_sharedString->string[pos] = replaceString[0];
+							m_buffer[pos] = replaceString[0];
 							++count;
 
 							break;
@@ -2958,21 +2971,21 @@ namespace Nz
 				unsigned int newSize;
 				{
 					unsigned int count = CountAny(oldCharacters);
-					newSize = m_sharedString->size - count + count*rSize;
+					newSize = m_size - count + count*rSize;
 				}
 				char* newString = new char[newSize+1];
 
 				unsigned int j = 0;
-				for (unsigned int i = 0; i < m_sharedString->size; ++i)
+				for (unsigned int i = 0; i < m_size; ++i)
 				{
 					if (i < pos) // Avant la position où on est censé commencer à remplacer, on ne fait que recopier
-						newString[j++] = m_sharedString->string[i];
+						newString[j++] = m_buffer[i];
 					else
 					{
 						bool found = false;
 						for (unsigned int l = 0; l < oSize; ++l)
 						{
-							if (m_sharedString->string[i] == oldCharacters[l])
+							if (m_buffer[i] == oldCharacters[l])
 							{
 								for (unsigned int k = 0; k < rSize; ++k)
 									newString[j++] = replaceString[k];
@@ -2984,14 +2997,14 @@ namespace Nz
 						}
 
 						if (!found)
-							newString[j++] = m_sharedString->string[i];
+							newString[j++] = m_buffer[i];
 					}
 				}
 				newString[newSize] = '\0';
 
 				ReleaseString();
 
-				m_sharedString->size = newSize;
+				m_size = newSize;
 				m_sharedString->string = newString;
 			}
 
@@ -3002,30 +3015,30 @@ namespace Nz
 		{
 			if (start < 0)
 			{
-				start = m_sharedString->size+start;
+				start = m_size+start;
 				if (start < 0)
 					start = 0;
 			}
 
 			unsigned int pos = static_cast<unsigned int>(start);
 
-			if (pos >= m_sharedString->size || m_sharedString->size == 0 || oldCharacters.m_sharedString->size == 0)
+			if (pos >= m_size || m_size == 0 || oldCharacters.m_size == 0)
 				return 0;
 
 			unsigned int count = 0;
 
-			if (replaceString.m_sharedString->size == 1) // On utilise un algorithme optimisé
+			if (replaceString.m_size == 1) // On utilise un algorithme optimisé
 			{
 				EnsureOwnership();
 
 				char character = replaceString[0];
-				for (; pos < m_sharedString->size; ++pos)
+				for (; pos < m_size; ++pos)
 				{
-					for (unsigned int i = 0; i < oldCharacters.m_sharedString->size; ++i)
+					for (unsigned int i = 0; i < oldCharacters.m_size; ++i)
 					{
-						if (m_sharedString->string[pos] == oldCharacters[i])
+						if (m_buffer[pos] == oldCharacters[i])
 						{
-							m_sharedString->string[pos] = character;
+							m_buffer[pos] = character;
 							++count;
 							break;
 						}
@@ -3037,23 +3050,23 @@ namespace Nz
 				unsigned int newSize;
 				{
 					unsigned int count = CountAny(oldCharacters);
-					newSize = m_sharedString->size - count + count*replaceString.m_sharedString->size;
+					newSize = m_size - count + count*replaceString.m_size;
 				}
 				char* newString = new char[newSize+1];
 
 				unsigned int j = 0;
-				for (unsigned int i = 0; i < m_sharedString->size; ++i)
+				for (unsigned int i = 0; i < m_size; ++i)
 				{
 					if (i < pos) // Avant la position où on est censé commencer à remplacer, on ne fait que recopier
-						newString[j++] = m_sharedString->string[i];
+						newString[j++] = m_buffer[i];
 					else
 					{
 						bool found = false;
-						for (unsigned int l = 0; l < oldCharacters.m_sharedString->size; ++l)
+						for (unsigned int l = 0; l < oldCharacters.m_size; ++l)
 						{
-							if (m_sharedString->string[i] == oldCharacters[l])
+							if (m_buffer[i] == oldCharacters[l])
 							{
-								for (unsigned int k = 0; k < replaceString.m_sharedString->size; ++k)
+								for (unsigned int k = 0; k < replaceString.m_size; ++k)
 									newString[j++] = replaceString[k];
 
 								++count;
@@ -3063,14 +3076,14 @@ namespace Nz
 						}
 
 						if (!found)
-							newString[j++] = m_sharedString->string[i];
+							newString[j++] = m_buffer[i];
 					}
 				}
 				newString[newSize] = '\0';
 
 				ReleaseString();
 
-				m_sharedString->size = newSize;
+				m_size = newSize;
 				m_sharedString->string = newString;
 			}
 
@@ -3088,16 +3101,16 @@ namespace Nz
 
 	void String::Reserve(std::size_t bufferSize)
 	{
-		if (m_sharedString->capacity > bufferSize)
+		if (GetCapacity() > bufferSize)
 			return;
 
-		auto newString = std::make_shared<SharedString>(bufferSize);
-		newString->size = m_sharedString->size;
+		String newString;
+		newString.AllocateBuffer(m_size, bufferSize);
 
-		if (m_sharedString->size > 0)
-			std::memcpy(newString->string.get(), m_sharedString->string.get(), m_sharedString->size);
+		if (m_size > 0)
+			std::memcpy(newString.m_buffer, m_buffer, m_size);
 
-		m_sharedString = std::move(newString);
+		*this = std::move(newString);
 	}
 
 	/*!
@@ -3117,34 +3130,35 @@ namespace Nz
 		}
 
 		if (size < 0)
-			size = std::max<std::intmax_t>(m_sharedString->size + size, 0);
+			size = std::max<std::intmax_t>(m_size + size, 0);
 
 		std::size_t newSize = static_cast<std::size_t>(size);
 
-		if (flags & HandleUtf8 && newSize < m_sharedString->size)
+		if (flags & HandleUtf8 && newSize < m_size)
 		{
-			std::size_t characterToRemove = m_sharedString->size - newSize;
+			std::size_t characterToRemove = m_size - newSize;
 
-			char* ptr = &m_sharedString->string[m_sharedString->size];
+			char* ptr = &m_buffer[m_size];
 			for (std::size_t i = 0; i < characterToRemove; ++i)
-				utf8::prior(ptr, m_sharedString->string.get());
+				utf8::prior(ptr, m_buffer);
 
-			newSize = ptr - m_sharedString->string.get();
+			newSize = ptr - m_buffer;
 		}
 
-		if (m_sharedString->capacity >= newSize)
+		if (GetCapacity() >= newSize)
 		{
 			EnsureOwnership();
 
-			m_sharedString->size = newSize;
-			m_sharedString->string[newSize] = '\0'; // Adds the EoS character
+			m_size = newSize;
+			m_buffer[newSize] = '\0'; // Adds the EoS character
 		}
 		else // Then we want to make the string bigger
 		{
-			auto newString = std::make_shared<SharedString>(newSize);
-			std::memcpy(newString->string.get(), m_sharedString->string.get(), m_sharedString->size);
+			String newString;
+			newString.AllocateBuffer(newSize);
+			std::memcpy(newString.m_buffer, m_buffer, m_size);
 
-			m_sharedString = std::move(newString);
+			*this = std::move(newString);
 		}
 
 		return *this;
@@ -3161,33 +3175,34 @@ namespace Nz
 	String String::Resized(std::intmax_t size, UInt32 flags) const
 	{
 		if (size < 0)
-			size = m_sharedString->size + size;
+			size = m_size + size;
 
 		if (size <= 0)
 			return String();
 
 		std::size_t newSize = static_cast<std::size_t>(size);
-		if (newSize == m_sharedString->size)
+		if (newSize == m_size)
 			return *this;
 
-		if (flags & HandleUtf8 && newSize < m_sharedString->size)
+		if (flags & HandleUtf8 && newSize < m_size)
 		{
-			std::size_t characterToRemove = m_sharedString->size - newSize;
+			std::size_t characterToRemove = m_size - newSize;
 
-			char* ptr = &m_sharedString->string[m_sharedString->size - 1];
+			char* ptr = &m_buffer[m_size - 1];
 			for (std::size_t i = 0; i < characterToRemove; ++i)
-				utf8::prior(ptr, m_sharedString->string.get());
+				utf8::prior(ptr, m_buffer);
 
-			newSize = ptr - m_sharedString->string.get();
+			newSize = ptr - m_buffer;
 		}
 
-		auto sharedStr = std::make_shared<SharedString>(newSize);
-		if (newSize > m_sharedString->size)
-			std::memcpy(sharedStr->string.get(), m_sharedString->string.get(), m_sharedString->size);
+		String sharedStr;
+		sharedStr.AllocateBuffer(newSize);
+		if (newSize > m_size)
+			std::memcpy(sharedStr.m_buffer, m_buffer, m_size);
 		else
-			std::memcpy(sharedStr->string.get(), m_sharedString->string.get(), newSize);
+			std::memcpy(sharedStr.m_buffer, m_buffer, newSize);
 
-		return String(std::move(sharedStr));
+		return sharedStr;
 	}
 
 	/*!
@@ -3197,13 +3212,15 @@ namespace Nz
 
 	String& String::Reverse()
 	{
-		if (m_sharedString->size != 0)
+		if (m_size != 0)
 		{
+			EnsureOwnership();
+
 			std::size_t i = 0;
-			std::size_t j = m_sharedString->size-1;
+			std::size_t j = m_size-1;
 
 			while (i < j)
-				std::swap(m_sharedString->string[i++], m_sharedString->string[j--]);
+				std::swap(m_buffer[i++], m_buffer[j--]);
 		}
 
 		return *this;
@@ -3216,19 +3233,20 @@ namespace Nz
 
 	String String::Reversed() const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return String();
 
-		auto sharedStr = std::make_shared<SharedString>(m_sharedString->size);
+		String sharedStr;
+		sharedStr.AllocateBuffer(m_size);
 
-		char* ptr = &sharedStr->string[m_sharedString->size - 1];
-		char* p = m_sharedString->string.get();
+		char* ptr = &sharedStr.m_buffer[m_size - 1];
+		char* p = m_buffer;
 
 		do
 			*ptr-- = *p;
 		while (*(++p));
 
-		return String(std::move(sharedStr));
+		return sharedStr;
 	}
 
 	/*!
@@ -3242,17 +3260,17 @@ namespace Nz
 	{
 		if (character != '\0')
 		{
-			if (m_sharedString->capacity >= 1)
+			if (GetCapacity() >= 1)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = 1;
-				m_sharedString->string[1] = '\0';
+				m_size = 1;
+				m_buffer[1] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(1);
+				AllocateBuffer(1);
 
-			m_sharedString->string[0] = character;
+			m_buffer[0] = character;
 		}
 		else
 			ReleaseString();
@@ -3273,18 +3291,18 @@ namespace Nz
 	{
 		if (rep > 0)
 		{
-			if (m_sharedString->capacity >= rep)
+			if (GetCapacity() >= rep)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = rep;
-				m_sharedString->string[rep] = '\0';
+				m_size = rep;
+				m_buffer[rep] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(rep);
+				AllocateBuffer(rep);
 
 			if (character != '\0')
-				std::memset(m_sharedString->string.get(), character, rep);
+				std::memset(m_buffer, character, rep);
 		}
 		else
 			ReleaseString();
@@ -3320,18 +3338,18 @@ namespace Nz
 
 		if (totalSize > 0)
 		{
-			if (m_sharedString->capacity >= totalSize)
+			if (GetCapacity() >= totalSize)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = totalSize;
-				m_sharedString->string[totalSize] = '\0';
+				m_size = totalSize;
+				m_buffer[totalSize] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(totalSize);
+				AllocateBuffer(totalSize);
 
 			for (std::size_t i = 0; i < rep; ++i)
-				std::memcpy(&m_sharedString->string[i*length], string, length);
+				std::memcpy(&m_buffer[i*length], string, length);
 		}
 		else
 			ReleaseString();
@@ -3349,7 +3367,7 @@ namespace Nz
 
 	String& String::Set(std::size_t rep, const String& string)
 	{
-		return Set(rep, string.GetConstBuffer(), string.m_sharedString->size);
+		return Set(rep, string.GetConstBuffer(), string.m_size);
 	}
 
 	/*!
@@ -3376,17 +3394,17 @@ namespace Nz
 	{
 		if (length > 0)
 		{
-			if (m_sharedString->capacity >= length)
+			if (GetCapacity() >= length)
 			{
 				EnsureOwnership(true);
 
-				m_sharedString->size = length;
-				m_sharedString->string[length] = '\0';
+				m_size = length;
+				m_buffer[length] = '\0';
 			}
 			else
-				m_sharedString = std::make_shared<SharedString>(length);
+				AllocateBuffer(length);
 
-			std::memcpy(m_sharedString->string.get(), string, length);
+			std::memcpy(m_buffer, string, length);
 		}
 		else
 			ReleaseString();
@@ -3415,7 +3433,20 @@ namespace Nz
 
 	String& String::Set(const String& string)
 	{
-		m_sharedString = string.m_sharedString;
+		if (&string == this)
+			return *this;
+
+		ReleaseString();
+
+		m_size = string.m_size;
+		if (string.m_buffer == string.m_localBuffer)
+			std::memcpy(m_localBuffer, string.m_localBuffer, sizeof(m_localBuffer));
+		else
+		{
+			m_buffer = string.m_buffer;
+			m_sharedString = string.m_sharedString;
+			m_sharedString->refCount.fetch_add(1, std::memory_order_relaxed);
+		}
 
 		return *this;
 	}
@@ -3429,7 +3460,25 @@ namespace Nz
 
 	String& String::Set(String&& string) noexcept
 	{
-		std::swap(m_sharedString, string.m_sharedString);
+		if (&string == this)
+			return *this;
+
+		ReleaseString();
+
+		m_size = string.m_size;
+		if (string.m_buffer == string.m_localBuffer)
+			std::memcpy(m_localBuffer, string.m_localBuffer, sizeof(m_localBuffer));
+		else
+		{
+			// Steal the buffer
+			m_buffer = string.m_buffer;
+			m_sharedString = string.m_sharedString;
+
+			string.m_buffer = string.m_localBuffer;
+		}
+
+		string.m_size = 0;
+		string.m_localBuffer[0] = '\0';
 
 		return *this;
 	}
@@ -3443,14 +3492,15 @@ namespace Nz
 
 	String String::Simplified(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return String();
 
-		auto newString = std::make_shared<SharedString>(m_sharedString->size);
-		char* str = newString->string.get();
+		String newString;
+		newString.AllocateBuffer(m_size);
+		char* str = newString.m_buffer;
 		char* p = str;
 
-		const char* ptr = m_sharedString->string.get();
+		const char* ptr = m_buffer;
 		bool inword = false;
 		if (flags & HandleUtf8)
 		{
@@ -3475,7 +3525,7 @@ namespace Nz
 		}
 		else
 		{
-			const char* limit = &m_sharedString->string[m_sharedString->size];
+			const char* limit = &m_buffer[m_size];
 			do
 			{
 				if (Detail::IsSpace(*ptr))
@@ -3499,9 +3549,9 @@ namespace Nz
 			p--;
 
 		*p = '\0';
-		newString->size = p - str;
+		newString.m_size = p - str;
 
-		return String(std::move(newString));
+		return newString;
 	}
 
 	/*!
@@ -3528,7 +3578,7 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, char separation, std::intmax_t start, UInt32 flags) const
 	{
-		if (separation == '\0' || m_sharedString->size == 0)
+		if (separation == '\0' || m_size == 0)
 			return 0;
 
 		std::size_t lastSep = Find(separation, start, flags);
@@ -3552,7 +3602,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size-1)
+		if (lastSep != m_size-1)
 			result.push_back(SubString(lastSep+1));
 
 		return result.size();
@@ -3586,17 +3636,17 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, const char* separation, std::size_t length, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 		else if (length == 0)
 		{
-			result.reserve(m_sharedString->size);
-			for (std::size_t i = 0; i < m_sharedString->size; ++i)
-				result.push_back(String(m_sharedString->string[i]));
+			result.reserve(m_size);
+			for (std::size_t i = 0; i < m_size; ++i)
+				result.push_back(String(m_buffer[i]));
 
-			return m_sharedString->size;
+			return m_size;
 		}
-		else if (length > m_sharedString->size)
+		else if (length > m_size)
 		{
 			result.push_back(*this);
 			return 1;
@@ -3621,7 +3671,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size - length)
+		if (lastSep != m_size - length)
 			result.push_back(SubString(lastSep + length));
 
 		return result.size()-oldSize;
@@ -3639,7 +3689,7 @@ namespace Nz
 
 	unsigned int String::Split(std::vector<String>& result, const String& separation, std::intmax_t start, UInt32 flags) const
 	{
-		return Split(result, separation.m_sharedString->string.get(), separation.m_sharedString->size, start, flags);
+		return Split(result, separation.m_buffer, separation.m_size, start, flags);
 	}
 
 	/*!
@@ -3654,7 +3704,7 @@ namespace Nz
 
 	unsigned int String::SplitAny(std::vector<String>& result, const char* separations, std::intmax_t start, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return 0;
 
 		std::size_t oldSize = result.size();
@@ -3677,7 +3727,7 @@ namespace Nz
 			lastSep = sep;
 		}
 
-		if (lastSep != m_sharedString->size-1)
+		if (lastSep != m_size-1)
 			result.push_back(SubString(lastSep+1));
 
 		return result.size()-oldSize;
@@ -3695,7 +3745,7 @@ namespace Nz
 
 	unsigned int String::SplitAny(std::vector<String>& result, const String& separations, std::intmax_t start, UInt32 flags) const
 	{
-		return SplitAny(result, separations.m_sharedString->string.get(), start, flags);
+		return SplitAny(result, separations.m_buffer, start, flags);
 	}
 
 	/*!
@@ -3710,13 +3760,13 @@ namespace Nz
 
 	bool String::StartsWith(char character, UInt32 flags) const
 	{
-		if (character == '\0' || m_sharedString->size == 0)
+		if (character == '\0' || m_size == 0)
 			return false;
 
 		if (flags & CaseInsensitive)
-			return Detail::ToLower(m_sharedString->string[0]) == Detail::ToLower(character);
+			return Detail::ToLower(m_buffer[0]) == Detail::ToLower(character);
 		else
-			return m_sharedString->string[0] == character;
+			return m_buffer[0] == character;
 	}
 
 	/*!
@@ -3731,14 +3781,14 @@ namespace Nz
 
 	bool String::StartsWith(const char* string, UInt32 flags) const
 	{
-		if (!string || !string[0] || m_sharedString->size == 0)
+		if (!string || !string[0] || m_size == 0)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_buffer);
 				utf8::unchecked::iterator<const char*> it2(string);
 				do
 				{
@@ -3754,7 +3804,7 @@ namespace Nz
 			}
 			else
 			{
-				char* ptr = m_sharedString->string.get();
+				char* ptr = m_buffer;
 				const char* s = string;
 				do
 				{
@@ -3771,7 +3821,7 @@ namespace Nz
 		}
 		else
 		{
-			char* ptr = m_sharedString->string.get();
+			char* ptr = m_buffer;
 			const char* s = string;
 			do
 			{
@@ -3801,17 +3851,17 @@ namespace Nz
 
 	bool String::StartsWith(const String& string, UInt32 flags) const
 	{
-		if (string.m_sharedString->size == 0)
+		if (string.m_size == 0)
 			return false;
 
-		if (m_sharedString->size < string.m_sharedString->size)
+		if (m_size < string.m_size)
 			return false;
 
 		if (flags & CaseInsensitive)
 		{
 			if (flags & HandleUtf8)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_buffer);
 				utf8::unchecked::iterator<const char*> it2(string.GetConstBuffer());
 				do
 				{
@@ -3827,7 +3877,7 @@ namespace Nz
 			}
 			else
 			{
-				char* ptr = m_sharedString->string.get();
+				char* ptr = m_buffer;
 				const char* s = string.GetConstBuffer();
 				do
 				{
@@ -3843,7 +3893,7 @@ namespace Nz
 			}
 		}
 		else
-			return std::memcmp(m_sharedString->string.get(), string.GetConstBuffer(), string.m_sharedString->size) == 0;
+			return std::memcmp(m_buffer, string.GetConstBuffer(), string.m_size) == 0;
 
 		return false;
 	}
@@ -3859,27 +3909,28 @@ namespace Nz
 	String String::SubString(std::intmax_t startPos, std::intmax_t endPos) const
 	{
 		if (startPos < 0)
-			startPos = std::max<std::size_t>(m_sharedString->size + startPos, 0);
+			startPos = std::max<std::size_t>(m_size + startPos, 0);
 
 		std::size_t start = static_cast<std::size_t>(startPos);
 
 		if (endPos < 0)
 		{
-			endPos = m_sharedString->size+endPos;
+			endPos = m_size+endPos;
 			if (endPos < 0)
 				return String();
 		}
 
-		std::size_t minEnd = std::min(static_cast<std::size_t>(endPos), m_sharedString->size - 1);
-		if (start > minEnd || start >= m_sharedString->size)
+		std::size_t minEnd = std::min(static_cast<std::size_t>(endPos), m_size - 1);
+		if (start > minEnd || start >= m_size)
 			return String();
 
 		std::size_t size = minEnd - start + 1;
 
-		auto str = std::make_shared<SharedString>(size);
-		std::memcpy(str->string.get(), &m_sharedString->string[start], size);
+		String str;
+		str.AllocateBuffer(size);
+		std::memcpy(str.m_buffer, &m_buffer[start], size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -3969,7 +4020,7 @@ namespace Nz
 
 	String String::SubStringFrom(const String& string, std::intmax_t startPos, bool fromLast, bool include, UInt32 flags) const
 	{
-		return SubStringFrom(string.GetConstBuffer(), string.m_sharedString->size, startPos, fromLast, include, flags);
+		return SubStringFrom(string.GetConstBuffer(), string.m_size, startPos, fromLast, include, flags);
 	}
 
 	/*!
@@ -4059,7 +4110,7 @@ namespace Nz
 
 	String String::SubStringTo(const String& string, std::intmax_t startPos, bool toLast, bool include, UInt32 flags) const
 	{
-		return SubStringTo(string.GetConstBuffer(), string.m_sharedString->size, startPos, toLast, include, flags);
+		return SubStringTo(string.GetConstBuffer(), string.m_size, startPos, toLast, include, flags);
 	}
 
 	/*!
@@ -4070,7 +4121,9 @@ namespace Nz
 
 	void String::Swap(String& str)
 	{
-		std::swap(m_sharedString, str.m_sharedString);
+		String temp(std::move(str));
+		str = std::move(*this);
+		*this = std::move(temp);
 	}
 
 	/*!
@@ -4083,7 +4136,7 @@ namespace Nz
 
 	bool String::ToBool(bool* value, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		String word = GetWord(0);
@@ -4129,11 +4182,11 @@ namespace Nz
 
 	bool String::ToDouble(double* value) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (value)
-			*value = std::atof(m_sharedString->string.get());
+			*value = std::atof(m_buffer);
 
 		return true;
 	}
@@ -4168,14 +4221,14 @@ namespace Nz
 
 	String String::ToLower(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		if (flags & HandleUtf8)
 		{
 			String lower;
-			lower.Reserve(m_sharedString->size);
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			lower.Reserve(m_size);
+			utf8::unchecked::iterator<const char*> it(m_buffer);
 			do
 				utf8::append(Unicode::GetLowercase(*it), std::back_inserter(lower));
 			while (*++it);
@@ -4184,17 +4237,18 @@ namespace Nz
 		}
 		else
 		{
-			auto str = std::make_shared<SharedString>(m_sharedString->size);
+			String str;
+			str.AllocateBuffer(m_size);
 
-			char* ptr = m_sharedString->string.get();
-			char* s = str->string.get();
+			char* ptr = m_buffer;
+			char* s = str.m_buffer;
 			do
 				*s++ = Detail::ToLower(*ptr);
 			while (*++ptr);
 
 			*s = '\0';
 
-			return String(std::move(str));
+			return str;
 		}
 	}
 
@@ -4204,7 +4258,7 @@ namespace Nz
 	*/
 	std::string String::ToStdString() const
 	{
-		return std::string(m_sharedString->string.get(), m_sharedString->size);
+		return std::string(m_buffer, m_size);
 	}
 
 	/*!
@@ -4215,14 +4269,14 @@ namespace Nz
 	*/
 	String String::ToUpper(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		if (flags & HandleUtf8)
 		{
 			String upper;
-			upper.Reserve(m_sharedString->size);
-			utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+			upper.Reserve(m_size);
+			utf8::unchecked::iterator<const char*> it(m_buffer);
 			do
 				utf8::append(Unicode::GetUppercase(*it), std::back_inserter(upper));
 			while (*++it);
@@ -4231,17 +4285,18 @@ namespace Nz
 		}
 		else
 		{
-			auto str = std::make_shared<SharedString>(m_sharedString->size);
+			String str;
+			str.AllocateBuffer(m_size);
 
-			char* ptr = m_sharedString->string.get();
-			char* s = str->string.get();
+			char* ptr = m_buffer;
+			char* s = str.m_buffer;
 			do
 				*s++ = Detail::ToUpper(*ptr);
 			while (*++ptr);
 
 			*s = '\0';
 
-			return String(std::move(str));
+			return str;
 		}
 	}
 
@@ -4279,7 +4334,7 @@ namespace Nz
 
 	String String::Trimmed(UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		std::size_t startPos;
@@ -4288,7 +4343,7 @@ namespace Nz
 		{
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				utf8::unchecked::iterator<const char*> it(m_sharedString->string.get());
+				utf8::unchecked::iterator<const char*> it(m_buffer);
 				do
 				{
 					if (!Detail::IsSpace(*it))
@@ -4296,44 +4351,44 @@ namespace Nz
 				}
 				while (*++it);
 
-				startPos = it.base() - m_sharedString->string.get();
+				startPos = it.base() - m_buffer;
 			}
 			else
 				startPos = 0;
 
 			if ((flags & TrimOnlyLeft) == 0)
 			{
-				utf8::unchecked::iterator<const char*> it(&m_sharedString->string[m_sharedString->size]);
-				while ((it--).base() != m_sharedString->string.get())
+				utf8::unchecked::iterator<const char*> it(&m_buffer[m_size]);
+				while ((it--).base() != m_buffer)
 				{
 					if (!Detail::IsSpace(*it))
 						break;
 				}
 
-				endPos = it.base() - m_sharedString->string.get();
+				endPos = it.base() - m_buffer;
 			}
 			else
-				endPos = m_sharedString->size-1;
+				endPos = m_size-1;
 		}
 		else
 		{
 			startPos = 0;
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					char c = m_sharedString->string[startPos];
+					char c = m_buffer[startPos];
 					if (!Detail::IsSpace(c))
 						break;
 				}
 			}
 
-			endPos = m_sharedString->size-1;
+			endPos = m_size-1;
 			if ((flags & TrimOnlyLeft) == 0)
 			{
 				for (; endPos > 0; --endPos)
 				{
-					char c = m_sharedString->string[endPos];
+					char c = m_buffer[endPos];
 					if (!Detail::IsSpace(c))
 						break;
 				}
@@ -4353,19 +4408,19 @@ namespace Nz
 
 	String String::Trimmed(char character, UInt32 flags) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return *this;
 
 		std::size_t startPos = 0;
-		std::size_t endPos = m_sharedString->size-1;
+		std::size_t endPos = m_size-1;
 		if (flags & CaseInsensitive)
 		{
 			char ch = Detail::ToLower(character);
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					if (Detail::ToLower(m_sharedString->string[startPos]) != ch)
+					if (Detail::ToLower(m_buffer[startPos]) != ch)
 						break;
 				}
 			}
@@ -4374,7 +4429,7 @@ namespace Nz
 			{
 				for (; endPos > 0; --endPos)
 				{
-					if (Detail::ToLower(m_sharedString->string[endPos]) != ch)
+					if (Detail::ToLower(m_buffer[endPos]) != ch)
 						break;
 				}
 			}
@@ -4383,9 +4438,9 @@ namespace Nz
 		{
 			if ((flags & TrimOnlyRight) == 0)
 			{
-				for (; startPos < m_sharedString->size; ++startPos)
+				for (; startPos < m_size; ++startPos)
 				{
-					if (m_sharedString->string[startPos] != character)
+					if (m_buffer[startPos] != character)
 						break;
 				}
 			}
@@ -4394,7 +4449,7 @@ namespace Nz
 			{
 				for (; endPos > 0; --endPos)
 				{
-					if (m_sharedString->string[endPos] != character)
+					if (m_buffer[endPos] != character)
 						break;
 				}
 			}
@@ -4410,7 +4465,7 @@ namespace Nz
 
 	char* String::begin()
 	{
-		return m_sharedString->string.get();
+		return m_buffer;
 	}
 
 	/*!
@@ -4420,7 +4475,7 @@ namespace Nz
 
 	const char* String::begin() const
 	{
-		return m_sharedString->string.get();
+		return m_buffer;
 	}
 
 	/*!
@@ -4430,7 +4485,7 @@ namespace Nz
 
 	char* String::end()
 	{
-		return &m_sharedString->string[m_sharedString->size];
+		return &m_buffer[m_size];
 	}
 
 	/*!
@@ -4440,7 +4495,7 @@ namespace Nz
 
 	const char* String::end() const
 	{
-		return &m_sharedString->string[m_sharedString->size];
+		return &m_buffer[m_size];
 	}
 
 	/*!
@@ -4471,22 +4526,22 @@ namespace Nz
 	/*
 	char* String::rbegin()
 	{
-		return &m_sharedString->string[m_sharedString->size-1];
+		return &m_buffer[m_size-1];
 	}
 
 	const char* String::rbegin() const
 	{
-		return &m_sharedString->string[m_sharedString->size-1];
+		return &m_buffer[m_size-1];
 	}
 
 	char* String::rend()
 	{
-		return &m_sharedString->string[-1];
+		return &m_buffer[-1];
 	}
 
 	const char* String::rend() const
 	{
-		return &m_sharedString->string[-1];
+		return &m_buffer[-1];
 	}
 	*/
 
@@ -4503,10 +4558,10 @@ namespace Nz
 	{
 		EnsureOwnership();
 
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 			Resize(pos+1);
 
-		return m_sharedString->string[pos];
+		return m_buffer[pos];
 	}
 
 	/*!
@@ -4521,14 +4576,14 @@ namespace Nz
 	char String::operator[](std::size_t pos) const
 	{
 		#if NAZARA_CORE_SAFE
-		if (pos >= m_sharedString->size)
+		if (pos >= m_size)
 		{
-			NazaraError("Index out of range (" + Number(pos) + " >= " + Number(m_sharedString->size) + ')');
+			NazaraError("Index out of range (" + Number(pos) + " >= " + Number(m_size) + ')');
 			return 0;
 		}
 		#endif
 
-		return m_sharedString->string[pos];
+		return m_buffer[pos];
 	}
 
 	/*!
@@ -4603,11 +4658,12 @@ namespace Nz
 		if (character == '\0')
 			return *this;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + 1);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		str->string[m_sharedString->size] = character;
+		String str;
+		str.AllocateBuffer(m_size + 1);
+		std::memcpy(str.m_buffer, GetConstBuffer(), m_size);
+		str.m_buffer[m_size] = character;
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4622,18 +4678,19 @@ namespace Nz
 		if (!string || !string[0])
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
 		std::size_t length = std::strlen(string);
 		if (length == 0)
 			return *this;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + length);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string, length+1);
+		String str;
+		str.AllocateBuffer(m_size + length);
+		std::memcpy(str.m_buffer, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_buffer[m_size], string, length+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4648,14 +4705,15 @@ namespace Nz
 		if (string.empty())
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + string.size());
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string.c_str(), string.size()+1);
+		String str;
+		str.AllocateBuffer(m_size + string.size());
+		std::memcpy(str.m_buffer, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_buffer[m_size], string.c_str(), string.size()+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4667,17 +4725,18 @@ namespace Nz
 
 	String String::operator+(const String& string) const
 	{
-		if (string.m_sharedString->size == 0)
+		if (string.m_size == 0)
 			return *this;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string;
 
-		auto str = std::make_shared<SharedString>(m_sharedString->size + string.m_sharedString->size);
-		std::memcpy(str->string.get(), GetConstBuffer(), m_sharedString->size);
-		std::memcpy(&str->string[m_sharedString->size], string.GetConstBuffer(), string.m_sharedString->size);
+		String str;
+		str.AllocateBuffer(m_size + string.m_size);
+		std::memcpy(str.m_buffer, GetConstBuffer(), m_size);
+		std::memcpy(&str.m_buffer[m_size], string.GetConstBuffer(), string.m_size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -4689,7 +4748,7 @@ namespace Nz
 
 	String& String::operator+=(char character)
 	{
-		return Insert(m_sharedString->size, character);
+		return Insert(m_size, character);
 	}
 
 	/*!
@@ -4701,7 +4760,7 @@ namespace Nz
 
 	String& String::operator+=(const char* string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -4713,7 +4772,7 @@ namespace Nz
 
 	String& String::operator+=(const std::string& string)
 	{
-		return Insert(m_sharedString->size, string.c_str(), string.size());
+		return Insert(m_size, string.c_str(), string.size());
 	}
 
 	/*!
@@ -4725,7 +4784,7 @@ namespace Nz
 
 	String& String::operator+=(const String& string)
 	{
-		return Insert(m_sharedString->size, string);
+		return Insert(m_size, string);
 	}
 
 	/*!
@@ -4737,13 +4796,13 @@ namespace Nz
 
 	bool String::operator==(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return character == '\0';
 
-		if (m_sharedString->size > 1)
+		if (m_size > 1)
 			return false;
 
-		return m_sharedString->string[0] == character;
+		return m_buffer[0] == character;
 	}
 
 	/*!
@@ -4755,7 +4814,7 @@ namespace Nz
 
 	bool String::operator==(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return !string || !string[0];
 
 		if (!string || !string[0])
@@ -4773,10 +4832,10 @@ namespace Nz
 
 	bool String::operator==(const std::string& string) const
 	{
-		if (m_sharedString->size == 0 || string.empty())
-			return m_sharedString->size == string.size();
+		if (m_size == 0 || string.empty())
+			return m_size == string.size();
 
-		if (m_sharedString->size != string.size())
+		if (m_size != string.size())
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) == 0;
@@ -4791,16 +4850,16 @@ namespace Nz
 
 	bool String::operator!=(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return character != '\0';
 
-		if (character == '\0' || m_sharedString->size != 1)
+		if (character == '\0' || m_size != 1)
 			return true;
 
-		if (m_sharedString->size != 1)
+		if (m_size != 1)
 			return true;
 
-		return m_sharedString->string[0] != character;
+		return m_buffer[0] != character;
 	}
 
 	/*!
@@ -4812,7 +4871,7 @@ namespace Nz
 
 	bool String::operator!=(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return string && string[0];
 
 		if (!string || !string[0])
@@ -4830,10 +4889,10 @@ namespace Nz
 
 	bool String::operator!=(const std::string& string) const
 	{
-		if (m_sharedString->size == 0 || string.empty())
-			return m_sharedString->size == string.size();
+		if (m_size == 0 || string.empty())
+			return m_size == string.size();
 
-		if (m_sharedString->size != string.size())
+		if (m_size != string.size())
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) != 0;
@@ -4851,10 +4910,10 @@ namespace Nz
 		if (character == '\0')
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
-		return m_sharedString->string[0] < character;
+		return m_buffer[0] < character;
 	}
 
 	/*!
@@ -4869,7 +4928,7 @@ namespace Nz
 		if (!string || !string[0])
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		return std::strcmp(GetConstBuffer(), string) < 0;
@@ -4887,7 +4946,7 @@ namespace Nz
 		if (string.empty())
 			return false;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) < 0;
@@ -4902,13 +4961,13 @@ namespace Nz
 
 	bool String::operator<=(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (character == '\0')
 			return false;
 
-		return m_sharedString->string[0] < character || (m_sharedString->string[0] == character && m_sharedString->size == 1);
+		return m_buffer[0] < character || (m_buffer[0] == character && m_size == 1);
 	}
 
 	/*!
@@ -4920,7 +4979,7 @@ namespace Nz
 
 	bool String::operator<=(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (!string || !string[0])
@@ -4938,7 +4997,7 @@ namespace Nz
 
 	bool String::operator<=(const std::string& string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return true;
 
 		if (string.empty())
@@ -4956,13 +5015,13 @@ namespace Nz
 
 	bool String::operator>(char character) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (character == '\0')
 			return true;
 
-		return m_sharedString->string[0] > character;
+		return m_buffer[0] > character;
 	}
 
 	/*!
@@ -4974,7 +5033,7 @@ namespace Nz
 
 	bool String::operator>(const char* string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (!string || !string[0])
@@ -4992,7 +5051,7 @@ namespace Nz
 
 	bool String::operator>(const std::string& string) const
 	{
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		if (string.empty())
@@ -5013,10 +5072,10 @@ namespace Nz
 		if (character == '\0')
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
-		return m_sharedString->string[0] > character || (m_sharedString->string[0] == character && m_sharedString->size == 1);
+		return m_buffer[0] > character || (m_buffer[0] == character && m_size == 1);
 	}
 
 	/*!
@@ -5031,7 +5090,7 @@ namespace Nz
 		if (!string || !string[0])
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string) >= 0;
@@ -5049,7 +5108,7 @@ namespace Nz
 		if (string.empty())
 			return true;
 
-		if (m_sharedString->size == 0)
+		if (m_size == 0)
 			return false;
 
 		return std::strcmp(GetConstBuffer(), string.c_str()) >= 0;
@@ -5066,10 +5125,11 @@ namespace Nz
 	{
 		std::size_t size = (boolean) ? 4 : 5;
 
-		auto str = std::make_shared<SharedString>(size);
-		std::memcpy(str->string.get(), (boolean) ? "true" : "false", size);
+		String str;
+		str.AllocateBuffer(size);
+		std::memcpy(str.m_buffer, (boolean) ? "true" : "false", size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5082,10 +5142,10 @@ namespace Nz
 
 	int String::Compare(const String& first, const String& second)
 	{
-		if (first.m_sharedString->size == 0)
-			return (second.m_sharedString->size == 0) ? 0 : -1;
+		if (first.m_size == 0)
+			return (second.m_size == 0) ? 0 : -1;
 
-		if (second.m_sharedString->size == 0)
+		if (second.m_size == 0)
 			return 1;
 
 		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer());
@@ -5106,10 +5166,11 @@ namespace Nz
 
 		std::size_t length = std::vsnprintf(nullptr, 0, format, args);
 
-		auto str = std::make_shared<SharedString>(length);
-		std::vsnprintf(str->string.get(), length + 1, format, args2);
+		String str;
+		str.AllocateBuffer(length);
+		std::vsnprintf(str.m_buffer, length + 1, format, args2);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5304,10 +5365,11 @@ namespace Nz
 	{
 		const std::size_t capacity = sizeof(void*)*2 + 2;
 
-		auto str = std::make_shared<SharedString>(capacity);
-		str->size = std::sprintf(str->string.get(), "0x%p", ptr);
+		String str;
+		str.AllocateBuffer(capacity);
+		str.m_size = std::sprintf(str.m_buffer, "0x%p", ptr);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5332,10 +5394,11 @@ namespace Nz
 		else
 			count = 4;
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::append(character, str->string.get());
+		String str;
+		str.AllocateBuffer(count);
+		utf8::append(character, str.m_buffer);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5370,14 +5433,15 @@ namespace Nz
 
 		count *= 2; // We ensure to have enough place
 
-		auto str = std::make_shared<SharedString>(count);
+		String str;
+		str.AllocateBuffer(count);
 
-		char* r = utf8::utf16to8(u16String, ptr, str->string.get());
+		char* r = utf8::utf16to8(u16String, ptr, str.m_buffer);
 		*r = '\0';
 
-		str->size = r - str->string.get();
+		str.m_size = r - str.m_buffer;
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5408,10 +5472,11 @@ namespace Nz
 		}
 		while (*++ptr);
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::utf32to8(u32String, ptr, str->string.get());
+		String str;
+		str.AllocateBuffer(count);
+		utf8::utf32to8(u32String, ptr, str.m_buffer);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5442,10 +5507,11 @@ namespace Nz
 		}
 		while (*++ptr);
 
-		auto str = std::make_shared<SharedString>(count);
-		utf8::utf32to8(wString, ptr, str->string.get());
+		String str;
+		str.AllocateBuffer(count);
+		utf8::utf32to8(wString, ptr, str.m_buffer);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5493,7 +5559,7 @@ namespace Nz
 		if (str.IsEmpty())
 			return os;
 
-		return operator<<(os, str.m_sharedString->string.get());
+		return operator<<(os, str.m_buffer);
 	}
 
 	/*!
@@ -5512,11 +5578,12 @@ namespace Nz
 		if (string.IsEmpty())
 			return String(character);
 
-		auto str = std::make_shared<String::SharedString>(string.m_sharedString->size + 1);
-		str->string[0] = character;
-		std::memcpy(&str->string[1], string.GetConstBuffer(), string.m_sharedString->size);
+		String str;
+		str.AllocateBuffer(string.m_size + 1);
+		str.m_buffer[0] = character;
+		std::memcpy(&str.m_buffer[1], string.GetConstBuffer(), string.m_size);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5536,13 +5603,14 @@ namespace Nz
 			return string;
 
 		std::size_t size = std::strlen(string);
-		std::size_t totalSize = size + nstring.m_sharedString->size;
+		std::size_t totalSize = size + nstring.m_size;
 
-		auto str = std::make_shared<String::SharedString>(totalSize);
-		std::memcpy(str->string.get(), string, size);
-		std::memcpy(&str->string[size], nstring.GetConstBuffer(), nstring.m_sharedString->size+1);
+		String str;
+		str.AllocateBuffer(totalSize);
+		std::memcpy(str.m_buffer, string, size);
+		std::memcpy(&str.m_buffer[size], nstring.GetConstBuffer(), nstring.m_size+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5558,16 +5626,17 @@ namespace Nz
 		if (string.empty())
 			return nstring;
 
-		if (nstring.m_sharedString->size == 0)
+		if (nstring.m_size == 0)
 			return string;
 
-		std::size_t totalSize = string.size() + nstring.m_sharedString->size;
+		std::size_t totalSize = string.size() + nstring.m_size;
 
-		auto str = std::make_shared<String::SharedString>(totalSize);
-		std::memcpy(str->string.get(), string.c_str(), string.size());
-		std::memcpy(&str->string[string.size()], nstring.GetConstBuffer(), nstring.m_sharedString->size+1);
+		String str;
+		str.AllocateBuffer(totalSize);
+		std::memcpy(str.m_buffer, string.c_str(), string.size());
+		std::memcpy(&str.m_buffer[string.size()], nstring.GetConstBuffer(), nstring.m_size+1);
 
-		return String(std::move(str));
+		return str;
 	}
 
 	/*!
@@ -5580,16 +5649,16 @@ namespace Nz
 
 	bool operator==(const String& first, const String& second)
 	{
-		if (first.m_sharedString->size == 0 || second.m_sharedString->size == 0)
-			return first.m_sharedString->size == second.m_sharedString->size;
+		if (first.m_size == 0 || second.m_size == 0)
+			return first.m_size == second.m_size;
 
-		if (first.m_sharedString->size != second.m_sharedString->size)
+		if (first.m_size != second.m_size)
 			return false;
 
-		if (first.m_sharedString == second.m_sharedString)
+		if (first.m_buffer == second.m_buffer)
 			return true;
 
-		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer()) == 0;
+		return std::memcmp(first.m_buffer, second.m_buffer, first.m_size) == 0;
 	}
 
 	/*!
@@ -5615,10 +5684,10 @@ namespace Nz
 
 	bool operator<(const String& first, const String& second)
 	{
-		if (second.m_sharedString->size == 0)
+		if (second.m_size == 0)
 			return false;
 
-		if (first.m_sharedString->size == 0)
+		if (first.m_size == 0)
 			return true;
 
 		return std::strcmp(first.GetConstBuffer(), second.GetConstBuffer()) < 0;
@@ -5897,6 +5966,35 @@ namespace Nz
 		return !operator<(string, nstring);
 	}
 
+	/*!
+	* \brief Replaces the content of the string by a buffer only owned by this string
+	*
+	* \param size Size of the string, its characters are left uninitialized
+	* \param capacity Minimum capacity of the buffer
+	*
+	* \remark Strings fitting in the inline buffer never allocate
+	*/
+
+	void String::AllocateBuffer(std::size_t size, std::size_t capacity)
+	{
+		ReleaseString();
+
+		capacity = std::max(size, capacity);
+		if (capacity > LocalCapacity)
+		{
+			void* memory = ::operator new(sizeof(SharedString) + capacity + 1);
+
+			m_sharedString = new (memory) SharedString;
+			m_sharedString->capacity = capacity;
+			m_sharedString->refCount.store(1, std::memory_order_relaxed);
+
+			m_buffer = reinterpret_cast<char*>(m_sharedString + 1);
+		}
+
+		m_size = size;
+		m_buffer[size] = '\0';
+	}
+
 	/*!
 	* \brief Ensures the ownership of the string
 	*
@@ -5905,28 +6003,31 @@ namespace Nz
 
 	void String::EnsureOwnership(bool discardContent)
 	{
-		if (!m_sharedString)
+		if (m_buffer == m_localBuffer)
 			return;
 
-		if (!m_sharedString.unique())
+		// Nobody else can add a reference to a buffer we are the last owner of
+		if (m_sharedString->refCount.load(std::memory_order_acquire) != 1)
 		{
-			auto newSharedString = std::make_shared<SharedString>(GetSize(), GetCapacity());
-			if (!discardContent && newSharedString->size > 0)
-				std::memcpy(newSharedString->string.get(), GetConstBuffer(), GetSize()+1);
+			String newString;
+			newString.AllocateBuffer(m_size, GetCapacity());
+			if (!discardContent && m_size > 0)
+				std::memcpy(newString.m_buffer, m_buffer, m_size);
 
-			m_sharedString = std::move(newSharedString);
+			*this = std::move(newString);
 		}
 	}
 
 	/*!
-	* \brief Gets the empty string
-	* \return A reference to the empty string
+	* \brief Releases a buffer shared by multiple strings
+	*
+	* \param sharedString Header of the buffer
 	*/
 
-	const std::shared_ptr<String::SharedString>& String::GetEmptyString()
+	void String::FreeSharedString(SharedString* sharedString)
 	{
-		static auto emptyString = std::make_shared<SharedString>();
-		return emptyString;
+		sharedString->~SharedString();
+		::operator delete(sharedString);
 	}
 
 	/*!
@@ -0,0 +1,21 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/StringView.hpp>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::StringView
+	* \brief Core class that represents a non-owning reference to a sequence of characters
+	*
+	* A view is cheap to copy and to build from a "C string", a std::string or a Nz::String, making it suitable for parameters
+	* only used for lookups. The referenced characters must outlive the view and are not guaranteed to be null-terminated.
+	*/
+
+	const std::size_t StringView::npos(std::numeric_limits<std::size_t>::max());
+}
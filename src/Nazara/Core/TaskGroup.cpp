@@ -0,0 +1,152 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	struct TaskGroup::Task
+	{
+		std::vector<Task*> successors;      //< Protected by group mutex
+		TaskGroup* group;
+		TaskScheduler::TaskSlot* slot;      //< Held until the task is submitted to the scheduler
+		unsigned int remainingDependencies; //< Protected by group mutex
+		bool completed;                     //< Protected by group mutex
+	};
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaskGroup
+	* \brief Core class that represents a set of tasks which can be waited independently from the others
+	*
+	* Tasks of a group can depend on other tasks of the same group, they will only be submitted to the scheduler
+	* once every one of their dependencies is completed.
+	*
+	* \remark A TaskGroup can be waited from a task, in which case the waiting thread executes pending tasks instead of sleeping
+	*/
+
+	/*!
+	* \brief Constructs an empty TaskGroup object
+	*/
+	TaskGroup::TaskGroup() :
+	m_pendingTaskCount(0),
+	m_taskCount(0)
+	{
+	}
+
+	/*!
+	* \brief Destructs the object, waiting for all its tasks to be completed
+	*/
+	TaskGroup::~TaskGroup()
+	{
+		Wait();
+
+		// Makes sure the thread which completed the last task has released the mutex
+		LockGuard lock(m_mutex);
+	}
+
+	/*!
+	* \brief Waits for all tasks and forgets about them
+	*
+	* Memory used to track the tasks is kept to be reused by the next ones, making a cleared group cheap to fill again.
+	*
+	* \remark Task identifiers previously returned by this group are invalidated
+	*/
+	void TaskGroup::Clear()
+	{
+		Wait();
+
+		LockGuard lock(m_mutex);
+		m_taskCount = 0;
+	}
+
+	/*!
+	* \brief Waits for every task of this group to be completed, running pending tasks in the meantime
+	*
+	* \see TaskScheduler::Wait
+	*/
+	void TaskGroup::Wait()
+	{
+		if (!IsDone())
+			TaskScheduler::Wait(*this);
+	}
+
+	TaskGroup::TaskId TaskGroup::AddTaskSlot(TaskScheduler::TaskSlot* taskSlot, const TaskId* dependencies, std::size_t dependencyCount)
+	{
+		m_pendingTaskCount++;
+
+		LockGuard lock(m_mutex);
+
+		if (m_taskCount == m_tasks.size())
+			m_tasks.emplace_back(std::make_unique<Task>());
+
+		Task* task = m_tasks[m_taskCount++].get();
+		task->completed = false;
+		task->group = this;
+		task->remainingDependencies = 0;
+		task->slot = taskSlot;
+
+		taskSlot->groupTask = task;
+
+		for (std::size_t i = 0; i < dependencyCount; ++i)
+		{
+			Task* dependency = dependencies[i];
+			NazaraAssert(dependency && dependency->group == this, "Dependency must be a task of the same group");
+
+			if (!dependency->completed)
+			{
+				dependency->successors.push_back(task);
+				task->remainingDependencies++;
+			}
+		}
+
+		if (task->remainingDependencies == 0)
+		{
+			task->slot = nullptr;
+			TaskScheduler::SubmitTask(taskSlot);
+		}
+
+		return task;
+	}
+
+	bool TaskGroup::WaitForCompletion(UInt32 timeout)
+	{
+		LockGuard lock(m_mutex);
+		if (m_pendingTaskCount.load() == 0)
+			return true;
+
+		m_doneCondition.Wait(&m_mutex, timeout);
+
+		return m_pendingTaskCount.load() == 0;
+	}
+
+	void TaskGroup::OnTaskCompleted(Task* task)
+	{
+		TaskGroup* group = task->group;
+
+		LockGuard lock(group->m_mutex);
+
+		task->completed = true;
+
+		for (Task* successor : task->successors)
+		{
+			if (--successor->remainingDependencies == 0)
+			{
+				TaskScheduler::TaskSlot* successorSlot = successor->slot;
+				successor->slot = nullptr;
+
+				TaskScheduler::SubmitTask(successorSlot);
+			}
+		}
+		task->successors.clear(); // Keep capacity, this node may be reused after a Clear
+
+		// Last access to the group must be done while holding the mutex, as the group may be destroyed right after
+		if (--group->m_pendingTaskCount == 0)
+			group->m_doneCondition.SignalAll();
+	}
+}
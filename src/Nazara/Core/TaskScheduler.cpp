@@ -3,32 +3,107 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/ConditionVariable.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
-
-#if defined(NAZARA_PLATFORM_WINDOWS)
-	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
-#elif defined(NAZARA_PLATFORM_POSIX)
-	#include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
-#else
-	#error Lack of implementation: Task Scheduler
-#endif
-
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Nazara/Core/WorkStealingQueue.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	namespace
+	class TaskSchedulerImpl
 	{
-		std::vector<Functor*> s_pendingWorks;
-		unsigned int s_workerCount = 0;
-	}
+		public:
+			using TaskSlot = TaskScheduler::TaskSlot;
+
+			struct Worker
+			{
+				WorkStealingQueue<TaskSlot*> queue;
+				Thread thread;
+				UInt32 randomState;
+			};
+
+			struct SchedulerData
+			{
+				ConditionVariable doneCondition;
+				ConditionVariable wakeCondition;
+				Mutex doneMutex;
+				Mutex injectionMutex;
+				Mutex wakeMutex;
+				std::atomic_bool running;
+				std::atomic_uint activeTaskCount;      //< Tasks submitted to the workers but not yet completed
+				std::atomic_uint queuedTaskCount;      //< Tasks submitted to the workers but not yet picked by one of them
+				std::atomic_uint sleepingWorkerCount;
+				std::size_t injectionOffset;           //< Index of the next task to take from the injection queue
+				std::vector<TaskSlot*> injectionQueue; //< Tasks submitted from outside the workers, protected by injectionMutex
+				std::unique_ptr<Worker[]> workers;
+				unsigned int workerCount;
+			};
+
+			// Free task slots owned by a thread, allocating and releasing tasks only touches this list most of the time
+			struct SlotCache
+			{
+				~SlotCache();
+
+				TaskSlot* head;
+				std::size_t count;
+			};
+
+			struct SlotBatch
+			{
+				TaskSlot* head;
+				std::size_t count;
+			};
+
+			// Free slots exchanged between threads by batches, as tasks are usually released by another thread than the one which created them
+			struct SlotPool
+			{
+				Mutex mutex;
+				std::vector<std::unique_ptr<TaskSlot[]>> chunks;
+				std::vector<SlotBatch> batches;
+			};
+
+			static TaskSlot* FetchExternalTask();
+			static TaskSlot* FetchTask(Worker& worker);
+			static SlotPool& GetSlotPool();
+			static TaskSlot* GrabInjectedTasks(Worker& worker);
+			static void NotifyTaskCompletion();
+			static bool RunPendingTask();
+			static void RunTask(TaskSlot* task);
+			static TaskSlot* StealTask(Worker* thief, UInt32& randomState);
+			static void WakeWorkers(std::size_t taskCount);
+			static void WorkerProc(Worker* worker);
+
+			static constexpr std::size_t SlotBatchSize = 64;
+
+			static std::unique_ptr<SchedulerData> s_scheduler;
+			static std::vector<TaskSlot*> s_pendingWorks;
+			static thread_local SlotCache s_slotCache;
+			static thread_local Worker* s_currentWorker;
+			static thread_local unsigned int s_runningTaskDepth; //< Number of tasks being executed by this thread (may be nested by waits)
+			static unsigned int s_workerCount;
+	};
 
 	/*!
 	* \ingroup core
 	* \class Nz::TaskScheduler
 	* \brief Core class that represents a pool of threads
 	*
+	* Each worker owns a lock-free deque of tasks, tasks added from a worker are pushed to its own deque
+	* and idle workers steal tasks from the others.
+	*
+	* Tasks live in pooled slots recycled by each thread, their functor is constructed inside the slot when its captures
+	* do not exceed MaxInlineCaptureSize bytes, making task submission allocation-free in the common case.
+	*
 	* \remark Initialized should be called first
 	*/
 
@@ -39,7 +114,7 @@ namespace Nz
 
 	unsigned int TaskScheduler::GetWorkerCount()
 	{
-		return (s_workerCount > 0) ? s_workerCount : HardwareInfo::GetProcessorCount();
+		return (TaskSchedulerImpl::s_workerCount > 0) ? TaskSchedulerImpl::s_workerCount : HardwareInfo::GetProcessorCount();
 	}
 
 	/*!
@@ -49,7 +124,41 @@ namespace Nz
 
 	bool TaskScheduler::Initialize()
 	{
-		return TaskSchedulerImpl::Initialize(GetWorkerCount());
+		using Worker = TaskSchedulerImpl::Worker;
+
+		auto& scheduler = TaskSchedulerImpl::s_scheduler;
+		if (scheduler)
+			return true; // Already initialized
+
+		unsigned int workerCount = GetWorkerCount();
+
+		#if NAZARA_CORE_SAFE
+		if (workerCount == 0)
+		{
+			NazaraError("Invalid worker count ! (0)");
+			return false;
+		}
+		#endif
+
+		scheduler = std::make_unique<TaskSchedulerImpl::SchedulerData>();
+		scheduler->activeTaskCount = 0;
+		scheduler->injectionOffset = 0;
+		scheduler->queuedTaskCount = 0;
+		scheduler->running = true;
+		scheduler->sleepingWorkerCount = 0;
+		scheduler->workerCount = workerCount;
+		scheduler->workers.reset(new Worker[workerCount]);
+
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			Worker& worker = scheduler->workers[i];
+			worker.randomState = 2463534242U + i * 2654435761U; // Any non-zero seed will do
+
+			worker.thread = Thread(TaskSchedulerImpl::WorkerProc, &worker);
+			worker.thread.SetName("Task worker #" + String::Number(i));
+		}
+
+		return true;
 	}
 
 	/*!
@@ -66,10 +175,22 @@ namespace Nz
 			return;
 		}
 
-		if (!s_pendingWorks.empty())
+		auto& scheduler = TaskSchedulerImpl::s_scheduler;
+		std::vector<TaskSlot*>& pendingWorks = TaskSchedulerImpl::s_pendingWorks;
+		if (!pendingWorks.empty())
 		{
-			TaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
-			s_pendingWorks.clear();
+			std::size_t taskCount = pendingWorks.size();
+			scheduler->activeTaskCount += static_cast<unsigned int>(taskCount);
+			scheduler->queuedTaskCount += static_cast<unsigned int>(taskCount);
+
+			{
+				LockGuard lock(scheduler->injectionMutex);
+				scheduler->injectionQueue.insert(scheduler->injectionQueue.end(), pendingWorks.begin(), pendingWorks.end());
+			}
+
+			pendingWorks.clear();
+
+			TaskSchedulerImpl::WakeWorkers(taskCount);
 		}
 	}
 
@@ -84,30 +205,98 @@ namespace Nz
 	void TaskScheduler::SetWorkerCount(unsigned int workerCount)
 	{
 		#ifdef NAZARA_CORE_SAFE
-		if (TaskSchedulerImpl::IsInitialized())
+		if (TaskSchedulerImpl::s_scheduler)
 		{
 			NazaraError("Worker count cannot be set while initialized");
 			return;
 		}
 		#endif
 
-		s_workerCount = workerCount;
+		TaskSchedulerImpl::s_workerCount = workerCount;
 	}
 
 	/*!
 	* \brief Uninitializes the TaskScheduler class
+	*
+	* \remark Tasks which were not yet executed are destroyed without being run
 	*/
 
 	void TaskScheduler::Uninitialize()
 	{
-		if (TaskSchedulerImpl::IsInitialized())
-			TaskSchedulerImpl::Uninitialize();
+		auto& scheduler = TaskSchedulerImpl::s_scheduler;
+		if (!scheduler)
+			return;
+
+		{
+			LockGuard lock(scheduler->wakeMutex);
+			scheduler->running = false;
+			scheduler->wakeCondition.SignalAll();
+		}
+
+		for (unsigned int i = 0; i < scheduler->workerCount; ++i)
+			scheduler->workers[i].thread.Join();
+
+		// Workers are stopped, we can now safely free the remaining tasks
+		for (unsigned int i = 0; i < scheduler->workerCount; ++i)
+		{
+			TaskSlot* task;
+			while (scheduler->workers[i].queue.Pop(&task))
+				ReleaseTaskSlot(task);
+		}
+
+		for (std::size_t i = scheduler->injectionOffset; i < scheduler->injectionQueue.size(); ++i)
+			ReleaseTaskSlot(scheduler->injectionQueue[i]);
+
+		for (TaskSlot* task : TaskSchedulerImpl::s_pendingWorks)
+			ReleaseTaskSlot(task);
+
+		TaskSchedulerImpl::s_pendingWorks.clear();
+		scheduler.reset();
+	}
+
+	/*!
+	* \brief Waits for every task of a group to be done
+	*
+	* \param group Group to wait for
+	*
+	* The calling thread executes pending tasks (of any group) while waiting, so this can be called from a task.
+	*
+	* \remark Produce a NazaraError if the class is not initialized
+	*/
+
+	void TaskScheduler::Wait(TaskGroup& group)
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			return;
+		}
+
+		constexpr unsigned int spinCount = 64;
+
+		unsigned int failedAttempts = 0;
+		while (!group.IsDone())
+		{
+			if (TaskSchedulerImpl::RunPendingTask())
+				failedAttempts = 0;
+			else if (++failedAttempts < spinCount)
+				Thread::Sleep(0); // Yield, remaining tasks are probably being executed
+			else
+			{
+				// Nothing to help with, sleep until the group is done (or until a new task may be available)
+				group.WaitForCompletion(1);
+				failedAttempts = 0;
+			}
+		}
 	}
 
 	/*!
 	* \brief Waits for tasks to be done
 	*
+	* The calling thread executes pending tasks while waiting.
+	*
 	* \remark Produce a NazaraError if the class is not initialized
+	* \remark Produce a NazaraError if called from a task (which would wait for itself), use a TaskGroup instead
 	*/
 
 	void TaskScheduler::WaitForTasks()
@@ -118,26 +307,369 @@ namespace Nz
 			return;
 		}
 
-		TaskSchedulerImpl::WaitForTasks();
+		if (TaskSchedulerImpl::s_runningTaskDepth > 0)
+		{
+			NazaraError("WaitForTasks cannot be called from a task, use a TaskGroup instead");
+			return;
+		}
+
+		auto& scheduler = TaskSchedulerImpl::s_scheduler;
+		while (scheduler->activeTaskCount.load() > 0)
+		{
+			if (!TaskSchedulerImpl::RunPendingTask())
+			{
+				LockGuard lock(scheduler->doneMutex);
+				while (scheduler->activeTaskCount.load() > 0)
+					scheduler->doneCondition.Wait(&scheduler->doneMutex);
+			}
+		}
 	}
 
 	/*!
 	* \brief Adds a task on the pending list
 	*
-	* \param taskFunctor Functor represeting a task to be done
+	* \param task Task to be done
 	*
 	* \remark Produce a NazaraError if the class is not initialized
-	* \remark A task containing a call on this class is undefined behaviour
+	* \remark When called from a task, the new task is directly pushed in the current worker queue (without requiring a call to Run)
 	*/
 
-	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
+	void TaskScheduler::AddTaskSlot(TaskSlot* task)
 	{
 		if (!Initialize())
 		{
 			NazaraError("Failed to initialize Task Scheduler");
+			ReleaseTaskSlot(task);
 			return;
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		if (TaskSchedulerImpl::s_runningTaskDepth > 0)
+			SubmitTask(task); // Spawned from a task, keep it local (other workers will steal it if they're idle)
+		else
+			TaskSchedulerImpl::s_pendingWorks.push_back(task);
+	}
+
+	/*!
+	* \brief Takes a free task slot from the calling thread cache
+	* \return Task slot, its functor has to be constructed by the caller
+	*
+	* \remark The cache is refilled by batches from a global pool, which only allocates memory when no free batch is available
+	*/
+
+	TaskScheduler::TaskSlot* TaskScheduler::AllocateTaskSlot()
+	{
+		constexpr std::size_t batchSize = TaskSchedulerImpl::SlotBatchSize;
+
+		TaskSchedulerImpl::SlotCache& cache = TaskSchedulerImpl::s_slotCache;
+		if (!cache.head)
+		{
+			TaskSchedulerImpl::SlotPool& pool = TaskSchedulerImpl::GetSlotPool();
+
+			LockGuard lock(pool.mutex);
+			if (!pool.batches.empty())
+			{
+				const TaskSchedulerImpl::SlotBatch& batch = pool.batches.back();
+				cache.head = batch.head;
+				cache.count = batch.count;
+
+				pool.batches.pop_back();
+			}
+			else
+			{
+				std::unique_ptr<TaskSlot[]> chunk(new TaskSlot[batchSize]);
+				for (std::size_t i = 0; i < batchSize - 1; ++i)
+					chunk[i].next = &chunk[i + 1];
+
+				chunk[batchSize - 1].next = nullptr;
+
+				cache.head = chunk.get();
+				cache.count = batchSize;
+
+				pool.chunks.emplace_back(std::move(chunk));
+			}
+		}
+
+		TaskSlot* task = cache.head;
+		cache.head = task->next;
+		cache.count--;
+
+		return task;
+	}
+
+	/*!
+	* \brief Destroys the functor of a task and gives its slot back to the calling thread cache
+	*
+	* \param task Task to release
+	*/
+
+	void TaskScheduler::ReleaseTaskSlot(TaskSlot* task)
+	{
+		constexpr std::size_t batchSize = TaskSchedulerImpl::SlotBatchSize;
+
+		if (reinterpret_cast<UInt8*>(task->functor) == task->storage)
+			PlacementDestroy(task->functor);
+		else
+			delete task->functor;
+
+		TaskSchedulerImpl::SlotCache& cache = TaskSchedulerImpl::s_slotCache;
+		task->next = cache.head;
+		cache.head = task;
+		cache.count++;
+
+		// Workers usually release more tasks than they create, give the surplus back to the pool so other threads can use them
+		if (cache.count >= batchSize * 2)
+		{
+			TaskSlot* first = cache.head;
+			TaskSlot* last = first;
+			for (std::size_t i = 1; i < batchSize; ++i)
+				last = last->next;
+
+			cache.head = last->next;
+			cache.count -= batchSize;
+			last->next = nullptr;
+
+			TaskSchedulerImpl::SlotPool& pool = TaskSchedulerImpl::GetSlotPool();
+
+			LockGuard lock(pool.mutex);
+			pool.batches.push_back({first, batchSize});
+		}
 	}
+
+	/*!
+	* \brief Submits a task to the workers without waiting for Run
+	*
+	* \param task Task to be done
+	*
+	* \remark When called from a task, the task is pushed in the current worker queue
+	*/
+
+	void TaskScheduler::SubmitTask(TaskSlot* task)
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			ReleaseTaskSlot(task);
+			return;
+		}
+
+		auto& scheduler = TaskSchedulerImpl::s_scheduler;
+		scheduler->activeTaskCount++;
+		scheduler->queuedTaskCount++;
+
+		if (TaskSchedulerImpl::s_currentWorker)
+			TaskSchedulerImpl::s_currentWorker->queue.Push(task);
+		else
+		{
+			LockGuard lock(scheduler->injectionMutex);
+			scheduler->injectionQueue.push_back(task);
+		}
+
+		TaskSchedulerImpl::WakeWorkers(1);
+	}
+
+	TaskSchedulerImpl::SlotCache::~SlotCache()
+	{
+		// The thread is exiting (workers when the scheduler is uninitialized), give its free slots back for the next threads
+		if (!head)
+			return;
+
+		SlotPool& pool = GetSlotPool();
+
+		LockGuard lock(pool.mutex);
+		pool.batches.push_back({head, count});
+
+		head = nullptr;
+		count = 0;
+	}
+
+	auto TaskSchedulerImpl::FetchExternalTask() -> TaskSlot*
+	{
+		// Threads which are not part of the pool have no queue, they can only take injected tasks or steal from workers
+		thread_local UInt32 randomState = 2463534242U;
+
+		TaskSlot* task = nullptr;
+		{
+			LockGuard lock(s_scheduler->injectionMutex);
+
+			std::vector<TaskSlot*>& injectionQueue = s_scheduler->injectionQueue;
+			std::size_t& offset = s_scheduler->injectionOffset;
+			if (offset < injectionQueue.size())
+			{
+				task = injectionQueue[offset++];
+				if (offset == injectionQueue.size())
+				{
+					injectionQueue.clear();
+					offset = 0;
+				}
+			}
+		}
+
+		if (!task)
+			task = StealTask(nullptr, randomState);
+
+		if (task)
+			s_scheduler->queuedTaskCount--;
+
+		return task;
+	}
+
+	auto TaskSchedulerImpl::FetchTask(Worker& worker) -> TaskSlot*
+	{
+		TaskSlot* task;
+		if (!worker.queue.Pop(&task))
+		{
+			task = GrabInjectedTasks(worker);
+			if (!task)
+				task = StealTask(&worker, worker.randomState);
+		}
+
+		if (task)
+			s_scheduler->queuedTaskCount--;
+
+		return task;
+	}
+
+	auto TaskSchedulerImpl::GetSlotPool() -> SlotPool&
+	{
+		// Slots may outlive the scheduler (tasks created before its initialization or cached by threads), so is the pool
+		static SlotPool pool;
+		return pool;
+	}
+
+	auto TaskSchedulerImpl::GrabInjectedTasks(Worker& worker) -> TaskSlot*
+	{
+		LockGuard lock(s_scheduler->injectionMutex);
+
+		std::vector<TaskSlot*>& injectionQueue = s_scheduler->injectionQueue;
+		std::size_t& offset = s_scheduler->injectionOffset;
+		if (offset >= injectionQueue.size())
+			return nullptr;
+
+		TaskSlot* task = injectionQueue[offset++];
+
+		// Take our share of the remaining tasks in our own queue, so other workers can steal them from us without locking
+		std::size_t share = (injectionQueue.size() - offset) / s_scheduler->workerCount;
+		for (std::size_t i = 0; i < share; ++i)
+			worker.queue.Push(injectionQueue[offset++]);
+
+		// Keep the memory around for the next tasks
+		if (offset == injectionQueue.size())
+		{
+			injectionQueue.clear();
+			offset = 0;
+		}
+
+		if (share > 0)
+			WakeWorkers(share);
+
+		return task;
+	}
+
+	void TaskSchedulerImpl::NotifyTaskCompletion()
+	{
+		if (--s_scheduler->activeTaskCount == 0)
+		{
+			LockGuard lock(s_scheduler->doneMutex);
+			s_scheduler->doneCondition.SignalAll();
+		}
+	}
+
+	bool TaskSchedulerImpl::RunPendingTask()
+	{
+		TaskSlot* task = (s_currentWorker) ? FetchTask(*s_currentWorker) : FetchExternalTask();
+		if (!task)
+			return false;
+
+		RunTask(task);
+		return true;
+	}
+
+	void TaskSchedulerImpl::RunTask(TaskSlot* task)
+	{
+		s_runningTaskDepth++;
+		{
+			NazaraProfileZone("TaskScheduler::RunTask");
+			task->functor->Run();
+		}
+		s_runningTaskDepth--;
+
+		TaskGroup::Task* groupTask = static_cast<TaskGroup::Task*>(task->groupTask);
+		TaskScheduler::ReleaseTaskSlot(task);
+
+		if (groupTask)
+			TaskGroup::OnTaskCompleted(groupTask);
+
+		NotifyTaskCompletion();
+	}
+
+	auto TaskSchedulerImpl::StealTask(Worker* thief, UInt32& randomState) -> TaskSlot*
+	{
+		unsigned int workerCount = s_scheduler->workerCount;
+
+		// Xorshift, to pick a random victim and prevent every idle worker from trying to rob the same one
+		randomState ^= randomState << 13;
+		randomState ^= randomState >> 17;
+		randomState ^= randomState << 5;
+
+		unsigned int offset = randomState % workerCount;
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			Worker& victim = s_scheduler->workers[(offset + i) % workerCount];
+			if (&victim == thief)
+				continue;
+
+			TaskSlot* task;
+			if (victim.queue.Steal(&task))
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void TaskSchedulerImpl::WakeWorkers(std::size_t taskCount)
+	{
+		// queuedTaskCount has already been increased, if a worker is about to sleep it will see it
+		if (s_scheduler->sleepingWorkerCount.load() == 0)
+			return;
+
+		LockGuard lock(s_scheduler->wakeMutex);
+		if (taskCount > 1)
+			s_scheduler->wakeCondition.SignalAll();
+		else
+			s_scheduler->wakeCondition.Signal();
+	}
+
+	void TaskSchedulerImpl::WorkerProc(Worker* worker)
+	{
+		s_currentWorker = worker;
+
+		Profiler::SetThreadName("Task worker #" + String::Number(worker - s_scheduler->workers.get()));
+
+		while (s_scheduler->running)
+		{
+			if (TaskSlot* task = FetchTask(*worker))
+				RunTask(task);
+			else if (s_scheduler->queuedTaskCount.load() == 0)
+			{
+				// No work left, go to sleep until a task is submitted
+				LockGuard lock(s_scheduler->wakeMutex);
+
+				s_scheduler->sleepingWorkerCount++;
+				while (s_scheduler->running && s_scheduler->queuedTaskCount.load() == 0)
+					s_scheduler->wakeCondition.Wait(&s_scheduler->wakeMutex);
+
+				s_scheduler->sleepingWorkerCount--;
+			}
+			// else a task is being pushed or was taken by someone else, try again
+		}
+
+		s_currentWorker = nullptr;
+	}
+
+	std::unique_ptr<TaskSchedulerImpl::SchedulerData> TaskSchedulerImpl::s_scheduler;
+	std::vector<TaskSchedulerImpl::TaskSlot*> TaskSchedulerImpl::s_pendingWorks;
+	thread_local TaskSchedulerImpl::SlotCache TaskSchedulerImpl::s_slotCache = { nullptr, 0 };
+	thread_local TaskSchedulerImpl::Worker* TaskSchedulerImpl::s_currentWorker = nullptr;
+	thread_local unsigned int TaskSchedulerImpl::s_runningTaskDepth = 0;
+	unsigned int TaskSchedulerImpl::s_workerCount = 0;
 }
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <ostream>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -150,6 +151,7 @@ namespace Nz
 		NazaraAssert(name.GetSize() < 16, "Thread name is too long");
 
 		ThreadImpl::SetCurrentName(name);
+		Profiler::SetThreadName(name);
 	}
 
 	/*!
@@ -0,0 +1,137 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/String.hpp>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// PrefetchVirtualMemory is only available since Windows 8
+		struct MemoryRangeEntry
+		{
+			PVOID VirtualAddress;
+			SIZE_T NumberOfBytes;
+		};
+
+		using PrefetchVirtualMemoryFunc = BOOL(WINAPI*)(HANDLE hProcess, ULONG_PTR NumberOfEntries, MemoryRangeEntry* VirtualAddresses, ULONG Flags);
+	}
+
+	MappedFileImpl::MappedFileImpl() :
+	m_ptr(nullptr),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		Unmap();
+	}
+
+	bool MappedFileImpl::Advise(MemoryAccessHint hint, UInt64 offset, UInt64 size)
+	{
+		if (!m_ptr)
+			return true;
+
+		switch (hint)
+		{
+			case MemoryAccessHint_WillNeed:
+			{
+				static PrefetchVirtualMemoryFunc prefetchVirtualMemory = reinterpret_cast<PrefetchVirtualMemoryFunc>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "PrefetchVirtualMemory"));
+				if (prefetchVirtualMemory)
+				{
+					MemoryRangeEntry entry;
+					entry.VirtualAddress = m_ptr + offset;
+					entry.NumberOfBytes = static_cast<SIZE_T>(size);
+
+					if (!prefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0))
+					{
+						NazaraError("Failed to prefetch memory: " + Error::GetLastSystemError());
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			// Windows has no equivalent for these hints on file views, its cache manager already detects access patterns
+			case MemoryAccessHint_DontNeed:
+			case MemoryAccessHint_Normal:
+			case MemoryAccessHint_Random:
+			case MemoryAccessHint_Sequential:
+				return true;
+		}
+
+		NazaraError("Memory access hint 0x" + String::Number(hint, 16) + " is not handled");
+		return false;
+	}
+
+	bool MappedFileImpl::Map(const String& filePath, MappedFileMode mode)
+	{
+		HANDLE file = CreateFileW(filePath.GetWideString().data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open \"" + filePath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// The view keeps a reference to the file and the mapping
+		CallOnExit closeFile([file]() { CloseHandle(file); });
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			NazaraError("Failed to get size of \"" + filePath + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		UInt64 size = static_cast<UInt64>(fileSize.QuadPart);
+		if (size > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("\"" + filePath + "\" is too big to be mapped");
+			return false;
+		}
+
+		// Empty files cannot be mapped, but are still valid
+		if (size > 0)
+		{
+			HANDLE mapping = CreateFileMappingW(file, nullptr, (mode == MappedFileMode_CopyOnWrite) ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping)
+			{
+				NazaraError("Failed to create mapping of \"" + filePath + "\": " + Error::GetLastSystemError());
+				return false;
+			}
+
+			CallOnExit closeMapping([mapping]() { CloseHandle(mapping); });
+
+			void* ptr = MapViewOfFile(mapping, (mode == MappedFileMode_CopyOnWrite) ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+			if (!ptr)
+			{
+				NazaraError("Failed to map \"" + filePath + "\": " + Error::GetLastSystemError());
+				return false;
+			}
+
+			m_ptr = static_cast<UInt8*>(ptr);
+		}
+
+		m_size = size;
+		return true;
+	}
+
+	void MappedFileImpl::Unmap()
+	{
+		if (m_ptr)
+		{
+			UnmapViewOfFile(m_ptr);
+			m_ptr = nullptr;
+		}
+
+		m_size = 0;
+	}
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_WORKSTEALINGQUEUE_HPP
+#define NAZARA_WORKSTEALINGQUEUE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	template<typename T>
+	class WorkStealingQueue
+	{
+		public:
+			WorkStealingQueue(std::size_t initialCapacity = 256);
+			WorkStealingQueue(const WorkStealingQueue&) = delete;
+			WorkStealingQueue(WorkStealingQueue&&) = delete;
+			~WorkStealingQueue() = default;
+
+			inline std::size_t GetSize() const;
+
+			inline bool IsEmpty() const;
+
+			bool Pop(T* value);
+			void Push(T value);
+
+			bool Steal(T* value);
+
+			WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+			WorkStealingQueue& operator=(WorkStealingQueue&&) = delete;
+
+		private:
+			struct Buffer
+			{
+				Buffer(std::size_t bufferCapacity);
+
+				inline T Load(Int64 index) const;
+				inline void Store(Int64 index, T value);
+
+				std::unique_ptr<std::atomic<T>[]> data;
+				std::size_t capacity;
+				std::size_t mask;
+			};
+
+			Buffer* Grow(Buffer* buffer, Int64 bottom, Int64 top);
+
+			std::atomic<Buffer*> m_buffer;
+			std::atomic<Int64> m_bottom;
+			std::atomic<Int64> m_top;
+			std::vector<std::unique_ptr<Buffer>> m_buffers; //< Every buffer ever used, thieves may still be reading from an old one
+	};
+}
+
+#include <Nazara/Core/WorkStealingQueue.inl>
+
+#endif // NAZARA_WORKSTEALINGQUEUE_HPP
@@ -0,0 +1,183 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::WorkStealingQueue
+	* \brief Core class that represents a lock-free Chase-Lev deque
+	*
+	* The owner thread pushes and pops at the bottom of the deque while any other thread may steal from the top
+	*
+	* \remark Push and Pop must only be called from the owner thread, Steal can be called from any thread
+	* \remark T must be trivially copyable
+	*/
+
+	/*!
+	* \brief Constructs a WorkStealingQueue object with an initial capacity
+	*
+	* \param initialCapacity Number of values the queue can hold before growing, will be rounded to the next power of two
+	*/
+	template<typename T>
+	WorkStealingQueue<T>::WorkStealingQueue(std::size_t initialCapacity) :
+	m_bottom(0),
+	m_top(0)
+	{
+		m_buffers.emplace_back(std::make_unique<Buffer>(GetNearestPowerOfTwo(std::max<std::size_t>(initialCapacity, 2))));
+		m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets an estimation of the number of values in the queue
+	* \return Number of values (may already be outdated if other threads are using the queue)
+	*/
+	template<typename T>
+	std::size_t WorkStealingQueue<T>::GetSize() const
+	{
+		Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+		Int64 top = m_top.load(std::memory_order_relaxed);
+
+		return static_cast<std::size_t>(std::max<Int64>(bottom - top, 0));
+	}
+
+	/*!
+	* \brief Checks whether the queue is empty
+	* \return true if the queue looks empty (may already be outdated if other threads are using the queue)
+	*/
+	template<typename T>
+	bool WorkStealingQueue<T>::IsEmpty() const
+	{
+		return GetSize() == 0;
+	}
+
+	/*!
+	* \brief Pops the last pushed value from the bottom of the queue
+	* \return true if a value was popped
+	*
+	* \param value Pointer to the value which will receive the popped value
+	*
+	* \remark Must only be called by the owner thread
+	*/
+	template<typename T>
+	bool WorkStealingQueue<T>::Pop(T* value)
+	{
+		Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+		m_bottom.store(bottom, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		Int64 top = m_top.load(std::memory_order_relaxed);
+		if (top > bottom)
+		{
+			// Queue is empty
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		T popped = buffer->Load(bottom);
+		if (top == bottom)
+		{
+			// Last value of the queue, we have to race with thieves for it
+			bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			if (!won)
+				return false;
+		}
+
+		*value = popped;
+		return true;
+	}
+
+	/*!
+	* \brief Pushes a value at the bottom of the queue, growing it if required
+	*
+	* \param value Value to push
+	*
+	* \remark Must only be called by the owner thread
+	*/
+	template<typename T>
+	void WorkStealingQueue<T>::Push(T value)
+	{
+		Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+		Int64 top = m_top.load(std::memory_order_acquire);
+		Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+		if (bottom - top > static_cast<Int64>(buffer->capacity) - 1)
+			buffer = Grow(buffer, bottom, top);
+
+		buffer->Store(bottom, value);
+
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Steals the oldest value from the top of the queue
+	* \return true if a value was stolen, false if the queue was empty or if another thread took the value first
+	*
+	* \param value Pointer to the value which will receive the stolen value
+	*/
+	template<typename T>
+	bool WorkStealingQueue<T>::Steal(T* value)
+	{
+		Int64 top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+			return false;
+
+		Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+		T stolen = buffer->Load(top);
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return false;
+
+		*value = stolen;
+		return true;
+	}
+
+	template<typename T>
+	typename WorkStealingQueue<T>::Buffer* WorkStealingQueue<T>::Grow(Buffer* buffer, Int64 bottom, Int64 top)
+	{
+		std::unique_ptr<Buffer> newBuffer = std::make_unique<Buffer>(buffer->capacity * 2);
+		for (Int64 i = top; i < bottom; ++i)
+			newBuffer->Store(i, buffer->Load(i));
+
+		Buffer* newBufferPtr = newBuffer.get();
+		m_buffers.emplace_back(std::move(newBuffer));
+
+		m_buffer.store(newBufferPtr, std::memory_order_release);
+
+		return newBufferPtr;
+	}
+
+	template<typename T>
+	WorkStealingQueue<T>::Buffer::Buffer(std::size_t bufferCapacity) :
+	data(new std::atomic<T>[bufferCapacity]),
+	capacity(bufferCapacity),
+	mask(bufferCapacity - 1)
+	{
+	}
+
+	template<typename T>
+	T WorkStealingQueue<T>::Buffer::Load(Int64 index) const
+	{
+		return data[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	void WorkStealingQueue<T>::Buffer::Store(Int64 index, T value)
+	{
+		data[static_cast<std::size_t>(index) & mask].store(value, std::memory_order_relaxed);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
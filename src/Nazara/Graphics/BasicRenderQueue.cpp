@@ -6,6 +6,7 @@
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
 #include <limits>
+#include <unordered_map>
 #include <Nazara/Graphics/Debug.hpp>
 
 ///TODO: Replace sinus/cosinus by a lookup table (which will lead to a speed up about 10x)
@@ -690,6 +691,45 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Adds the content of another queue after the content of this one
+	*
+	* \param queue Queue to copy the content from
+	*
+	* Appending queues filled separately (for example by different threads) gives the same content as filling a single queue with the same calls in the same order.
+	*
+	* \remark Produces a NazaraAssert if queue is this queue
+	*/
+	void BasicRenderQueue::Append(const BasicRenderQueue& queue)
+	{
+		NazaraAssert(&queue != this, "Cannot append a queue to itself");
+
+		directionalLights.insert(directionalLights.end(), queue.directionalLights.begin(), queue.directionalLights.end());
+		pointLights.insert(pointLights.end(), queue.pointLights.begin(), queue.pointLights.end());
+		spotLights.insert(spotLights.end(), queue.spotLights.begin(), queue.spotLights.end());
+
+		for (int layer : queue.m_renderLayers)
+			RegisterLayer(layer);
+
+		// Billboard chains reference the billboard data of their own queue
+		std::size_t billboardOffset = m_billboards.size();
+		m_billboards.insert(m_billboards.end(), queue.m_billboards.begin(), queue.m_billboards.end());
+
+		billboards.Append(queue.billboards, [billboardOffset](BillboardChain& chain)
+		{
+			chain.billboardIndex += billboardOffset;
+		});
+
+		basicSprites.Append(queue.basicSprites);
+		customDrawables.Append(queue.customDrawables);
+		depthSortedBillboards.Append(queue.depthSortedBillboards);
+		depthSortedModels.Append(queue.depthSortedModels);
+		depthSortedSprites.Append(queue.depthSortedSprites);
+		models.Append(queue.models);
+
+		m_sortInvalidated = true;
+	}
+
 	/*!
 	* \brief Clears the queue
 	*
@@ -702,255 +742,155 @@ namespace Nz
 
 		basicSprites.Clear();
 		billboards.Clear();
+		customDrawables.Clear();
 		depthSortedBillboards.Clear();
 		depthSortedModels.Clear();
 		depthSortedSprites.Clear();
 		models.Clear();
 
-		m_pipelineCache.clear();
-		m_materialCache.clear();
-		m_overlayCache.clear();
-		m_shaderCache.clear();
-		m_textureCache.clear();
-		m_vertexBufferCache.clear();
-
 		m_billboards.clear();
 		m_renderLayers.clear();
+
+		m_sortInvalidated = true;
 	}
 
 	/*!
 	* \brief Sorts the object according to the viewer position, furthest to nearest
 	*
 	* \param viewer Viewer of the scene
+	*
+	* Queues sorted by render states are only sorted again if the content of the queue changed since the last sort,
+	* depth-sorted queues are also sorted again if the viewer moved (or turned, for billboards and orthogonal projections).
+	* When the visible objects do not change, the render system does not rebuild the queue and most frames skip the sort entirely.
+	*
+	* \remark As sort keys are computed from the render states of materials, changing the states of a material already in the queue may only be taken into account after the next Clear
 	*/
-
 	void BasicRenderQueue::Sort(const AbstractViewer* viewer)
 	{
-		m_layerCache.clear();
-		for (int layer : m_renderLayers)
-			m_layerCache.emplace(layer, m_layerCache.size());
+		ProjectionType projectionType = viewer->GetProjectionType();
+		Planef nearPlane = viewer->GetFrustum().GetPlane(FrustumPlane_Near);
+		Vector3f viewerPos = viewer->GetEyePosition();
 
-		auto GetOrInsert = [](auto& container, auto&& value)
-		{
-			auto it = container.find(value);
-			if (it == container.end())
-				it = container.emplace(value, container.size()).first;
+		bool sortInvalidated = m_sortInvalidated || projectionType != m_sortProjectionType;
 
-			return it->second;
-		};
+		// Billboards are always sorted by their distance to the near plane, which also changes when the viewer turns
+		bool billboardSortInvalidated = sortInvalidated || nearPlane != m_sortNearPlane;
+		bool depthSortInvalidated = sortInvalidated || ((projectionType == ProjectionType_Orthogonal) ? nearPlane != m_sortNearPlane : viewerPos != m_sortEyePosition);
 
-		basicSprites.Sort([&](const SpriteChain& vertices)
-		{
-			// RQ index:
-			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Overlay (8bits)
-			// - Scissor (4bits)
-			// - ??? (4bits)
-
-			UInt64 layerIndex = m_layerCache[vertices.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, vertices.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, vertices.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, vertices.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, vertices.material->GetDiffuseMap());
-			UInt64 overlayIndex = GetOrInsert(m_overlayCache, vertices.overlay);
-			UInt64 scissorIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (overlayIndex  & 0xFF)   << 8 |
-			               (scissorIndex  & 0x0F)   << 4;
-
-			return index;
-		});
-		
-		billboards.Sort([&](const BillboardChain& billboard)
-		{
-			// RQ index:
-			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Scissor (4bits)
-			// - ??? (12bits)
-
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, billboard.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, billboard.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, billboard.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, billboard.material->GetDiffuseMap());
-			UInt64 unknownIndex = 0; //< ???
-			UInt64 scissorIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (scissorIndex  & 0x0F)   << 12 |
-			               (unknownIndex  & 0xFF)   <<  0;
-
-			return index;
-		});
+		if (!billboardSortInvalidated && !depthSortInvalidated)
+			return;
 
-		customDrawables.Sort([&](const CustomDrawable& drawable)
-		{
-			// RQ index:
-			// - Layer (16bits)
+		m_sortEyePosition = viewerPos;
+		m_sortNearPlane = nearPlane;
+		m_sortProjectionType = projectionType;
 
-			UInt64 layerIndex = m_layerCache[drawable.layerIndex];
+		// Indices are only needed while sorting, their memory comes from an arena reused at every sort to keep them from hitting the heap each frame
+		m_transientAllocator.Reset();
 
-			UInt64 index = (layerIndex & 0xFFFF) << 48;
+		auto MakeCache = [&](auto key)
+		{
+			using Key = decltype(key);
+			using Cache = std::unordered_map<Key, std::size_t, std::hash<Key>, std::equal_to<Key>, ArenaStlAllocator<std::pair<const Key, std::size_t>>>;
 
-			return index;
+			return Cache(ArenaStlAllocator<std::pair<const Key, std::size_t>>(m_transientAllocator));
+		};
 
-		});
+		auto layerCache = MakeCache(int());
+		for (int layer : m_renderLayers)
+			layerCache.emplace(layer, layerCache.size());
 
-		models.Sort([&](const Model& renderData)
+		if (m_sortInvalidated)
 		{
-			// RQ index:
-			// - Layer (16bits)
-			// - Pipeline (8bits)
-			// - Material (8bits)
-			// - Shader? (8bits)
-			// - Textures (8bits)
-			// - Buffers (8bits)
-			// - Scissor (4bits)
-			// - ??? (4bits)
-
-			UInt64 layerIndex = m_layerCache[renderData.layerIndex];
-			UInt64 pipelineIndex = GetOrInsert(m_pipelineCache, renderData.material->GetPipeline());
-			UInt64 materialIndex = GetOrInsert(m_materialCache, renderData.material);
-			UInt64 shaderIndex = GetOrInsert(m_shaderCache, renderData.material->GetShader());
-			UInt64 textureIndex = GetOrInsert(m_textureCache, renderData.material->GetDiffuseMap());
-			UInt64 bufferIndex = GetOrInsert(m_vertexBufferCache, renderData.meshData.vertexBuffer);
-			UInt64 scissorIndex = 0; //< TODO
-			UInt64 depthIndex = 0; //< TODO
-
-			UInt64 index = (layerIndex    & 0xFFFF) << 48 |
-			               (pipelineIndex & 0xFF)   << 40 |
-			               (materialIndex & 0xFF)   << 32 |
-			               (shaderIndex   & 0xFF)   << 24 |
-			               (textureIndex  & 0xFF)   << 16 |
-			               (bufferIndex   & 0xFF)   <<  8 |
-			               (scissorIndex  & 0x0F)   <<  4;
-
-			return index;
-		});
+			auto pipelineCache = MakeCache(static_cast<const MaterialPipeline*>(nullptr));
+			auto materialCache = MakeCache(static_cast<const Material*>(nullptr));
+			auto overlayCache = MakeCache(static_cast<const Texture*>(nullptr));
+			auto shaderCache = MakeCache(static_cast<const UberShader*>(nullptr));
+			auto textureCache = MakeCache(static_cast<const Texture*>(nullptr));
+			auto vertexBufferCache = MakeCache(static_cast<const VertexBuffer*>(nullptr));
+
+			auto GetOrInsert = [](auto& container, auto&& value)
+			{
+				auto it = container.find(value);
+				if (it == container.end())
+					it = container.emplace(value, container.size()).first;
 
-		static_assert(std::numeric_limits<float>::is_iec559, "The following sorting functions relies on IEEE 754 floatings-points");
+				return it->second;
+			};
 
-#if defined(arm) && \
-    ((defined(__MAVERICK__) && defined(NAZARA_BIG_ENDIAN)) || \
-    (!defined(__SOFTFP__) && !defined(__VFP_FP__) && !defined(__MAVERICK__)))
-	#error The following code relies on native-endian IEEE-754 representation, which your platform does not guarantee
-#endif
+			basicSprites.Sort([&](const SpriteChain& vertices)
+			{
+				return ComputeSortKey(layerCache[vertices.layerIndex],
+				                      GetOrInsert(pipelineCache, vertices.material->GetPipeline()),
+				                      GetOrInsert(materialCache, vertices.material),
+				                      GetOrInsert(shaderCache, vertices.material->GetShader()),
+				                      GetOrInsert(textureCache, vertices.material->GetDiffuseMap()),
+				                      GetOrInsert(overlayCache, vertices.overlay),
+				                      0); //< TODO: Scissor
+			});
 
-		Planef nearPlane = viewer->GetFrustum().GetPlane(FrustumPlane_Near);
+			billboards.Sort([&](const BillboardChain& billboard)
+			{
+				return ComputeSortKey(layerCache[billboard.layerIndex],
+				                      GetOrInsert(pipelineCache, billboard.material->GetPipeline()),
+				                      GetOrInsert(materialCache, billboard.material),
+				                      GetOrInsert(shaderCache, billboard.material->GetShader()),
+				                      GetOrInsert(textureCache, billboard.material->GetDiffuseMap()),
+				                      0,
+				                      0); //< TODO: Scissor
+			});
 
-		depthSortedBillboards.Sort([&](const Billboard& billboard)
-		{
-			// RQ index:
-			// - Layer (16bits)
-			// - Depth (32bits)
-			// - ??    (16bits)
+			customDrawables.Sort([&](const CustomDrawable& drawable)
+			{
+				return ComputeSortKey(layerCache[drawable.layerIndex], 0, 0, 0, 0, 0, 0);
+			});
 
-			// Reinterpret depth as UInt32 (this will work as long as they're all either positive or negative,
-			// a negative distance may happen with billboard behind the camera which we don't care about since they'll not be rendered)
-			float depth = nearPlane.Distance(billboard.data.center);
+			models.Sort([&](const Model& renderData)
+			{
+				return ComputeSortKey(layerCache[renderData.layerIndex],
+				                      GetOrInsert(pipelineCache, renderData.material->GetPipeline()),
+				                      GetOrInsert(materialCache, renderData.material),
+				                      GetOrInsert(shaderCache, renderData.material->GetShader()),
+				                      GetOrInsert(textureCache, renderData.material->GetDiffuseMap()),
+				                      GetOrInsert(vertexBufferCache, renderData.meshData.vertexBuffer),
+				                      0); //< TODO: Scissor
+			});
 
-			UInt64 layerIndex = m_layerCache[billboard.layerIndex];
-			UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
+			m_sortInvalidated = false;
+		}
 
-			UInt64 index = (layerIndex & 0xFFFF)     << 48 |
-			               (depthIndex & 0xFFFFFFFF) << 16;
+		if (billboardSortInvalidated)
+		{
+			depthSortedBillboards.Sort([&](const Billboard& billboard)
+			{
+				return ComputeDepthSortKey(layerCache[billboard.layerIndex], nearPlane.Distance(billboard.data.center));
+			});
+		}
 
-			return index;
-		});
+		if (!depthSortInvalidated)
+			return;
 
-		if (viewer->GetProjectionType() == ProjectionType_Orthogonal)
+		if (projectionType == ProjectionType_Orthogonal)
 		{
 			depthSortedModels.Sort([&](const Model& model)
 			{
-				// RQ index:
-				// - Layer (16bits)
-				// - Depth (32bits)
-				// - ??    (16bits)
-
-				float depth = nearPlane.Distance(model.obbSphere.GetPosition());
-
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
-				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
-
-				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
-				               (depthIndex & 0xFFFFFFFF) << 16;
-
-				return index;
+				return ComputeDepthSortKey(layerCache[model.layerIndex], nearPlane.Distance(model.obbSphere.GetPosition()));
 			});
 
 			depthSortedSprites.Sort([&](const SpriteChain& spriteChain)
 			{
-				// RQ index:
-				// - Layer (16bits)
-				// - Depth (32bits)
-				// - ??    (16bits)
-
-				float depth = nearPlane.Distance(spriteChain.vertices[0].position);
-
-				UInt64 layerIndex = m_layerCache[spriteChain.layerIndex];
-				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
-
-				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
-				               (depthIndex & 0xFFFFFFFF) << 16;
-
-				return index;
+				return ComputeDepthSortKey(layerCache[spriteChain.layerIndex], nearPlane.Distance(spriteChain.vertices[0].position));
 			});
 		}
 		else
 		{
-			Vector3f viewerPos = viewer->GetEyePosition();
-			
 			depthSortedModels.Sort([&](const Model& model)
 			{
-				// RQ index:
-				// - Layer (16bits)
-				// - Depth (32bits)
-				// - ??    (16bits)
-
-				float depth = viewerPos.SquaredDistance(model.obbSphere.GetPosition());
-
-				UInt64 layerIndex = m_layerCache[model.layerIndex];
-				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
-
-				UInt64 index = (layerIndex & 0x0F)       << 48 |
-				               (depthIndex & 0xFFFFFFFF) << 16;
-
-				return index;
+				return ComputeDepthSortKey(layerCache[model.layerIndex], viewerPos.SquaredDistance(model.obbSphere.GetPosition()));
 			});
 
 			depthSortedSprites.Sort([&](const SpriteChain& sprites)
 			{
-				// RQ index:
-				// - Layer (16bits)
-				// - Depth (32bits)
-				// - ??    (16bits)
-
-				float depth = viewerPos.SquaredDistance(sprites.vertices[0].position);
-
-				UInt64 layerIndex = m_layerCache[sprites.layerIndex];
-				UInt64 depthIndex = ~reinterpret_cast<UInt32&>(depth);
-
-				UInt64 index = (layerIndex & 0xFFFF)     << 48 |
-				               (depthIndex & 0xFFFFFFFF) << 16;
-
-				return index;
+				return ComputeDepthSortKey(layerCache[sprites.layerIndex], viewerPos.SquaredDistance(sprites.vertices[0].position));
 			});
 		}
 	}
@@ -27,6 +27,15 @@ namespace Nz
 		renderQueue->AddBillboards(instanceData.renderOrder, GetMaterial(), 1, scissorRect, &position, &m_size, &m_sinCos, &m_color);
 	}
 
+	/*!
+	* \brief Checks whether this billboard can be added to render queues by several threads at once
+	* \return true, as adding a billboard only reads its own parameters
+	*/
+	bool Billboard::CanAddToRenderQueueConcurrently() const
+	{
+		return true;
+	}
+
 	/*!
 	* \brief Clones this billboard
 	*/
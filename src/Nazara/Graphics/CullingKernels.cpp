@@ -0,0 +1,451 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/CullingKernels.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/X86Intrinsics.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t PlaneCount = FrustumPlane_Max + 1;
+
+		// Sides indexed by (outside << 1 | intersecting)
+		constexpr UInt8 s_sides[4] = { IntersectionSide_Inside, IntersectionSide_Intersecting, IntersectionSide_Outside, IntersectionSide_Outside };
+
+		// The positive (resp. negative) vertex of a box only depends on the signs of the plane normal: its coordinates can be read from the right array
+		struct BoxPlane
+		{
+			const float* positiveVertex[3];
+			const float* negativeVertex[3];
+			float normal[3];
+			float distance;
+		};
+
+		struct SpherePlane
+		{
+			float normal[3];
+			float distance;
+		};
+
+		void BuildBoxPlanes(const Frustumf& frustum, const CullingBoxArray& boxes, BoxPlane* boxPlanes)
+		{
+			const std::vector<float>* minComponents[3] = { &boxes.minX, &boxes.minY, &boxes.minZ };
+			const std::vector<float>* maxComponents[3] = { &boxes.maxX, &boxes.maxY, &boxes.maxZ };
+
+			for (std::size_t i = 0; i < PlaneCount; ++i)
+			{
+				const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+				BoxPlane& boxPlane = boxPlanes[i];
+				boxPlane.distance = plane.distance;
+
+				for (std::size_t j = 0; j < 3; ++j)
+				{
+					float normal = plane.normal[j];
+					boxPlane.normal[j] = normal;
+					boxPlane.positiveVertex[j] = (normal > 0.f) ? maxComponents[j]->data() : minComponents[j]->data();
+					boxPlane.negativeVertex[j] = (normal < 0.f) ? maxComponents[j]->data() : minComponents[j]->data();
+				}
+			}
+		}
+
+		void BuildSpherePlanes(const Frustumf& frustum, SpherePlane* spherePlanes)
+		{
+			for (std::size_t i = 0; i < PlaneCount; ++i)
+			{
+				const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+				spherePlanes[i].normal[0] = plane.normal.x;
+				spherePlanes[i].normal[1] = plane.normal.y;
+				spherePlanes[i].normal[2] = plane.normal.z;
+				spherePlanes[i].distance = plane.distance;
+			}
+		}
+
+		// Operations are done in the same order as Frustum::Intersect, so that every kernel gives the exact same results
+
+		UInt8 CullBoxScalar(const BoxPlane* planes, std::size_t index)
+		{
+			bool outside = false;
+			bool intersecting = false;
+			for (std::size_t i = 0; i < PlaneCount; ++i)
+			{
+				const BoxPlane& plane = planes[i];
+
+				float positiveDistance = plane.normal[0] * plane.positiveVertex[0][index] + plane.normal[1] * plane.positiveVertex[1][index] + plane.normal[2] * plane.positiveVertex[2][index] - plane.distance;
+				float negativeDistance = plane.normal[0] * plane.negativeVertex[0][index] + plane.normal[1] * plane.negativeVertex[1][index] + plane.normal[2] * plane.negativeVertex[2][index] - plane.distance;
+
+				outside |= positiveDistance < 0.f;
+				intersecting |= negativeDistance < 0.f;
+			}
+
+			return s_sides[(outside << 1) | intersecting];
+		}
+
+		void CullBoxesScalar(const BoxPlane* planes, std::size_t first, std::size_t count, UInt8* results)
+		{
+			for (std::size_t i = first; i < count; ++i)
+				results[i] = CullBoxScalar(planes, i);
+		}
+
+		UInt8 CullSphereScalar(const SpherePlane* planes, const CullingSphereArray& spheres, std::size_t index)
+		{
+			float radius = spheres.radius[index];
+
+			bool outside = false;
+			bool intersecting = false;
+			for (std::size_t i = 0; i < PlaneCount; ++i)
+			{
+				const SpherePlane& plane = planes[i];
+
+				float distance = plane.normal[0] * spheres.x[index] + plane.normal[1] * spheres.y[index] + plane.normal[2] * spheres.z[index] - plane.distance;
+
+				outside |= distance < -radius;
+				intersecting |= distance < radius;
+			}
+
+			return s_sides[(outside << 1) | intersecting];
+		}
+
+		void CullSpheresScalar(const SpherePlane* planes, const CullingSphereArray& spheres, std::size_t first, std::size_t count, UInt8* results)
+		{
+			for (std::size_t i = first; i < count; ++i)
+				results[i] = CullSphereScalar(planes, spheres, i);
+		}
+
+		#ifdef NAZARA_X86_INTRINSICS
+		template<std::size_t Width>
+		void WriteResults(int outsideMask, int intersectingMask, UInt8* results)
+		{
+			for (std::size_t i = 0; i < Width; ++i)
+				results[i] = s_sides[(((outsideMask >> i) & 1) << 1) | ((intersectingMask >> i) & 1)];
+		}
+
+		NAZARA_X86_TARGET("sse2")
+		std::size_t CullBoxesSSE2(const BoxPlane* planes, std::size_t count, UInt8* results)
+		{
+			const __m128 zero = _mm_setzero_ps();
+
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 outside = zero;
+				__m128 intersecting = zero;
+				for (std::size_t j = 0; j < PlaneCount; ++j)
+				{
+					const BoxPlane& plane = planes[j];
+
+					__m128 normalX = _mm_set1_ps(plane.normal[0]);
+					__m128 normalY = _mm_set1_ps(plane.normal[1]);
+					__m128 normalZ = _mm_set1_ps(plane.normal[2]);
+					__m128 distance = _mm_set1_ps(plane.distance);
+
+					__m128 positiveDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, _mm_loadu_ps(&plane.positiveVertex[0][i])), _mm_mul_ps(normalY, _mm_loadu_ps(&plane.positiveVertex[1][i]))), _mm_mul_ps(normalZ, _mm_loadu_ps(&plane.positiveVertex[2][i])));
+					__m128 negativeDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, _mm_loadu_ps(&plane.negativeVertex[0][i])), _mm_mul_ps(normalY, _mm_loadu_ps(&plane.negativeVertex[1][i]))), _mm_mul_ps(normalZ, _mm_loadu_ps(&plane.negativeVertex[2][i])));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_sub_ps(positiveDistance, distance), zero));
+					intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(_mm_sub_ps(negativeDistance, distance), zero));
+				}
+
+				WriteResults<4>(_mm_movemask_ps(outside), _mm_movemask_ps(intersecting), &results[i]);
+			}
+
+			return i;
+		}
+
+		NAZARA_X86_TARGET("sse2")
+		std::size_t CullSpheresSSE2(const SpherePlane* planes, const CullingSphereArray& spheres, UInt8* results)
+		{
+			const __m128 zero = _mm_setzero_ps();
+			std::size_t count = spheres.GetSize();
+
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x = _mm_loadu_ps(&spheres.x[i]);
+				__m128 y = _mm_loadu_ps(&spheres.y[i]);
+				__m128 z = _mm_loadu_ps(&spheres.z[i]);
+				__m128 radius = _mm_loadu_ps(&spheres.radius[i]);
+				__m128 negativeRadius = _mm_sub_ps(zero, radius);
+
+				__m128 outside = zero;
+				__m128 intersecting = zero;
+				for (std::size_t j = 0; j < PlaneCount; ++j)
+				{
+					const SpherePlane& plane = planes[j];
+
+					__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal[0]), x), _mm_mul_ps(_mm_set1_ps(plane.normal[1]), y)), _mm_mul_ps(_mm_set1_ps(plane.normal[2]), z));
+					distance = _mm_sub_ps(distance, _mm_set1_ps(plane.distance));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+					intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(distance, radius));
+				}
+
+				WriteResults<4>(_mm_movemask_ps(outside), _mm_movemask_ps(intersecting), &results[i]);
+			}
+
+			return i;
+		}
+
+		NAZARA_X86_TARGET("avx")
+		std::size_t CullBoxesAVX(const BoxPlane* planes, std::size_t count, UInt8* results)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 outside = zero;
+				__m256 intersecting = zero;
+				for (std::size_t j = 0; j < PlaneCount; ++j)
+				{
+					const BoxPlane& plane = planes[j];
+
+					__m256 normalX = _mm256_set1_ps(plane.normal[0]);
+					__m256 normalY = _mm256_set1_ps(plane.normal[1]);
+					__m256 normalZ = _mm256_set1_ps(plane.normal[2]);
+					__m256 distance = _mm256_set1_ps(plane.distance);
+
+					__m256 positiveDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(normalX, _mm256_loadu_ps(&plane.positiveVertex[0][i])), _mm256_mul_ps(normalY, _mm256_loadu_ps(&plane.positiveVertex[1][i]))), _mm256_mul_ps(normalZ, _mm256_loadu_ps(&plane.positiveVertex[2][i])));
+					__m256 negativeDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(normalX, _mm256_loadu_ps(&plane.negativeVertex[0][i])), _mm256_mul_ps(normalY, _mm256_loadu_ps(&plane.negativeVertex[1][i]))), _mm256_mul_ps(normalZ, _mm256_loadu_ps(&plane.negativeVertex[2][i])));
+
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_sub_ps(positiveDistance, distance), zero, _CMP_LT_OQ));
+					intersecting = _mm256_or_ps(intersecting, _mm256_cmp_ps(_mm256_sub_ps(negativeDistance, distance), zero, _CMP_LT_OQ));
+				}
+
+				WriteResults<8>(_mm256_movemask_ps(outside), _mm256_movemask_ps(intersecting), &results[i]);
+			}
+
+			return i;
+		}
+
+		NAZARA_X86_TARGET("avx")
+		std::size_t CullSpheresAVX(const SpherePlane* planes, const CullingSphereArray& spheres, UInt8* results)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+			std::size_t count = spheres.GetSize();
+
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x = _mm256_loadu_ps(&spheres.x[i]);
+				__m256 y = _mm256_loadu_ps(&spheres.y[i]);
+				__m256 z = _mm256_loadu_ps(&spheres.z[i]);
+				__m256 radius = _mm256_loadu_ps(&spheres.radius[i]);
+				__m256 negativeRadius = _mm256_sub_ps(zero, radius);
+
+				__m256 outside = zero;
+				__m256 intersecting = zero;
+				for (std::size_t j = 0; j < PlaneCount; ++j)
+				{
+					const SpherePlane& plane = planes[j];
+
+					__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal[0]), x), _mm256_mul_ps(_mm256_set1_ps(plane.normal[1]), y)), _mm256_mul_ps(_mm256_set1_ps(plane.normal[2]), z));
+					distance = _mm256_sub_ps(distance, _mm256_set1_ps(plane.distance));
+
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negativeRadius, _CMP_LT_OQ));
+					intersecting = _mm256_or_ps(intersecting, _mm256_cmp_ps(distance, radius, _CMP_LT_OQ));
+				}
+
+				WriteResults<8>(_mm256_movemask_ps(outside), _mm256_movemask_ps(intersecting), &results[i]);
+			}
+
+			return i;
+		}
+		#endif
+
+		CullingKernels::Implementation& GetCurrentImplementation()
+		{
+			static CullingKernels::Implementation implementation = []()
+			{
+				if (CullingKernels::IsImplementationSupported(CullingKernels::Implementation_AVX))
+					return CullingKernels::Implementation_AVX;
+				else if (CullingKernels::IsImplementationSupported(CullingKernels::Implementation_SSE2))
+					return CullingKernels::Implementation_SSE2;
+				else
+					return CullingKernels::Implementation_Scalar;
+			}();
+
+			return implementation;
+		}
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::CullingKernels
+	* \brief Graphics class testing arrays of volumes against a frustum
+	*
+	* Volumes are tested several at a time against all the planes of the frustum, using the widest instruction set supported by the processor (selected at runtime).
+	* Results are the same as testing every volume with Frustum::Intersect, whatever the implementation.
+	*
+	* \see CullingList
+	*/
+
+	/*!
+	* \brief Tests a single box of an array against a frustum
+	* \return Intersection side of the box, same as the one given by CullBoxes
+	*
+	* \param frustum Frustum to test the box against
+	* \param boxes Boxes array
+	* \param index Index of the box to test
+	*/
+	IntersectionSide CullingKernels::CullBox(const Frustumf& frustum, const CullingBoxArray& boxes, std::size_t index)
+	{
+		NazaraAssert(index < boxes.GetSize(), "Index out of range");
+
+		BoxPlane planes[PlaneCount];
+		BuildBoxPlanes(frustum, boxes, planes);
+
+		return static_cast<IntersectionSide>(CullBoxScalar(planes, index));
+	}
+
+	/*!
+	* \brief Tests boxes against a frustum
+	*
+	* \param frustum Frustum to test the boxes against
+	* \param boxes Boxes to test
+	* \param results Array receiving the IntersectionSide of every box, must be at least as big as the box array
+	*/
+	void CullingKernels::CullBoxes(const Frustumf& frustum, const CullingBoxArray& boxes, UInt8* results)
+	{
+		std::size_t count = boxes.GetSize();
+		if (count == 0)
+			return;
+
+		BoxPlane planes[PlaneCount];
+		BuildBoxPlanes(frustum, boxes, planes);
+
+		std::size_t first = 0;
+		switch (GetCurrentImplementation())
+		{
+			#ifdef NAZARA_X86_INTRINSICS
+			case Implementation_AVX:
+				first = CullBoxesAVX(planes, count, results);
+				break;
+
+			case Implementation_SSE2:
+				first = CullBoxesSSE2(planes, count, results);
+				break;
+			#endif
+
+			default:
+				break;
+		}
+
+		CullBoxesScalar(planes, first, count, results);
+	}
+
+	/*!
+	* \brief Tests a single sphere of an array against a frustum
+	* \return Intersection side of the sphere, same as the one given by CullSpheres
+	*
+	* \param frustum Frustum to test the sphere against
+	* \param spheres Spheres array
+	* \param index Index of the sphere to test
+	*/
+	IntersectionSide CullingKernels::CullSphere(const Frustumf& frustum, const CullingSphereArray& spheres, std::size_t index)
+	{
+		NazaraAssert(index < spheres.GetSize(), "Index out of range");
+
+		SpherePlane planes[PlaneCount];
+		BuildSpherePlanes(frustum, planes);
+
+		return static_cast<IntersectionSide>(CullSphereScalar(planes, spheres, index));
+	}
+
+	/*!
+	* \brief Tests spheres against a frustum
+	*
+	* \param frustum Frustum to test the spheres against
+	* \param spheres Spheres to test
+	* \param results Array receiving the IntersectionSide of every sphere, must be at least as big as the sphere array
+	*/
+	void CullingKernels::CullSpheres(const Frustumf& frustum, const CullingSphereArray& spheres, UInt8* results)
+	{
+		std::size_t count = spheres.GetSize();
+		if (count == 0)
+			return;
+
+		SpherePlane planes[PlaneCount];
+		BuildSpherePlanes(frustum, planes);
+
+		std::size_t first = 0;
+		switch (GetCurrentImplementation())
+		{
+			#ifdef NAZARA_X86_INTRINSICS
+			case Implementation_AVX:
+				first = CullSpheresAVX(planes, spheres, results);
+				break;
+
+			case Implementation_SSE2:
+				first = CullSpheresSSE2(planes, spheres, results);
+				break;
+			#endif
+
+			default:
+				break;
+		}
+
+		CullSpheresScalar(planes, spheres, first, count, results);
+	}
+
+	/*!
+	* \brief Gets the implementation used by the kernels
+	* \return Current implementation
+	*/
+	CullingKernels::Implementation CullingKernels::GetImplementation()
+	{
+		return GetCurrentImplementation();
+	}
+
+	/*!
+	* \brief Checks whether an implementation can be used on this processor
+	* \return true If the implementation is supported
+	*
+	* \param implementation Implementation to check
+	*/
+	bool CullingKernels::IsImplementationSupported(Implementation implementation)
+	{
+		switch (implementation)
+		{
+			case Implementation_Scalar:
+				return true;
+
+			#ifdef NAZARA_X86_INTRINSICS
+			case Implementation_SSE2:
+				return HasProcessorCapabilities<ProcessorCap_SSE2>();
+
+			case Implementation_AVX:
+				return HasProcessorCapabilities<ProcessorCap_AVX>();
+			#endif
+
+			default:
+				return false;
+		}
+	}
+
+	/*!
+	* \brief Changes the implementation used by the kernels
+	* \return true If the implementation is supported and is now used
+	*
+	* \param implementation Implementation to use
+	*
+	* \remark This is meant for testing and benchmarking purposes, the best implementation is selected by default
+	* \remark This is not thread-safe
+	*/
+	bool CullingKernels::SetImplementation(Implementation implementation)
+	{
+		if (!IsImplementationSupported(implementation))
+		{
+			NazaraError("Culling implementation is not supported by this processor");
+			return false;
+		}
+
+		GetCurrentImplementation() = implementation;
+		return true;
+	}
+}
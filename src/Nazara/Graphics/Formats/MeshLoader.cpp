@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/Formats/MeshLoader.hpp>
+#include <Nazara/Core/PackFile.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Graphics/Model.hpp>
 #include <Nazara/Graphics/SkeletalModel.hpp>
@@ -25,7 +26,7 @@ namespace Nz
 				String filePath;
 				if (matData.GetStringParameter(MaterialData::FilePath, &filePath))
 				{
-					if (!File::Exists(filePath))
+					if (!File::Exists(filePath) && !PackFile::IsFileMounted(filePath))
 					{
 						NazaraWarning("Shader name does not refer to an existing file, \".tga\" is used by default");
 						filePath += ".tga";
@@ -26,6 +26,17 @@ namespace Nz
 		OnInstancedRenderableRelease(this);
 	}
 
+	/*!
+	* \brief Checks whether AddToRenderQueue and UpdateData can be called by several threads at once, on different instances
+	* \return false by default, renderables only reading their own state and writing to the instance data can return true
+	*
+	* \remark Renderables returning true are added to the render queue by worker threads
+	*/
+	bool InstancedRenderable::CanAddToRenderQueueConcurrently() const
+	{
+		return false;
+	}
+
 	/*!
 	* \brief Culls the instanced if not in the frustum
 	* \return true If instanced is in the frustum
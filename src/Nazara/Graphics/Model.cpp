@@ -68,6 +68,15 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Checks whether this model can be added to render queues by several threads at once
+	* \return true, as adding a model only reads its mesh and materials
+	*/
+	bool Model::CanAddToRenderQueueConcurrently() const
+	{
+		return true;
+	}
+
 	/*!
 	* \brief Clones this model
 	*/
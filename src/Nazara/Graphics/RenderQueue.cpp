@@ -4,15 +4,75 @@
 
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <array>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Under this size, a comparison sort is faster than going (at least) twice over the data
+		constexpr std::size_t RadixSortThreshold = 256;
+	}
+
+	/*!
+	* \brief Sorts the ordered render queue by increasing index, data with the same index keeping their insertion order
+	*
+	* Big queues are sorted with a LSD radix sort (one byte per pass), skipping the bytes shared by every index,
+	* which are common as indices are made of a few values packed together.
+	*/
 	void RenderQueueInternal::Sort()
 	{
-		std::sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+		std::size_t count = m_orderedRenderQueue.size();
+		if (count < RadixSortThreshold)
+		{
+			// Pairs are inserted in increasing data order, comparing them gives the same order as a stable sort
+			std::sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+			{
+				return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+			});
+
+			return;
+		}
+
+		constexpr std::size_t PassCount = sizeof(Index);
+		constexpr std::size_t BucketCount = 256;
+
+		std::array<std::array<std::size_t, BucketCount>, PassCount> histograms = {};
+		for (const RenderDataPair& pair : m_orderedRenderQueue)
 		{
-			return lhs.first < rhs.first;
-		});
+			for (std::size_t pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(pair.first >> (pass * 8)) & 0xFF]++;
+		}
+
+		m_sortBuffer.resize(count);
+
+		RenderDataPair* source = m_orderedRenderQueue.data();
+		RenderDataPair* destination = m_sortBuffer.data();
+		for (std::size_t pass = 0; pass < PassCount; ++pass)
+		{
+			std::size_t shift = pass * 8;
+
+			std::array<std::size_t, BucketCount>& offsets = histograms[pass];
+			if (offsets[(source[0].first >> shift) & 0xFF] == count)
+				continue; //< Every index has the same byte
+
+			std::size_t offset = 0;
+			for (std::size_t& bucketOffset : offsets)
+			{
+				std::size_t bucketSize = bucketOffset;
+				bucketOffset = offset;
+				offset += bucketSize;
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+				destination[offsets[(source[i].first >> shift) & 0xFF]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_orderedRenderQueue.data())
+			std::swap(m_orderedRenderQueue, m_sortBuffer);
 	}
 }
@@ -122,6 +122,15 @@ namespace Nz
 		InvalidateBoundingVolume();
 	}
 
+	/*!
+	* \brief Checks whether this skeletal model can be added to render queues by several threads at once
+	* \return false, as adding a skeletal model may create its skinned vertex buffer through the SkinningManager
+	*/
+	bool SkeletalModel::CanAddToRenderQueueConcurrently() const
+	{
+		return false;
+	}
+
 	/*!
 	* \brief Clones this skeletal model
 	* \return Pointer to newly allocated SkeletalModel
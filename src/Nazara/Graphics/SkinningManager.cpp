@@ -4,6 +4,8 @@
 
 #include <Nazara/Graphics/SkinningManager.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Joint.hpp>
@@ -92,14 +94,11 @@ namespace Nz
 			for (unsigned int i = 0; i < jointCount; ++i)
 				skinningData.joints[i].EnsureSkinningMatrixUpdate();
 
-			unsigned int workerCount = TaskScheduler::GetWorkerCount();
-
-			std::ldiv_t div = std::ldiv(mesh->GetVertexCount(), workerCount);
-			for (unsigned int i = 0; i < workerCount; ++i)
-				TaskScheduler::AddTask(SkinPositionNormalTangent, skinningData, i*div.quot, (i == workerCount-1) ? div.quot + div.rem : div.quot);
-
-			TaskScheduler::Run();
-			TaskScheduler::WaitForTasks();
+			// Waits for our own chunks only, allowing skinning to be done from a task or alongside other work
+			ParallelFor(0U, mesh->GetVertexCount(), 256U, [&skinningData](unsigned int firstVertex, unsigned int lastVertex)
+			{
+				SkinPositionNormalTangent(skinningData, firstVertex, lastVertex - firstVertex);
+			});
 		}
 	}
 
@@ -188,6 +187,9 @@ namespace Nz
 
 	void SkinningManager::Skin()
 	{
+		NazaraProfileZone("SkinningManager::Skin");
+		NazaraProfileCounter("SkinningManager::SkinnedMeshes", s_skinningQueue.size());
+
 		for (QueueData& data : s_skinningQueue)
 			s_skinFunc(data.mesh, data.skeleton, data.buffer);
 
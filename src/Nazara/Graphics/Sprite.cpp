@@ -27,6 +27,15 @@ namespace Nz
 		renderQueue->AddSprites(instanceData.renderOrder, GetMaterial(), vertices, 1, scissorRect);
 	}
 
+	/*!
+	* \brief Checks whether this sprite can be added to render queues by several threads at once
+	* \return true, as sprite vertices are generated in the instance data
+	*/
+	bool Sprite::CanAddToRenderQueueConcurrently() const
+	{
+		return true;
+	}
+
 	/*!
 	* \brief Clones this sprite
 	*/
@@ -41,6 +41,15 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Checks whether this text sprite can be added to render queues by several threads at once
+	* \return true, as glyph vertices are generated in the instance data
+	*/
+	bool TextSprite::CanAddToRenderQueueConcurrently() const
+	{
+		return true;
+	}
+
 	/*!
 	* \brief Clones this text sprite
 	*/
@@ -40,6 +40,15 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Checks whether this tilemap can be added to render queues by several threads at once
+	* \return true, as tile vertices are generated in the instance data
+	*/
+	bool TileMap::CanAddToRenderQueueConcurrently() const
+	{
+		return true;
+	}
+
 	/*!
 	* \brief Clones this tilemap
 	*/
@@ -14,6 +14,8 @@
 
 #include <Nazara/Network/ENetHost.hpp>
 #include <Nazara/Core/OffsetOf.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/SmallObjectAllocator.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/NetPacket.hpp>
@@ -205,6 +207,8 @@ namespace Nz
 
 	int ENetHost::Service(ENetEvent* event, UInt32 timeout)
 	{
+		NazaraProfileZone("ENetHost::Service");
+
 		if (event)
 		{
 			event->type = ENetEventType::None;
@@ -311,9 +315,8 @@ namespace Nz
 
 	ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags)
 	{
-		ENetPacketRef enetPacket = m_packetPool.New<ENetPacket>();
+		ENetPacketRef enetPacket = SmallObjectAllocator::New<ENetPacket>();
 		enetPacket->flags = flags;
-		enetPacket->owner = &m_packetPool;
 
 		return enetPacket;
 	}
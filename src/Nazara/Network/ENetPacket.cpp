@@ -3,7 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/ENetPacket.hpp>
-#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/SmallObjectAllocator.hpp>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
@@ -14,7 +14,7 @@ namespace Nz
 		if (m_packet)
 		{
 			if (--m_packet->referenceCount == 0)
-				m_packet->owner->Delete(m_packet);
+				SmallObjectAllocator::Delete(m_packet);
 		}
 
 		m_packet = packet;
@@ -3,16 +3,263 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/NetPacket.hpp>
-#include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/ThreadCachePool.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <algorithm>
+#include <atomic>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr unsigned int MinBufferCapacityLog2 = 6;
+		constexpr std::size_t MaxBufferCapacity = std::size_t(1) << (MinBufferCapacityLog2 + NetPacket::BufferCapacityClassCount - 1);
+		constexpr std::size_t BatchSize = 8;
+		constexpr std::size_t ThreadCacheSize = 2 * BatchSize; //< Per capacity class
+
+		// Buffers are given to other threads by batches
+		struct BufferBatch
+		{
+			std::array<ByteArray*, BatchSize> buffers;
+			std::size_t count;
+			BufferBatch* next;
+		};
+
+		struct ClassCounters
+		{
+			std::atomic<UInt64> acquireCount;
+			std::atomic<UInt64> allocationCount;
+			std::atomic<UInt64> cacheHitCount;
+			std::atomic<UInt64> releaseCount;
+		};
+
+		// Counters are only written by their owner thread, atomics are only there to allow GetBufferPoolStats to read them
+		struct BufferCounters
+		{
+			ClassCounters classes[NetPacket::BufferCapacityClassCount];
+		};
+
+		struct BufferCache
+		{
+			std::array<ByteArray*, ThreadCacheSize> buffers;
+			std::size_t count;
+		};
+
+		struct ThreadBufferCache
+		{
+			BufferCache bufferCaches[NetPacket::BufferCapacityClassCount];
+			BufferBatch* spareBatches; //< Empty batches, to give buffers back without allocating
+		};
+
+		struct BufferPoolTraits
+		{
+			using Batch = BufferBatch;
+			using Counters = BufferCounters;
+			using ThreadCache = ThreadBufferCache;
+
+			static constexpr std::size_t ClassCount = NetPacket::BufferCapacityClassCount;
+
+			static void FlushThreadCache(ThreadBufferCache& cache);
+			static void MergeCounters(BufferCounters& target, const BufferCounters& source);
+			static BufferBatch*& NextBatch(BufferBatch* batch) { return batch->next; }
+		};
+
+		using BufferPool = ThreadCachePool<BufferPoolTraits>;
+
+		std::atomic<BufferBatch*> s_emptyBatches(nullptr); //< Lock-free stack of empty batches, going back to the threads giving buffers
+
+		constexpr std::size_t GetClassCapacity(std::size_t capacityClass)
+		{
+			return std::size_t(1) << (MinBufferCapacityLog2 + capacityClass);
+		}
+
+		// Class of the buffers able to hold this capacity without reallocating (except for the last class)
+		inline std::size_t GetAcquireClass(std::size_t capacity)
+		{
+			if (capacity <= GetClassCapacity(0))
+				return 0;
+
+			capacity = std::min(capacity, MaxBufferCapacity);
+			return IntegralLog2(static_cast<UInt32>(capacity - 1)) + 1 - MinBufferCapacityLog2;
+		}
+
+		// Class whose capacity is guaranteed by this buffer
+		inline std::size_t GetReleaseClass(std::size_t capacity)
+		{
+			if (capacity <= GetClassCapacity(0))
+				return 0;
+
+			capacity = std::min(capacity, MaxBufferCapacity);
+			return IntegralLog2(static_cast<UInt32>(capacity)) - MinBufferCapacityLog2;
+		}
+
+		BufferBatch* GetEmptyBatch(ThreadBufferCache& cache)
+		{
+			if (!cache.spareBatches)
+				cache.spareBatches = s_emptyBatches.exchange(nullptr, std::memory_order_acquire);
+
+			BufferBatch* batch = cache.spareBatches;
+			if (batch)
+				cache.spareBatches = batch->next;
+			else
+				batch = new BufferBatch;
+
+			return batch;
+		}
+
+		void GiveEmptyBatch(ThreadBufferCache& cache, BufferBatch* batch)
+		{
+			batch->count = 0;
+
+			// Keep one for ourselves, and give the others back to the threads which give buffers away
+			if (cache.spareBatches)
+				BufferPool::PushBatch(s_emptyBatches, batch);
+			else
+			{
+				batch->next = nullptr;
+				cache.spareBatches = batch;
+			}
+		}
+
+		void FreeBatches(BufferBatch* batch)
+		{
+			while (batch)
+			{
+				BufferBatch* next = batch->next;
+				for (std::size_t i = 0; i < batch->count; ++i)
+					delete batch->buffers[i];
+
+				delete batch;
+				batch = next;
+			}
+		}
+
+		void BufferPoolTraits::FlushThreadCache(ThreadBufferCache& cache)
+		{
+			for (std::size_t i = 0; i < NetPacket::BufferCapacityClassCount; ++i)
+			{
+				BufferCache& bufferCache = cache.bufferCaches[i];
+				while (bufferCache.count > 0)
+				{
+					BufferBatch* batch = GetEmptyBatch(cache);
+
+					batch->count = std::min(bufferCache.count, BatchSize);
+					bufferCache.count -= batch->count;
+					std::copy_n(&bufferCache.buffers[bufferCache.count], batch->count, batch->buffers.begin());
+
+					BufferPool::PushBatch(i, batch);
+				}
+			}
+
+			while (BufferBatch* batch = cache.spareBatches)
+			{
+				cache.spareBatches = batch->next;
+				BufferPool::PushBatch(s_emptyBatches, batch);
+			}
+		}
+
+		void BufferPoolTraits::MergeCounters(BufferCounters& target, const BufferCounters& source)
+		{
+			for (std::size_t i = 0; i < NetPacket::BufferCapacityClassCount; ++i)
+			{
+				target.classes[i].acquireCount += source.classes[i].acquireCount.load(std::memory_order_relaxed);
+				target.classes[i].allocationCount += source.classes[i].allocationCount.load(std::memory_order_relaxed);
+				target.classes[i].cacheHitCount += source.classes[i].cacheHitCount.load(std::memory_order_relaxed);
+				target.classes[i].releaseCount += source.classes[i].releaseCount.load(std::memory_order_relaxed);
+			}
+		}
+
+		std::unique_ptr<ByteArray> AcquireBuffer(std::size_t minCapacity)
+		{
+			std::size_t capacityClass = GetAcquireClass(minCapacity);
+
+			BufferPool::ThreadData* threadData = BufferPool::GetThreadData();
+			if (threadData)
+			{
+				BufferCache& bufferCache = threadData->cache.bufferCaches[capacityClass];
+				ClassCounters& counters = threadData->counters.classes[capacityClass];
+
+				BufferPool::IncreaseCounter(counters.acquireCount);
+
+				if (bufferCache.count > 0)
+				{
+					BufferPool::IncreaseCounter(counters.cacheHitCount);
+					return std::unique_ptr<ByteArray>(bufferCache.buffers[--bufferCache.count]);
+				}
+
+				if (BufferBatch* batch = BufferPool::PopBatch(capacityClass, threadData))
+				{
+					bufferCache.count = batch->count;
+					std::copy_n(batch->buffers.begin(), batch->count, bufferCache.buffers.begin());
+
+					GiveEmptyBatch(threadData->cache, batch);
+
+					return std::unique_ptr<ByteArray>(bufferCache.buffers[--bufferCache.count]);
+				}
+
+				BufferPool::IncreaseCounter(counters.allocationCount);
+			}
+			else
+			{
+				// This thread is exiting, buffers are allocated and freed directly
+				BufferPool::UpdateRetiredCounters([=](BufferCounters& retiredCounters)
+				{
+					retiredCounters.classes[capacityClass].acquireCount++;
+					retiredCounters.classes[capacityClass].allocationCount++;
+				});
+			}
+
+			// Allocate the whole class capacity, so that the buffer is reused for any packet of its class
+			std::unique_ptr<ByteArray> buffer = std::make_unique<ByteArray>();
+			buffer->Reserve(std::max(minCapacity, GetClassCapacity(capacityClass)));
+
+			return buffer;
+		}
+
+		void ReleaseBuffer(std::unique_ptr<ByteArray> buffer)
+		{
+			std::size_t capacityClass = GetReleaseClass(buffer->GetCapacity());
+
+			BufferPool::ThreadData* threadData = BufferPool::GetThreadData();
+			if (!threadData)
+			{
+				buffer.reset();
+
+				BufferPool::UpdateRetiredCounters([=](BufferCounters& retiredCounters)
+				{
+					retiredCounters.classes[capacityClass].releaseCount++;
+				});
+				return;
+			}
+
+			BufferPool::IncreaseCounter(threadData->counters.classes[capacityClass].releaseCount);
+
+			BufferCache& bufferCache = threadData->cache.bufferCaches[capacityClass];
+			if (bufferCache.count == ThreadCacheSize)
+			{
+				// Give the oldest half of our buffers to the other threads
+				BufferBatch* batch = GetEmptyBatch(threadData->cache);
+
+				batch->count = BatchSize;
+				std::copy_n(bufferCache.buffers.begin(), BatchSize, batch->buffers.begin());
+				std::copy(bufferCache.buffers.begin() + BatchSize, bufferCache.buffers.end(), bufferCache.buffers.begin());
+				bufferCache.count -= BatchSize;
+
+				BufferPool::PushBatch(capacityClass, batch);
+			}
+
+			bufferCache.buffers[bufferCache.count++] = buffer.release();
+		}
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
 	* \brief Network class that represents a packet
+	*
+	* Packet buffers are pooled by capacity class, in a cache of the calling thread shared with other threads by batches (see ThreadCachePool).
 	*/
 
 	/*!
@@ -102,8 +349,34 @@ namespace Nz
 		Reset(0);
 	}
 
+	/*!
+	* \brief Gets the statistics of the packet buffer pool
+	* \return Statistics of every capacity class, for every thread
+	*/
+
+	NetPacket::BufferPoolStats NetPacket::GetBufferPoolStats()
+	{
+		BufferCounters counters = {};
+		BufferPool::AccumulateCounters(counters);
+
+		BufferPoolStats stats;
+		for (std::size_t i = 0; i < BufferCapacityClassCount; ++i)
+		{
+			BufferCapacityClassStats& classStats = stats.capacityClasses[i];
+			classStats.bufferCapacity = GetClassCapacity(i);
+			classStats.acquireCount = counters.classes[i].acquireCount;
+			classStats.allocationCount = counters.classes[i].allocationCount;
+			classStats.cacheHitCount = counters.classes[i].cacheHitCount;
+			classStats.releaseCount = counters.classes[i].releaseCount;
+		}
+
+		return stats;
+	}
+
 	/*!
 	* \brief Frees the stream
+	*
+	* The buffer is given back to the pool
 	*/
 
 	void NetPacket::FreeStream()
@@ -111,10 +384,7 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		Nz::LockGuard lock(*s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		ReleaseBuffer(std::move(m_buffer));
 	}
 
 	/*!
@@ -131,20 +401,12 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			Nz::LockGuard lock(*s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
+		// Keep our buffer if it's big enough
+		if (m_buffer && m_buffer->GetCapacity() < minCapacity)
+			FreeStream();
 
 		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+			m_buffer = AcquireBuffer(minCapacity);
 
 		m_buffer->Resize(minCapacity);
 
@@ -160,20 +422,40 @@ namespace Nz
 
 	bool NetPacket::Initialize()
 	{
-		s_availableBuffersMutex = std::make_unique<Mutex>();
 		return true;
 	}
 
 	/*!
 	* \brief Uninitializes the NetPacket class
+	*
+	* Frees the buffers pooled by the calling thread and shared between threads
 	*/
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
-		s_availableBuffersMutex.reset();
-	}
+		if (BufferPool::ThreadData* threadData = BufferPool::GetThreadData())
+		{
+			for (BufferCache& bufferCache : threadData->cache.bufferCaches)
+			{
+				for (std::size_t i = 0; i < bufferCache.count; ++i)
+					delete bufferCache.buffers[i];
+
+				bufferCache.count = 0;
+			}
 
-	std::unique_ptr<Mutex> NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
+			for (BufferBatch*& batches : threadData->reservedBatches)
+			{
+				FreeBatches(batches);
+				batches = nullptr;
+			}
+
+			FreeBatches(threadData->cache.spareBatches);
+			threadData->cache.spareBatches = nullptr;
+		}
+
+		for (std::size_t i = 0; i < BufferCapacityClassCount; ++i)
+			FreeBatches(BufferPool::TakeBatches(i));
+
+		FreeBatches(s_emptyBatches.exchange(nullptr, std::memory_order_acquire));
+	}
 }
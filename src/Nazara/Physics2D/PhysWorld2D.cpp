@@ -4,6 +4,7 @@
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <Nazara/Physics2D/Arbiter2D.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
 #include <Nazara/Physics2D/Debug.hpp>
@@ -353,6 +354,8 @@ namespace Nz
 
 	void PhysWorld2D::Step(float timestep)
 	{
+		NazaraProfileZone("PhysWorld2D::Step");
+
 		m_timestepAccumulator += timestep;
 
 		std::size_t stepCount = std::min(static_cast<std::size_t>(m_timestepAccumulator / m_stepSize), m_maxStepCount);
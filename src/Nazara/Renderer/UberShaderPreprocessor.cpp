@@ -79,7 +79,7 @@ namespace Nz
 							code << "#define EARLY_FRAGMENT_TESTS " << ((glslVersion >= 420 || OpenGL::IsSupported(OpenGLExtension_Shader_ImageLoadStore)) ? '1' : '0') << "\n\n";
 
 							for (auto it = shaderStage.flags.begin(); it != shaderStage.flags.end(); ++it)
-								code << "#define " << it->first << ' ' << ((stageFlags & it->second) ? '1' : '0') << '\n';
+								code << "#define " << it->first.GetName() << ' ' << ((stageFlags & it->second) ? '1' : '0') << '\n';
 
 							code << "\n#line 1\n"; // Pour que les éventuelles erreurs du shader se réfèrent à la bonne ligne
 							code << shaderStage.source;
@@ -134,13 +134,15 @@ namespace Nz
 
 		for (String& flag : flags)
 		{
-			auto it = m_flags.find(flag);
+			ParameterKey key(flag);
+
+			auto it = m_flags.find(key);
 			if (it == m_flags.end())
-				m_flags[flag] = 1U << m_flags.size();
+				m_flags[key] = 1U << m_flags.size();
 
-			auto it2 = shader.flags.find(flag);
+			auto it2 = shader.flags.find(key);
 			if (it2 == shader.flags.end())
-				shader.flags[flag] = 1U << shader.flags.size();
+				shader.flags[key] = 1U << shader.flags.size();
 		}
 
 		// On construit les flags requis pour l'activation du shader
@@ -153,11 +155,13 @@ namespace Nz
 		{
 			UInt32 flagVal;
 
-			auto it = m_flags.find(flag);
+			ParameterKey key(flag);
+
+			auto it = m_flags.find(key);
 			if (it == m_flags.end())
 			{
 				flagVal = 1U << m_flags.size();
-				m_flags[flag] = flagVal;
+				m_flags[key] = flagVal;
 			}
 			else
 				flagVal = it->second;
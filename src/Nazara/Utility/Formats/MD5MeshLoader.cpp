@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MD5MeshLoader.hpp>
+#include <Nazara/Core/PackFile.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/Joint.hpp>
@@ -215,7 +216,7 @@ namespace Nz
 					if (!path.IsEmpty())
 					{
 						path.Replace(".md5mesh", ".md5anim", -8, String::CaseInsensitive);
-						if (File::Exists(path))
+						if (File::Exists(path) || PackFile::IsFileMounted(path))
 							mesh->SetAnimation(path);
 					}
 				}
@@ -4,6 +4,7 @@
 
 #include <Nazara/Utility/Formats/OBJLoader.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/PackFile.hpp>
 #include <Nazara/Utility/IndexMapper.hpp>
 #include <Nazara/Utility/MaterialData.hpp>
 #include <Nazara/Utility/Mesh.hpp>
@@ -44,13 +45,19 @@ namespace Nz
 
 		bool ParseMTL(Mesh* mesh, const String& filePath, const String* materials, const OBJParser::Mesh* meshes, UInt32 meshCount)
 		{
-			File file(filePath);
-			if (!file.Open(OpenMode_ReadOnly | OpenMode_Text))
+			std::unique_ptr<Stream> packedFile = PackFile::OpenMountedFile(filePath);
+
+			File diskFile;
+			if (packedFile)
+				packedFile->EnableTextMode(true);
+			else if (!diskFile.Open(filePath, OpenMode_ReadOnly | OpenMode_Text))
 			{
-				NazaraError("Failed to open MTL file (" + file.GetPath() + ')');
+				NazaraError("Failed to open MTL file (" + diskFile.GetPath() + ')');
 				return false;
 			}
 
+			Stream& file = (packedFile) ? *packedFile : diskFile;
+
 			MTLParser materialParser;
 			if (!materialParser.Parse(file))
 			{
@@ -108,21 +108,15 @@ namespace Nz
 			unsigned int pixelsPerFace = width * height;
 			levels[i] = std::make_unique<UInt8[]>(pixelsPerFace * depth * PixelFormat::GetBytesPerPixel(newFormat));
 
+			// Faces and slices are contiguous, convert the whole level at once so it can be split between threads
 			UInt8* dst = levels[i].get();
 			UInt8* src = m_sharedImage->levels[i].get();
-			unsigned int srcStride = pixelsPerFace * PixelFormat::GetBytesPerPixel(m_sharedImage->format);
-			unsigned int dstStride = pixelsPerFace * PixelFormat::GetBytesPerPixel(newFormat);
+			std::size_t srcSize = std::size_t(pixelsPerFace) * depth * PixelFormat::GetBytesPerPixel(m_sharedImage->format);
 
-			for (unsigned int d = 0; d < depth; ++d)
+			if (!PixelFormat::Convert(m_sharedImage->format, newFormat, src, &src[srcSize], dst))
 			{
-				if (!PixelFormat::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
-				{
-					NazaraError("Failed to convert image");
-					return false;
-				}
-
-				src += srcStride;
-				dst += dstStride;
+				NazaraError("Failed to convert image");
+				return false;
 			}
 
 			if (width > 1)
@@ -5,6 +5,9 @@
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Parallel.hpp>
+#include <atomic>
+#include <cstring>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -1268,6 +1271,70 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Converts a range of pixels from a format to another
+	* \return true if the conversion succeeded
+	*
+	* \param srcFormat Format of the source pixels
+	* \param dstFormat Format of the destination pixels
+	* \param start Pointer to the first source pixel
+	* \param end Pointer past the last source pixel
+	* \param dst Pointer to the destination pixels, which must be large enough to hold the converted range
+	*
+	* \remark Large ranges of uncompressed pixels are converted in parallel by the task scheduler
+	*/
+	bool PixelFormat::Convert(PixelFormatType srcFormat, PixelFormatType dstFormat, const void* start, const void* end, void* dst)
+	{
+		// Pixels converted by a single task, large enough to keep the scheduling cost negligible
+		constexpr std::size_t pixelGrain = 16 * 1024;
+
+		if (srcFormat == dstFormat)
+		{
+			std::memcpy(dst, start, reinterpret_cast<const UInt8*>(end)-reinterpret_cast<const UInt8*>(start));
+			return true;
+		}
+
+		const ConvertFunction& func = s_convertFunctions[srcFormat][dstFormat];
+		if (!func)
+		{
+			NazaraError("Pixel format conversion from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " is not supported");
+			return false;
+		}
+
+		const UInt8* srcPtr = reinterpret_cast<const UInt8*>(start);
+		const UInt8* srcEnd = reinterpret_cast<const UInt8*>(end);
+		UInt8* dstPtr = reinterpret_cast<UInt8*>(dst);
+
+		bool succeeded;
+
+		// Compressed formats are made of blocks, we can only split ranges of independent pixels
+		std::size_t srcBpp = GetBytesPerPixel(srcFormat);
+		std::size_t dstBpp = GetBytesPerPixel(dstFormat);
+		if (!IsCompressed(srcFormat) && !IsCompressed(dstFormat) && srcBpp > 0 && dstBpp > 0)
+		{
+			std::size_t pixelCount = (srcEnd - srcPtr) / srcBpp;
+
+			std::atomic_bool failed(false);
+			ParallelFor<std::size_t>(0, pixelCount, pixelGrain, [&](std::size_t firstPixel, std::size_t lastPixel)
+			{
+				if (!func(&srcPtr[firstPixel * srcBpp], &srcPtr[lastPixel * srcBpp], &dstPtr[firstPixel * dstBpp]))
+					failed = true;
+			});
+
+			succeeded = !failed;
+		}
+		else
+			succeeded = (func(srcPtr, srcEnd, dstPtr) != nullptr);
+
+		if (!succeeded)
+		{
+			NazaraError("Pixel format conversion from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " failed");
+			return false;
+		}
+
+		return true;
+	}
+
 	bool PixelFormat::Flip(PixelFlipping flipping, PixelFormatType format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
 	{
 		#if NAZARA_UTILITY_SAFE
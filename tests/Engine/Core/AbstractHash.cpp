@@ -2,8 +2,11 @@
 #include <Catch/catch.hpp>
 
 #include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Hash/CRC32.hpp>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 {
@@ -25,3 +28,56 @@ SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 		}
 	}
 }
+
+SCENARIO("Hash implementations", "[CORE][ABSTRACTHASH]")
+{
+	GIVEN("A large buffer, hashed in uneven chunks")
+	{
+		// Chunks smaller and larger than hardware accelerated blocks
+		auto ComputeHash = [](Nz::AbstractHash& hash, const std::vector<Nz::UInt8>& data)
+		{
+			hash.Begin();
+
+			std::size_t offset = 0;
+			std::size_t chunkSize = 1;
+			while (offset < data.size())
+			{
+				std::size_t size = std::min(chunkSize, data.size() - offset);
+				hash.Append(&data[offset], size);
+
+				offset += size;
+				chunkSize = chunkSize * 3 + 1;
+			}
+
+			return hash.End().ToHex().ToUpper();
+		};
+
+		std::vector<Nz::UInt8> data(1000000, 'a');
+
+		THEN("Digests match reference values")
+		{
+			CHECK(ComputeHash(*Nz::AbstractHash::Get(Nz::HashType_CRC32), data) == "DC25BFBC");
+			CHECK(ComputeHash(*Nz::AbstractHash::Get(Nz::HashType_SHA1), data) == "34AA973CD4C4DAA4F61EEB2BDBAD27316534016F");
+			CHECK(ComputeHash(*Nz::AbstractHash::Get(Nz::HashType_SHA256), data) == "CDC76E5C9914FB9281A1C7E284D73E67F1809A48A497200E046D39CCC7112CD0");
+		}
+	}
+
+	GIVEN("The standard check string")
+	{
+		const char check[] = "123456789";
+		const Nz::UInt8* data = reinterpret_cast<const Nz::UInt8*>(check);
+
+		THEN("CRC-32 and CRC-32C give their check values")
+		{
+			Nz::HashCRC32 crc32;
+			crc32.Begin();
+			crc32.Append(data, 9);
+			CHECK(crc32.End().ToHex().ToUpper() == "CBF43926");
+
+			Nz::HashCRC32 crc32c(0x1edc6f41);
+			crc32c.Begin();
+			crc32c.Append(data, 9);
+			CHECK(crc32c.End().ToHex().ToUpper() == "E3069283");
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#include <Nazara/Core/ArenaAllocator.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector3.hpp>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	void Fill(Nz::ArenaAllocator& arena)
+	{
+		for (std::size_t i = 0; i < 100; ++i)
+			std::memset(arena.Allocate(100 + i * 10), 0xFF, 100 + i * 10);
+
+		std::memset(arena.Allocate(10000), 0xFF, 10000);
+	}
+}
+
+SCENARIO("ArenaAllocator", "[CORE][ARENAALLOCATOR]")
+{
+	GIVEN("An arena with small blocks")
+	{
+		Nz::ArenaAllocator arena(1024);
+
+		WHEN("We allocate memory with various alignments")
+		{
+			std::vector<std::pair<void*, std::size_t>> allocations;
+			for (std::size_t i = 0; i < 200; ++i)
+			{
+				std::size_t alignment = std::size_t(1) << (i % 4);
+				allocations.emplace_back(arena.Allocate(1 + i % 13, alignment), alignment);
+			}
+
+			THEN("It is aligned and distinct")
+			{
+				for (auto& pair : allocations)
+					CHECK(reinterpret_cast<std::uintptr_t>(pair.first) % pair.second == 0);
+
+				for (std::size_t i = 1; i < allocations.size(); ++i)
+					CHECK(allocations[i].first != allocations[i - 1].first);
+
+				CHECK(arena.GetAllocationCount() == 200);
+				CHECK(arena.GetUsedMemory() >= 200);
+				CHECK(arena.GetReservedMemory() >= arena.GetUsedMemory());
+			}
+		}
+
+		WHEN("We allocate more than a block")
+		{
+			void* ptr = arena.Allocate(4096);
+
+			THEN("It gets its own block")
+			{
+				std::memset(ptr, 0xFF, 4096);
+				CHECK(arena.GetReservedMemory() >= 4096);
+			}
+		}
+
+		WHEN("We reuse the arena with the same pattern")
+		{
+			Fill(arena);
+			CHECK(arena.GetHeapAllocationCount() > 0);
+
+			std::size_t reservedMemory = arena.GetReservedMemory();
+
+			arena.Reset();
+			CHECK(arena.GetAllocationCount() == 0);
+			CHECK(arena.GetUsedMemory() == 0);
+
+			Fill(arena);
+
+			THEN("No memory is requested from the heap anymore")
+			{
+				CHECK(arena.GetHeapAllocationCount() == 0);
+				CHECK(arena.GetReservedMemory() == reservedMemory);
+			}
+		}
+
+		WHEN("We construct objects in it")
+		{
+			Nz::Vector3f* vector = arena.New<Nz::Vector3f>(1.f, 2.f, 3.f);
+			int* array = arena.AllocateArray<int>(10);
+			for (int i = 0; i < 10; ++i)
+				array[i] = i;
+
+			THEN("They are usable")
+			{
+				CHECK(*vector == Nz::Vector3f(1.f, 2.f, 3.f));
+				CHECK(array[9] == 9);
+			}
+		}
+
+		WHEN("A standard container allocates from it")
+		{
+			std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Nz::ArenaStlAllocator<std::pair<const int, int>>> map{Nz::ArenaStlAllocator<std::pair<const int, int>>(arena)};
+			for (int i = 0; i < 1000; ++i)
+				map.emplace(i, i * 2);
+
+			THEN("It works as usual")
+			{
+				CHECK(map.size() == 1000);
+				CHECK(map[500] == 1000);
+				CHECK(arena.GetAllocationCount() >= 1000);
+			}
+		}
+	}
+}
+
+SCENARIO("FrameAllocator", "[CORE][ARENAALLOCATOR]")
+{
+	GIVEN("A triple-buffered frame allocator")
+	{
+		Nz::FrameAllocator frameAllocator(3, 1024);
+		REQUIRE(frameAllocator.GetFrameCount() == 3);
+
+		WHEN("We allocate memory during a frame")
+		{
+			int* value = frameAllocator.GetCurrentFrame().New<int>(42);
+
+			THEN("It stays valid for two more frames")
+			{
+				frameAllocator.NextFrame();
+				frameAllocator.GetCurrentFrame().New<int>(0);
+				frameAllocator.NextFrame();
+				frameAllocator.GetCurrentFrame().New<int>(0);
+
+				CHECK(*value == 42);
+			}
+		}
+
+		WHEN("Frames always do the same allocations")
+		{
+			for (std::size_t i = 0; i < 6; ++i)
+			{
+				Fill(frameAllocator.GetCurrentFrame());
+				frameAllocator.NextFrame();
+			}
+
+			THEN("They don't allocate from the heap anymore")
+			{
+				CHECK(frameAllocator.GetLastFrameHeapAllocationCount() == 0);
+			}
+		}
+	}
+}
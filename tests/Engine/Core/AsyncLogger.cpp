@@ -0,0 +1,122 @@
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+#include <vector>
+
+SCENARIO("AsyncLogger", "[CORE][ASYNCLOGGER]")
+{
+	GIVEN("An asynchronous logger")
+	{
+		const char* logPath = "AsyncLogger.log";
+
+		WHEN("We write messages and errors")
+		{
+			{
+				Nz::AsyncLogger logger(logPath);
+				logger.EnableStdReplication(false);
+				logger.EnableTimeLogging(false);
+
+				logger.Write("First message");
+				logger.WriteError(Nz::ErrorType_Warning, "Something happened", 42, "File.cpp", "Function");
+				logger.Write("Last message");
+				logger.Flush();
+
+				THEN("They are written once flushed")
+				{
+					CHECK(logger.GetWrittenMessageCount() == 3);
+					CHECK(logger.GetQueueDepth() == 0);
+					CHECK(logger.GetDroppedMessageCount() == 0);
+				}
+			}
+
+			THEN("The file contains them in order, errors being formatted")
+			{
+				Nz::File file(logPath, Nz::OpenMode_ReadOnly | Nz::OpenMode_Text);
+				REQUIRE(file.IsOpen());
+				CHECK(file.ReadLine() == "First message");
+				CHECK(file.ReadLine() == "Warning: Something happened (File.cpp:42: Function)");
+				CHECK(file.ReadLine() == "Last message");
+			}
+		}
+
+		WHEN("We enable time logging")
+		{
+			{
+				Nz::AsyncLogger logger(logPath);
+				logger.EnableStdReplication(false);
+				logger.Write("Message");
+			}
+
+			THEN("Messages are prefixed by the date")
+			{
+				Nz::File file(logPath, Nz::OpenMode_ReadOnly | Nz::OpenMode_Text);
+				REQUIRE(file.IsOpen());
+
+				Nz::String line = file.ReadLine();
+				CHECK(line.EndsWith(": Message"));
+				CHECK(line.GetSize() == 23 + 7);
+			}
+		}
+
+		WHEN("Multiple threads write to a blocking logger")
+		{
+			constexpr unsigned int threadCount = 4;
+			constexpr unsigned int messageCount = 10000;
+
+			Nz::AsyncLogger logger(logPath, 16, Nz::LogOverflowPolicy_Block);
+			logger.EnableStdReplication(false);
+
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&logger]()
+				{
+					for (unsigned int j = 0; j < messageCount; ++j)
+						logger.Write("Message");
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			logger.Flush();
+
+			THEN("No message is lost")
+			{
+				CHECK(logger.GetQueueCapacity() == 16);
+				CHECK(logger.GetDroppedMessageCount() == 0);
+				CHECK(logger.GetWrittenMessageCount() == threadCount * messageCount);
+			}
+		}
+
+		WHEN("Multiple threads write to a dropping logger with a tiny queue")
+		{
+			constexpr unsigned int threadCount = 4;
+			constexpr unsigned int messageCount = 10000;
+
+			Nz::AsyncLogger logger(logPath, 2, Nz::LogOverflowPolicy_Drop);
+			logger.EnableStdReplication(false);
+
+			std::vector<Nz::Thread> threads;
+			for (unsigned int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([&logger]()
+				{
+					for (unsigned int j = 0; j < messageCount; ++j)
+						logger.Write("Message");
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			logger.Flush();
+
+			THEN("Every message is either written or counted as dropped")
+			{
+				CHECK(logger.GetWrittenMessageCount() + logger.GetDroppedMessageCount() == threadCount * messageCount);
+			}
+		}
+	}
+}
@@ -3,12 +3,14 @@
 #include <Catch/catch.hpp>
 #include <array>
 #include <string>
+#include <vector>
 #include <iostream>
 
 template<typename Block> void Check(const char* title);
 template<typename Block> void CheckAppend(const char* title);
 template<typename Block> void CheckBitOps(const char* title);
 template<typename Block> void CheckBitOpsMultipleBlocks(const char* title);
+template<typename Block> void CheckBulkOps(const char* title);
 template<typename Block> void CheckConstructor(const char* title);
 template<typename Block> void CheckCopyMoveSwap(const char* title);
 template<typename Block> void CheckRead(const char* title);
@@ -30,6 +32,7 @@ void Check(const char* title)
 
 	CheckBitOps<Block>(title);
 	CheckBitOpsMultipleBlocks<Block>(title);
+	CheckBulkOps<Block>(title);
 
 	CheckAppend<Block>(title);
 	CheckRead<Block>(title);
@@ -181,6 +184,120 @@ void CheckBitOpsMultipleBlocks(const char* title)
 	}
 }
 
+template<typename Block>
+void CheckBulkOps(const char* title)
+{
+	SECTION(title)
+	{
+		GIVEN("Two bitsets spanning many blocks")
+		{
+			Nz::Bitset<Block> first(300, false);
+			Nz::Bitset<Block> second(200, false);
+
+			std::vector<std::size_t> firstBits = { 0, 7, 8, 63, 64, 65, 150, 199, 200, 255, 299 };
+			for (std::size_t bit : firstBits)
+				first.Set(bit);
+
+			for (std::size_t bit = 0; bit < 200; bit += 3)
+				second.Set(bit);
+
+			WHEN("We iterate on the bits set")
+			{
+				std::vector<std::size_t> bits;
+				first.ForEachSetBit([&](std::size_t bit) { bits.push_back(bit); });
+
+				THEN("Every bit is visited in order")
+				{
+					CHECK(bits == firstBits);
+				}
+			}
+
+			WHEN("We perform a AND NOT")
+			{
+				Nz::Bitset<Block> andNot;
+				andNot.PerformsANDNOT(first, second);
+
+				Nz::Bitset<Block> notAnd;
+				notAnd.PerformsANDNOT(second, first);
+
+				THEN("It matches the result of the AND with the negated bitset")
+				{
+					Nz::Bitset<Block> expected = first;
+					for (std::size_t bit = 0; bit < 200; bit += 3)
+						expected.Reset(bit);
+
+					CHECK(andNot.GetSize() == 300);
+					CHECK(andNot == expected);
+					CHECK(notAnd.GetSize() == 200);
+
+					Nz::Bitset<Block> expectedNotAnd = second;
+					for (std::size_t bit : firstBits)
+					{
+						if (bit < 200)
+							expectedNotAnd.Reset(bit);
+					}
+
+					CHECK(notAnd == expectedNotAnd);
+				}
+
+				AND_THEN("It works in place")
+				{
+					Nz::Bitset<Block> inPlace = first;
+					inPlace.PerformsANDNOT(inPlace, second);
+					CHECK(inPlace == andNot);
+
+					Nz::Bitset<Block> inPlaceB = second;
+					inPlaceB.PerformsANDNOT(first, inPlaceB);
+					CHECK(inPlaceB == andNot);
+				}
+			}
+
+			WHEN("We test subsets and intersections")
+			{
+				Nz::Bitset<Block> subset(100, false);
+				subset.Set(0, true);
+				subset.Set(63, true);
+
+				THEN("They are correctly detected")
+				{
+					CHECK(subset.IsSubsetOf(first));
+					CHECK(!first.IsSubsetOf(subset));
+					CHECK(first.IsSubsetOf(first));
+					CHECK(Nz::Bitset<Block>().IsSubsetOf(subset));
+
+					subset.Set(1, true);
+					CHECK(!subset.IsSubsetOf(first));
+
+					// Bits beyond the size of the other bitset
+					Nz::Bitset<Block> highBit(300, false);
+					highBit.Set(299, true);
+					CHECK(highBit.IsSubsetOf(first));
+					CHECK(!highBit.IsSubsetOf(second));
+
+					CHECK(first.Intersects(second));
+					CHECK(!highBit.Intersects(second));
+					CHECK(highBit.TestAny());
+					CHECK(!Nz::Bitset<Block>(300, false).TestAny());
+				}
+			}
+
+			WHEN("We fill a bitset whose size is a multiple of the block size")
+			{
+				Nz::Bitset<Block> full(4 * Nz::BitCount<Block>(), true);
+
+				THEN("All its bits are set")
+				{
+					CHECK(full.TestAll());
+					CHECK(full.Count() == 4 * Nz::BitCount<Block>());
+
+					full.Reset(Nz::BitCount<Block>());
+					CHECK(!full.TestAll());
+				}
+			}
+		}
+	}
+}
+
 template<typename Block>
 void CheckConstructor(const char* title)
 {
@@ -0,0 +1,229 @@
+#include <Nazara/Core/DynamicAABBTree.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct Proxy
+	{
+		std::size_t id;
+		bool alive;
+	};
+
+	std::vector<std::size_t> Sorted(std::vector<std::size_t> values)
+	{
+		std::sort(values.begin(), values.end());
+		return values;
+	}
+}
+
+SCENARIO("DynamicAABBTree", "[CORE][DYNAMICAABBTREE]")
+{
+	GIVEN("A tree filled with random boxes, some of them moved or destroyed")
+	{
+		constexpr std::size_t BoxCount = 2000;
+
+		std::mt19937 generator(2017);
+		std::uniform_real_distribution<float> position(-200.f, 200.f);
+		std::uniform_real_distribution<float> size(0.1f, 10.f);
+		std::uniform_real_distribution<float> movement(-2.f, 2.f);
+
+		auto RandomBox = [&]()
+		{
+			return Nz::Boxf(position(generator), position(generator), position(generator), size(generator), size(generator), size(generator));
+		};
+
+		Nz::DynamicAABBTree tree(0.5f);
+
+		std::vector<Proxy> proxies(BoxCount);
+		for (std::size_t i = 0; i < BoxCount; ++i)
+		{
+			proxies[i].id = tree.CreateProxy(RandomBox(), i);
+			proxies[i].alive = true;
+		}
+
+		std::size_t movedCount = 0;
+		for (std::size_t i = 0; i < BoxCount; i += 3)
+		{
+			Nz::Boxf box = tree.GetFatAABB(proxies[i].id);
+			box.x += movement(generator);
+			box.y += movement(generator);
+
+			if (tree.MoveProxy(proxies[i].id, box))
+				movedCount++;
+		}
+
+		for (std::size_t i = 1; i < BoxCount; i += 5)
+		{
+			tree.DestroyProxy(proxies[i].id);
+			proxies[i].alive = false;
+		}
+
+		std::size_t aliveCount = std::count_if(proxies.begin(), proxies.end(), [](const Proxy& proxy) { return proxy.alive; });
+
+		THEN("The tree stays balanced")
+		{
+			CHECK(movedCount > 0);
+			CHECK(tree.GetProxyCount() == aliveCount);
+			CHECK(tree.GetHeight() <= 2 * static_cast<unsigned int>(std::log2(aliveCount)) + 2);
+
+			for (std::size_t i = 0; i < BoxCount; ++i)
+			{
+				if (proxies[i].alive)
+					CHECK(tree.GetUserData(proxies[i].id) == i);
+			}
+		}
+
+		WHEN("We move a box inside its fat AABB")
+		{
+			Nz::Boxf box = tree.GetFatAABB(proxies[0].id);
+			Nz::Boxf smallerBox(box.x + 0.25f, box.y + 0.25f, box.z + 0.25f, box.width - 0.5f, box.height - 0.5f, box.depth - 0.5f);
+
+			THEN("The tree is not modified")
+			{
+				CHECK_FALSE(tree.MoveProxy(proxies[0].id, smallerBox));
+				CHECK(tree.GetFatAABB(proxies[0].id) == box);
+			}
+		}
+
+		WHEN("We query a box")
+		{
+			Nz::Boxf queryBox(-50.f, -50.f, -50.f, 100.f, 80.f, 60.f);
+
+			std::vector<std::size_t> results;
+			tree.Query(queryBox, [&](std::size_t proxyId)
+			{
+				results.push_back(tree.GetUserData(proxyId));
+				return true;
+			});
+
+			THEN("Every overlapping fat AABB is reported once")
+			{
+				std::vector<std::size_t> expected;
+				for (std::size_t i = 0; i < BoxCount; ++i)
+				{
+					if (!proxies[i].alive)
+						continue;
+
+					Nz::Boxf fatBox = tree.GetFatAABB(proxies[i].id);
+					Nz::Vector3f minimum = fatBox.GetMinimum();
+					Nz::Vector3f maximum = fatBox.GetMaximum();
+					if (maximum.x >= queryBox.x && minimum.x <= queryBox.x + queryBox.width &&
+					    maximum.y >= queryBox.y && minimum.y <= queryBox.y + queryBox.height &&
+					    maximum.z >= queryBox.z && minimum.z <= queryBox.z + queryBox.depth)
+						expected.push_back(i);
+				}
+
+				CHECK(!expected.empty());
+				CHECK(Sorted(results) == expected);
+			}
+		}
+
+		WHEN("We query a frustum")
+		{
+			Nz::Frustumf frustum;
+			frustum.Build(70.f, 16.f / 9.f, 1.f, 150.f, Nz::Vector3f(10.f, 0.f, 5.f), Nz::Vector3f(0.2f, 0.1f, -1.f));
+
+			std::vector<std::size_t> results;
+			std::vector<Nz::IntersectionSide> sides(BoxCount, Nz::IntersectionSide_Outside);
+			tree.Query(frustum, [&](std::size_t proxyId, Nz::IntersectionSide side)
+			{
+				std::size_t index = tree.GetUserData(proxyId);
+				results.push_back(index);
+				sides[index] = side;
+			});
+
+			THEN("Results match Frustum::Intersect on every fat AABB")
+			{
+				std::vector<std::size_t> expected;
+				std::size_t mismatchCount = 0;
+				std::size_t insideCount = 0;
+				for (std::size_t i = 0; i < BoxCount; ++i)
+				{
+					if (!proxies[i].alive)
+						continue;
+
+					Nz::IntersectionSide side = frustum.Intersect(tree.GetFatAABB(proxies[i].id));
+					if (side != Nz::IntersectionSide_Outside)
+						expected.push_back(i);
+
+					if (side == Nz::IntersectionSide_Inside)
+						insideCount++;
+
+					if (side != sides[i])
+						mismatchCount++;
+				}
+
+				CHECK(insideCount > 0);
+				CHECK(mismatchCount == 0);
+				CHECK(Sorted(results) == expected);
+			}
+		}
+
+		WHEN("We cast a ray")
+		{
+			// Aimed at the first box, with a null Z component to test rays parallel to slabs
+			Nz::Vector3f target = tree.GetFatAABB(proxies[0].id).GetCenter();
+			Nz::Rayf ray(Nz::Vector3f(-250.f, target.y - 0.1f, target.z), Nz::Vector3f(1.f, 0.1f / (target.x + 250.f), 0.f));
+
+			std::vector<std::size_t> results;
+			tree.Query(ray, 400.f, [&](std::size_t proxyId, float distance)
+			{
+				float closestHit;
+				CHECK(ray.Intersect(tree.GetFatAABB(proxyId), &closestHit));
+				CHECK(distance == Approx(closestHit).epsilon(0.001));
+
+				results.push_back(tree.GetUserData(proxyId));
+				return true;
+			});
+
+			THEN("Every fat AABB hit within the distance is reported")
+			{
+				std::vector<std::size_t> expected;
+				for (std::size_t i = 0; i < BoxCount; ++i)
+				{
+					float closestHit;
+					if (proxies[i].alive && ray.Intersect(tree.GetFatAABB(proxies[i].id), &closestHit) && closestHit <= 400.f)
+						expected.push_back(i);
+				}
+
+				CHECK(!expected.empty());
+				CHECK(Sorted(results) == expected);
+			}
+
+			AND_THEN("The query can be stopped")
+			{
+				std::size_t callCount = 0;
+				tree.Query(ray, 400.f, [&](std::size_t /*proxyId*/, float /*distance*/)
+				{
+					callCount++;
+					return false;
+				});
+
+				CHECK(callCount == 1);
+			}
+		}
+
+		WHEN("We destroy every proxy")
+		{
+			for (const Proxy& proxy : proxies)
+			{
+				if (proxy.alive)
+					tree.DestroyProxy(proxy.id);
+			}
+
+			THEN("The tree is empty and proxies can be created again")
+			{
+				CHECK(tree.GetProxyCount() == 0);
+				CHECK(tree.GetHeight() == 0);
+
+				std::size_t proxyId = tree.CreateProxy(Nz::Boxf(1.f, 1.f, 1.f), 42);
+				CHECK(tree.GetUserData(proxyId) == 42);
+				CHECK(tree.GetFatAABB(proxyId) == Nz::Boxf(-0.5f, -0.5f, -0.5f, 2.f, 2.f, 2.f));
+			}
+		}
+	}
+}
@@ -0,0 +1,130 @@
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Catch/catch.hpp>
+
+#include <cstring>
+
+SCENARIO("MappedFile", "[CORE][MAPPEDFILE]")
+{
+	GIVEN("A file with some lines")
+	{
+		{
+			Nz::File file("Mapped File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.IsOpen());
+			file.Write(Nz::String("First line\nSecond line\r\nThird line"));
+		}
+
+		WHEN("We map it in read-only mode")
+		{
+			Nz::MappedFile file("Mapped File.txt");
+			REQUIRE(file.IsOpen());
+			CHECK(file.GetSize() == 34U);
+			CHECK(file.IsReadable());
+			CHECK(!file.IsWritable());
+			CHECK(file.GetPath() == Nz::File::NormalizePath("Mapped File.txt"));
+			CHECK(file.Advise(Nz::MemoryAccessHint_Sequential));
+
+			THEN("Its content is directly accessible")
+			{
+				REQUIRE(file.GetMemoryView() != nullptr);
+				CHECK(std::memcmp(file.GetMemoryView(), "First line", 10) == 0);
+				CHECK(file.GetWritableMemoryView() == nullptr);
+			}
+
+			THEN("We can read it as a stream")
+			{
+				char buffer[6] = {};
+				CHECK(file.Read(buffer, 5) == 5);
+				CHECK(std::strcmp(buffer, "First") == 0);
+				CHECK(file.GetCursorPos() == 5U);
+
+				const Nz::UInt8* view = file.ReadView(5);
+				REQUIRE(view != nullptr);
+				CHECK(std::memcmp(view, " line", 5) == 0);
+				CHECK(file.GetCursorPos() == 10U);
+
+				CHECK(file.ReadView(100) == nullptr);
+				CHECK(file.GetCursorPos() == 10U);
+			}
+
+			THEN("We can read it line by line")
+			{
+				file.EnableTextMode(true);
+
+				CHECK(file.ReadLine() == "First line");
+				CHECK(file.ReadLine() == "Second line");
+				CHECK(file.ReadLine() == "Third line");
+				CHECK(file.EndOfStream());
+			}
+
+			AND_WHEN("We close it")
+			{
+				file.Close();
+
+				THEN("It is not mapped anymore")
+				{
+					CHECK(!file.IsOpen());
+					CHECK(file.GetMemoryView() == nullptr);
+					CHECK(file.GetSize() == 0U);
+				}
+			}
+		}
+
+		WHEN("We map it in copy-on-write mode and modify it")
+		{
+			{
+				Nz::MappedFile file("Mapped File.txt", Nz::MappedFileMode_CopyOnWrite);
+				REQUIRE(file.IsWritable());
+
+				Nz::UInt8* memory = file.GetWritableMemoryView();
+				REQUIRE(memory != nullptr);
+				memory[0] = 'f';
+
+				file.SetCursorPos(1);
+				CHECK(file.Write("IRST", 4) == 4);
+				CHECK(std::memcmp(file.GetMemoryView(), "fIRST line", 10) == 0);
+			}
+
+			THEN("The file itself is not modified")
+			{
+				Nz::MappedFile file("Mapped File.txt");
+				CHECK(std::memcmp(file.GetMemoryView(), "First line", 10) == 0);
+			}
+		}
+
+		Nz::File::Delete("Mapped File.txt");
+	}
+
+	GIVEN("An empty file")
+	{
+		{
+			Nz::File file("Empty Mapped File.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+		}
+
+		WHEN("We map it")
+		{
+			Nz::MappedFile file("Empty Mapped File.txt");
+
+			THEN("It is open but empty")
+			{
+				CHECK(file.IsOpen());
+				CHECK(file.GetSize() == 0U);
+				CHECK(file.EndOfStream());
+				CHECK(file.ReadLine().IsEmpty());
+			}
+		}
+
+		Nz::File::Delete("Empty Mapped File.txt");
+	}
+
+	GIVEN("A file which does not exist")
+	{
+		Nz::MappedFile file;
+
+		THEN("It cannot be mapped")
+		{
+			CHECK(!file.Open("Nonexistent Mapped File.txt"));
+			CHECK(!file.IsOpen());
+		}
+	}
+}
@@ -137,4 +137,40 @@ SCENARIO("Handle", "[CORE][HandledObject][ObjectHandle]")
 			}
 		}
 	}
+
+	GIVEN("A handle to an object which is going to die")
+	{
+		Nz::ObjectHandle<ObjectHandle_Test> oldHandle;
+		{
+			ObjectHandle_Test dyingTest(6);
+			oldHandle = dyingTest.CreateHandle();
+		}
+
+		WHEN("Another object reuses its slot")
+		{
+			ObjectHandle_Test test(7);
+			Nz::ObjectHandle<ObjectHandle_Test> newHandle = test.CreateHandle();
+
+			THEN("Only the new handle is valid")
+			{
+				CHECK_FALSE(oldHandle.IsValid());
+				CHECK(oldHandle.GetObject() == nullptr);
+				CHECK(newHandle.GetObject() == &test);
+				CHECK(oldHandle.GetObject() != newHandle.GetObject());
+			}
+		}
+
+		WHEN("We move a handle")
+		{
+			ObjectHandle_Test test(8);
+			Nz::ObjectHandle<ObjectHandle_Test> handle = test.CreateHandle();
+			Nz::ObjectHandle<ObjectHandle_Test> movedHandle(std::move(handle));
+
+			THEN("The moved-from handle is reset")
+			{
+				CHECK_FALSE(handle.IsValid());
+				CHECK(movedHandle.GetObject() == &test);
+			}
+		}
+	}
 }
@@ -0,0 +1,162 @@
+#include <Nazara/Core/PackFile.hpp>
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Catch/catch.hpp>
+
+#include <random>
+
+namespace
+{
+	Nz::String ReadAll(Nz::Stream& stream)
+	{
+		Nz::String content(static_cast<std::size_t>(stream.GetSize()), '\0');
+		stream.Read(&content[0], content.GetSize());
+
+		return content;
+	}
+}
+
+SCENARIO("PackFile", "[CORE][PACKFILE]")
+{
+	GIVEN("A pack built from some files")
+	{
+		Nz::String text;
+		for (int i = 0; i < 1000; ++i)
+			text += "Line " + Nz::String::Number(i % 10) + '\n';
+
+		std::mt19937 randomEngine(42);
+		Nz::String noise(4096, '\0');
+		for (std::size_t i = 0; i < noise.GetSize(); ++i)
+			noise[i] = static_cast<char>(randomEngine());
+
+		REQUIRE(Nz::Directory::Create("PackSource"));
+		{
+			Nz::File file("PackSource/text.txt", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.IsOpen());
+			file.Write(text);
+		}
+		{
+			Nz::File file("PackSource/noise.bin", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.IsOpen());
+			file.Write(noise);
+		}
+		{
+			Nz::File file("PackSource/empty", Nz::OpenMode_WriteOnly | Nz::OpenMode_Truncate);
+			REQUIRE(file.IsOpen());
+		}
+
+		std::vector<Nz::PackFile::BuildEntry> entries = {
+			{"text.txt", "PackSource/text.txt"},
+			{"data/noise.bin", "PackSource/noise.bin"},
+			{"data/empty", "PackSource/empty"}
+		};
+		REQUIRE(Nz::PackFile::Build("Test.pack", entries, true, 64));
+
+		WHEN("We open it")
+		{
+			Nz::PackFile pack("Test.pack");
+			REQUIRE(pack.IsOpen());
+			CHECK(pack.GetEntryCount() == 3);
+			CHECK(pack.Contains("text.txt"));
+			CHECK(pack.Contains("data/noise.bin"));
+			CHECK(!pack.Contains("noise.bin"));
+			CHECK(!pack.OpenEntry("missing.txt"));
+
+			THEN("Compressible entries are compressed and others are stored")
+			{
+				for (std::size_t i = 0; i < pack.GetEntryCount(); ++i)
+				{
+					Nz::PackFile::EntryInfo info = pack.GetEntryInfo(i);
+					if (info.path == "text.txt")
+					{
+						CHECK(info.compressed);
+						CHECK(info.size == text.GetSize());
+						CHECK(info.storedSize < info.size);
+					}
+					else if (info.path == "data/noise.bin")
+					{
+						CHECK(!info.compressed);
+						CHECK(info.size == noise.GetSize());
+					}
+					else
+					{
+						CHECK(info.path == "data/empty");
+						CHECK(info.size == 0);
+					}
+				}
+			}
+
+			THEN("Entries content is preserved")
+			{
+				std::unique_ptr<Nz::Stream> textStream = pack.OpenEntry("text.txt");
+				REQUIRE(textStream);
+				CHECK(ReadAll(*textStream) == text);
+				textStream->SetCursorPos(0);
+				CHECK(textStream->ReadLine() == "Line 0");
+
+				std::unique_ptr<Nz::Stream> noiseStream = pack.OpenEntry("data/noise.bin");
+				REQUIRE(noiseStream);
+				CHECK(noiseStream->GetMemoryView() != nullptr);
+				CHECK(reinterpret_cast<std::uintptr_t>(noiseStream->GetMemoryView()) % 64 == 0);
+				CHECK(ReadAll(*noiseStream) == noise);
+				CHECK(noiseStream->GetPath() == Nz::File::NormalizePath("data/noise.bin"));
+
+				std::unique_ptr<Nz::Stream> emptyStream = pack.OpenEntry("data/empty");
+				REQUIRE(emptyStream);
+				CHECK(emptyStream->GetSize() == 0);
+			}
+		}
+
+		WHEN("We mount it")
+		{
+			REQUIRE(Nz::PackFile::Mount("Test.pack", "Mounted"));
+
+			THEN("Its entries can be opened as files of the mount point")
+			{
+				CHECK(Nz::PackFile::IsFileMounted("Mounted/text.txt"));
+				CHECK(Nz::PackFile::IsFileMounted("Mounted/data/../data/noise.bin"));
+				CHECK(!Nz::PackFile::IsFileMounted("text.txt"));
+				CHECK(!Nz::File::Exists("Mounted/text.txt"));
+
+				std::unique_ptr<Nz::Stream> stream = Nz::PackFile::OpenMountedFile("Mounted/data/noise.bin");
+				REQUIRE(stream);
+				CHECK(stream->GetDirectory() == Nz::File::AbsolutePath("Mounted/data") + NAZARA_DIRECTORY_SEPARATOR);
+
+				// Streams keep the pack alive
+				CHECK(Nz::PackFile::Unmount("Test.pack"));
+				CHECK(!Nz::PackFile::IsFileMounted("Mounted/text.txt"));
+				CHECK(ReadAll(*stream) == noise);
+			}
+
+			Nz::PackFile::UnmountAll();
+		}
+
+		WHEN("The pack is corrupted")
+		{
+			{
+				Nz::File file("Test.pack", Nz::OpenMode_ReadWrite);
+				REQUIRE(file.IsOpen());
+				file.SetCursorPos(24);
+
+				Nz::UInt64 namesOffset = 0xFFFFFFFFFFFF;
+				file.Write(&namesOffset, sizeof(namesOffset));
+			}
+
+			THEN("It is rejected")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent);
+
+				Nz::PackFile pack;
+				CHECK(!pack.Open("Test.pack"));
+				CHECK(!pack.IsOpen());
+			}
+		}
+
+		Nz::File::Delete("Test.pack");
+		Nz::File::Delete("PackSource/text.txt");
+		Nz::File::Delete("PackSource/noise.bin");
+		Nz::File::Delete("PackSource/empty");
+		Nz::Directory::Remove("PackSource");
+	}
+}
@@ -0,0 +1,91 @@
+#include <Nazara/Core/Parallel.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <string>
+#include <vector>
+
+SCENARIO("Parallel", "[CORE][PARALLEL]")
+{
+	GIVEN("A large array")
+	{
+		std::vector<unsigned int> values(100000);
+
+		WHEN("We fill it with ParallelFor")
+		{
+			std::atomic_uint callCount(0);
+			Nz::ParallelFor(std::size_t(0), values.size(), std::size_t(1000), [&](std::size_t first, std::size_t last)
+			{
+				callCount++;
+				for (std::size_t i = first; i < last; ++i)
+					values[i] += static_cast<unsigned int>(i);
+			});
+
+			THEN("Every index was processed exactly once")
+			{
+				bool valid = true;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					valid = valid && (values[i] == i);
+
+				CHECK(valid);
+				CHECK(callCount > 1);
+				CHECK(callCount <= 100);
+			}
+		}
+
+		WHEN("We sum it with ParallelReduce")
+		{
+			std::iota(values.begin(), values.end(), 1U);
+
+			unsigned long long sum = Nz::ParallelReduce(std::size_t(0), values.size(), std::size_t(1000), 0ULL, [&](std::size_t first, std::size_t last)
+			{
+				return std::accumulate(values.begin() + first, values.begin() + last, 0ULL);
+			},
+			[](unsigned long long lhs, unsigned long long rhs)
+			{
+				return lhs + rhs;
+			});
+
+			THEN("We get the same result as a sequential sum")
+			{
+				CHECK(sum == 100000ULL * 100001ULL / 2);
+			}
+		}
+	}
+
+	GIVEN("A non-commutative reduction")
+	{
+		std::string result = Nz::ParallelReduce(0, 26, 1, std::string(), [](int first, int last)
+		{
+			std::string str;
+			for (int i = first; i < last; ++i)
+				str += static_cast<char>('a' + i);
+
+			return str;
+		},
+		[](std::string lhs, const std::string& rhs)
+		{
+			return lhs + rhs;
+		});
+
+		THEN("Chunks are combined in order")
+		{
+			CHECK(result == "abcdefghijklmnopqrstuvwxyz");
+		}
+	}
+
+	GIVEN("An empty range")
+	{
+		bool called = false;
+		Nz::ParallelFor(10, 10, 1, [&](int, int) { called = true; });
+
+		int value = Nz::ParallelReduce(10, 10, 1, 42, [](int, int) { return 0; }, [](int lhs, int rhs) { return lhs + rhs; });
+
+		THEN("Nothing is called")
+		{
+			CHECK_FALSE(called);
+			CHECK(value == 42);
+		}
+	}
+}
@@ -1,4 +1,5 @@
 #include <Nazara/Core/ParameterList.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Catch/catch.hpp>
 
 #include <Nazara/Core/String.hpp>
@@ -281,4 +282,80 @@ SCENARIO("ParameterList", "[CORE][PARAMETERLIST]")
 			}
 		}
 	}
+
+	GIVEN("Parameter keys")
+	{
+		Nz::ParameterKey diffuseKey("DIFFUSE_MAPPING");
+		Nz::ParameterKey normalKey("NORMAL_MAPPING");
+
+		THEN("Keys are interned by name")
+		{
+			CHECK(diffuseKey.IsValid());
+			CHECK(diffuseKey == Nz::ParameterKey("DIFFUSE_MAPPING"));
+			CHECK(diffuseKey != normalKey);
+			CHECK(diffuseKey.GetName() == "DIFFUSE_MAPPING");
+			CHECK(Nz::ParameterKey::Find("NORMAL_MAPPING") == normalKey);
+			CHECK(!Nz::ParameterKey::Find("A name which was never interned").IsValid());
+		}
+
+		WHEN("We use them to set and get parameters")
+		{
+			Nz::ParameterList parameterList;
+			parameterList.SetParameter(diffuseKey, true);
+			parameterList.SetParameter("NORMAL_MAPPING", false);
+			parameterList.SetParameter("LongString", "A string too long to be stored inline");
+
+			THEN("Keys and names reference the same parameters")
+			{
+				bool value = false;
+				CHECK(parameterList.GetBooleanParameter("DIFFUSE_MAPPING", &value));
+				CHECK(value);
+				CHECK(parameterList.GetBooleanParameter(normalKey, &value));
+				CHECK(!value);
+				CHECK(!parameterList.HasParameter(Nz::ParameterKey("SHADOW_MAPPING")));
+			}
+
+			AND_THEN("Getting unknown names does not intern them")
+			{
+				bool boolean;
+				long long integer;
+				Nz::String str;
+				CHECK(!parameterList.GetBooleanParameter("A boolean which was never set", &boolean));
+				CHECK(!parameterList.GetIntegerParameter("An integer which was never set", &integer));
+				CHECK(!parameterList.GetStringParameter("A string which was never set", &str));
+				CHECK(Nz::Error::GetLastError() == "Parameter \"A string which was never set\" is not present");
+
+				CHECK(!Nz::ParameterKey::Find("A boolean which was never set").IsValid());
+				CHECK(!Nz::ParameterKey::Find("An integer which was never set").IsValid());
+				CHECK(!Nz::ParameterKey::Find("A string which was never set").IsValid());
+			}
+
+			AND_THEN("Values survive copies and removals")
+			{
+				Nz::ParameterList copy = parameterList;
+				copy.RemoveParameter(diffuseKey);
+				parameterList.SetParameter("NewParameter", 42LL);
+
+				Nz::String str;
+				CHECK(copy.GetStringParameter("LongString", &str));
+				CHECK(str == "A string too long to be stored inline");
+				CHECK(parameterList.GetStringParameter("LongString", &str));
+				CHECK(str == "A string too long to be stored inline");
+				CHECK(!copy.HasParameter(diffuseKey));
+				CHECK(parameterList.HasParameter(diffuseKey));
+			}
+
+			AND_THEN("We can remove parameters while iterating")
+			{
+				parameterList.ForEach([&](const Nz::ParameterList&, const Nz::String& name)
+				{
+					return name.EndsWith("_MAPPING");
+				});
+
+				CHECK(!parameterList.HasParameter(diffuseKey));
+				CHECK(!parameterList.HasParameter(normalKey));
+				CHECK(parameterList.HasParameter("LongString"));
+			}
+		}
+	}
 }
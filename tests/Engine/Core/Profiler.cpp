@@ -0,0 +1,136 @@
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+namespace
+{
+	Nz::String WriteTrace()
+	{
+		Nz::ByteArray byteArray;
+		Nz::MemoryStream stream(&byteArray, Nz::OpenMode_WriteOnly);
+		Nz::Profiler::WriteChromeTrace(stream);
+
+		return Nz::String(reinterpret_cast<const char*>(byteArray.GetConstBuffer()), byteArray.GetSize());
+	}
+}
+
+SCENARIO("Profiler", "[CORE][PROFILER]")
+{
+	GIVEN("A cleared profiler")
+	{
+		Nz::Profiler::Clear();
+
+		WHEN("Zones are used while the profiler is disabled")
+		{
+			{
+				Nz::ProfilerZone zone("DisabledZone");
+				Nz::Profiler::Enable(); // Enabling it in the middle of a zone mustn't record an orphan end
+			}
+			Nz::Profiler::Disable();
+
+			THEN("Nothing is recorded")
+			{
+				CHECK(Nz::Profiler::GetEventCount() == 0);
+			}
+		}
+
+		WHEN("Nested zones, counters and frames are recorded")
+		{
+			Nz::Profiler::Enable();
+			{
+				Nz::ProfilerZone outerZone("Outer");
+				{
+					Nz::ProfilerZone innerZone("Inner \"quoted\"");
+					Nz::Profiler::RecordCounter("Counter", 42.0);
+				}
+
+				Nz::Profiler::MarkFrame("Frame");
+				Nz::Profiler::Disable(); // The outer zone must still end
+			}
+
+			THEN("Every event is recorded")
+			{
+				CHECK(Nz::Profiler::GetEventCount() == 6);
+			}
+
+			AND_THEN("The Chrome trace contains them")
+			{
+				Nz::String trace = WriteTrace();
+
+				CHECK(trace.StartsWith("{"));
+				CHECK(trace.Find("\"traceEvents\"") != Nz::String::npos);
+				CHECK(trace.Find("\"name\": \"Outer\", \"ph\": \"B\"") != Nz::String::npos);
+				CHECK(trace.Find("\"name\": \"Inner \\\"quoted\\\"\", \"ph\": \"B\"") != Nz::String::npos);
+				CHECK(trace.Find("\"name\": \"Counter\", \"ph\": \"C\"") != Nz::String::npos);
+				CHECK(trace.Find("\"args\": {\"value\": 42}") != Nz::String::npos);
+				CHECK(trace.Find("\"ph\": \"E\"") != Nz::String::npos);
+				CHECK(trace.Find("\"name\": \"Frame\", \"ph\": \"i\"") != Nz::String::npos);
+			}
+
+			AND_THEN("Clearing the profiler removes them")
+			{
+				Nz::Profiler::Clear();
+				CHECK(Nz::Profiler::GetEventCount() == 0);
+			}
+		}
+
+		WHEN("Other threads record zones")
+		{
+			constexpr unsigned int ZonePerThread = 3000; // More than a chunk worth of events
+
+			Nz::Profiler::Enable();
+
+			Nz::Thread threads[2];
+			for (Nz::Thread& thread : threads)
+			{
+				thread = Nz::Thread([]()
+				{
+					Nz::Thread::SetCurrentThreadName("ProfiledThread");
+
+					for (unsigned int i = 0; i < ZonePerThread; ++i)
+						NazaraProfileZone("ThreadZone");
+				});
+			}
+
+			for (Nz::Thread& thread : threads)
+				thread.Join();
+
+			Nz::Profiler::Disable();
+
+			THEN("Their events and names are recorded")
+			{
+				#if NAZARA_CORE_ENABLE_PROFILER
+				CHECK(Nz::Profiler::GetEventCount() == 2 * 2 * ZonePerThread);
+
+				Nz::String trace = WriteTrace();
+				CHECK(trace.Find("\"args\": {\"name\": \"ProfiledThread\"}") != Nz::String::npos);
+				#endif
+			}
+		}
+
+		WHEN("A thread is named while the profiler is disabled")
+		{
+			Nz::Thread thread([]()
+			{
+				Nz::Thread::SetCurrentThreadName("UnprofiledThr");
+
+				NazaraProfileZone("UnprofiledZone");
+			});
+			thread.Join();
+
+			THEN("Nothing is recorded for it")
+			{
+				CHECK(Nz::Profiler::GetEventCount() == 0);
+
+				Nz::String trace = WriteTrace();
+				CHECK(trace.Find("UnprofiledThr") == Nz::String::npos);
+			}
+		}
+
+		Nz::Profiler::Disable();
+		Nz::Profiler::Clear();
+	}
+}
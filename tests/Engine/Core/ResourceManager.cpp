@@ -0,0 +1,205 @@
+#include <Nazara/Core/ResourceManager.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/RefCounted.hpp>
+#include <Nazara/Core/Resource.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	struct DummyParams : Nz::ResourceParameters
+	{
+		bool IsValid() const
+		{
+			return true;
+		}
+	};
+
+	class DummyResource;
+
+	using DummyResourceRef = Nz::ObjectRef<DummyResource>;
+	using DummyResourceManager = Nz::ResourceManager<DummyResource, DummyParams>;
+
+	class DummyResource : public Nz::RefCounted, public Nz::Resource
+	{
+		friend DummyResourceManager;
+
+		public:
+			static DummyResourceRef LoadFromFile(const Nz::String& filePath, const DummyParams& /*params*/)
+			{
+				{
+					std::unique_lock<std::mutex> lock(s_gateMutex);
+					s_gateCondition.wait(lock, []() { return s_gateOpen; });
+				}
+
+				s_loadCount++;
+
+				if (filePath.EndsWith("Invalid"))
+					return nullptr;
+
+				DummyResourceRef resource = new DummyResource;
+				resource->SetFilePath(filePath);
+
+				return resource;
+			}
+
+			static void SetGate(bool open)
+			{
+				{
+					std::lock_guard<std::mutex> lock(s_gateMutex);
+					s_gateOpen = open;
+				}
+
+				s_gateCondition.notify_all();
+			}
+
+			static std::atomic_uint s_loadCount;
+
+		private:
+			static std::condition_variable s_gateCondition;
+			static std::mutex s_gateMutex;
+			static bool s_gateOpen;
+
+			static DummyResourceManager::ManagerMap s_managerMap;
+			static DummyResourceManager::ManagerParams s_managerParameters;
+	};
+
+	std::atomic_uint DummyResource::s_loadCount(0);
+	std::condition_variable DummyResource::s_gateCondition;
+	std::mutex DummyResource::s_gateMutex;
+	bool DummyResource::s_gateOpen = true;
+	DummyResourceManager::ManagerMap DummyResource::s_managerMap;
+	DummyResourceManager::ManagerParams DummyResource::s_managerParameters;
+}
+
+SCENARIO("ResourceManager", "[CORE][RESOURCEMANAGER]")
+{
+	GIVEN("A resource manager")
+	{
+		DummyResourceManager::Clear();
+		DummyResource::s_loadCount = 0;
+
+		WHEN("We get the same resource synchronously twice")
+		{
+			DummyResourceRef first = DummyResourceManager::Get("first");
+			DummyResourceRef second = DummyResourceManager::Get("first");
+
+			THEN("It is loaded only once")
+			{
+				REQUIRE(first);
+				CHECK(first == second);
+				CHECK(DummyResource::s_loadCount == 1);
+			}
+		}
+
+		WHEN("We request the same resource asynchronously multiple times")
+		{
+			std::atomic_uint callbackCount(0);
+			auto callback = [&](const DummyResourceRef& resource)
+			{
+				if (resource)
+					callbackCount++;
+			};
+
+			DummyResource::SetGate(false);
+
+			DummyResourceManager::AsyncResource first = DummyResourceManager::GetAsync("async", 0, callback);
+			DummyResourceManager::AsyncResource second = DummyResourceManager::GetAsync("async", 0, callback);
+			CHECK(first.IsValid());
+			CHECK(!first.IsReady());
+
+			DummyResource::SetGate(true);
+
+			THEN("Both requests share a single load and callbacks are called")
+			{
+				DummyResourceRef resource = first.Get();
+				Nz::TaskScheduler::WaitForTasks();
+
+				REQUIRE(resource);
+				CHECK(second.IsReady());
+				CHECK(second.Get() == resource);
+				CHECK(DummyResourceManager::Get("async") == resource);
+				CHECK(DummyResource::s_loadCount == 1);
+				CHECK(callbackCount == 2);
+			}
+		}
+
+		WHEN("We request a resource and only poll it")
+		{
+			DummyResourceManager::AsyncResource asyncResource = DummyResourceManager::GetAsync("polled");
+
+			THEN("It gets loaded by the workers")
+			{
+				// Neither Get, Wait nor TaskScheduler::Run are called, the load must start by itself
+				Nz::Clock clock;
+				while (!asyncResource.IsReady() && clock.GetMilliseconds() < 10000)
+					std::this_thread::yield();
+
+				REQUIRE(asyncResource.IsReady());
+				CHECK(asyncResource.Get());
+				CHECK(DummyResource::s_loadCount == 1);
+			}
+		}
+
+		WHEN("We request a resource which is already loaded")
+		{
+			DummyResourceRef resource = DummyResourceManager::Get("loaded");
+
+			bool called = false;
+			DummyResourceManager::AsyncResource asyncResource = DummyResourceManager::GetAsync("loaded", 0, [&](const DummyResourceRef& loaded)
+			{
+				called = (loaded == resource);
+			});
+
+			THEN("It is ready immediately")
+			{
+				CHECK(called);
+				CHECK(asyncResource.IsReady());
+				CHECK(asyncResource.Get() == resource);
+				CHECK(DummyResource::s_loadCount == 1);
+			}
+		}
+
+		WHEN("We request many resources with different priorities")
+		{
+			DummyResource::SetGate(false);
+
+			std::vector<DummyResourceManager::AsyncResource> resources;
+			for (int i = 0; i < 20; ++i)
+				resources.push_back(DummyResourceManager::GetAsync("resource" + Nz::String::Number(i), i % 3));
+
+			DummyResource::SetGate(true);
+
+			THEN("All of them get loaded once")
+			{
+				for (auto& asyncResource : resources)
+					CHECK(asyncResource.Get());
+
+				Nz::TaskScheduler::WaitForTasks();
+				CHECK(DummyResource::s_loadCount == 20);
+			}
+		}
+
+		WHEN("A load fails")
+		{
+			DummyResourceManager::AsyncResource asyncResource = DummyResourceManager::GetAsync("Invalid");
+
+			THEN("The resource is null")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorFlag_Silent);
+
+				CHECK(!asyncResource.Get());
+				Nz::TaskScheduler::WaitForTasks();
+			}
+		}
+
+		Nz::TaskScheduler::WaitForTasks();
+		DummyResourceManager::Clear();
+	}
+}
@@ -1,11 +1,14 @@
 #include <Nazara/Core/SerializationContext.hpp>
 
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/File.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Ray.hpp>
 #include <array>
+#include <cstring>
+#include <limits>
 
 #include <Catch/catch.hpp>
 
@@ -43,6 +46,188 @@ SCENARIO("Serialization", "[CORE][SERIALIZATION]")
 			}
 		}
 
+		WHEN("We serialize arrays of arithmetic values")
+		{
+			std::array<Nz::UInt32, 5> values = { 0x01020304, 0xDEADBEEF, 0, 42, 0xFFFFFFFF };
+			std::array<float, 3> floats = { 1.f, -2.5f, 1e10f };
+
+			THEN("They are encoded like values serialized one by one, whatever the endianness")
+			{
+				for (Nz::Endianness endianness : { Nz::Endianness_BigEndian, Nz::Endianness_LittleEndian })
+				{
+					context.endianness = endianness;
+
+					std::array<char, 256> expected;
+					Nz::MemoryView expectedStream(expected.data(), expected.size());
+					Nz::SerializationContext expectedContext;
+					expectedContext.endianness = endianness;
+					expectedContext.stream = &expectedStream;
+
+					for (Nz::UInt32 value : values)
+						REQUIRE(Serialize(expectedContext, value));
+
+					context.stream->SetCursorPos(0);
+					REQUIRE(Serialize(context, values.data(), values.size()));
+					CHECK(context.stream->GetCursorPos() == values.size() * sizeof(Nz::UInt32));
+					CHECK(std::memcmp(datas.data(), expected.data(), values.size() * sizeof(Nz::UInt32)) == 0);
+
+					std::array<Nz::UInt32, 5> readValues;
+					context.stream->SetCursorPos(0);
+					REQUIRE(Unserialize(context, readValues.data(), readValues.size()));
+					CHECK(readValues == values);
+
+					context.stream->SetCursorPos(0);
+					REQUIRE(Serialize(context, floats.data(), floats.size()));
+
+					std::array<float, 3> readFloats;
+					context.stream->SetCursorPos(0);
+					REQUIRE(Unserialize(context, readFloats.data(), readFloats.size()));
+					CHECK(readFloats == floats);
+				}
+			}
+
+			THEN("Pending bits are flushed before them")
+			{
+				context.stream->SetCursorPos(0);
+				REQUIRE(Serialize(context, true));
+				REQUIRE(Serialize(context, values.data(), values.size()));
+				CHECK(context.stream->GetCursorPos() == 1 + values.size() * sizeof(Nz::UInt32));
+
+				bool boolean = false;
+				std::array<Nz::UInt32, 5> readValues;
+				context.stream->SetCursorPos(0);
+				REQUIRE(Unserialize(context, &boolean));
+				REQUIRE(Unserialize(context, readValues.data(), readValues.size()));
+				CHECK(boolean);
+				CHECK(readValues == values);
+			}
+
+			THEN("Reading past the end fails")
+			{
+				std::array<Nz::UInt64, 64> tooBig;
+				context.stream->SetCursorPos(0);
+				CHECK_FALSE(Unserialize(context, tooBig.data(), tooBig.size()));
+			}
+		}
+
+		WHEN("We serialize bits")
+		{
+			context.stream->SetCursorPos(0);
+			REQUIRE(Nz::SerializeBits(context, 5, 3));
+			REQUIRE(Serialize(context, true));
+			REQUIRE(Nz::SerializeBits(context, 0x1234, 13));
+			REQUIRE(Nz::SerializeBits(context, 0xFFFFFFFFFFFFFFFFULL, 64));
+			REQUIRE(Nz::SerializeBits(context, 0xFF, 0));
+			REQUIRE(Nz::SerializeBits(context, 0x0F, 2)); // Upper bits are ignored
+			context.FlushBits();
+
+			THEN("They are tightly packed")
+			{
+				CHECK(context.stream->GetCursorPos() == 11); // 3 + 1 + 13 + 64 + 2 = 83 bits
+			}
+
+			AND_THEN("They can be read back")
+			{
+				Nz::UInt64 value;
+				bool boolean = false;
+				context.stream->SetCursorPos(0);
+				REQUIRE(Nz::UnserializeBits(context, &value, 3));
+				CHECK(value == 5);
+				REQUIRE(Unserialize(context, &boolean));
+				CHECK(boolean);
+				REQUIRE(Nz::UnserializeBits(context, &value, 13));
+				CHECK(value == 0x1234);
+				REQUIRE(Nz::UnserializeBits(context, &value, 64));
+				CHECK(value == 0xFFFFFFFFFFFFFFFFULL);
+				REQUIRE(Nz::UnserializeBits(context, &value, 0));
+				CHECK(value == 0);
+				REQUIRE(Nz::UnserializeBits(context, &value, 2));
+				CHECK(value == 3);
+			}
+		}
+
+		WHEN("We serialize variable-length integers")
+		{
+			THEN("Small values take a single byte")
+			{
+				context.stream->SetCursorPos(0);
+				REQUIRE(Nz::SerializeVarInt(context, Nz::UInt32(127)));
+				REQUIRE(Nz::SerializeVarInt(context, Nz::Int32(-64)));
+				CHECK(context.stream->GetCursorPos() == 2);
+				CHECK(Nz::UInt8(datas[0]) == 0x7F);
+				CHECK(Nz::UInt8(datas[1]) == 0x7F); // Zigzag encoding of -64
+
+				REQUIRE(Nz::SerializeVarInt(context, Nz::UInt32(300)));
+				CHECK(Nz::UInt8(datas[2]) == 0xAC);
+				CHECK(Nz::UInt8(datas[3]) == 0x02);
+			}
+
+			THEN("Extreme values go through")
+			{
+				std::array<Nz::Int64, 6> signedValues = { 0, -1, 1, std::numeric_limits<Nz::Int64>::min(), std::numeric_limits<Nz::Int64>::max(), -1234567 };
+				std::array<Nz::UInt64, 4> unsignedValues = { 0, 128, 16383, std::numeric_limits<Nz::UInt64>::max() };
+				Nz::Int8 int8Value = std::numeric_limits<Nz::Int8>::min();
+				Nz::UInt16 uint16Value = std::numeric_limits<Nz::UInt16>::max();
+
+				context.stream->SetCursorPos(0);
+				REQUIRE(Nz::SerializeVarInt(context, signedValues.data(), signedValues.size()));
+				REQUIRE(Nz::SerializeVarInt(context, unsignedValues.data(), unsignedValues.size()));
+				REQUIRE(Nz::SerializeVarInt(context, int8Value));
+				REQUIRE(Nz::SerializeVarInt(context, uint16Value));
+				Nz::UInt64 size = context.stream->GetCursorPos();
+
+				auto CheckValues = [&](Nz::SerializationContext& readContext)
+				{
+					std::array<Nz::Int64, 6> readSignedValues;
+					std::array<Nz::UInt64, 4> readUnsignedValues;
+					Nz::Int8 readInt8Value;
+					Nz::UInt16 readUInt16Value;
+
+					readContext.stream->SetCursorPos(0);
+					REQUIRE(Nz::UnserializeVarInt(readContext, readSignedValues.data(), readSignedValues.size()));
+					REQUIRE(Nz::UnserializeVarInt(readContext, readUnsignedValues.data(), readUnsignedValues.size()));
+					REQUIRE(Nz::UnserializeVarInt(readContext, &readInt8Value));
+					REQUIRE(Nz::UnserializeVarInt(readContext, &readUInt16Value));
+					CHECK(readContext.stream->GetCursorPos() == size);
+
+					CHECK(readSignedValues == signedValues);
+					CHECK(readUnsignedValues == unsignedValues);
+					CHECK(readInt8Value == int8Value);
+					CHECK(readUInt16Value == uint16Value);
+				};
+
+				// Decoded in place from the memory view
+				CheckValues(context);
+
+				// Decoded byte by byte from a stream without memory access
+				Nz::File file("SerializationVarInt.bin", Nz::OpenMode_ReadWrite | Nz::OpenMode_Truncate);
+				REQUIRE(file.Write(datas.data(), static_cast<std::size_t>(size)) == size);
+
+				Nz::SerializationContext fileContext;
+				fileContext.stream = &file;
+				CheckValues(fileContext);
+
+				file.Close();
+				file.Delete();
+			}
+
+			THEN("Invalid encodings are rejected")
+			{
+				std::array<Nz::UInt8, 3> overflowing = { 0xFF, 0xFF, 0x04 }; // 2^16 doesn't fit in a UInt16
+				Nz::MemoryView overflowingStream(overflowing.data(), overflowing.size());
+				context.stream = &overflowingStream;
+
+				Nz::UInt16 value;
+				CHECK_FALSE(Nz::UnserializeVarInt(context, &value));
+
+				std::array<Nz::UInt8, 2> truncated = { 0x80, 0x80 };
+				Nz::MemoryView truncatedStream(truncated.data(), truncated.size());
+				context.stream = &truncatedStream;
+
+				CHECK_FALSE(Nz::UnserializeVarInt(context, &value));
+			}
+		}
+
 		WHEN("We serialize mathematical classes")
 		{
 			THEN("BoudingVolume")
@@ -1,5 +1,7 @@
 #include <Nazara/Core/Signal.hpp>
 #include <Catch/catch.hpp>
+#include <array>
+#include <vector>
 
 struct Incrementer
 {
@@ -46,3 +48,170 @@ SCENARIO("Signal", "[CORE][SIGNAL]")
 		}
 	}
 }
+
+SCENARIO("Signal slots", "[CORE][SIGNAL]")
+{
+	GIVEN("A signal with listeners")
+	{
+		Nz::Signal<int*> signal;
+		int inc = 0;
+
+		WHEN("A listener connects another one during the emission")
+		{
+			Nz::Signal<int*>::Connection lateConnection;
+			signal.Connect([&](int* value)
+			{
+				*value += 1;
+				if (!lateConnection.IsConnected())
+					lateConnection = signal.Connect([](int* lateValue) { *lateValue += 10; });
+			});
+
+			signal(&inc);
+
+			THEN("The new listener is only called from the next emission")
+			{
+				CHECK(inc == 1);
+				CHECK(lateConnection.IsConnected());
+				CHECK(signal.GetSlotCount() == 2);
+
+				signal(&inc);
+				CHECK(inc == 12);
+			}
+		}
+
+		WHEN("Listeners disconnect themselves and each other during the emission")
+		{
+			Nz::Signal<int*>::Connection first;
+			Nz::Signal<int*>::Connection second;
+			Nz::Signal<int*>::Connection third;
+
+			first = signal.Connect([&](int* value)
+			{
+				*value += 1;
+				first.Disconnect();
+				third.Disconnect();
+			});
+			second = signal.Connect([](int* value) { *value += 10; });
+			third = signal.Connect([](int* value) { *value += 100; });
+
+			signal(&inc);
+
+			THEN("Disconnected listeners are no longer called")
+			{
+				CHECK(inc == 11);
+				CHECK(!first.IsConnected());
+				CHECK(second.IsConnected());
+				CHECK(!third.IsConnected());
+				CHECK(signal.GetSlotCount() == 1);
+
+				signal(&inc);
+				CHECK(inc == 21);
+			}
+		}
+
+		WHEN("A listener captures more than fits in a slot")
+		{
+			std::array<int, 16> values;
+			values.fill(1);
+
+			signal.Connect([values](int* value)
+			{
+				for (int v : values)
+					*value += v;
+			});
+
+			signal(&inc);
+
+			THEN("It is still called")
+			{
+				CHECK(inc == 16);
+			}
+		}
+
+		WHEN("The signal is moved")
+		{
+			auto connection = signal.Connect([](int* value) { *value += 1; });
+			Nz::Signal<int*> movedSignal(std::move(signal));
+
+			THEN("Connections follow the signal")
+			{
+				CHECK(connection.IsConnected());
+
+				movedSignal(&inc);
+				CHECK(inc == 1);
+
+				connection.Disconnect();
+				CHECK(!connection.IsConnected());
+
+				movedSignal(&inc);
+				CHECK(inc == 1);
+			}
+		}
+
+		WHEN("The signal is destroyed or cleared")
+		{
+			Nz::Signal<int*>::Connection connection;
+			{
+				Nz::Signal<int*> temporarySignal;
+				connection = temporarySignal.Connect([](int*) {});
+				CHECK(connection.IsConnected());
+			}
+
+			auto clearedConnection = signal.Connect([](int* value) { *value += 1; });
+			signal.Clear();
+
+			THEN("Connections are disconnected")
+			{
+				CHECK(!connection.IsConnected());
+				connection.Disconnect();
+
+				CHECK(!clearedConnection.IsConnected());
+				signal(&inc);
+				CHECK(inc == 0);
+			}
+		}
+
+		WHEN("A connection guard goes out of scope")
+		{
+			{
+				Nz::Signal<int*>::ConnectionGuard guard;
+				guard.Connect(signal, [](int* value) { *value += 1; });
+
+				signal(&inc);
+			}
+
+			signal(&inc);
+
+			THEN("The listener is disconnected")
+			{
+				CHECK(inc == 1);
+				CHECK(signal.GetSlotCount() == 0);
+			}
+		}
+	}
+
+	GIVEN("A signal with deferred emissions")
+	{
+		Nz::Signal<int> signal;
+		std::vector<int> received;
+		signal.Connect([&](int value) { received.push_back(value); });
+
+		signal.Defer(1);
+		signal.Defer(2);
+		signal.Defer(3);
+
+		WHEN("We flush it")
+		{
+			CHECK(received.empty());
+			CHECK(signal.GetDeferredCount() == 3);
+
+			signal.Flush();
+
+			THEN("Every emission is made in order")
+			{
+				CHECK(received == std::vector<int>({ 1, 2, 3 }));
+				CHECK(signal.GetDeferredCount() == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,129 @@
+#include <Nazara/Core/SmallObjectAllocator.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+
+#include <Nazara/Math/Vector2.hpp>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <vector>
+
+SCENARIO("SmallObjectAllocator", "[CORE][SMALLOBJECTALLOCATOR]")
+{
+	GIVEN("Some allocations of various sizes")
+	{
+		Nz::SmallObjectAllocator::Stats statsBefore = Nz::SmallObjectAllocator::GetStats();
+
+		std::vector<std::pair<void*, std::size_t>> allocations;
+		for (std::size_t size = 1; size <= 2 * Nz::SmallObjectAllocator::MaxSmallSize; size += 7)
+			allocations.emplace_back(Nz::SmallObjectAllocator::Allocate(size), size);
+
+		THEN("Memory is aligned and usable")
+		{
+			for (auto& pair : allocations)
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(pair.first) % alignof(std::max_align_t) == 0);
+				std::memset(pair.first, 0xFF, pair.second);
+			}
+		}
+
+		THEN("Stats report them")
+		{
+			Nz::SmallObjectAllocator::Stats stats = Nz::SmallObjectAllocator::GetStats();
+
+			std::size_t expectedBytes = 0;
+			for (auto& pair : allocations)
+				expectedBytes += Nz::SmallObjectAllocator::GetBlockSize(pair.second);
+
+			CHECK(stats.bytesInUse - statsBefore.bytesInUse == expectedBytes);
+			CHECK(stats.largeAllocationCount > statsBefore.largeAllocationCount);
+			CHECK(stats.bytesReserved > 0);
+		}
+
+		for (auto& pair : allocations)
+			Nz::SmallObjectAllocator::Free(pair.first, pair.second);
+
+		WHEN("We free them")
+		{
+			Nz::SmallObjectAllocator::Stats stats = Nz::SmallObjectAllocator::GetStats();
+
+			THEN("Memory is not in use anymore")
+			{
+				CHECK(stats.bytesInUse == statsBefore.bytesInUse);
+			}
+		}
+
+		WHEN("We allocate the same sizes again")
+		{
+			void* ptr = Nz::SmallObjectAllocator::Allocate(allocations.front().second);
+
+			THEN("Freed blocks are reused from the thread cache")
+			{
+				Nz::SmallObjectAllocator::Stats stats = Nz::SmallObjectAllocator::GetStats();
+				CHECK(stats.sizeClasses[0].cacheHitCount > statsBefore.sizeClasses[0].cacheHitCount);
+			}
+
+			Nz::SmallObjectAllocator::Free(ptr, allocations.front().second);
+		}
+	}
+
+	GIVEN("An object created by New")
+	{
+		Nz::Vector2<int>* vector = Nz::SmallObjectAllocator::New<Nz::Vector2<int>>(1, 2);
+
+		THEN("It is constructed and can be deleted")
+		{
+			CHECK(*vector == Nz::Vector2<int>(1, 2));
+		}
+
+		Nz::SmallObjectAllocator::Delete(vector);
+	}
+
+	GIVEN("Standard containers using SmallObjectStlAllocator")
+	{
+		std::list<int, Nz::SmallObjectStlAllocator<int>> list;
+		std::map<int, int, std::less<int>, Nz::SmallObjectStlAllocator<std::pair<const int, int>>> map;
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			list.push_back(i);
+			map[i] = i * 2;
+		}
+
+		THEN("They work as usual")
+		{
+			CHECK(list.size() == 1000);
+			CHECK(list.back() == 999);
+			CHECK(map.size() == 1000);
+			CHECK(map[500] == 1000);
+		}
+	}
+
+	GIVEN("Blocks allocated by a thread")
+	{
+		constexpr std::size_t blockCount = 10000;
+
+		std::vector<void*> blocks(blockCount);
+		for (void*& block : blocks)
+			block = Nz::SmallObjectAllocator::Allocate(24);
+
+		WHEN("Another thread frees them")
+		{
+			Nz::SmallObjectAllocator::Stats statsBefore = Nz::SmallObjectAllocator::GetStats();
+
+			Nz::Thread thread([&blocks]()
+			{
+				for (void* block : blocks)
+					Nz::SmallObjectAllocator::Free(block, 24);
+			});
+			thread.Join();
+
+			THEN("They are accounted as freed")
+			{
+				Nz::SmallObjectAllocator::Stats stats = Nz::SmallObjectAllocator::GetStats();
+				CHECK(statsBefore.bytesInUse - stats.bytesInUse == blockCount * Nz::SmallObjectAllocator::GetBlockSize(24));
+			}
+		}
+	}
+}
@@ -142,5 +142,60 @@ SCENARIO("String", "[CORE][STRING]")
 			}
 		}
 	}
-}
 
+	GIVEN("A short and a long string")
+	{
+		Nz::String shortString("Short");
+		Nz::String longString("A string too long to be stored inline");
+
+		WHEN("We copy and modify them")
+		{
+			Nz::String shortCopy(shortString);
+			Nz::String longCopy(longString);
+
+			shortCopy[0] = 's';
+			longCopy[0] = 'a';
+
+			THEN("Originals are left untouched")
+			{
+				CHECK(shortString == "Short");
+				CHECK(shortCopy == "short");
+				CHECK(longString == "A string too long to be stored inline");
+				CHECK(longCopy == "a string too long to be stored inline");
+			}
+		}
+
+		WHEN("We move them")
+		{
+			const char* longBuffer = longString.GetConstBuffer();
+
+			Nz::String shortMoved(std::move(shortString));
+			Nz::String longMoved;
+			longMoved = std::move(longString);
+
+			THEN("Content is transferred, without copying long strings")
+			{
+				CHECK(shortMoved == "Short");
+				CHECK(longMoved == "A string too long to be stored inline");
+				CHECK(longMoved.GetConstBuffer() == longBuffer);
+				CHECK(shortString.IsEmpty());
+				CHECK(longString.IsEmpty());
+			}
+		}
+
+		WHEN("We swap them and append to them")
+		{
+			shortString.Swap(longString);
+			for (int i = 0; i < 100; ++i)
+				longString.Append('x');
+
+			THEN("Both remain valid")
+			{
+				CHECK(shortString == "A string too long to be stored inline");
+				CHECK(longString.GetSize() == 105);
+				CHECK(longString.StartsWith("Shortxxx"));
+				CHECK(std::hash<Nz::String>()(shortString) == std::hash<Nz::StringView>()(Nz::StringView("A string too long to be stored inline")));
+			}
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#include <Nazara/Core/StringView.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Catch/catch.hpp>
+#include <unordered_set>
+
+SCENARIO("StringView", "[CORE][STRINGVIEW]")
+{
+	GIVEN("A view of a string")
+	{
+		Nz::String string("resources/textures/wall.png");
+		Nz::StringView view = string;
+
+		THEN("It references the string content")
+		{
+			CHECK(view.GetConstBuffer() == string.GetConstBuffer());
+			CHECK(view.GetSize() == string.GetSize());
+			CHECK(view == "resources/textures/wall.png");
+			CHECK(view != "resources/textures/wall.jpg");
+			CHECK(Nz::String(view) == string);
+		}
+
+		WHEN("We look for parts of it")
+		{
+			std::size_t extensionPos = view.FindLast('.');
+			std::size_t separatorPos = view.Find('/');
+
+			THEN("These results are expected")
+			{
+				CHECK(view.StartsWith("resources/"));
+				CHECK(view.EndsWith(".png"));
+				CHECK(!view.EndsWith("a much longer suffix than the view"));
+				CHECK(separatorPos == 9);
+				CHECK(view.Find('/', separatorPos + 1) == 18);
+				CHECK(view.Find('?') == Nz::StringView::npos);
+				CHECK(view.SubView(extensionPos + 1) == "png");
+				CHECK(view.SubView(0, separatorPos) == "resources");
+				CHECK(view.SubView(100).IsEmpty());
+			}
+		}
+
+		WHEN("We compare it")
+		{
+			THEN("It is ordered lexicographically")
+			{
+				CHECK(Nz::StringView("abc") < Nz::StringView("abd"));
+				CHECK(Nz::StringView("ab") < Nz::StringView("abc"));
+				CHECK(Nz::StringView("abc").Compare("abc") == 0);
+				CHECK(Nz::StringView("b").Compare("abc") > 0);
+			}
+		}
+	}
+
+	GIVEN("A view built from a part of a buffer")
+	{
+		const char buffer[] = "Position=12";
+		Nz::StringView key(buffer, 8);
+
+		THEN("It hashes like the equivalent string")
+		{
+			CHECK(key == "Position");
+			CHECK(std::hash<Nz::StringView>()(key) == std::hash<Nz::String>()("Position"));
+
+			std::unordered_set<Nz::StringView> set;
+			set.insert(key);
+			CHECK(set.count("Position") == 1);
+			CHECK(set.count("Pos") == 0);
+		}
+	}
+
+	GIVEN("A default view")
+	{
+		Nz::StringView view;
+
+		THEN("It is empty")
+		{
+			CHECK(view.IsEmpty());
+			CHECK(view == "");
+			CHECK(view == Nz::StringView(nullptr));
+		}
+	}
+}
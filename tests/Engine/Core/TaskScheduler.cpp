@@ -0,0 +1,177 @@
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Catch/catch.hpp>
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+	void Spawn(std::atomic_int* counter, int depth)
+	{
+		(*counter)++;
+
+		if (depth > 0)
+		{
+			Nz::TaskScheduler::AddTask([counter, depth]() { Spawn(counter, depth - 1); });
+			Nz::TaskScheduler::AddTask([counter, depth]() { Spawn(counter, depth - 1); });
+		}
+	}
+}
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("An initialized task scheduler")
+	{
+		REQUIRE(Nz::TaskScheduler::Initialize());
+
+		WHEN("We run a lot of tasks")
+		{
+			std::atomic_int counter(0);
+			for (int i = 0; i < 10000; ++i)
+				Nz::TaskScheduler::AddTask([&counter]() { counter++; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every one of them was executed once")
+			{
+				CHECK(counter == 10000);
+			}
+		}
+
+		WHEN("Tasks spawn other tasks")
+		{
+			std::atomic_int counter(0);
+			Nz::TaskScheduler::AddTask(Spawn, &counter, 10);
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Spawned tasks are executed before WaitForTasks returns")
+			{
+				CHECK(counter == (1 << 11) - 1);
+			}
+		}
+
+		WHEN("Tasks capture more data than a task slot can hold")
+		{
+			struct LargeCapture
+			{
+				std::atomic_int* counter;
+				char padding[Nz::TaskScheduler::MaxInlineCaptureSize * 2];
+			};
+
+			std::atomic_int counter(0);
+			LargeCapture capture;
+			capture.counter = &counter;
+			capture.padding[0] = 1;
+
+			for (int i = 0; i < 1000; ++i)
+				Nz::TaskScheduler::AddTask([capture]() { *capture.counter += capture.padding[0]; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("They are still executed")
+			{
+				CHECK(counter == 1000);
+			}
+		}
+
+		WHEN("We use a task group")
+		{
+			std::atomic_int counter(0);
+
+			Nz::TaskGroup group;
+			for (int i = 0; i < 1000; ++i)
+				group.AddTask([&counter]() { counter++; });
+
+			group.Wait();
+
+			THEN("Tasks are executed without calling Run")
+			{
+				CHECK(group.IsDone());
+				CHECK(group.GetPendingTaskCount() == 0);
+				CHECK(counter == 1000);
+			}
+		}
+
+		WHEN("Tasks of a group depend on each other")
+		{
+			std::vector<int> order;
+
+			Nz::TaskGroup group;
+			Nz::TaskGroup::TaskId first = group.AddTask([&order]() { order.push_back(1); });
+			Nz::TaskGroup::TaskId second = group.AddTask({ first }, [&order]() { order.push_back(2); });
+			group.AddTask({ first, second }, [&order]() { order.push_back(3); });
+
+			Nz::TaskScheduler::Wait(group);
+
+			THEN("They are executed in the dependency order")
+			{
+				REQUIRE(order.size() == 3);
+				CHECK(order[0] == 1);
+				CHECK(order[1] == 2);
+				CHECK(order[2] == 3);
+			}
+
+			AND_THEN("A completed task can still be used as a dependency")
+			{
+				group.AddTask({ second }, [&order]() { order.push_back(4); });
+				group.Wait();
+
+				REQUIRE(order.size() == 4);
+				CHECK(order[3] == 4);
+			}
+
+			AND_THEN("The group can be cleared and reused")
+			{
+				group.Clear();
+
+				Nz::TaskGroup::TaskId fifth = group.AddTask([&order]() { order.push_back(5); });
+				group.AddTask({ fifth }, [&order]() { order.push_back(6); });
+				group.Wait();
+
+				REQUIRE(order.size() == 5);
+				CHECK(order[3] == 5);
+				CHECK(order[4] == 6);
+			}
+		}
+
+		WHEN("A task waits for another group")
+		{
+			std::atomic_int counter(0);
+
+			Nz::TaskGroup outerGroup;
+			for (int i = 0; i < 16; ++i)
+			{
+				outerGroup.AddTask([&counter]()
+				{
+					Nz::TaskGroup innerGroup;
+					for (int j = 0; j < 16; ++j)
+						innerGroup.AddTask([&counter]() { counter++; });
+
+					innerGroup.Wait();
+				});
+			}
+
+			outerGroup.Wait();
+
+			THEN("Nested waits do not deadlock")
+			{
+				CHECK(counter == 16 * 16);
+			}
+		}
+
+		WHEN("We wait without running anything")
+		{
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("It returns immediately")
+			{
+				SUCCEED();
+			}
+		}
+	}
+}
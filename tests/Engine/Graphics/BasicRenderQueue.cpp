@@ -0,0 +1,271 @@
+#include <Nazara/Graphics/BasicRenderQueue.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Utility/MeshData.hpp>
+#include <Nazara/Utility/VertexStruct.hpp>
+#include <Catch/catch.hpp>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	class TestViewer : public Nz::AbstractViewer
+	{
+		public:
+			TestViewer()
+			{
+				SetForward(Nz::Vector3f::Forward());
+			}
+
+			void ApplyView() const override {}
+
+			float GetAspectRatio() const override { return 1.f; }
+			Nz::Vector3f GetEyePosition() const override { return Nz::Vector3f::Zero(); }
+			Nz::Vector3f GetForward() const override { return m_forward; }
+			const Nz::Frustumf& GetFrustum() const override { return m_frustum; }
+			const Nz::Matrix4f& GetProjectionMatrix() const override { return m_matrix; }
+			Nz::ProjectionType GetProjectionType() const override { return Nz::ProjectionType_Perspective; }
+			const Nz::RenderTarget* GetTarget() const override { return nullptr; }
+			const Nz::Matrix4f& GetViewMatrix() const override { return m_matrix; }
+			const Nz::Recti& GetViewport() const override { return m_viewport; }
+			float GetZFar() const override { return 1000.f; }
+			float GetZNear() const override { return 1.f; }
+
+			void SetForward(const Nz::Vector3f& forward)
+			{
+				m_forward = forward;
+				m_frustum.Build(70.f, 1.f, 1.f, 1000.f, Nz::Vector3f::Zero(), forward);
+			}
+
+		private:
+			Nz::Frustumf m_frustum;
+			Nz::Vector3f m_forward;
+			Nz::Matrix4f m_matrix = Nz::Matrix4f::Identity();
+			Nz::Recti m_viewport = Nz::Recti(0, 0, 1, 1);
+	};
+
+	// Same calls as a render system would do for many objects, with different render orders and materials
+	void FillQueue(Nz::BasicRenderQueue& queue, std::size_t first, std::size_t last, const Nz::Material* opaqueMaterial, const Nz::Material* sortedMaterial, const std::vector<Nz::VertexStruct_XYZ_Color_UV>& vertices)
+	{
+		Nz::Recti scissorRect(-1, -1, -1, -1);
+
+		for (std::size_t i = first; i < last; ++i)
+		{
+			int renderOrder = static_cast<int>(i % 3) - 1;
+			const Nz::Material* material = (i % 5 == 0) ? sortedMaterial : opaqueMaterial;
+			Nz::Vector3f position(float(i % 17), float(i % 11), -float(i));
+
+			switch (i % 3)
+			{
+				case 0:
+				{
+					Nz::MeshData meshData;
+					meshData.indexBuffer = nullptr;
+					meshData.primitiveMode = Nz::PrimitiveMode_TriangleList;
+					meshData.vertexBuffer = nullptr;
+
+					queue.AddMesh(renderOrder, material, meshData, Nz::Boxf(1.f, 1.f, 1.f), Nz::Matrix4f::Translate(position), scissorRect);
+					break;
+				}
+
+				case 1:
+				{
+					Nz::Vector3f positions[2] = {position, position + Nz::Vector3f::Up()};
+					float sizes[2] = {1.f, 2.f};
+					queue.AddBillboards(renderOrder, material, 2, scissorRect, positions, sizes);
+					break;
+				}
+
+				case 2:
+					queue.AddSprites(renderOrder, material, &vertices[4 * i], 1, scissorRect);
+					break;
+			}
+		}
+	}
+
+	std::vector<Nz::Vector3f> GetBillboardCenters(const Nz::BasicRenderQueue& queue)
+	{
+		std::vector<Nz::Vector3f> centers;
+		for (const Nz::BasicRenderQueue::Billboard& billboard : queue.depthSortedBillboards)
+			centers.push_back(billboard.data.center);
+
+		return centers;
+	}
+
+	template<typename T, typename F>
+	bool CompareQueues(const Nz::RenderQueue<T>& lhs, const Nz::RenderQueue<T>& rhs, F&& compare)
+	{
+		if (lhs.size() != rhs.size())
+			return false;
+
+		auto lhsIt = lhs.begin();
+		for (const T& rhsData : rhs)
+		{
+			if (!compare(*lhsIt, rhsData))
+				return false;
+
+			++lhsIt;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("BasicRenderQueue", "[GRAPHICS][BASICRENDERQUEUE]")
+{
+	GIVEN("A queue filled with models, billboards and sprites, and the same content split in several queues")
+	{
+		constexpr std::size_t ObjectCount = 500;
+		constexpr std::size_t SliceSize = 37;
+
+		Nz::MaterialRef opaqueMaterial = Nz::Material::New();
+		Nz::MaterialRef sortedMaterial = Nz::Material::New();
+		sortedMaterial->EnableDepthSorting(true);
+
+		std::vector<Nz::VertexStruct_XYZ_Color_UV> vertices(4 * ObjectCount);
+		for (std::size_t i = 0; i < vertices.size(); ++i)
+			vertices[i].position.Set(float(i % 13), float(i % 7), -float(i));
+
+		Nz::BasicRenderQueue serialQueue;
+		FillQueue(serialQueue, 0, ObjectCount, opaqueMaterial, sortedMaterial, vertices);
+
+		std::vector<std::unique_ptr<Nz::BasicRenderQueue>> slices;
+		for (std::size_t first = 0; first < ObjectCount; first += SliceSize)
+		{
+			slices.emplace_back(std::make_unique<Nz::BasicRenderQueue>());
+			FillQueue(*slices.back(), first, std::min(first + SliceSize, ObjectCount), opaqueMaterial, sortedMaterial, vertices);
+		}
+
+		WHEN("We append the slices in order to an empty queue")
+		{
+			Nz::BasicRenderQueue mergedQueue;
+			for (const auto& slice : slices)
+				mergedQueue.Append(*slice);
+
+			TestViewer viewer;
+			serialQueue.Sort(&viewer);
+			mergedQueue.Sort(&viewer);
+
+			THEN("Both queues have the same content")
+			{
+				CHECK(serialQueue.models.size() > 0);
+				CHECK(serialQueue.depthSortedModels.size() > 0);
+				CHECK(serialQueue.billboards.size() > 0);
+				CHECK(serialQueue.depthSortedBillboards.size() > 0);
+				CHECK(serialQueue.basicSprites.size() > 0);
+				CHECK(serialQueue.depthSortedSprites.size() > 0);
+
+				auto CompareModels = [](const Nz::BasicRenderQueue::Model& lhs, const Nz::BasicRenderQueue::Model& rhs)
+				{
+					return lhs.layerIndex == rhs.layerIndex && lhs.material == rhs.material && lhs.matrix == rhs.matrix;
+				};
+
+				CHECK(CompareQueues(serialQueue.models, mergedQueue.models, CompareModels));
+				CHECK(CompareQueues(serialQueue.depthSortedModels, mergedQueue.depthSortedModels, CompareModels));
+
+				CHECK(CompareQueues(serialQueue.billboards, mergedQueue.billboards, [&](const Nz::BasicRenderQueue::BillboardChain& lhs, const Nz::BasicRenderQueue::BillboardChain& rhs)
+				{
+					if (lhs.layerIndex != rhs.layerIndex || lhs.material != rhs.material || lhs.billboardCount != rhs.billboardCount)
+						return false;
+
+					for (std::size_t i = 0; i < lhs.billboardCount; ++i)
+					{
+						const Nz::BasicRenderQueue::BillboardData* lhsData = serialQueue.GetBillboardData(lhs.billboardIndex + i);
+						const Nz::BasicRenderQueue::BillboardData* rhsData = mergedQueue.GetBillboardData(rhs.billboardIndex + i);
+						if (lhsData->center != rhsData->center || lhsData->size != rhsData->size)
+							return false;
+					}
+
+					return true;
+				}));
+
+				CHECK(CompareQueues(serialQueue.depthSortedBillboards, mergedQueue.depthSortedBillboards, [](const Nz::BasicRenderQueue::Billboard& lhs, const Nz::BasicRenderQueue::Billboard& rhs)
+				{
+					return lhs.layerIndex == rhs.layerIndex && lhs.material == rhs.material && lhs.data.center == rhs.data.center;
+				}));
+
+				auto CompareSprites = [](const Nz::BasicRenderQueue::SpriteChain& lhs, const Nz::BasicRenderQueue::SpriteChain& rhs)
+				{
+					return lhs.layerIndex == rhs.layerIndex && lhs.material == rhs.material && lhs.vertices == rhs.vertices && lhs.spriteCount == rhs.spriteCount;
+				};
+
+				CHECK(CompareQueues(serialQueue.basicSprites, mergedQueue.basicSprites, CompareSprites));
+				CHECK(CompareQueues(serialQueue.depthSortedSprites, mergedQueue.depthSortedSprites, CompareSprites));
+			}
+		}
+
+		WHEN("We sort the queue, add objects to it and sort it again")
+		{
+			TestViewer viewer;
+			serialQueue.Sort(&viewer);
+
+			std::size_t previousSize = serialQueue.models.size();
+
+			Nz::MeshData meshData;
+			meshData.indexBuffer = nullptr;
+			meshData.primitiveMode = Nz::PrimitiveMode_TriangleList;
+			meshData.vertexBuffer = nullptr;
+
+			serialQueue.AddMesh(-5, opaqueMaterial, meshData, Nz::Boxf(1.f, 1.f, 1.f), Nz::Matrix4f::Identity(), Nz::Recti(-1, -1, -1, -1));
+			serialQueue.Sort(&viewer);
+
+			THEN("The new objects are sorted with the others")
+			{
+				REQUIRE(serialQueue.models.size() == previousSize + 1);
+				CHECK((*serialQueue.models.begin()).layerIndex == -5);
+
+				int previousLayer = -5;
+				bool layersSorted = true;
+				for (const Nz::BasicRenderQueue::Model& model : serialQueue.models)
+				{
+					layersSorted = layersSorted && model.layerIndex >= previousLayer;
+					previousLayer = model.layerIndex;
+				}
+
+				CHECK(layersSorted);
+			}
+		}
+
+		WHEN("We sort the queue, turn the viewer without moving it and sort it again")
+		{
+			TestViewer viewer;
+			serialQueue.Sort(&viewer);
+
+			std::vector<Nz::Vector3f> previousCenters = GetBillboardCenters(serialQueue);
+
+			viewer.SetForward(Nz::Vector3f::Right());
+			serialQueue.Sort(&viewer);
+
+			Nz::BasicRenderQueue freshQueue;
+			FillQueue(freshQueue, 0, ObjectCount, opaqueMaterial, sortedMaterial, vertices);
+			freshQueue.Sort(&viewer);
+
+			THEN("Billboards are sorted again, as if the queue was sorted for the first time")
+			{
+				std::vector<Nz::Vector3f> centers = GetBillboardCenters(serialQueue);
+
+				CHECK(centers != previousCenters);
+				CHECK(centers == GetBillboardCenters(freshQueue));
+			}
+		}
+
+		WHEN("We clear the queue")
+		{
+			serialQueue.Clear();
+
+			TestViewer viewer;
+			serialQueue.Sort(&viewer);
+
+			THEN("It is empty")
+			{
+				CHECK(serialQueue.models.empty());
+				CHECK(serialQueue.depthSortedModels.empty());
+				CHECK(serialQueue.billboards.empty());
+				CHECK(serialQueue.depthSortedBillboards.empty());
+				CHECK(serialQueue.basicSprites.empty());
+				CHECK(serialQueue.depthSortedSprites.empty());
+				CHECK(serialQueue.customDrawables.empty());
+			}
+		}
+	}
+}
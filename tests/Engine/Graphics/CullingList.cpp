@@ -0,0 +1,286 @@
+#include <Nazara/Graphics/CullingList.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct Renderable
+	{
+		std::size_t id;
+	};
+
+	// Mixes volumes far away, intersecting the planes and fully inside (odd counts to exercise the scalar tail of the kernels)
+	std::vector<Nz::Boxf> BuildBoxes(std::size_t count)
+	{
+		std::mt19937 generator(1337);
+		std::uniform_real_distribution<float> position(-120.f, 120.f);
+		std::uniform_real_distribution<float> size(0.f, 20.f);
+
+		std::vector<Nz::Boxf> boxes;
+		boxes.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			boxes.emplace_back(position(generator), position(generator), position(generator), size(generator), size(generator), size(generator));
+
+		return boxes;
+	}
+
+	Nz::Frustumf BuildFrustum()
+	{
+		Nz::Frustumf frustum;
+		frustum.Build(70.f, 16.f / 9.f, 1.f, 100.f, Nz::Vector3f(1.f, 2.f, 3.f), Nz::Vector3f(0.3f, -0.2f, -1.f));
+
+		return frustum;
+	}
+}
+
+SCENARIO("CullingKernels", "[GRAPHICS][CULLINGKERNELS]")
+{
+	GIVEN("Boxes and spheres stored as arrays")
+	{
+		constexpr std::size_t VolumeCount = 1003;
+
+		Nz::Frustumf frustum = BuildFrustum();
+		std::vector<Nz::Boxf> boxes = BuildBoxes(VolumeCount);
+
+		Nz::CullingBoxArray boxArray;
+		Nz::CullingSphereArray sphereArray;
+		for (const Nz::Boxf& box : boxes)
+		{
+			boxArray.Add(box);
+			sphereArray.Add(Nz::Spheref(box.GetCenter(), box.GetRadius()));
+		}
+
+		Nz::CullingKernels::Implementation defaultImplementation = Nz::CullingKernels::GetImplementation();
+
+		WHEN("We cull them with every supported implementation")
+		{
+			THEN("Results are the same as Frustum::Intersect")
+			{
+				std::vector<Nz::UInt8> results(VolumeCount);
+				for (unsigned int i = 0; i <= Nz::CullingKernels::Implementation_Max; ++i)
+				{
+					Nz::CullingKernels::Implementation implementation = static_cast<Nz::CullingKernels::Implementation>(i);
+					if (!Nz::CullingKernels::IsImplementationSupported(implementation))
+						continue;
+
+					INFO("Implementation #" << i);
+					REQUIRE(Nz::CullingKernels::SetImplementation(implementation));
+
+					Nz::CullingKernels::CullBoxes(frustum, boxArray, results.data());
+
+					std::size_t boxMismatchCount = 0;
+					for (std::size_t j = 0; j < VolumeCount; ++j)
+					{
+						if (results[j] != frustum.Intersect(boxes[j]))
+							boxMismatchCount++;
+					}
+					CHECK(boxMismatchCount == 0);
+
+					Nz::CullingKernels::CullSpheres(frustum, sphereArray, results.data());
+
+					std::size_t sphereMismatchCount = 0;
+					for (std::size_t j = 0; j < VolumeCount; ++j)
+					{
+						if (results[j] != frustum.Intersect(Nz::Spheref(boxes[j].GetCenter(), boxes[j].GetRadius())))
+							sphereMismatchCount++;
+					}
+					CHECK(sphereMismatchCount == 0);
+				}
+
+				Nz::CullingKernels::SetImplementation(defaultImplementation);
+			}
+		}
+
+		WHEN("We remove some of them")
+		{
+			boxArray.Remove(0);
+			boxArray.Remove(boxArray.GetSize() - 1);
+			sphereArray.Remove(10);
+
+			THEN("The last one is moved in their place")
+			{
+				REQUIRE(boxArray.GetSize() == VolumeCount - 2);
+				CHECK(boxArray.minX[0] == Approx(boxes[VolumeCount - 1].x));
+				CHECK(boxArray.maxY[0] == Approx(boxes[VolumeCount - 1].y + boxes[VolumeCount - 1].height));
+
+				REQUIRE(sphereArray.GetSize() == VolumeCount - 1);
+				CHECK(sphereArray.radius[10] == Approx(boxes[VolumeCount - 1].GetRadius()));
+			}
+		}
+	}
+}
+
+SCENARIO("CullingList", "[GRAPHICS][CULLINGLIST]")
+{
+	GIVEN("A culling list with every kind of entries")
+	{
+		constexpr std::size_t RenderableCount = 101;
+
+		Nz::Frustumf frustum = BuildFrustum();
+		std::vector<Nz::Boxf> boxes = BuildBoxes(RenderableCount);
+		std::vector<Renderable> renderables(4 * RenderableCount);
+
+		Nz::CullingList<Renderable> cullingList;
+
+		std::vector<Nz::CullingList<Renderable>::BoxEntry> boxEntries;
+		std::vector<Nz::CullingList<Renderable>::NoTestEntry> noTestEntries;
+		std::vector<Nz::CullingList<Renderable>::SphereEntry> sphereEntries;
+		std::vector<Nz::CullingList<Renderable>::VolumeEntry> volumeEntries;
+		std::vector<Nz::BoundingVolumef> volumes;
+		for (std::size_t i = 0; i < RenderableCount; ++i)
+		{
+			Nz::BoundingVolumef volume(boxes[i]);
+			volume.Update(Nz::Matrix4f::Identity());
+
+			boxEntries.emplace_back(cullingList.RegisterBoxTest(&renderables[i]));
+			boxEntries.back().UpdateBox(boxes[i]);
+
+			noTestEntries.emplace_back(cullingList.RegisterNoTest(&renderables[RenderableCount + i]));
+
+			sphereEntries.emplace_back(cullingList.RegisterSphereTest(&renderables[2 * RenderableCount + i]));
+			sphereEntries.back().UpdateSphere(Nz::Spheref(boxes[i].GetCenter(), boxes[i].GetRadius()));
+
+			volumeEntries.emplace_back(cullingList.RegisterVolumeTest(&renderables[3 * RenderableCount + i]));
+			volumeEntries.back().UpdateVolume(volume);
+			volumes.push_back(volume);
+		}
+
+		auto ComputeExpectedResults = [&](std::vector<const Renderable*>* fullyVisible, std::vector<const Renderable*>* partiallyVisible)
+		{
+			auto AddExpected = [&](Nz::IntersectionSide side, const Renderable* renderable)
+			{
+				if (side == Nz::IntersectionSide_Inside)
+					fullyVisible->push_back(renderable);
+				else if (side == Nz::IntersectionSide_Intersecting)
+					partiallyVisible->push_back(renderable);
+			};
+
+			for (std::size_t i = 0; i < boxEntries.size(); ++i)
+				AddExpected(frustum.Intersect(boxes[i]), &renderables[i]);
+
+			for (std::size_t i = 0; i < noTestEntries.size(); ++i)
+				AddExpected(Nz::IntersectionSide_Inside, &renderables[RenderableCount + i]);
+
+			for (std::size_t i = 0; i < sphereEntries.size(); ++i)
+				AddExpected(frustum.Intersect(Nz::Spheref(boxes[i].GetCenter(), boxes[i].GetRadius())), &renderables[2 * RenderableCount + i]);
+
+			for (std::size_t i = 0; i < volumeEntries.size(); ++i)
+				AddExpected(frustum.Intersect(volumes[i]), &renderables[3 * RenderableCount + i]);
+		};
+
+		WHEN("We cull them")
+		{
+			std::size_t hash = cullingList.Cull(frustum);
+
+			THEN("Visible renderables are reported in registration order")
+			{
+				std::vector<const Renderable*> fullyVisible;
+				std::vector<const Renderable*> partiallyVisible;
+				ComputeExpectedResults(&fullyVisible, &partiallyVisible);
+
+				CHECK(cullingList.GetFullyVisibleResults() == fullyVisible);
+				CHECK(cullingList.GetPartiallyVisibleResults() == partiallyVisible);
+				CHECK(cullingList.Cull(frustum) == hash);
+			}
+		}
+
+		WHEN("We switch to the dynamic tree backend")
+		{
+			std::size_t linearHash = cullingList.Cull(frustum);
+			auto linearFullyVisible = cullingList.GetFullyVisibleResults();
+			auto linearPartiallyVisible = cullingList.GetPartiallyVisibleResults();
+
+			cullingList.SetBackend(Nz::CullingBackend_DynamicTree);
+
+			THEN("Results are the same as with the linear backend")
+			{
+				CHECK(cullingList.GetBackend() == Nz::CullingBackend_DynamicTree);
+				CHECK(cullingList.Cull(frustum) == linearHash);
+				CHECK(cullingList.GetFullyVisibleResults() == linearFullyVisible);
+				CHECK(cullingList.GetPartiallyVisibleResults() == linearPartiallyVisible);
+			}
+
+			AND_WHEN("Entries are updated, released and registered")
+			{
+				for (std::size_t i = 0; i < RenderableCount; ++i)
+				{
+					Nz::Vector3f offset(static_cast<float>(i % 7) * 3.f - 9.f, static_cast<float>(i % 5) - 2.f, static_cast<float>(i % 3) * 10.f - 10.f);
+
+					Nz::Boxf box = boxes[i];
+					box.x += offset.x;
+					box.y += offset.y;
+					box.z += offset.z;
+
+					boxEntries[i].UpdateBox(box);
+					sphereEntries[i].UpdateSphere(Nz::Spheref(box.GetCenter(), box.GetRadius()));
+				}
+
+				boxEntries.erase(boxEntries.begin() + 10);
+				sphereEntries.erase(sphereEntries.begin() + 20, sphereEntries.begin() + 30);
+
+				Renderable newRenderable;
+				boxEntries.emplace_back(cullingList.RegisterBoxTest(&newRenderable));
+				boxEntries.back().UpdateBox(Nz::Boxf(frustum.GetCorner(Nz::BoxCorner_NearLeftBottom), frustum.GetCorner(Nz::BoxCorner_NearRightTop)));
+
+				std::size_t treeHash = cullingList.Cull(frustum);
+				auto treeFullyVisible = cullingList.GetFullyVisibleResults();
+				auto treePartiallyVisible = cullingList.GetPartiallyVisibleResults();
+
+				cullingList.SetBackend(Nz::CullingBackend_Linear);
+
+				THEN("Results are still the same as with the linear backend")
+				{
+					CHECK(cullingList.Cull(frustum) == treeHash);
+					CHECK(cullingList.GetFullyVisibleResults() == treeFullyVisible);
+					CHECK(cullingList.GetPartiallyVisibleResults() == treePartiallyVisible);
+					CHECK(std::find(treePartiallyVisible.begin(), treePartiallyVisible.end(), &newRenderable) != treePartiallyVisible.end());
+				}
+			}
+		}
+
+		WHEN("We release some entries and move others")
+		{
+			std::size_t hash = cullingList.Cull(frustum);
+
+			// Release the first entry of each kind, the last one takes its place
+			boxEntries.front() = std::move(boxEntries.back());
+			boxEntries.pop_back();
+			noTestEntries.front() = std::move(noTestEntries.back());
+			noTestEntries.pop_back();
+			sphereEntries.front() = std::move(sphereEntries.back());
+			sphereEntries.pop_back();
+
+			THEN("Results and visibility hash change accordingly")
+			{
+				const Renderable* releasedBox = &renderables[0];
+				const Renderable* releasedNoTest = &renderables[RenderableCount];
+
+				CHECK(cullingList.Cull(frustum) != hash);
+
+				const auto& fullyVisible = cullingList.GetFullyVisibleResults();
+				CHECK(std::find(fullyVisible.begin(), fullyVisible.end(), releasedBox) == fullyVisible.end());
+				CHECK(std::find(fullyVisible.begin(), fullyVisible.end(), releasedNoTest) == fullyVisible.end());
+				CHECK(fullyVisible.size() + cullingList.GetPartiallyVisibleResults().size() > 0);
+			}
+
+			AND_WHEN("We update a moved entry")
+			{
+				Nz::Vector3f insidePoint = (frustum.GetCorner(Nz::BoxCorner_NearLeftBottom) + frustum.GetCorner(Nz::BoxCorner_FarRightTop)) * 0.5f;
+				Nz::Boxf insideBox(insidePoint, insidePoint + Nz::Vector3f(0.01f));
+				boxEntries.front().UpdateBox(insideBox);
+				sphereEntries.front().UpdateSphere(Nz::Spheref(insideBox.GetCenter(), 0.01f));
+
+				cullingList.Cull(frustum);
+
+				THEN("The new volume is used")
+				{
+					const auto& fullyVisible = cullingList.GetFullyVisibleResults();
+					CHECK(std::find(fullyVisible.begin(), fullyVisible.end(), &renderables[RenderableCount - 1]) != fullyVisible.end());
+					CHECK(std::find(fullyVisible.begin(), fullyVisible.end(), &renderables[3 * RenderableCount - 1]) != fullyVisible.end());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Catch/catch.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct Data
+	{
+		Nz::UInt64 key;
+		std::size_t id;
+	};
+
+	bool IsSortedLikeStableSort(std::size_t count, Nz::UInt64 keyMask)
+	{
+		std::mt19937_64 generator(static_cast<unsigned long>(count));
+
+		std::vector<Data> expected;
+		Nz::RenderQueue<Data> queue;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Data data = {generator() & keyMask, i};
+			expected.push_back(data);
+			queue.Insert(std::move(data));
+		}
+
+		std::stable_sort(expected.begin(), expected.end(), [](const Data& lhs, const Data& rhs) { return lhs.key < rhs.key; });
+
+		// Sort twice, to sort from an already sorted state with the scratch buffer of the previous sort
+		for (unsigned int i = 0; i < 2; ++i)
+		{
+			queue.Sort([](const Data& data) { return data.key; });
+
+			if (queue.size() != expected.size())
+				return false;
+
+			auto expectedIt = expected.begin();
+			for (const Data& data : queue)
+			{
+				if (data.id != expectedIt->id)
+					return false;
+
+				++expectedIt;
+			}
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("RenderQueue", "[GRAPHICS][RENDERQUEUE]")
+{
+	GIVEN("Queues of random keys")
+	{
+		WHEN("We sort small queues")
+		{
+			THEN("Data are sorted by key, keeping their insertion order when keys are equal")
+			{
+				CHECK(IsSortedLikeStableSort(0, 0xFFFFFFFFFFFFFFFFULL));
+				CHECK(IsSortedLikeStableSort(1, 0xFFFFFFFFFFFFFFFFULL));
+				CHECK(IsSortedLikeStableSort(100, 0xFFFFFFFFFFFFFFFFULL));
+				CHECK(IsSortedLikeStableSort(100, 0x0003000000000F00ULL));
+			}
+		}
+
+		WHEN("We sort big queues")
+		{
+			THEN("Data are sorted by key, keeping their insertion order when keys are equal")
+			{
+				CHECK(IsSortedLikeStableSort(5000, 0xFFFFFFFFFFFFFFFFULL));
+				CHECK(IsSortedLikeStableSort(5000, 0x0003000000000F00ULL));
+				CHECK(IsSortedLikeStableSort(5000, 0xFFFF00FF000000F0ULL));
+				CHECK(IsSortedLikeStableSort(5000, 0x0ULL));
+			}
+		}
+	}
+}
@@ -54,6 +54,16 @@ TEST_CASE("CountBits", "[MATH][ALGORITHM]")
 	{
 		REQUIRE(Nz::CountBits(0xFFFFFFFF) == 32);
 	}
+
+	SECTION("Number -1 has 32 bit set to 1")
+	{
+		REQUIRE(Nz::CountBits(-1) == 32);
+	}
+
+	SECTION("Number 0x8000000000000001 has 2 bit set to 1")
+	{
+		REQUIRE(Nz::CountBits(0x8000000000000001ULL) == 2);
+	}
 }
 
 TEST_CASE("DegreeToRadian", "[MATH][ALGORITHM]")
@@ -64,6 +74,26 @@ TEST_CASE("DegreeToRadian", "[MATH][ALGORITHM]")
 	}
 }
 
+TEST_CASE("FindFirstBit", "[MATH][ALGORITHM]")
+{
+	SECTION("First bit of 1 is 0")
+	{
+		REQUIRE(Nz::FindFirstBit(1) == 0);
+	}
+
+	SECTION("First bit of 12 is 2")
+	{
+		REQUIRE(Nz::FindFirstBit(12) == 2);
+	}
+
+	SECTION("First bit of small and large types")
+	{
+		REQUIRE(Nz::FindFirstBit(Nz::UInt8(0x80)) == 7);
+		REQUIRE(Nz::FindFirstBit(Nz::UInt64(1) << 40) == 40);
+		REQUIRE(Nz::FindFirstBit(0xFFFFFFFF00000000ULL) == 32);
+	}
+}
+
 TEST_CASE("GetNearestPowerOfTwo", "[MATH][ALGORITHM]")
 {
 	SECTION("Nearest power of two of 0 = 1")
@@ -0,0 +1,170 @@
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Core/Thread.hpp>
+#include <Catch/catch.hpp>
+#include <vector>
+
+namespace
+{
+	Nz::NetPacket::BufferCapacityClassStats GetClassStats(std::size_t capacity)
+	{
+		Nz::NetPacket::BufferPoolStats stats = Nz::NetPacket::GetBufferPoolStats();
+		for (const Nz::NetPacket::BufferCapacityClassStats& classStats : stats.capacityClasses)
+		{
+			if (classStats.bufferCapacity >= capacity)
+				return classStats;
+		}
+
+		return stats.capacityClasses.back();
+	}
+
+	Nz::UInt64 GetTotalReleaseCount()
+	{
+		Nz::UInt64 releaseCount = 0;
+		for (const Nz::NetPacket::BufferCapacityClassStats& classStats : Nz::NetPacket::GetBufferPoolStats().capacityClasses)
+			releaseCount += classStats.releaseCount;
+
+		return releaseCount;
+	}
+}
+
+SCENARIO("NetPacket", "[NETWORK][NETPACKET]")
+{
+	GIVEN("A packet")
+	{
+		Nz::NetPacket packet(42, 100);
+
+		WHEN("We write into it and read it back")
+		{
+			packet << Nz::UInt32(0xDEADBEEF) << Nz::String("Hello");
+
+			std::size_t size;
+			const void* data = packet.OnSend(&size);
+			REQUIRE(data);
+
+			Nz::UInt32 packetSize;
+			Nz::UInt16 netCode;
+			REQUIRE(Nz::NetPacket::DecodeHeader(data, &packetSize, &netCode));
+			CHECK(packetSize == size);
+			CHECK(netCode == 42);
+
+			Nz::NetPacket received;
+			received.OnReceive(netCode, static_cast<const Nz::UInt8*>(data) + Nz::NetPacket::HeaderSize, size - Nz::NetPacket::HeaderSize);
+
+			THEN("We get the same data")
+			{
+				Nz::UInt32 value;
+				Nz::String string;
+				received >> value >> string;
+
+				CHECK(value == 0xDEADBEEF);
+				CHECK(string == "Hello");
+			}
+		}
+	}
+
+	GIVEN("The packet buffer pool")
+	{
+		constexpr std::size_t PacketCapacity = 200;
+
+		WHEN("Packets are created and destroyed on the same thread")
+		{
+			// Make sure the thread cache holds a buffer of this class
+			{
+				Nz::NetPacket packet(1, PacketCapacity);
+			}
+
+			Nz::NetPacket::BufferCapacityClassStats before = GetClassStats(PacketCapacity + Nz::NetPacket::HeaderSize);
+
+			for (unsigned int i = 0; i < 10; ++i)
+				Nz::NetPacket packet(1, PacketCapacity);
+
+			Nz::NetPacket::BufferCapacityClassStats after = GetClassStats(PacketCapacity + Nz::NetPacket::HeaderSize);
+
+			THEN("Their buffers are reused from the thread cache")
+			{
+				CHECK(after.acquireCount - before.acquireCount == 10);
+				CHECK(after.cacheHitCount - before.cacheHitCount == 10);
+				CHECK(after.allocationCount == before.allocationCount);
+				CHECK(after.releaseCount - before.releaseCount == 10);
+			}
+		}
+
+		WHEN("Packets are created on a thread and destroyed on another one")
+		{
+			constexpr std::size_t PacketCount = 100;
+
+			std::vector<Nz::NetPacket> packets;
+			Nz::Thread producer([&]()
+			{
+				for (std::size_t i = 0; i < PacketCount; ++i)
+				{
+					packets.emplace_back(1, PacketCapacity);
+					packets.back() << Nz::UInt64(i);
+				}
+			});
+			producer.Join();
+
+			Nz::NetPacket::BufferCapacityClassStats before = GetClassStats(PacketCapacity + Nz::NetPacket::HeaderSize);
+
+			std::vector<Nz::UInt64> values;
+			Nz::Thread consumer([&]()
+			{
+				for (Nz::NetPacket& packet : packets)
+				{
+					packet.GetStream()->SetCursorPos(Nz::NetPacket::HeaderSize);
+
+					Nz::UInt64 value;
+					packet >> value;
+					values.push_back(value);
+				}
+
+				packets.clear();
+			});
+			consumer.Join();
+
+			REQUIRE(values.size() == PacketCount);
+			for (std::size_t i = 0; i < PacketCount; ++i)
+				CHECK(values[i] == i);
+
+			Nz::NetPacket::BufferCapacityClassStats after = GetClassStats(PacketCapacity + Nz::NetPacket::HeaderSize);
+
+			THEN("Their buffers are given back to the pool")
+			{
+				CHECK(after.releaseCount - before.releaseCount == PacketCount);
+			}
+
+			AND_THEN("Other threads reuse them instead of allocating")
+			{
+				Nz::Thread user([&]()
+				{
+					for (std::size_t i = 0; i < PacketCount; ++i)
+						packets.emplace_back(1, PacketCapacity);
+
+					packets.clear();
+				});
+				user.Join();
+
+				Nz::NetPacket::BufferCapacityClassStats reused = GetClassStats(PacketCapacity + Nz::NetPacket::HeaderSize);
+				CHECK(reused.acquireCount - after.acquireCount == PacketCount);
+				CHECK(reused.allocationCount == after.allocationCount);
+			}
+		}
+
+		WHEN("A packet grows beyond its capacity class")
+		{
+			Nz::NetPacket packet(1, 10);
+			std::vector<Nz::UInt8> data(5000, 0xAB);
+			packet.Write(data.data(), data.size());
+
+			THEN("Its data is intact and its buffer is given back to the pool")
+			{
+				CHECK(packet.GetDataSize() == data.size());
+				CHECK(packet.GetConstData()[Nz::NetPacket::HeaderSize + 4999] == 0xAB);
+
+				Nz::UInt64 releaseCount = GetTotalReleaseCount();
+				packet.Reset();
+				CHECK(GetTotalReleaseCount() - releaseCount == 1);
+			}
+		}
+	}
+}
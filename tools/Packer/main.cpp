@@ -0,0 +1,119 @@
+/*
+** Packer - Builds and lists Nazara packs (see Nz::PackFile)
+** Usage:
+** - Packer [--no-compress] [--alignment <bytes>] <directory> <pack>: packs every file of a directory (recursively)
+** - Packer --list <pack>: lists entries of a pack
+*/
+
+#include <Nazara/Core/Directory.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/PackFile.hpp>
+#include <Nazara/Core/String.hpp>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	void CollectFiles(const Nz::String& directoryPath, const Nz::String& entryPrefix, std::vector<Nz::PackFile::BuildEntry>& entries)
+	{
+		Nz::Directory directory(directoryPath);
+		if (!directory.Open())
+		{
+			std::cerr << "Failed to open directory " << directoryPath << std::endl;
+			return;
+		}
+
+		while (directory.NextResult())
+		{
+			Nz::String entryPath = entryPrefix + directory.GetResultName();
+			if (directory.IsResultDirectory())
+				CollectFiles(directory.GetResultPath(), entryPath + '/', entries);
+			else
+				entries.push_back({entryPath, directory.GetResultPath()});
+		}
+	}
+
+	int ListPack(const Nz::String& packPath)
+	{
+		Nz::PackFile pack;
+		if (!pack.Open(packPath))
+			return 1;
+
+		Nz::UInt64 totalSize = 0;
+		Nz::UInt64 totalStoredSize = 0;
+		for (std::size_t i = 0; i < pack.GetEntryCount(); ++i)
+		{
+			Nz::PackFile::EntryInfo info = pack.GetEntryInfo(i);
+			std::cout << info.path << ": " << info.size << " bytes";
+			if (info.compressed)
+				std::cout << " (" << info.storedSize << " compressed)";
+
+			std::cout << std::endl;
+
+			totalSize += info.size;
+			totalStoredSize += info.storedSize;
+		}
+
+		std::cout << pack.GetEntryCount() << " entries, " << totalSize << " bytes (" << totalStoredSize << " stored)" << std::endl;
+		return 0;
+	}
+
+	void PrintUsage()
+	{
+		std::cout << "Usage:" << std::endl;
+		std::cout << "  Packer [--no-compress] [--alignment <bytes>] <directory> <pack>" << std::endl;
+		std::cout << "  Packer --list <pack>" << std::endl;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool compress = true;
+	Nz::UInt32 alignment = 16;
+	std::vector<Nz::String> arguments;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		Nz::String argument(argv[i]);
+		if (argument == "--list")
+		{
+			if (i + 1 >= argc)
+			{
+				PrintUsage();
+				return 1;
+			}
+
+			return ListPack(argv[i + 1]);
+		}
+		else if (argument == "--no-compress")
+			compress = false;
+		else if (argument == "--alignment")
+		{
+			long long value;
+			if (i + 1 >= argc || !Nz::String(argv[++i]).ToInteger(&value) || value <= 0 || (value & (value - 1)) != 0)
+			{
+				std::cerr << "Alignment must be a power of two" << std::endl;
+				return 1;
+			}
+
+			alignment = static_cast<Nz::UInt32>(value);
+		}
+		else
+			arguments.push_back(argument);
+	}
+
+	if (arguments.size() != 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<Nz::PackFile::BuildEntry> entries;
+	CollectFiles(arguments[0], Nz::String(), entries);
+
+	if (!Nz::PackFile::Build(arguments[1], entries, compress, alignment))
+		return 1;
+
+	std::cout << "Packed " << entries.size() << " files into " << arguments[1] << std::endl;
+	return 0;
+}